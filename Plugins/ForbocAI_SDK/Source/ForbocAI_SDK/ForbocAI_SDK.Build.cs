@@ -1,3 +1,4 @@
+using System.Linq;
 using UnrealBuildTool;
 
 public class ForbocAI_SDK : ModuleRules
@@ -31,6 +32,17 @@ public class ForbocAI_SDK : ModuleRules
 		{
 			LlamaLibraryPath = System.IO.Path.Combine(ThirdPartyPath, "llama.cpp/lib/Mac/libllama.a");
 		}
+		else if (Target.Platform == UnrealTargetPlatform.Linux)
+		{
+			/**
+			 * Linux prefers the shared build (ggml-cpu variants dispatched at load time), else static
+			 * User Story: As a Linux integrator, I need both layouts accepted so shared and static CPU builds link without edits.
+			 */
+			string LinuxSharedLlama = System.IO.Path.Combine(ThirdPartyPath, "llama.cpp/lib/Linux/libllama.so");
+			LlamaLibraryPath = System.IO.File.Exists(LinuxSharedLlama)
+				? LinuxSharedLlama
+				: System.IO.Path.Combine(ThirdPartyPath, "llama.cpp/lib/Linux/libllama.a");
+		}
 
 		bool bHasNativeLlama = System.IO.Directory.Exists(LlamaIncludePath)
 			&& System.IO.File.Exists(LlamaHeaderPath)
@@ -63,7 +75,10 @@ public class ForbocAI_SDK : ModuleRules
 			 * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
 			 */
 			string LlamaLibDir = System.IO.Path.GetDirectoryName(LlamaLibraryPath);
-			string[] GgmlLibs = { "libggml.a", "libggml-base.a", "libggml-cpu.a" };
+			bool bSharedLlama = LlamaLibraryPath.EndsWith(".so");
+			string[] GgmlLibs = bSharedLlama
+				? new string[] { "libggml.so", "libggml-base.so" }
+				: new string[] { "libggml.a", "libggml-base.a", "libggml-cpu.a" };
 			foreach (string GgmlLib in GgmlLibs)
 			{
 				string GgmlLibPath = System.IO.Path.Combine(LlamaLibDir, GgmlLib);
@@ -93,6 +108,44 @@ public class ForbocAI_SDK : ModuleRules
 					PublicFrameworks.Add("Accelerate");
 				}
 			}
+
+			/**
+			 * Linux CPU backend: stage shared libs next to the binary and load ggml-cpu variants at runtime
+			 * User Story: As a Linux server operator, I need the best SSE/AVX2/AVX-512 kernel picked per host so one build runs fast everywhere.
+			 */
+			if (Target.Platform == UnrealTargetPlatform.Linux)
+			{
+				PublicSystemLibraries.AddRange(new string[] { "pthread", "dl", "m" });
+
+				if (bSharedLlama)
+				{
+					RuntimeDependencies.Add("$(BinaryOutputDir)/libllama.so", LlamaLibraryPath);
+					foreach (string GgmlLib in GgmlLibs)
+					{
+						string GgmlLibPath = System.IO.Path.Combine(LlamaLibDir, GgmlLib);
+						if (System.IO.File.Exists(GgmlLibPath))
+						{
+							RuntimeDependencies.Add("$(BinaryOutputDir)/" + GgmlLib, GgmlLibPath);
+						}
+					}
+					/**
+					 * The binaries' DT_NEEDED entries name the SONAME files (libllama.so.0, ...),
+					 * not the unversioned link names, so stage every versioned sibling too.
+					 * User Story: As Linux packaging, I need the SONAME files staged so the packaged game loads llama.
+					 */
+					foreach (string SharedLib in new string[] { "libllama.so" }.Concat(GgmlLibs))
+					{
+						foreach (string Versioned in System.IO.Directory.GetFiles(LlamaLibDir, SharedLib + ".*"))
+						{
+							RuntimeDependencies.Add("$(BinaryOutputDir)/" + System.IO.Path.GetFileName(Versioned), Versioned);
+						}
+					}
+					foreach (string CpuVariant in System.IO.Directory.GetFiles(LlamaLibDir, "libggml-cpu-*.so"))
+					{
+						RuntimeDependencies.Add("$(BinaryOutputDir)/" + System.IO.Path.GetFileName(CpuVariant), CpuVariant);
+					}
+				}
+			}
 		}
 
 		if (bHasSqliteHeaders)
@@ -129,6 +182,14 @@ public class ForbocAI_SDK : ModuleRules
 		}
 
 		PublicDefinitions.Add("WITH_FORBOC_NATIVE=" + (bHasNativeLlama ? "1" : "0"));
+		/**
+		 * Set when ggml backends are dynamic modules that must be loaded before the first model
+		 * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+		 */
+		bool bGgmlBackendDl = bHasNativeLlama
+			&& Target.Platform == UnrealTargetPlatform.Linux
+			&& LlamaLibraryPath.EndsWith(".so");
+		PublicDefinitions.Add("WITH_FORBOC_GGML_BACKEND_DL=" + (bGgmlBackendDl ? "1" : "0"));
 		/**
 		 * sqlite-vec auto-enabled when sqlite3.h header and amalgamation source are present
 		 * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
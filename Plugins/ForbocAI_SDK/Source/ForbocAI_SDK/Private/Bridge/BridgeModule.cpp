@@ -6,7 +6,7 @@
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-#include "RuntimeStore.h"
+#include "RuntimeFacade.h"
 #include "Serialization/JsonSerializer.h"
 #include "Bridge/BridgeThunks.h"
 
@@ -37,8 +37,31 @@ FValidationResult ValidateAttack(const FAgentAction &Action,
 } // namespace BridgeRules
 
 namespace BridgeHelpers {
-BridgeTypes::ValidationPipeline<FAgentAction, FString>
-bridgeValidationPipeline();
+/**
+ * Structural checks every bridge action must pass before rule evaluation.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct RequireActionType {
+  func::Maybe<FString> operator()(const FAgentAction &Action) const {
+    return Action.Type.IsEmpty()
+               ? func::just(FString(TEXT("Action type cannot be empty")))
+               : func::nothing<FString>();
+  }
+};
+
+struct RequireActionTarget {
+  func::Maybe<FString> operator()(const FAgentAction &Action) const {
+    return Action.Target.IsEmpty()
+               ? func::just(FString(TEXT("Action target cannot be empty")))
+               : func::nothing<FString>();
+  }
+};
+
+typedef decltype(func::staticValidation<FAgentAction, FString>() |
+                 func::check(RequireActionType()) |
+                 func::check(RequireActionTarget())) FBridgeActionChecks;
+
+const FBridgeActionChecks &bridgeActionChecks();
 }
 
 /**
@@ -51,13 +74,12 @@ namespace BridgeHelpers {
 FValidationResult RunLocalBridgeValidation(const FAgentAction &Action,
                                           const TArray<FValidationRule> &Rules,
                                           const FBridgeRuleContext &Context) {
-  auto validationPipeline = bridgeValidationPipeline();
-  auto result = func::runValidation(validationPipeline, Action);
+  const std::vector<FString> Errors =
+      func::validateRef(bridgeActionChecks(), Action);
 
-  return result.isLeft
-             ? TypeFactory::Invalid(result.left)
+  return !Errors.empty()
+             ? TypeFactory::Invalid(Errors.front())
              : [&]() -> FValidationResult {
-                 const FAgentAction validatedAction = result.right;
                  struct CheckRules {
                    static FValidationResult apply(
                        const TArray<FValidationRule> &R,
@@ -76,7 +98,7 @@ FValidationResult RunLocalBridgeValidation(const FAgentAction &Action,
                              : apply(R, VA, Ctx, Idx + 1);
                    }
                  };
-                 return CheckRules::apply(Rules, validatedAction, Context, 0);
+                 return CheckRules::apply(Rules, Action, Context, 0);
                }();
 }
 
@@ -99,9 +121,8 @@ TArray<FValidationRule> BridgeOps::CreateDefaultRules() {
 FValidationResult BridgeOps::Validate(const FAgentAction &Action,
                                       const TArray<FValidationRule> &Rules,
                                       const FBridgeRuleContext &Context) {
-  auto Store = ConfigureStore();
-  return Ops::WaitForResult(
-      Store.dispatch(rtk::localValidateBridgeThunk(Action, Rules, Context)));
+  return Ops::WaitForResult(FacadeDispatch::Run(
+      rtk::localValidateBridgeThunk(Action, Rules, Context)));
 }
 
 TArray<FValidationRule> BridgeOps::CreateRPGRules() {
@@ -121,11 +142,11 @@ TArray<FValidationRule> BridgeOps::CreateRPGRules() {
 BridgeTypes::AsyncResult<FDirectiveRuleSet>
 BridgeOps::RegisterRule(const FValidationRule &Rule, const FString &ApiUrl) {
   /**
-   * Dispatch through the store — no direct HTTP calls.
+   * Run the ruleset thunk — no direct HTTP calls; the bridge slice sees the
+   * result when facade store sync is enabled.
    * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
    */
   static_cast<void>(ApiUrl);
-  auto Store = ConfigureStore();
   FDirectiveRuleSet Ruleset;
   Ruleset.Id = Rule.Id;
   Ruleset.RulesetId = Rule.Name;
@@ -134,7 +155,7 @@ BridgeOps::RegisterRule(const FValidationRule &Rule, const FString &ApiUrl) {
   BridgeRule.RuleDescription = Rule.Name;
   BridgeRule.RuleActionTypes = Rule.ActionTypes;
   Ruleset.RulesetRules.Add(BridgeRule);
-  return Store.dispatch(rtk::registerRulesetThunk(Ruleset));
+  return FacadeDispatch::Run(rtk::registerRulesetThunk(Ruleset));
 }
 
 /**
@@ -157,28 +178,15 @@ createLazyHttpRequest(const FString &url) {
 }
 
 /**
- * Implementation of bridge validation pipeline
+ * Implementation of bridge action checks. Built once; the checks are
+ * stateless and run against the caller's action by const reference.
  * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
  */
-BridgeTypes::ValidationPipeline<FAgentAction, FString>
-bridgeValidationPipeline() {
-  return func::validationPipeline<FAgentAction, FString>() |
-         [](const FAgentAction &action)
-             -> BridgeTypes::Either<FString, FAgentAction> {
-           return action.Type.IsEmpty()
-                      ? BridgeTypes::make_left(
-                            FString(TEXT("Action type cannot be empty")),
-                            FAgentAction{})
-                      : BridgeTypes::make_right(FString(), action);
-         } |
-         [](const FAgentAction &action)
-             -> BridgeTypes::Either<FString, FAgentAction> {
-           return action.Target.IsEmpty()
-                      ? BridgeTypes::make_left(
-                            FString(TEXT("Action target cannot be empty")),
-                            FAgentAction{})
-                      : BridgeTypes::make_right(FString(), action);
-         };
+const FBridgeActionChecks &bridgeActionChecks() {
+  static const FBridgeActionChecks Checks =
+      func::staticValidation<FAgentAction, FString>() |
+      func::check(RequireActionType()) | func::check(RequireActionTarget());
+  return Checks;
 }
 
 /**
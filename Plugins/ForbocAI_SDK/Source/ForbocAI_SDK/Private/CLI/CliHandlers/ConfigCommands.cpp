@@ -31,7 +31,15 @@ HandlerResult HandleConfig(rtk::EnhancedStore<FStoreState> &Store,
                  static const TArray<FString> ConfigKeys = {
                      TEXT("version"), TEXT("apiUrl"), TEXT("apiKey"),
                      TEXT("modelPath"), TEXT("databasePath"),
-                     TEXT("vectorDimension"), TEXT("maxRecallResults")};
+                     TEXT("vectorDimension"), TEXT("maxRecallResults"),
+                     TEXT("modelQuant"), TEXT("modelMemoryBudgetMb"),
+                     TEXT("memoryReadConnections"),
+                     TEXT("memoryVectorStorage"),
+                     TEXT("memoryRecallScoring"),
+                     TEXT("memoryRecencyTauSeconds"),
+                     TEXT("memoryMmrLambda"),
+                     TEXT("facadeStoreSync"),
+                     TEXT("storeSnapshotSlot")};
                  struct LogKeys {
                    static void apply(const TArray<FString> &Keys, int32 Idx) {
                      Idx >= Keys.Num()
@@ -70,6 +70,24 @@ HandlerResult HandleCortex(rtk::EnhancedStore<FStoreState> &Store,
                         return just(
                             Result::Success("Completion done"));
                       }())
+         : CommandKey == TEXT("cortex_quantize")
+             ? (Args.Num() < 2
+                    ? just(Result::Failure(
+                          "Usage: cortex_quantize <source.gguf> <quant> "
+                          "[out.gguf]"))
+                    : [&]() -> HandlerResult {
+                        const func::Either<FString, FString> Built =
+                            Ops::QuantizeModel(
+                                Args[0], Args[1],
+                                Args.Num() > 2 ? Args[2] : TEXT(""));
+                        UE_LOG(LogTemp, Display, TEXT("Quantize: %s"),
+                               Built.isLeft ? *Built.left : *Built.right);
+                        return Built.isLeft
+                                   ? just(Result::Failure(
+                                         TCHAR_TO_UTF8(*Built.left)))
+                                   : just(Result::Success(
+                                         "Model quantized"));
+                      }())
              : nothing<Result>();
 }
 
@@ -1,6 +1,7 @@
 #include "CLI/CliHandlers.h"
 #include "CLI/CliOperations.h"
 #include "Core/ThunkDetail.h"
+#include "Core/TimerWheel.h"
 #include "NativeEngine.h"
 #include "RuntimeConfig.h"
 #include "HAL/PlatformProcess.h"
@@ -8,6 +9,8 @@
 #include "Misc/Guid.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include <algorithm>
+#include <iterator>
 
 namespace CLIOps {
 namespace Handlers {
@@ -330,37 +333,32 @@ int32 RunProcess(const FString &Executable, const FString &Args,
       }()
     : [&]() -> int32 {
         /**
-         * Wait with timeout — recursive helper replaces while loop
+         * Wait with timeout — the timer wheel drains the pipe every 100 ms
+         * and this thread blocks until the poll settles, without sleeping.
          * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
          */
-        struct WaitHelper {
-          static int32 poll(FProcHandle &Proc, void *ReadPipe, void *WritePipe,
-                            FString &StdOut, float TimeoutSeconds,
-                            double StartTime) {
-            return !FPlatformProcess::IsProcRunning(Proc)
-              ? 0
-              : [&]() -> int32 {
-                  StdOut += FPlatformProcess::ReadPipe(ReadPipe);
-                  return (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
-                    ? [&]() -> int32 {
-                        FPlatformProcess::TerminateProc(Proc);
-                        UE_LOG(LogTemp, Warning, TEXT("  [FAIL] Process timed out after %.0fs"),
-                               TimeoutSeconds);
-                        FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
-                        return -1;
-                      }()
-                    : [&]() -> int32 {
-                        FPlatformProcess::Sleep(0.1f);
-                        return poll(Proc, ReadPipe, WritePipe, StdOut,
-                                    TimeoutSeconds, StartTime);
-                      }();
-                }();
-          }
-        };
-
         const double StartTime = FPlatformTime::Seconds();
-        const int32 PollResult = WaitHelper::poll(
-            Proc, ReadPipe, WritePipe, StdOut, TimeoutSeconds, StartTime);
+        bool bTimedOut = false;
+        Timers::awaitResult(Timers::interval(
+            100, [&Proc, ReadPipe, &StdOut, &bTimedOut, TimeoutSeconds,
+                  StartTime](int64) {
+              return !FPlatformProcess::IsProcRunning(Proc)
+                ? false
+                : (StdOut += FPlatformProcess::ReadPipe(ReadPipe),
+                   bTimedOut =
+                       FPlatformTime::Seconds() - StartTime > TimeoutSeconds,
+                   bTimedOut ? (FPlatformProcess::TerminateProc(Proc), false)
+                             : true);
+            }));
+
+        const int32 PollResult = bTimedOut
+          ? [&]() -> int32 {
+              UE_LOG(LogTemp, Warning, TEXT("  [FAIL] Process timed out after %.0fs"),
+                     TimeoutSeconds);
+              FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+              return -1;
+            }()
+          : 0;
 
         return PollResult == -1
           ? PollResult
@@ -378,6 +376,29 @@ int32 RunProcess(const FString &Executable, const FString &Args,
       }();
 }
 
+#if PLATFORM_LINUX
+/**
+ * Returns the SONAME file beside a shared library's link name: the shortest
+ * versioned sibling (libllama.so.0 rather than libllama.so.0.0.5000), or an
+ * empty string when the library was built without a SOVERSION.
+ * User Story: As Linux packaging, I need the SONAME file located because the
+ * dynamic loader resolves DT_NEEDED by that name, not the link name.
+ */
+FString FindSonameFile(const FString &Dir, const FString &LinkName) {
+  TArray<FString> Versioned;
+  IFileManager::Get().FindFiles(Versioned, *(Dir / (LinkName + TEXT(".*"))),
+                                true, false);
+  const FString *Shortest = std::min_element(
+      Versioned.GetData(), Versioned.GetData() + Versioned.Num(),
+      [](const FString &A, const FString &B) { return A.Len() < B.Len(); });
+  return Versioned.Num() > 0 ? *Shortest : FString();
+}
+
+/** Shared libraries whose SONAME files the Linux build stages. */
+const TCHAR *const LinuxSonameLibs[] = {TEXT("libllama.so"), TEXT("libggml.so"),
+                                        TEXT("libggml-base.so")};
+#endif
+
 /**
  * Extracts a zip file to a destination directory.
  * User Story: As dependency setup, I need zip extraction so downloaded archives
@@ -460,6 +481,16 @@ Result VerifyThirdParty() {
 #elif PLATFORM_WINDOWS
   const FString LlamaLib =
       ThirdPartyDir / TEXT("llama.cpp/lib/Win64/llama.lib");
+#elif PLATFORM_LINUX
+  /**
+   * Linux prefers the shared CPU-variant build and falls back to static.
+   * User Story: As Linux setup diagnostics, I need either llama layout
+   * recognized so shared and static installs both verify cleanly.
+   */
+  const FString LlamaLib =
+      PF.FileExists(*(ThirdPartyDir / TEXT("llama.cpp/lib/Linux/libllama.so")))
+          ? ThirdPartyDir / TEXT("llama.cpp/lib/Linux/libllama.so")
+          : ThirdPartyDir / TEXT("llama.cpp/lib/Linux/libllama.a");
 #else
   const FString LlamaLib = TEXT("");
 #endif
@@ -484,6 +515,26 @@ Result VerifyThirdParty() {
       PF.FileExists(*(LlamaLibDir / TEXT("ggml-cpu.lib")));
   const bool bGgmlMetal = false;
   const bool bGgmlBlas = false;
+#elif PLATFORM_LINUX
+  const FString LlamaLibDir = ThirdPartyDir / TEXT("llama.cpp/lib/Linux");
+  TArray<FString> GgmlCpuVariants;
+  IFileManager::Get().FindFiles(
+      GgmlCpuVariants, *(LlamaLibDir / TEXT("libggml-cpu-*.so")), true, false);
+  const bool bSonames = std::all_of(
+      std::begin(LinuxSonameLibs), std::end(LinuxSonameLibs),
+      [&LlamaLibDir](const TCHAR *LinkName) {
+        return !FindSonameFile(LlamaLibDir, LinkName).IsEmpty();
+      });
+  const bool bGgmlCore =
+      LlamaLib.EndsWith(TEXT(".so"))
+          ? PF.FileExists(*(LlamaLibDir / TEXT("libggml.so"))) &&
+                PF.FileExists(*(LlamaLibDir / TEXT("libggml-base.so"))) &&
+                GgmlCpuVariants.Num() > 0 && bSonames
+          : PF.FileExists(*(LlamaLibDir / TEXT("libggml.a"))) &&
+                PF.FileExists(*(LlamaLibDir / TEXT("libggml-base.a"))) &&
+                PF.FileExists(*(LlamaLibDir / TEXT("libggml-cpu.a")));
+  const bool bGgmlMetal = false;
+  const bool bGgmlBlas = false;
 #else
   const FString LlamaLibDir = TEXT("");
   const bool bGgmlCore = false;
@@ -524,6 +575,16 @@ Result VerifyThirdParty() {
   UE_LOG(LogTemp, Display, TEXT("  [%s] ggml-blas             (%s)"),
          bGgmlBlas ? TEXT("OK") : TEXT("--"),
          *(LlamaLibDir / TEXT("libggml-blas.a")));
+#elif PLATFORM_LINUX
+  UE_LOG(LogTemp, Display, TEXT("  [%s] ggml-cpu variants     (%d runtime-dispatched .so in %s)"),
+         GgmlCpuVariants.Num() > 0 ? TEXT("OK") : TEXT("--"),
+         GgmlCpuVariants.Num(), *LlamaLibDir);
+  LlamaLib.EndsWith(TEXT(".so"))
+      ? [&]() {
+          UE_LOG(LogTemp, Display, TEXT("  [%s] SONAME files          (libllama.so.N, libggml.so.N, libggml-base.so.N)"),
+                 bSonames ? TEXT("OK") : TEXT("--"));
+        }()
+      : void();
 #endif
   UE_LOG(LogTemp, Display, TEXT("  [%s] sqlite3 headers       (%s)"),
          bSqliteHeaders ? TEXT("OK") : TEXT("--"), *SqliteInclude);
@@ -620,12 +681,14 @@ Result SetupThirdPartyDeps(rtk::EnhancedStore<FStoreState> &Store,
   const FString LlamaIncDir = ThirdPartyDir / TEXT("llama.cpp/include");
   const FString LlamaLibMac = ThirdPartyDir / TEXT("llama.cpp/lib/Mac");
   const FString LlamaLibWin = ThirdPartyDir / TEXT("llama.cpp/lib/Win64");
+  const FString LlamaLibLinux = ThirdPartyDir / TEXT("llama.cpp/lib/Linux");
   const FString SqliteIncDir = ThirdPartyDir / TEXT("sqlite-vss/include");
   const FString SqliteSrcDir = ThirdPartyDir / TEXT("sqlite-vss/src");
 
   PF.CreateDirectoryTree(*LlamaIncDir);
   PF.CreateDirectoryTree(*LlamaLibMac);
   PF.CreateDirectoryTree(*LlamaLibWin);
+  PF.CreateDirectoryTree(*LlamaLibLinux);
   PF.CreateDirectoryTree(*SqliteIncDir);
   PF.CreateDirectoryTree(*SqliteSrcDir);
   PF.CreateDirectoryTree(*TmpDir);
@@ -877,28 +940,40 @@ Result BuildLlama(const TArray<FString> &Args) {
   struct BuildArgFlags {
     FString Tag;
     FString DeploymentTarget;
+    bool bStatic;
   };
 
   struct ParseBuildArgsHelper {
     static BuildArgFlags apply(const TArray<FString> &Arr, int32 Idx,
-                               const FString &Tag, const FString &DT) {
+                               const FString &Tag, const FString &DT,
+                               bool bStatic) {
       return Idx >= Arr.Num()
-        ? BuildArgFlags{Tag, DT}
+        ? BuildArgFlags{Tag, DT, bStatic}
         : Arr[Idx].StartsWith(TEXT("--tag="))
-          ? apply(Arr, Idx + 1, Arr[Idx].Mid(6), DT)
+          ? apply(Arr, Idx + 1, Arr[Idx].Mid(6), DT, bStatic)
 #if PLATFORM_MAC
           : Arr[Idx].StartsWith(TEXT("--macos-deployment-target="))
             ? apply(Arr, Idx + 1, Tag,
-                    Arr[Idx].Mid(FString(TEXT("--macos-deployment-target=")).Len()))
+                    Arr[Idx].Mid(FString(TEXT("--macos-deployment-target=")).Len()),
+                    bStatic)
 #endif
-            : apply(Arr, Idx + 1, Tag, DT);
+          : Arr[Idx] == TEXT("--static")
+            ? apply(Arr, Idx + 1, Tag, DT, true)
+            : apply(Arr, Idx + 1, Tag, DT, bStatic);
     }
   };
 
   const BuildArgFlags BAFlags = ParseBuildArgsHelper::apply(
-      Args, 0, FString(LLAMA_CPP_TAG), FString(MACOS_DEPLOYMENT_TARGET));
+      Args, 0, FString(LLAMA_CPP_TAG), FString(MACOS_DEPLOYMENT_TARGET), false);
   const FString Tag = BAFlags.Tag;
   const FString DeploymentTarget = BAFlags.DeploymentTarget;
+  /**
+   * Linux builds shared libs with runtime-dispatched ggml-cpu variants by
+   * default; --static produces a single AVX2 baseline archive instead.
+   * User Story: As Linux setup, I need a static fallback so toolchains that
+   * cannot stage shared libraries still link a portable CPU build.
+   */
+  const bool bStatic = BAFlags.bStatic;
 
   IPlatformFile &PF = FPlatformFileManager::Get().GetPlatformFile();
 
@@ -912,6 +987,10 @@ Result BuildLlama(const TArray<FString> &Args) {
 #elif PLATFORM_WINDOWS
   const FString LibDest = ThirdPartyDir / TEXT("llama.cpp/lib/Win64/llama.lib");
   const FString LibName = TEXT("llama.lib");
+#elif PLATFORM_LINUX
+  const FString LibName =
+      bStatic ? FString(TEXT("libllama.a")) : FString(TEXT("libllama.so"));
+  const FString LibDest = ThirdPartyDir / TEXT("llama.cpp/lib/Linux") / LibName;
 #else
   return Result::Failure("build_llama not supported on this platform");
 #endif
@@ -929,6 +1008,10 @@ Result BuildLlama(const TArray<FString> &Args) {
 #if PLATFORM_MAC
         UE_LOG(LogTemp, Display, TEXT("  macOS deployment target: %s"),
                *DeploymentTarget);
+#elif PLATFORM_LINUX
+        UE_LOG(LogTemp, Display, TEXT("  Linux CPU build: %s"),
+               bStatic ? TEXT("static (AVX2 baseline)")
+                       : TEXT("shared (runtime-dispatched CPU variants)"));
 #endif
         UE_LOG(LogTemp, Display, TEXT(""));
 
@@ -983,8 +1066,30 @@ Result BuildLlama(const TArray<FString> &Args) {
               const FString CmakeExeAlt = CmakeExe;
 #endif
 
+#if PLATFORM_LINUX
+              /**
+               * Shared: one ggml-cpu .so per x86 feature level (sse4.2, avx2,
+               * avx512, ...), picked at load time by ggml's backend registry.
+               * Static: GGML_NATIVE off so the archive runs on any AVX2 host.
+               * User Story: As Linux deployment, I need CPU-portable binaries so
+               * one package runs on both older and AVX-512 capable hosts.
+               */
+              FString CmakeConfigArgs = FString::Printf(
+                  TEXT("-B \"%s\" -DCMAKE_BUILD_TYPE=Release -DBUILD_SHARED_LIBS=%s"),
+                  *BuildDir, bStatic ? TEXT("OFF") : TEXT("ON"));
+              CmakeConfigArgs += TEXT(
+                  " -DGGML_NATIVE=OFF -DGGML_OPENMP=OFF -DLLAMA_CURL=OFF"
+                  " -DLLAMA_BUILD_TESTS=OFF -DLLAMA_BUILD_EXAMPLES=OFF"
+                  " -DLLAMA_BUILD_TOOLS=OFF -DLLAMA_BUILD_SERVER=OFF");
+              CmakeConfigArgs += bStatic
+                  ? TEXT(" -DGGML_AVX=ON -DGGML_AVX2=ON -DGGML_FMA=ON -DGGML_F16C=ON"
+                         " -DCMAKE_POSITION_INDEPENDENT_CODE=ON")
+                  : TEXT(" -DGGML_BACKEND_DL=ON -DGGML_CPU_ALL_VARIANTS=ON"
+                         " -DCMAKE_BUILD_RPATH_USE_ORIGIN=ON");
+#else
               FString CmakeConfigArgs = FString::Printf(
                   TEXT("-B \"%s\" -DBUILD_SHARED_LIBS=OFF"), *BuildDir);
+#endif
 
 #if PLATFORM_MAC
               CmakeConfigArgs += TEXT(" -DGGML_METAL=ON");
@@ -1009,8 +1114,20 @@ Result BuildLlama(const TArray<FString> &Args) {
                      * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
                      */
                     UE_LOG(LogTemp, Display, TEXT("  Step 3/3: Building llama target..."));
+                    /**
+                     * Dynamic ggml-cpu variants are not link dependencies of
+                     * llama, so the shared Linux build compiles every target.
+                     * User Story: As Linux setup, I need the CPU variant modules
+                     * built so the runtime loader has a backend to select.
+                     */
+#if PLATFORM_LINUX
+                    const FString CmakeBuildArgs = bStatic
+                        ? FString::Printf(TEXT("--build \"%s\" --target llama -j"), *BuildDir)
+                        : FString::Printf(TEXT("--build \"%s\" -j"), *BuildDir);
+#else
                     const FString CmakeBuildArgs = FString::Printf(
                         TEXT("--build \"%s\" --target llama -j"), *BuildDir);
+#endif
 
                     const int32 BuildRc = RunProcess(CmakeExe, CmakeBuildArgs, CloneDir, 600.0f);
                     const int32 EffectiveBuildRc = BuildRc != 0
@@ -1028,6 +1145,10 @@ Result BuildLlama(const TArray<FString> &Args) {
                           const FString BuiltLib = BuildDir / TEXT("src/libllama.a");
 #elif PLATFORM_WINDOWS
                           const FString BuiltLib = BuildDir / TEXT("src/Release/llama.lib");
+#elif PLATFORM_LINUX
+                          const FString BuiltLib = bStatic
+                              ? BuildDir / TEXT("src/libllama.a")
+                              : BuildDir / TEXT("bin/libllama.so");
 #endif
 
                           PF.CreateDirectoryTree(*FPaths::GetPath(LibDest));
@@ -1068,9 +1189,31 @@ Result BuildLlama(const TArray<FString> &Args) {
                                     {TEXT("ggml/src/Release/ggml-base.lib"), TEXT("ggml-base.lib")},
                                     {TEXT("ggml/src/Release/ggml-cpu.lib"), TEXT("ggml-cpu.lib")},
                                 };
+#elif PLATFORM_LINUX
+                                struct GgmlEntry {
+                                  const TCHAR *BuildSubPath;
+                                  const TCHAR *DestName;
+                                };
+                                const GgmlEntry GgmlStaticLibs[] = {
+                                    {TEXT("ggml/src/libggml.a"), TEXT("libggml.a")},
+                                    {TEXT("ggml/src/libggml-base.a"), TEXT("libggml-base.a")},
+                                    {TEXT("ggml/src/libggml-cpu.a"), TEXT("libggml-cpu.a")},
+                                };
+                                const GgmlEntry GgmlSharedLibs[] = {
+                                    {TEXT("bin/libggml.so"), TEXT("libggml.so")},
+                                    {TEXT("bin/libggml-base.so"), TEXT("libggml-base.so")},
+                                };
+                                const GgmlEntry *GgmlLibs =
+                                    bStatic ? GgmlStaticLibs : GgmlSharedLibs;
 #endif
 
+#if PLATFORM_LINUX
+                                const int32 GgmlCount = bStatic
+                                    ? static_cast<int32>(sizeof(GgmlStaticLibs) / sizeof(GgmlStaticLibs[0]))
+                                    : static_cast<int32>(sizeof(GgmlSharedLibs) / sizeof(GgmlSharedLibs[0]));
+#else
                                 const int32 GgmlCount = sizeof(GgmlLibs) / sizeof(GgmlLibs[0]);
+#endif
 
                                 /**
                                  * Recursive helper replaces for loop over ggml libs
@@ -1104,6 +1247,81 @@ Result BuildLlama(const TArray<FString> &Args) {
                                 GgmlCopied = CopyGgmlHelper::apply(
                                     GgmlLibs, GgmlCount, 0, BuildDir, LibDestDir, PF, FM, 0);
 
+#if PLATFORM_LINUX
+                                /**
+                                 * Copy every runtime-dispatched ggml-cpu variant
+                                 * User Story: As Linux packaging, I need all CPU variants
+                                 * staged so ggml can pick the best one per host at load time.
+                                 */
+                                struct CopyVariantsHelper {
+                                  static int32 apply(const TArray<FString> &Names, int32 Idx,
+                                                     const FString &SrcDir, const FString &LibDestDir,
+                                                     IFileManager &FM, int32 Copied) {
+                                    return Idx >= Names.Num()
+                                      ? Copied
+                                      : [&]() -> int32 {
+                                          FM.Copy(*(LibDestDir / Names[Idx]), *(SrcDir / Names[Idx]));
+                                          UE_LOG(LogTemp, Display, TEXT("  [OK] %s"), *Names[Idx]);
+                                          return apply(Names, Idx + 1, SrcDir, LibDestDir, FM,
+                                                       Copied + 1);
+                                        }();
+                                  }
+                                };
+                                TArray<FString> CpuVariants;
+                                !bStatic
+                                    ? FM.FindFiles(CpuVariants,
+                                                   *(BuildDir / TEXT("bin/libggml-cpu-*.so")),
+                                                   true, false)
+                                    : void();
+                                GgmlCopied += CopyVariantsHelper::apply(
+                                    CpuVariants, 0, BuildDir / TEXT("bin"), LibDestDir, FM, 0);
+
+                                /**
+                                 * Stage the SONAME files the loader actually
+                                 * resolves (DT_NEEDED names libllama.so.0, not
+                                 * libllama.so); a missing one fails setup.
+                                 * User Story: As Linux packaging, I need the
+                                 * SONAME files next to the link names so the
+                                 * packaged game finds llama at load time.
+                                 */
+                                struct StageSonamesHelper {
+                                  static void apply(int32 Idx, const FString &SrcDir,
+                                                    const FString &LibDestDir,
+                                                    IFileManager &FM,
+                                                    TArray<FString> &Staged) {
+                                    Idx < UE_ARRAY_COUNT(LinuxSonameLibs)
+                                        ? [&]() {
+                                            const FString Soname = FindSonameFile(
+                                                SrcDir, LinuxSonameLibs[Idx]);
+                                            !Soname.IsEmpty()
+                                                ? (FM.Copy(*(LibDestDir / Soname),
+                                                           *(SrcDir / Soname)),
+                                                   Staged.Add(Soname), void())
+                                                : void();
+                                            apply(Idx + 1, SrcDir, LibDestDir, FM, Staged);
+                                          }()
+                                        : void();
+                                  }
+                                };
+                                TArray<FString> Sonames;
+                                !bStatic
+                                    ? StageSonamesHelper::apply(0, BuildDir / TEXT("bin"),
+                                                                LibDestDir, FM, Sonames)
+                                    : void();
+                                const bool bSonamesStaged =
+                                    bStatic || Sonames.Num() == UE_ARRAY_COUNT(LinuxSonameLibs);
+                                !bStatic
+                                    ? [&]() {
+                                        UE_LOG(LogTemp, Display, TEXT("  [%s] SONAME files: %s"),
+                                               bSonamesStaged ? TEXT("OK") : TEXT("FAIL"),
+                                               *FString::Join(Sonames, TEXT(", ")));
+                                      }()
+                                    : void();
+                                GgmlCopied += Sonames.Num();
+#else
+                                const bool bSonamesStaged = true;
+#endif
+
                                 UE_LOG(LogTemp, Display, TEXT("  Copied %d ggml libraries"), GgmlCopied);
 
                                 /**
@@ -1116,7 +1334,11 @@ Result BuildLlama(const TArray<FString> &Args) {
                                     "  Rebuild the UE project to enable WITH_FORBOC_NATIVE=1."));
                                 UE_LOG(LogTemp, Display, TEXT(""));
 
-                                return Result::Success("llama.cpp built and installed");
+                                return bSonamesStaged
+                                    ? Result::Success("llama.cpp built and installed")
+                                    : Result::Failure(
+                                          "SONAME files (libllama.so.N, libggml*.so.N) "
+                                          "missing from the shared build");
                               }()
                             : [&]() -> Result {
                                 UE_LOG(LogTemp, Warning, TEXT("  [FAIL] Built library not found at %s"),
@@ -1,5 +1,6 @@
 #include "CLI/CliHandlers.h"
 #include "CLI/CliOperations.h"
+#include "RuntimeConfig.h"
 #include "RuntimeStore.h"
 
 namespace CLIOps {
@@ -8,13 +9,21 @@ namespace Handlers {
 HandlerResult HandleVector(rtk::EnhancedStore<FStoreState> &Store,
                           const FString &CommandKey,
                           const TArray<FString> &Args) {
-  (void)Args;
   using func::just;
   using func::nothing;
 
   return CommandKey == TEXT("vector_init")
              ? (Ops::InitVector(Store),
                 just(Result::Success("Vector initialized")))
+         : CommandKey == TEXT("vector_migrate")
+             ? ((Args.Num() < 1 ||
+                 !(Args[0] == SDKConfig::VECTOR_STORAGE_FLOAT ||
+                   Args[0] == SDKConfig::VECTOR_STORAGE_INT8 ||
+                   Args[0] == SDKConfig::VECTOR_STORAGE_BINARY))
+                    ? just(Result::Failure(
+                          "Usage: vector_migrate <float|int8|binary>"))
+                    : (Ops::MigrateVectorStorage(Store, Args[0]),
+                       just(Result::Success("Vector storage migrated"))))
              : nothing<Result>();
 }
 
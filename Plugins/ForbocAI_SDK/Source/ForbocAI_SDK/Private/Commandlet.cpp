@@ -300,6 +300,12 @@ TArray<FString> BuildCommandArgs(const FString &Command,
                     return BuildParams(Params,
                                       {TEXT("Id="), TEXT("Prompt=")});
                   }),
+              func::when<FString, TArray<FString>>(
+                  func::equals<FString>(TEXT("cortex_quantize")),
+                  [&Params](const FString &) {
+                    return BuildParams(Params, {TEXT("Source="),
+                                                TEXT("Quant="), TEXT("Out=")});
+                  }),
 
               /**
                * ---- Ghost ----
@@ -396,6 +402,16 @@ TArray<FString> BuildCommandArgs(const FString &Command,
                     return BuildParams(Params, {TEXT("Key=")});
                   }),
 
+              /**
+               * ---- Vector ----
+               * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+               */
+              func::when<FString, TArray<FString>>(
+                  func::equals<FString>(TEXT("vector_migrate")),
+                  [&Params](const FString &) {
+                    return BuildParams(Params, {TEXT("Storage=")});
+                  }),
+
               /**
                * ---- Test Game ----
                * User Story: As test-game CLI entrypoints, I need one optional
@@ -416,11 +432,14 @@ TArray<FString> BuildCommandArgs(const FString &Command,
               func::when<FString, TArray<FString>>(
                   func::equals<FString>(TEXT("setup_build_llama")),
                   [&Params](const FString &) {
-                    return BuildPrefixed(
-                        Params,
-                        {TEXT("Tag="), TEXT("MacOSDeploymentTarget=")},
-                        {TEXT("--tag="),
-                         TEXT("--macos-deployment-target=")});
+                    return MergeArgs(
+                        BuildPrefixed(
+                            Params,
+                            {TEXT("Tag="), TEXT("MacOSDeploymentTarget=")},
+                            {TEXT("--tag="),
+                             TEXT("--macos-deployment-target=")}),
+                        BuildFlags(Params, {TEXT("Static")},
+                                   {TEXT("--static")}));
                   }),
               func::when<FString, TArray<FString>>(
                   [](const FString &C) {
@@ -614,6 +633,7 @@ UForbocAICommandlet::commandValidationPipeline() {
             TEXT("memory_export"),
             TEXT("cortex_init"),      TEXT("cortex_init_remote"),
             TEXT("cortex_models"),    TEXT("cortex_complete"),
+            TEXT("cortex_quantize"),
             TEXT("ghost_run"),        TEXT("ghost_status"),
             TEXT("ghost_results"),    TEXT("ghost_stop"),
             TEXT("ghost_history"),
@@ -626,7 +646,7 @@ UForbocAICommandlet::commandValidationPipeline() {
             TEXT("soul_verify"),
             TEXT("config_set"),       TEXT("config_get"),
             TEXT("config_list"),
-            TEXT("vector_init"),
+            TEXT("vector_init"),      TEXT("vector_migrate"),
             TEXT("setup"),            TEXT("setup_deps"),
             TEXT("setup_check"),      TEXT("setup_verify"),
             TEXT("setup_build_llama"), TEXT("setup_runtime_check"),
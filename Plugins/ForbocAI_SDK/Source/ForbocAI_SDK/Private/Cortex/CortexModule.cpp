@@ -5,14 +5,15 @@
 #include "Core/functional_core.hpp"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-#include "RuntimeStore.h"
+#include "RuntimeFacade.h"
 #include "Types.h"
 
 #include "NativeEngine.h"
 
 /**
  * Cortex Operations — Thin facade over cortex thunks
- * G.5: Model init/inference routed through Cortex Slice + Thunks
+ * G.5: Model init/inference runs the cortex thunks directly; whether the
+ * cortex slice sees them follows SDKConfig::GetFacadeStoreSync().
  * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
  */
 
@@ -42,8 +43,7 @@ TFuture<CortexTypes::CortexInitResult> CortexOps::Init(FCortex &Cortex) {
   auto Future = PromisePtr->GetFuture();
   FCortex *CortexPtr = &Cortex;
 
-  auto Store = ConfigureStore();
-  Store.dispatch(rtk::initNodeCortexThunk(Cortex.Config.Model))
+  FacadeDispatch::Run(rtk::initNodeCortexThunk(Cortex.Config.Model))
       .then([CortexPtr, PromisePtr](const FCortexStatus &Status) mutable {
         CortexPtr->bReady = Status.bReady;
         PromisePtr->SetValue(CortexTypes::make_right(FString(), Status.bReady));
@@ -63,23 +63,8 @@ TFuture<CortexTypes::CortexCompletionResult>
 CortexOps::Complete(const FCortex &Cortex, const FString &Prompt,
                     const TMap<FString, FString> &Context) {
   static_cast<void>(Context);
-  auto PromisePtr =
-      std::make_shared<TPromise<CortexTypes::CortexCompletionResult>>();
-  auto Future = PromisePtr->GetFuture();
-
-  auto Store = ConfigureStore();
-  Store.dispatch(rtk::completeNodeCortexThunk(Prompt, Cortex.Config))
-      .then([PromisePtr](const FCortexResponse &Response) mutable {
-        PromisePtr->SetValue(CortexTypes::make_right(FString(), Response));
-      })
-      .catch_([PromisePtr](std::string Error) mutable {
-        PromisePtr->SetValue(
-            CortexTypes::make_left(FString(UTF8_TO_TCHAR(Error.c_str())),
-                                   FCortexResponse{}));
-      })
-      .execute();
-
-  return Future;
+  return FacadeDispatch::ToFuture(FacadeDispatch::Run(
+      rtk::completeNodeCortexThunk(Prompt, Cortex.Config)));
 }
 
 TFuture<CortexTypes::CortexCompletionResult>
@@ -87,23 +72,8 @@ CortexOps::CompleteStream(const FCortex &Cortex, const FString &Prompt,
                           const FOnCortexToken &OnToken,
                           const TMap<FString, FString> &Context) {
   static_cast<void>(Context);
-  auto PromisePtr =
-      std::make_shared<TPromise<CortexTypes::CortexCompletionResult>>();
-  auto Future = PromisePtr->GetFuture();
-
-  auto Store = ConfigureStore();
-  Store.dispatch(rtk::streamNodeCortexThunk(Prompt, Cortex.Config, OnToken))
-      .then([PromisePtr](const FCortexResponse &Response) mutable {
-        PromisePtr->SetValue(CortexTypes::make_right(FString(), Response));
-      })
-      .catch_([PromisePtr](std::string Error) mutable {
-        PromisePtr->SetValue(
-            CortexTypes::make_left(FString(UTF8_TO_TCHAR(Error.c_str())),
-                                   FCortexResponse{}));
-      })
-      .execute();
-
-  return Future;
+  return FacadeDispatch::ToFuture(FacadeDispatch::Run(
+      rtk::streamNodeCortexThunk(Prompt, Cortex.Config, OnToken)));
 }
 
 FString CortexOps::GetStatus(const FCortex &Cortex) {
@@ -114,8 +84,9 @@ FString CortexOps::GetStatus(const FCortex &Cortex) {
 void CortexOps::Shutdown(FCortex &Cortex) {
   (void)Cortex;
   /**
-   * Shutdown is handled by initNodeCortexThunk (frees previous handle before
-   * loading new model). No explicit shutdown thunk; NodeCortexHandle persists.
+   * Shutdown is handled by initNodeCortexThunk (retires the previous model
+   * before loading a new one). No explicit shutdown thunk; NodeCortexSlot
+   * keeps the current model until the next init.
    * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
    */
 }
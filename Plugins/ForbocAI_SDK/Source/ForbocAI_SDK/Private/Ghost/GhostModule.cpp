@@ -7,7 +7,7 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "NPC/NPCModule.h"
-#include "RuntimeStore.h"
+#include "RuntimeFacade.h"
 #include "Serialization/JsonSerializer.h"
 
 /**
@@ -34,7 +34,7 @@ GhostTypes::GhostTestRunResult GhostOps::RunTest(const FGhost &Ghost,
                       std::function<void(std::string)> Reject) {
                      Reject("Ghost not initialized");
                    })
-             : ConfigureStore().dispatch(
+             : FacadeDispatch::Run(
                    rtk::runLocalGhostTestThunk(Ghost.Config.Agent, Scenario));
 }
 
@@ -52,14 +52,12 @@ GhostTypes::GhostTestRunAllResult GhostOps::RunAllTests(const FGhost &Ghost) {
         GhostInternal::RunTestsSequentially(
             Ghost, Report, 0,
             [resolve](FGhostTestReport FinalReport) {
-              auto Store = ConfigureStore();
-              Store.dispatch(
+              FacadeDispatch::Dispatch(
                   GhostSlice::Actions::GhostSessionCompleted(FinalReport));
               resolve(FinalReport);
             },
             [reject](std::string Error) {
-              auto Store = ConfigureStore();
-              Store.dispatch(GhostSlice::Actions::GhostSessionFailed(
+              FacadeDispatch::Dispatch(GhostSlice::Actions::GhostSessionFailed(
                   TEXT("ghost-run"), FString(Error.c_str())));
               reject(Error);
             });
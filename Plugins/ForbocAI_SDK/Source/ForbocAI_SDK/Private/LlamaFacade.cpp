@@ -9,10 +9,12 @@
 
 #include "LlamaFacade.h"
 #include "Core/functional_core.hpp"
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -24,8 +26,19 @@ struct llama_facade_context {
   llama_model *Model;
   llama_context *Ctx;
   bool IsEmbedding;
+  ggml_threadpool *Pool;
+  ggml_threadpool *BatchPool;
+  const std::atomic<bool> *AbortFlag;
+  std::vector<int> AppliedThreading;
 };
 
+/**
+ * Returns whether the caller abandoned the current generation.
+ */
+static bool IsAborted(const llama_facade_context *Ctx) {
+  return Ctx->AbortFlag && Ctx->AbortFlag->load(std::memory_order_acquire);
+}
+
 /**
  * Recursive helper: accumulates sum-of-squares across a float array.
  */
@@ -82,7 +95,7 @@ static int GenerateRecursive(llama_facade_context *Ctx,
                              llama_batch &Batch,
                              std::string &Output,
                              int MaxTokens, int Generated, int32_t Pos) {
-  return Generated >= MaxTokens
+  return Generated >= MaxTokens || IsAborted(Ctx)
              ? Generated
              : [&]() -> int {
                  const llama_token Next =
@@ -118,7 +131,7 @@ static int StreamRecursive(llama_facade_context *Ctx,
                            llama_batch &Batch,
                            LlamaFacade::TokenCallback OnToken, void *UserData,
                            int MaxTokens, int Generated, int32_t Pos) {
-  return Generated >= MaxTokens
+  return Generated >= MaxTokens || IsAborted(Ctx)
              ? Generated
              : [&]() -> int {
                  const llama_token Next =
@@ -162,22 +175,322 @@ static void ZeroFillRecursive(float *Out, int Dims, int Index) {
       : void();
 }
 
+/**
+ * Directory searched for dynamically loadable ggml backends (Linux CPU
+ * variants). Empty means ggml's default search (executable dir, then cwd).
+ */
+static std::string &BackendSearchPath() {
+  static std::string Path;
+  return Path;
+}
+
+/**
+ * Registers every ggml backend module found in the search path. ggml scores
+ * each libggml-cpu-*.so against the host CPU and keeps the best variant.
+ */
+static void LoadDynamicBackends() {
+#if WITH_FORBOC_GGML_BACKEND_DL
+  ggml_backend_load_all_from_path(
+      BackendSearchPath().empty() ? nullptr : BackendSearchPath().c_str());
+#endif
+}
+
 /**
  * Ensures llama backend is initialized exactly once.
  */
 static void EnsureBackendInit(bool &Initialized) {
-  !Initialized ? (llama_backend_init(), Initialized = true, void()) : void();
+  !Initialized
+      ? (LoadDynamicBackends(), llama_backend_init(), Initialized = true,
+         void())
+      : void();
+}
+
+/**
+ * Applies the process-wide NUMA strategy once; later requests are ignored
+ * because ggml can only partition nodes before the first graph runs.
+ * call_once keeps concurrent cortex and embedder loads from both applying it.
+ */
+static void EnsureNumaInit(int Strategy) {
+  static std::once_flag NumaOnce;
+  (Strategy > GGML_NUMA_STRATEGY_DISABLED &&
+   Strategy < GGML_NUMA_STRATEGY_COUNT)
+      ? std::call_once(NumaOnce,
+                       [Strategy]() {
+                         llama_numa_init(
+                             static_cast<ggml_numa_strategy>(Strategy));
+                       })
+      : void();
+}
+
+/**
+ * Registry entry for a ggml threadpool. Shared entries are matched by params
+ * and reference counted across contexts; private entries are never matched.
+ */
+struct FacadePool {
+  ggml_threadpool_params Params;
+  ggml_threadpool *Pool;
+  int Refs;
+  bool Shared;
+};
+
+static std::mutex &PoolMutex() {
+  static std::mutex Mutex;
+  return Mutex;
+}
+
+static std::vector<FacadePool> &Pools() {
+  static std::vector<FacadePool> Registry;
+  return Registry;
+}
+
+/** Threadpools created so far; diagnostics for pool reuse. */
+static std::atomic<long long> PoolCreations(0);
+
+typedef ggml_threadpool *(*ThreadpoolNewFn)(ggml_threadpool_params *);
+typedef void (*ThreadpoolFreeFn)(ggml_threadpool *);
+
+/**
+ * Threadpool create/free live in the CPU backend, which may be a dynamically
+ * loaded variant, so they are resolved through the backend registry.
+ */
+static void *CpuBackendProc(const char *Name) {
+  ggml_backend_dev_t Dev =
+      ggml_backend_dev_by_type(GGML_BACKEND_DEVICE_TYPE_CPU);
+  ggml_backend_reg_t Reg = Dev ? ggml_backend_dev_backend_reg(Dev) : nullptr;
+  return Reg ? ggml_backend_reg_get_proc_address(Reg, Name) : nullptr;
+}
+
+/**
+ * Recursive helper: marks each in-range core id in the pool cpumask.
+ */
+static void FillCpuMaskRecursive(ggml_threadpool_params &Params,
+                                 const int *Cores, int Count, int Index) {
+  Index < Count
+      ? ((Cores[Index] >= 0 && Cores[Index] < GGML_MAX_N_THREADS
+              ? (void)(Params.cpumask[Cores[Index]] = true)
+              : (void)0),
+         FillCpuMaskRecursive(Params, Cores, Count, Index + 1))
+      : void();
+}
+
+static ggml_threadpool_params
+MakePoolParams(const LlamaFacade::ThreadingParams &Threading, int NThreads) {
+  ggml_threadpool_params Params;
+  ggml_threadpool_params_init(&Params, NThreads);
+  Params.poll = static_cast<uint32_t>(
+      Threading.Poll < 0 ? 0 : (Threading.Poll > 100 ? 100 : Threading.Poll));
+  Params.strict_cpu = Threading.StrictAffinity;
+  Threading.AffinityCores
+      ? FillCpuMaskRecursive(Params, Threading.AffinityCores,
+                             Threading.AffinityCount, 0)
+      : void();
+  return Params;
+}
+
+/**
+ * Recursive helper: finds a shared pool whose params match.
+ */
+static int FindSharedPoolRecursive(const std::vector<FacadePool> &Registry,
+                                   const ggml_threadpool_params &Params,
+                                   size_t Index) {
+  return Index >= Registry.size()
+             ? -1
+             : (Registry[Index].Shared &&
+                ggml_threadpool_params_match(&Registry[Index].Params, &Params))
+                   ? static_cast<int>(Index)
+                   : FindSharedPoolRecursive(Registry, Params, Index + 1);
+}
+
+/**
+ * Recursive helper: finds the registry entry owning a pool handle.
+ */
+static int FindPoolHandleRecursive(const std::vector<FacadePool> &Registry,
+                                   const ggml_threadpool *Pool, size_t Index) {
+  return Index >= Registry.size()
+             ? -1
+             : Registry[Index].Pool == Pool
+                   ? static_cast<int>(Index)
+                   : FindPoolHandleRecursive(Registry, Pool, Index + 1);
+}
+
+static ggml_threadpool *AcquirePool(ggml_threadpool_params Params,
+                                    bool Shared) {
+  std::lock_guard<std::mutex> Lock(PoolMutex());
+  std::vector<FacadePool> &Registry = Pools();
+  const int Found = Shared ? FindSharedPoolRecursive(Registry, Params, 0) : -1;
+  return Found >= 0
+             ? (++Registry[Found].Refs, Registry[Found].Pool)
+             : [&]() -> ggml_threadpool * {
+                 ThreadpoolNewFn New = reinterpret_cast<ThreadpoolNewFn>(
+                     CpuBackendProc("ggml_threadpool_new"));
+                 ggml_threadpool *Pool = New ? New(&Params) : nullptr;
+                 Pool ? (Registry.push_back(
+                             FacadePool{Params, Pool, 1, Shared}),
+                         ++PoolCreations, void())
+                      : void();
+                 return Pool;
+               }();
+}
+
+static ggml_threadpool *RetainPool(ggml_threadpool *Pool) {
+  std::lock_guard<std::mutex> Lock(PoolMutex());
+  const int Found = FindPoolHandleRecursive(Pools(), Pool, 0);
+  return Found >= 0 ? (++Pools()[Found].Refs, Pool) : nullptr;
+}
+
+static void ReleasePool(ggml_threadpool *Pool) {
+  std::lock_guard<std::mutex> Lock(PoolMutex());
+  std::vector<FacadePool> &Registry = Pools();
+  const int Found = Pool ? FindPoolHandleRecursive(Registry, Pool, 0) : -1;
+  (Found >= 0 && --Registry[Found].Refs == 0)
+      ? [&]() {
+          ThreadpoolFreeFn Free = reinterpret_cast<ThreadpoolFreeFn>(
+              CpuBackendProc("ggml_threadpool_free"));
+          Free ? Free(Pool) : void();
+          Registry.erase(Registry.begin() + Found);
+        }()
+      : void();
+}
+
+/**
+ * Flattens threading params into a comparable key, copying the affinity set
+ * because the caller's array does not outlive the call.
+ */
+static std::vector<int>
+ThreadingKey(const LlamaFacade::ThreadingParams &Threading) {
+  std::vector<int> Key = {Threading.Threads,        Threading.BatchThreads,
+                          Threading.StrictAffinity, Threading.Poll,
+                          Threading.SharedPool,     Threading.AffinityCount};
+  Threading.AffinityCores
+      ? (void)Key.insert(Key.end(), Threading.AffinityCores,
+                         Threading.AffinityCores +
+                             (Threading.AffinityCount > 0
+                                  ? Threading.AffinityCount
+                                  : 0))
+      : (void)0;
+  return Key;
+}
+
+/**
+ * Swaps the context onto pools for Threading and releases the old ones.
+ */
+static void SwapThreading(llama_facade_context *F,
+                          const LlamaFacade::ThreadingParams &Threading) {
+  const int NThreads =
+      Threading.Threads > 0 ? Threading.Threads : llama_n_threads(F->Ctx);
+  const int NBatch =
+      Threading.BatchThreads > 0 ? Threading.BatchThreads : NThreads;
+  const bool bWantsPool =
+      Threading.Threads > 0 ||
+      (Threading.AffinityCores && Threading.AffinityCount > 0);
+
+  ggml_threadpool *OldPool = F->Pool;
+  ggml_threadpool *OldBatch = F->BatchPool;
+  ggml_threadpool *Pool =
+      bWantsPool ? AcquirePool(MakePoolParams(Threading, NThreads),
+                               Threading.SharedPool)
+                 : nullptr;
+  ggml_threadpool *Batch =
+      !Pool ? nullptr
+            : NBatch == NThreads
+                  ? RetainPool(Pool)
+                  : AcquirePool(MakePoolParams(Threading, NBatch),
+                                Threading.SharedPool);
+
+  (OldPool || OldBatch) ? llama_detach_threadpool(F->Ctx) : void();
+  Pool ? llama_attach_threadpool(F->Ctx, Pool, Batch ? Batch : Pool)
+       : void();
+  llama_set_n_threads(F->Ctx, NThreads, NBatch);
+  F->Pool = Pool;
+  F->BatchPool = Batch;
+  ReleasePool(OldPool);
+  ReleasePool(OldBatch);
+}
+
+/**
+ * Attaches pools matching Threading to the context and sets thread counts,
+ * then drops the pools it held before. Threads <= 0 without an affinity set
+ * keeps llama's internal pool. Params equal to the ones already applied are
+ * a no-op, so per-request re-application never churns private pools.
+ */
+static void AttachThreading(llama_facade_context *F,
+                            const LlamaFacade::ThreadingParams &Threading) {
+  std::vector<int> Key = ThreadingKey(Threading);
+  Key == F->AppliedThreading ? void()
+                             : (SwapThreading(F, Threading),
+                                F->AppliedThreading.swap(Key), void());
+}
+
+/**
+ * Recursive helper: folds a NULL-terminated ggml feature list into CpuFeature
+ * bits. A feature counts when its value is anything other than "0".
+ */
+static unsigned FeatureBitsRecursive(const ggml_backend_feature *Features,
+                                     unsigned Acc) {
+  return (!Features || !Features->name)
+             ? Acc
+             : FeatureBitsRecursive(
+                   Features + 1,
+                   (Features->value && std::strcmp(Features->value, "0") == 0)
+                       ? Acc
+                       : Acc |
+                             (std::strcmp(Features->name, "AVX2") == 0
+                                  ? LlamaFacade::CpuFeatureAvx2
+                              : std::strcmp(Features->name, "AVX512") == 0
+                                  ? LlamaFacade::CpuFeatureAvx512
+                              : std::strcmp(Features->name, "F16C") == 0
+                                  ? LlamaFacade::CpuFeatureF16C
+                              : std::strcmp(Features->name, "NEON") == 0
+                                  ? LlamaFacade::CpuFeatureNeon
+                                  : 0u));
 }
 
 namespace LlamaFacade {
 
 static bool BackendInitialized = false;
 
-llama_facade_context *LoadInferenceModel(const char *PathUtf8) {
+long long ThreadpoolCreations() { return PoolCreations.load(); }
+
+unsigned CpuFeatureFlags() {
+  EnsureBackendInit(BackendInitialized);
+  ggml_backend_dev_t Dev =
+      ggml_backend_dev_by_type(GGML_BACKEND_DEVICE_TYPE_CPU);
+  ggml_backend_reg_t Reg = Dev ? ggml_backend_dev_backend_reg(Dev) : nullptr;
+  ggml_backend_get_features_t GetFeatures =
+      Reg ? reinterpret_cast<ggml_backend_get_features_t>(
+                ggml_backend_reg_get_proc_address(Reg,
+                                                  "ggml_backend_get_features"))
+          : nullptr;
+  return GetFeatures ? FeatureBitsRecursive(GetFeatures(Reg), 0u) : 0u;
+}
+
+bool QuantizeModel(const char *InPathUtf8, const char *OutPathUtf8, int FType,
+                   int Threads, bool AllowRequantize) {
+  return (!InPathUtf8 || !*InPathUtf8 || !OutPathUtf8 || !*OutPathUtf8)
+             ? false
+             : [&]() -> bool {
+                 EnsureBackendInit(BackendInitialized);
+                 llama_model_quantize_params Params =
+                     llama_model_quantize_default_params();
+                 Params.ftype = static_cast<llama_ftype>(FType);
+                 Params.nthread = Threads;
+                 Params.allow_requantize = AllowRequantize;
+                 return llama_model_quantize(InPathUtf8, OutPathUtf8,
+                                             &Params) == 0;
+               }();
+}
+
+void SetBackendSearchPath(const char *DirUtf8) {
+  BackendSearchPath() = DirUtf8 ? DirUtf8 : "";
+}
+
+llama_facade_context *LoadInferenceModel(const char *PathUtf8,
+                                         const ThreadingParams *Threading) {
   return (!PathUtf8 || !*PathUtf8)
              ? nullptr
              : [&]() -> llama_facade_context * {
                  EnsureBackendInit(BackendInitialized);
+                 Threading ? EnsureNumaInit(Threading->NumaStrategy) : void();
 
                  llama_model_params MParams = llama_model_default_params();
                  MParams.n_gpu_layers = -1;
@@ -192,6 +505,10 @@ llama_facade_context *LoadInferenceModel(const char *PathUtf8) {
                                 CParams.n_ctx = 2048;
                                 CParams.n_batch = 512;
                                 CParams.embeddings = false;
+                                (Threading && Threading->Threads > 0)
+                                    ? (void)(CParams.n_threads =
+                                                 Threading->Threads)
+                                    : (void)0;
 
                                 llama_context *Ctx =
                                     llama_init_from_model(Model, CParams);
@@ -201,18 +518,26 @@ llama_facade_context *LoadInferenceModel(const char *PathUtf8) {
                                                std::unique_ptr<
                                                    llama_facade_context>
                                                    F(new llama_facade_context{
-                                                       Model, Ctx, false});
+                                                       Model, Ctx, false,
+                                                       nullptr, nullptr,
+                                                       nullptr});
+                                               Threading
+                                                   ? AttachThreading(
+                                                         F.get(), *Threading)
+                                                   : void();
                                                return F.release(); // Ownership transferred to caller; freed via FreeContext
                                              }();
                               }();
                }();
 }
 
-llama_facade_context *LoadEmbeddingModel(const char *PathUtf8) {
+llama_facade_context *LoadEmbeddingModel(const char *PathUtf8,
+                                         const ThreadingParams *Threading) {
   return (!PathUtf8 || !*PathUtf8)
              ? nullptr
              : [&]() -> llama_facade_context * {
                  EnsureBackendInit(BackendInitialized);
+                 Threading ? EnsureNumaInit(Threading->NumaStrategy) : void();
 
                  llama_model_params MParams = llama_model_default_params();
                  MParams.n_gpu_layers = -1;
@@ -229,6 +554,10 @@ llama_facade_context *LoadEmbeddingModel(const char *PathUtf8) {
                                 CParams.embeddings = true;
                                 CParams.pooling_type =
                                     LLAMA_POOLING_TYPE_MEAN;
+                                (Threading && Threading->Threads > 0)
+                                    ? (void)(CParams.n_threads =
+                                                 Threading->Threads)
+                                    : (void)0;
 
                                 llama_context *Ctx =
                                     llama_init_from_model(Model, CParams);
@@ -238,15 +567,46 @@ llama_facade_context *LoadEmbeddingModel(const char *PathUtf8) {
                                                std::unique_ptr<
                                                    llama_facade_context>
                                                    F(new llama_facade_context{
-                                                       Model, Ctx, true});
+                                                       Model, Ctx, true,
+                                                       nullptr, nullptr,
+                                                       nullptr});
+                                               Threading
+                                                   ? AttachThreading(
+                                                         F.get(), *Threading)
+                                                   : void();
                                                return F.release(); // Ownership transferred to caller; freed via FreeContext
                                              }();
                               }();
                }();
 }
 
+bool ApplyThreading(llama_facade_context *Ctx,
+                    const ThreadingParams *Threading) {
+  return (!Ctx || !Threading)
+             ? false
+             : (AttachThreading(Ctx, *Threading), true);
+}
+
+void SetAbortFlag(llama_facade_context *Ctx, const std::atomic<bool> *Flag) {
+  Ctx ? (Ctx->AbortFlag = Flag,
+         llama_set_abort_callback(
+             Ctx->Ctx,
+             Flag ? +[](void *Data) -> bool {
+               return static_cast<const std::atomic<bool> *>(Data)->load(
+                   std::memory_order_acquire);
+             }
+                  : static_cast<ggml_abort_callback>(nullptr),
+             const_cast<std::atomic<bool> *>(Flag)),
+         void())
+      : void();
+}
+
 void FreeContext(llama_facade_context *Ctx) {
-  Ctx ? (llama_free(Ctx->Ctx),
+  Ctx ? ((Ctx->Pool || Ctx->BatchPool) ? llama_detach_threadpool(Ctx->Ctx)
+                                       : void(),
+         llama_free(Ctx->Ctx),
+         ReleasePool(Ctx->Pool),
+         ReleasePool(Ctx->BatchPool),
          llama_model_free(Ctx->Model),
          std::unique_ptr<llama_facade_context>(Ctx).reset(),
          void())
@@ -570,13 +930,19 @@ bool Embed(llama_facade_context *Ctx, const char *TextUtf8, float *Out,
 
 namespace LlamaFacade {
 
-llama_facade_context *LoadInferenceModel(const char *) { return nullptr; }
-llama_facade_context *LoadEmbeddingModel(const char *) { return nullptr; }
+void SetBackendSearchPath(const char *) {}
+llama_facade_context *LoadInferenceModel(const char *, const ThreadingParams *) { return nullptr; }
+llama_facade_context *LoadEmbeddingModel(const char *, const ThreadingParams *) { return nullptr; }
+bool ApplyThreading(llama_facade_context *, const ThreadingParams *) { return false; }
+void SetAbortFlag(llama_facade_context *, const std::atomic<bool> *) {}
 void FreeContext(llama_facade_context *) {}
 char *Infer(llama_facade_context *, const char *, int, float) { return nullptr; }
 char *InferWithGrammar(llama_facade_context *, const char *, int, float, const char *) { return nullptr; }
 int InferStream(llama_facade_context *, const char *, int, float, TokenCallback, void *) { return 0; }
 bool Embed(llama_facade_context *, const char *, float *, int) { return false; }
+unsigned CpuFeatureFlags() { return 0u; }
+long long ThreadpoolCreations() { return 0; }
+bool QuantizeModel(const char *, const char *, int, int, bool) { return false; }
 
 } // namespace LlamaFacade
 
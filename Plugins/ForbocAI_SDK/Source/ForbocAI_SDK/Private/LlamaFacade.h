@@ -7,21 +7,66 @@
  * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
  */
 
+#include <atomic>
+
 struct llama_facade_context;
 
 namespace LlamaFacade {
 
+/**
+ * Sets the directory holding dynamically loaded ggml backends (libggml-cpu-*.so).
+ *  Must be called before the first model load; no-op unless WITH_FORBOC_GGML_BACKEND_DL=1.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+void SetBackendSearchPath(const char *DirUtf8);
+
+/**
+ * CPU threading for a context. Threads <= 0 without AffinityCores keeps the
+ *  context's current count on llama's internal pool; BatchThreads <= 0 follows
+ *  Threads. NativeEngine always resolves auto counts before calling, so SDK
+ *  contexts get a real pool. AffinityCores may be null; NumaStrategy uses
+ *  ggml_numa_strategy values. Contexts with SharedPool and matching settings
+ *  share one ggml threadpool, and re-applying equal params is a no-op.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+struct ThreadingParams {
+  int Threads;
+  int BatchThreads;
+  const int *AffinityCores;
+  int AffinityCount;
+  bool StrictAffinity;
+  int Poll;
+  int NumaStrategy;
+  bool SharedPool;
+};
+
 /**
  * Load model for inference (SmolLM, Llama3, etc.)
  * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
  */
-llama_facade_context *LoadInferenceModel(const char *PathUtf8);
+llama_facade_context *LoadInferenceModel(const char *PathUtf8,
+                                         const ThreadingParams *Threading = nullptr);
 
 /**
  * Load embedding model (all-MiniLM-L6-v2 GGUF). Use for Embed().
  * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
  */
-llama_facade_context *LoadEmbeddingModel(const char *PathUtf8);
+llama_facade_context *LoadEmbeddingModel(const char *PathUtf8,
+                                         const ThreadingParams *Threading = nullptr);
+
+/**
+ * Re-applies threading to a live context, swapping its threadpool. Matching
+ *  shared settings reuse the same pool. Not safe while the context is decoding.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+bool ApplyThreading(llama_facade_context *Ctx, const ThreadingParams *Threading);
+
+/**
+ * Installs a caller-owned abort flag polled between generated tokens and
+ * inside llama_decode. Pass nullptr to clear; the flag must outlive its use.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+void SetAbortFlag(llama_facade_context *Ctx, const std::atomic<bool> *Flag);
 
 void FreeContext(llama_facade_context *Ctx);
 
@@ -54,6 +99,38 @@ char *InferWithGrammar(llama_facade_context *Ctx, const char *PromptUtf8,
                        int MaxTokens, float Temperature,
                        const char *GrammarUtf8);
 
+/**
+ * CPU feature bits reported by the active ggml CPU backend.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+enum CpuFeature : unsigned {
+  CpuFeatureAvx2 = 1u << 0,
+  CpuFeatureAvx512 = 1u << 1,
+  CpuFeatureF16C = 1u << 2,
+  CpuFeatureNeon = 1u << 3,
+};
+
+/**
+ * Returns CpuFeature bits for the CPU backend ggml selected on this host.
+ *  Initializes the backend (loading dynamic variants) on first call.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+unsigned CpuFeatureFlags();
+
+/**
+ * Number of ggml threadpools created since startup, shared or private.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+long long ThreadpoolCreations();
+
+/**
+ * Requantizes a GGUF file to the given llama_ftype. Blocking; run off the game
+ *  thread. AllowRequantize permits sources that are already quantized.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+bool QuantizeModel(const char *InPathUtf8, const char *OutPathUtf8, int FType,
+                   int Threads, bool AllowRequantize);
+
 /**
  * Generate 384-dim normalized embedding. Caller provides Out[384].
  * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
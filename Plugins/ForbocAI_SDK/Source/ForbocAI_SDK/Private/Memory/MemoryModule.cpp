@@ -5,7 +5,7 @@
 #include "Memory/MemorySlice.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
-#include "RuntimeStore.h"
+#include "RuntimeFacade.h"
 #include "Serialization/JsonSerializer.h"
 #include "Memory/MemoryThunks.h"
 
@@ -118,19 +118,13 @@ MemoryOps::Store(const FMemoryStore &Store, const FString &Text,
                  Item.Timestamp =
                      FDateTime::Now().ToUnixTimestamp();
 
-                 auto RuntimeStore = ConfigureStore();
-
                  /**
-                  * Dispatch the store thunk
+                  * Run the store thunk directly; the memory slice only sees
+                  * it when facade store sync is enabled.
                   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
                   */
-                 auto ThunkResult = rtk::nodeMemoryStoreThunk(Item)(
-                     [RuntimeStore](const rtk::AnyAction &a) {
-                       return RuntimeStore.dispatch(a);
-                     },
-                     [RuntimeStore]() {
-                       return RuntimeStore.getState();
-                     });
+                 auto ThunkResult =
+                     FacadeDispatch::Run(rtk::nodeMemoryStoreThunk(Item));
 
                  /**
                   * Chain result back to the promise
@@ -178,11 +172,6 @@ MemoryOps::Recall(const FMemoryStore &Store, const FString &Query,
                  return Promise.GetFuture();
                }()
              : [&]() -> TFuture<MemoryTypes::MemoryStoreRecallResult> {
-                 TSharedPtr<TPromise<MemoryTypes::MemoryStoreRecallResult>>
-                     Promise = MakeShared<
-                         TPromise<MemoryTypes::MemoryStoreRecallResult>>();
-
-                 auto RuntimeStore = ConfigureStore();
                  FMemoryRecallRequest RecallRequest;
                  RecallRequest.Query = Query;
                  RecallRequest.Limit =
@@ -190,34 +179,11 @@ MemoryOps::Recall(const FMemoryStore &Store, const FString &Query,
                  RecallRequest.Threshold = 0.0f;
 
                  /**
-                  * Dispatch the recall thunk
+                  * Run the recall thunk directly and settle it into a future
                   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
                   */
-                 auto ThunkResult = rtk::nodeMemoryRecallThunk(RecallRequest)(
-                     [RuntimeStore](const rtk::AnyAction &a) {
-                       return RuntimeStore.dispatch(a);
-                     },
-                     [RuntimeStore]() {
-                       return RuntimeStore.getState();
-                     });
-
-                 /**
-                  * Chain result back to the promise
-                  * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
-                  */
-                 ThunkResult
-                     .then([Promise](TArray<FMemoryItem> Results) {
-                       Promise->SetValue(
-                           MemoryTypes::make_right(FString(), Results));
-                     })
-                     .catch_([Promise](std::string Error) {
-                       Promise->SetValue(MemoryTypes::make_left(
-                           FString(Error.c_str()),
-                           TArray<FMemoryItem>{}));
-                     })
-                     .execute();
-
-                 return Promise->GetFuture();
+                 return FacadeDispatch::ToFuture(FacadeDispatch::Run(
+                     rtk::nodeMemoryRecallThunk(RecallRequest)));
                }();
 }
 
@@ -1,8 +1,13 @@
 #include "NativeEngine.h"
 #include "LlamaFacade.h"
+#include "RuntimeConfig.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include <algorithm>
 #include <memory>
+#include <numeric>
 
 #if WITH_FORBOC_SQLITE_VEC
 extern "C" {
@@ -81,6 +86,27 @@ FString BuildJsonVector(const TArray<float> &Vector) {
 }
 
 #if WITH_FORBOC_SQLITE_VEC
+/** How long a connection waits on a locked database before failing. */
+constexpr int BusyTimeoutMs = 5000;
+
+/**
+ * Copies an fp32 vector blob column out of the current row; empty for NULL.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+TArray<float> ReadVectorColumn(sqlite3_stmt *Stmt, int Column) {
+  TArray<float> Vector;
+  const void *Blob = sqlite3_column_blob(Stmt, Column);
+  const int32 Count =
+      Blob ? sqlite3_column_bytes(Stmt, Column) /
+                 static_cast<int32>(sizeof(float))
+           : 0;
+  Count > 0 ? (Vector.SetNumUninitialized(Count),
+               FMemory::Memcpy(Vector.GetData(), Blob, Count * sizeof(float)),
+               void())
+            : void();
+  return Vector;
+}
+
 FMemoryItem ReadMemoryItem(sqlite3_stmt *Stmt) {
   FMemoryItem Item;
   const unsigned char *IdText = sqlite3_column_text(Stmt, 0);
@@ -96,6 +122,9 @@ FMemoryItem ReadMemoryItem(sqlite3_stmt *Stmt) {
   Item.Timestamp = static_cast<int64>(sqlite3_column_int64(Stmt, 4));
   Item.Similarity =
       static_cast<float>(1.0 - sqlite3_column_double(Stmt, 5));
+  sqlite3_column_count(Stmt) > 6
+      ? (void)(Item.Embedding = ReadVectorColumn(Stmt, 6))
+      : void();
   return Item;
 }
 
@@ -106,8 +135,368 @@ void CollectSearchRowsRecursive(sqlite3_stmt *Stmt, TArray<FMemoryItem> &Results
          CollectSearchRowsRecursive(Stmt, Results))
       : void();
 }
+
+using Native::Sqlite::EVectorStorage;
+
+/** Quantized searches re-rank this many candidates per requested result. */
+constexpr int32 RerankOversample = 8;
+
+/** vec0's upper bound on k for a single KNN query. */
+constexpr int32 MaxKnnCandidates = 4096;
+
+/** Per-connection cache key for the resolved storage mode. */
+constexpr const char *StorageClientDataKey = "forboc.vector_storage";
+
+/**
+ * Prepares, binds, steps and finalizes one statement. True when it ran to
+ * completion.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+bool RunStatement(sqlite3 *Db, const FString &Sql,
+                  const std::function<void(sqlite3_stmt *)> &Bind) {
+  sqlite3_stmt *Stmt = nullptr;
+  return sqlite3_prepare_v2(Db, TCHAR_TO_UTF8(*Sql), -1, &Stmt, nullptr) !=
+                 SQLITE_OK
+             ? (sqlite3_finalize(Stmt), false)
+             : [&]() {
+                 Bind(Stmt);
+                 const bool bOk = sqlite3_step(Stmt) == SQLITE_DONE;
+                 sqlite3_finalize(Stmt);
+                 return bOk;
+               }();
+}
+
+/**
+ * Returns the first column of the first row as text, or empty.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+FString QueryText(sqlite3 *Db, const char *Sql) {
+  sqlite3_stmt *Stmt = nullptr;
+  const bool bRow = sqlite3_prepare_v2(Db, Sql, -1, &Stmt, nullptr) ==
+                        SQLITE_OK &&
+                    sqlite3_step(Stmt) == SQLITE_ROW;
+  const unsigned char *Text = bRow ? sqlite3_column_text(Stmt, 0) : nullptr;
+  const FString Result =
+      Text ? FString(UTF8_TO_TCHAR(reinterpret_cast<const char *>(Text)))
+           : FString();
+  sqlite3_finalize(Stmt);
+  return Result;
+}
+
+/**
+ * Element type of the vec0 embedding column for a storage mode.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+const TCHAR *VectorElementType(EVectorStorage Storage) {
+  return Storage == EVectorStorage::Int8     ? TEXT("int8")
+         : Storage == EVectorStorage::Binary ? TEXT("bit")
+                                             : TEXT("float");
+}
+
+/**
+ * Wraps an fp32 vector expression in the quantizer for a storage mode.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+FString QuantizedValue(EVectorStorage Storage, const FString &Fp32Expr) {
+  return Storage == EVectorStorage::Int8
+             ? FString::Printf(TEXT("vec_quantize_int8(%s, 'unit')"),
+                               *Fp32Expr)
+         : Storage == EVectorStorage::Binary
+             ? FString::Printf(TEXT("vec_quantize_binary(%s)"), *Fp32Expr)
+             : Fp32Expr;
+}
+
+/**
+ * Schema for the search table, plus the cold fp32 table for quantized modes.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+FString StorageSchemaSql(EVectorStorage Storage) {
+  return FString::Printf(
+             TEXT("CREATE VIRTUAL TABLE IF NOT EXISTS memories USING "
+                  "vec0(embedding %s[%d], +id text, +text text, +type text, "
+                  "+importance float, +timestamp integer);"),
+             VectorElementType(Storage), EmbeddingDimensions) +
+         (Storage != EVectorStorage::Float
+              ? FString(TEXT("CREATE TABLE IF NOT EXISTS memory_vectors("
+                             "id TEXT PRIMARY KEY, embedding BLOB NOT NULL);"))
+              : FString());
+}
+
+/**
+ * Caches a connection's storage mode so per-call lookups skip the meta
+ * table.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void CacheStorage(sqlite3 *Db, EVectorStorage Storage) {
+  sqlite3_set_clientdata(Db, StorageClientDataKey,
+                         new EVectorStorage(Storage), [](void *Data) {
+                           delete static_cast<EVectorStorage *>(Data);
+                         });
+}
+
+/**
+ * Reads the storage mode recorded in the database; databases created before
+ * storage modes existed are Float.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+EVectorStorage QueryStorage(sqlite3 *Db) {
+  return Native::Sqlite::StorageFromName(
+      QueryText(Db, "SELECT value FROM forboc_meta "
+                    "WHERE key = 'vector_storage';"));
+}
+
+/**
+ * Returns a connection's storage mode, from the cache when present.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+EVectorStorage ConnectionStorage(sqlite3 *Db) {
+  const EVectorStorage *Cached = static_cast<const EVectorStorage *>(
+      sqlite3_get_clientdata(Db, StorageClientDataKey));
+  return Cached ? *Cached : [Db]() {
+    const EVectorStorage Storage = QueryStorage(Db);
+    CacheStorage(Db, Storage);
+    return Storage;
+  }();
+}
+
+/**
+ * Records the storage mode for a database on first open and creates its
+ * tables. A database that already holds memories but no recorded mode
+ * predates storage modes and stays Float. Returns the effective mode.
+ * User Story: As database open, I need the mode fixed at creation so every
+ * connection, including read-only ones, agrees on the table layout.
+ */
+EVectorStorage PrepareStorageSchema(sqlite3 *Db, EVectorStorage Requested) {
+  sqlite3_exec(Db,
+               "CREATE TABLE IF NOT EXISTS forboc_meta("
+               "key TEXT PRIMARY KEY, value TEXT NOT NULL);",
+               nullptr, nullptr, nullptr);
+  const bool bLegacy =
+      QueryText(Db, "SELECT value FROM forboc_meta "
+                    "WHERE key = 'vector_storage';")
+          .IsEmpty() &&
+      !QueryText(Db, "SELECT name FROM sqlite_master "
+                     "WHERE name = 'memories';")
+           .IsEmpty();
+  const EVectorStorage Initial =
+      bLegacy ? EVectorStorage::Float : Requested;
+  RunStatement(Db,
+               TEXT("INSERT OR IGNORE INTO forboc_meta (key, value) "
+                    "VALUES ('vector_storage', ?);"),
+               [Initial](sqlite3_stmt *Stmt) {
+                 sqlite3_bind_text(
+                     Stmt, 1,
+                     TCHAR_TO_UTF8(Native::Sqlite::StorageName(Initial)), -1,
+                     SQLITE_TRANSIENT);
+               });
+  const EVectorStorage Storage = QueryStorage(Db);
+  sqlite3_exec(Db, TCHAR_TO_UTF8(*StorageSchemaSql(Storage)), nullptr,
+               nullptr, nullptr);
+  CacheStorage(Db, Storage);
+  return Storage;
+}
+
+/**
+ * Binds id, text, type, importance, timestamp and the JSON vector to
+ * parameters 1-6.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void BindMemoryRow(sqlite3_stmt *Stmt, const FMemoryItem &Item,
+                   const FString &JsonVec) {
+  sqlite3_bind_text(Stmt, 1, TCHAR_TO_UTF8(*Item.Id), -1, SQLITE_TRANSIENT);
+  sqlite3_bind_text(Stmt, 2, TCHAR_TO_UTF8(*Item.Text), -1, SQLITE_TRANSIENT);
+  sqlite3_bind_text(Stmt, 3, TCHAR_TO_UTF8(*Item.Type), -1, SQLITE_TRANSIENT);
+  sqlite3_bind_double(Stmt, 4, static_cast<double>(Item.Importance));
+  sqlite3_bind_int64(Stmt, 5, static_cast<sqlite3_int64>(Item.Timestamp));
+  sqlite3_bind_text(Stmt, 6, TCHAR_TO_UTF8(*JsonVec), -1, SQLITE_TRANSIENT);
+}
+
+/**
+ * Search SQL for a storage mode. Float runs one exact KNN. Quantized modes
+ * run a KNN over the compact vectors for ?2 candidates (Hamming distance for
+ * binary), then re-rank those by exact L2 on the cold fp32 vectors and keep
+ * ?3. Distances stay L2 in every mode, so similarity thresholds carry over.
+ * The candidate set is materialized so the join is not pushed into the vec0
+ * KNN scan, which rejects constraints on auxiliary columns. With vectors, a
+ * seventh column carries each row's fp32 embedding.
+ * User Story: As quantized recall, I need the final order computed at full
+ * precision so compression costs scan time, not answer quality.
+ */
+FString SearchSql(EVectorStorage Storage, bool bWithVectors) {
+  return Storage == EVectorStorage::Float
+             ? FString::Printf(
+                   TEXT("SELECT id, text, type, importance, timestamp, "
+                        "distance%s FROM memories "
+                        "WHERE embedding MATCH ? "
+                        "ORDER BY distance "
+                        "LIMIT ?;"),
+                   bWithVectors ? TEXT(", embedding") : TEXT(""))
+             : FString::Printf(
+                   TEXT("WITH candidates AS MATERIALIZED ("
+                        "SELECT id, text, type, importance, timestamp "
+                        "FROM memories WHERE embedding MATCH %s AND k = ?2) "
+                        "SELECT c.id, c.text, c.type, c.importance, "
+                        "c.timestamp, "
+                        "vec_distance_l2(v.embedding, vec_f32(?1)) AS distance"
+                        "%s "
+                        "FROM candidates c "
+                        "JOIN memory_vectors v ON v.id = c.id "
+                        "ORDER BY distance LIMIT ?3;"),
+                   *QuantizedValue(Storage, TEXT("vec_f32(?1)")),
+                   bWithVectors ? TEXT(", v.embedding") : TEXT(""));
+}
+
+/**
+ * Rows of a database in any mode with fp32 embeddings, as a SELECT.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+FString FullPrecisionRowsSql(EVectorStorage Storage) {
+  return Storage == EVectorStorage::Float
+             ? FString(TEXT("SELECT id, text, type, importance, timestamp, "
+                            "embedding FROM memories"))
+             : FString(TEXT("SELECT m.id, m.text, m.type, m.importance, "
+                            "m.timestamp, v.embedding FROM memories m "
+                            "JOIN memory_vectors v ON v.id = m.id"));
+}
+
+/**
+ * Runs the nearest-neighbour query for Limit rows, optionally with each
+ * row's fp32 embedding.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+TArray<FMemoryItem> RunSearch(sqlite3 *Handle, const TArray<float> &Vector,
+                              int32 Limit, bool bWithVectors) {
+  TArray<FMemoryItem> Results;
+  const EVectorStorage Storage = ConnectionStorage(Handle);
+  const FString Sql = SearchSql(Storage, bWithVectors);
+
+  sqlite3_stmt *Stmt = nullptr;
+  return sqlite3_prepare_v2(Handle, TCHAR_TO_UTF8(*Sql), -1, &Stmt,
+                            nullptr) != SQLITE_OK
+             ? (sqlite3_finalize(Stmt), Results)
+             : [&]() -> TArray<FMemoryItem> {
+                 const FString JsonVec = BuildJsonVector(Vector);
+
+                 sqlite3_bind_text(Stmt, 1, TCHAR_TO_UTF8(*JsonVec), -1,
+                                   SQLITE_TRANSIENT);
+                 Storage == EVectorStorage::Float
+                     ? (sqlite3_bind_int(Stmt, 2, Limit), void())
+                     : (sqlite3_bind_int(Stmt, 2,
+                                         FMath::Min(Limit * RerankOversample,
+                                                    MaxKnnCandidates)),
+                        sqlite3_bind_int(Stmt, 3, Limit), void());
+                 CollectSearchRowsRecursive(Stmt, Results);
+
+                 sqlite3_finalize(Stmt);
+
+                 return Results;
+               }();
+}
 #endif
 
+using Native::Sqlite::ERecallScoring;
+using Native::Sqlite::FRecallScoring;
+
+/** Scored recalls rank this many candidates per requested result. */
+constexpr int32 RecallOversample = 5;
+
+/** Upper bound on the candidate set a scored recall ranks. */
+constexpr int32 MaxRecallCandidates = 512;
+
+/**
+ * exp(-age / tau) for a memory timestamp; 1 when decay is disabled.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+double RecencyWeight(int64 Timestamp, const FRecallScoring &Scoring) {
+  const double Age = FMath::Max(
+      0.0, static_cast<double>(Scoring.NowSeconds - Timestamp));
+  return Scoring.RecencyTauSeconds > 0.0
+             ? FMath::Exp(-Age / Scoring.RecencyTauSeconds)
+             : 1.0;
+}
+
+/**
+ * similarity x importance x recency for one candidate, never negative.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+double WeightedScore(const FMemoryItem &Item, const FRecallScoring &Scoring) {
+  return FMath::Max(0.0, static_cast<double>(Item.Similarity)) *
+         FMath::Max(0.0, static_cast<double>(Item.Importance)) *
+         RecencyWeight(Item.Timestamp, Scoring);
+}
+
+/**
+ * Cosine similarity of two vectors; 0 when either is empty or zero.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+double Cosine(const TArray<float> &A, const TArray<float> &B) {
+  const int32 N = FMath::Min(A.Num(), B.Num());
+  const double Dot =
+      std::inner_product(A.GetData(), A.GetData() + N, B.GetData(), 0.0);
+  const double NormA =
+      std::inner_product(A.GetData(), A.GetData() + N, A.GetData(), 0.0);
+  const double NormB =
+      std::inner_product(B.GetData(), B.GetData() + N, B.GetData(), 0.0);
+  return (N > 0 && NormA > 0.0 && NormB > 0.0)
+             ? Dot / FMath::Sqrt(NormA * NormB)
+             : 0.0;
+}
+
+/**
+ * Greedy maximal-marginal-relevance selection. Each step takes the remaining
+ * candidate with the best Lambda * relevance - (1 - Lambda) * closeness to
+ * anything already taken, then folds the pick into every remaining
+ * candidate's closeness.
+ * User Story: As recall for chatty NPCs, I need near-duplicate memories
+ * spread out so five results are not five rewordings of one event.
+ */
+struct FMmrSelection {
+  const TArray<FMemoryItem> &Candidates;
+  const TArray<double> &Relevance;
+  const double Lambda;
+  TArray<double> Closeness;
+  TArray<int32> Remaining;
+  TArray<int32> Picked;
+
+  FMmrSelection(const TArray<FMemoryItem> &InCandidates,
+                const TArray<double> &InRelevance, double InLambda)
+      : Candidates(InCandidates), Relevance(InRelevance), Lambda(InLambda) {
+    Closeness.Init(0.0, Candidates.Num());
+    Remaining.SetNumUninitialized(Candidates.Num());
+    std::iota(Remaining.GetData(), Remaining.GetData() + Remaining.Num(), 0);
+  }
+
+  double Marginal(int32 Index) const {
+    return Lambda * Relevance[Index] - (1.0 - Lambda) * Closeness[Index];
+  }
+
+  void FoldPick(int32 Pick, int32 Slot) {
+    Slot < Remaining.Num()
+        ? (Closeness[Remaining[Slot]] =
+               FMath::Max(Closeness[Remaining[Slot]],
+                          Cosine(Candidates[Remaining[Slot]].Embedding,
+                                 Candidates[Pick].Embedding)),
+           FoldPick(Pick, Slot + 1), void())
+        : void();
+  }
+
+  void Run(int32 Left) {
+    (Left > 0 && Remaining.Num() > 0)
+        ? [this, Left]() {
+            const int32 *Best = std::max_element(
+                Remaining.GetData(), Remaining.GetData() + Remaining.Num(),
+                [this](int32 A, int32 B) { return Marginal(A) < Marginal(B); });
+            const int32 Pick = *Best;
+            Remaining.RemoveAtSwap(static_cast<int32>(Best - Remaining.GetData()),
+                                   1, EAllowShrinking::No);
+            Picked.Add(Pick);
+            FoldPick(Pick, 0);
+            Run(Left - 1);
+          }()
+        : void();
+  }
+};
+
 bool IsRedirectCode(const int32 Code) {
   return Code == 301 || Code == 302 || Code == 303 || Code == 307 ||
          Code == 308;
@@ -200,6 +589,90 @@ FMemoryItem PrepareStoredItem(const FMemoryItem &Item) {
   return StoredItem;
 }
 
+#if WITH_FORBOC_GGML_BACKEND_DL
+bool HasCpuBackendVariants(const FString &Dir) {
+  TArray<FString> Variants;
+  IFileManager::Get().FindFiles(
+      Variants, *(Dir / TEXT("libggml-cpu-*.so")), true, false);
+  return Variants.Num() > 0;
+}
+
+FString FirstBackendDirRecursive(const TArray<FString> &Candidates,
+                                 int32 Index) {
+  return Index == Candidates.Num()
+             ? FString()
+             : HasCpuBackendVariants(Candidates[Index])
+                   ? Candidates[Index]
+                   : FirstBackendDirRecursive(Candidates, Index + 1);
+}
+#endif
+
+#if WITH_FORBOC_NATIVE
+/**
+ * Resolves auto thread counts: physical cores minus one so the game thread
+ * keeps a core, and batch threads default to the generation count.
+ * User Story: As native inference, I need auto threading that leaves headroom
+ * so CPU inference does not cause frame hitches through oversubscription.
+ */
+int32 ResolveThreadCount(int32 Requested) {
+  return Requested > 0 ? Requested
+                       : FMath::Max(1, FPlatformMisc::NumberOfCores() - 1);
+}
+
+/**
+ * Converts SDK threading config into facade params. The returned struct
+ * points into Config.AffinityCores, so Config must outlive the call it feeds.
+ * User Story: As native inference, I need SDK threading translated once so
+ * load-time and runtime thread changes share the same rules.
+ */
+LlamaFacade::ThreadingParams
+ToFacadeThreading(const FCortexThreadingConfig &Config) {
+  LlamaFacade::ThreadingParams Params;
+  Params.Threads = ResolveThreadCount(Config.Threads);
+  Params.BatchThreads =
+      Config.BatchThreads > 0 ? Config.BatchThreads : Params.Threads;
+  Params.AffinityCores =
+      Config.AffinityCores.Num() > 0 ? Config.AffinityCores.GetData() : nullptr;
+  Params.AffinityCount = Config.AffinityCores.Num();
+  Params.StrictAffinity = Config.bStrictAffinity;
+  Params.Poll = Config.PollLevel;
+  Params.NumaStrategy = static_cast<int>(Config.Numa);
+  Params.SharedPool = Config.bSharedPool;
+  return Params;
+}
+
+/**
+ * Points the llama facade at the directory holding ggml-cpu variant modules.
+ * User Story: As Linux local inference, I need the CPU backend variants found
+ * in packaged, editor, and source layouts so ggml can pick the best SIMD path.
+ */
+void EnsureBackendSearchPath() {
+#if WITH_FORBOC_GGML_BACKEND_DL
+  static bool bConfigured = false;
+  !bConfigured
+      ? [&]() {
+          const TArray<FString> Candidates = {
+              FString(FPlatformProcess::BaseDir()),
+              FPaths::ProjectPluginsDir() /
+                  TEXT("ForbocAI_SDK/Binaries/Linux"),
+              FPaths::ProjectPluginsDir() /
+                  TEXT("ForbocAI_SDK/ThirdParty/llama.cpp/lib/Linux")};
+          const FString Found = FirstBackendDirRecursive(Candidates, 0);
+          const FString Dir = Found.IsEmpty()
+                                  ? Found
+                                  : FPaths::ConvertRelativePathToFull(Found);
+          UE_LOG(LogTemp, Log, TEXT("ForbocAI: ggml backend search path: %s"),
+                 Dir.IsEmpty() ? TEXT("<default>") : *Dir);
+          auto Utf8Dir = StringCast<UTF8CHAR>(*Dir);
+          LlamaFacade::SetBackendSearchPath(
+              Dir.IsEmpty() ? nullptr : Utf8Bytes(Utf8Dir.Get()));
+          bConfigured = true;
+        }()
+      : void();
+#endif
+}
+#endif
+
 } // namespace
 
 namespace Native {
@@ -211,11 +684,24 @@ namespace Llama {
  * native context so inference requests can execute locally.
  */
 Context LoadModel(const FString &Path) {
+  return LoadModel(Path,
+                   SDKConfig::GetThreadingConfig(FPaths::GetBaseFilename(Path)));
+}
+
+/**
+ * Loads the primary inference model with explicit CPU threading.
+ * User Story: As local-cortex setup, I need threading applied at load so the
+ * context starts on the intended cores and shared threadpool.
+ */
+Context LoadModel(const FString &Path, const FCortexThreadingConfig &Threading) {
 #if WITH_FORBOC_NATIVE
+  EnsureBackendSearchPath();
   auto Utf8Path = StringCast<UTF8CHAR>(*Path);
+  const LlamaFacade::ThreadingParams Params = ToFacadeThreading(Threading);
   return reinterpret_cast<Context>(
-      LlamaFacade::LoadInferenceModel(Utf8Bytes(Utf8Path.Get())));
+      LlamaFacade::LoadInferenceModel(Utf8Bytes(Utf8Path.Get()), &Params));
 #else
+  (void)Threading;
   UE_LOG(LogTemp, Error, TEXT("ForbocAI: LoadModel requires WITH_FORBOC_NATIVE=1. Native libs not available."));
   return nullptr;
 #endif
@@ -227,16 +713,123 @@ Context LoadModel(const FString &Path) {
  * native context so text can be converted into vectors locally.
  */
 Context LoadEmbeddingModel(const FString &Path) {
+  return LoadEmbeddingModel(
+      Path, SDKConfig::GetThreadingConfig(FPaths::GetBaseFilename(Path)));
+}
+
+/**
+ * Loads the embedding model with explicit CPU threading.
+ * User Story: As local-vector setup, I need the embedder placed on its own
+ * cores so embedding bursts do not contend with generation threads.
+ */
+Context LoadEmbeddingModel(const FString &Path,
+                           const FCortexThreadingConfig &Threading) {
 #if WITH_FORBOC_NATIVE
+  EnsureBackendSearchPath();
   auto Utf8Path = StringCast<UTF8CHAR>(*Path);
+  const LlamaFacade::ThreadingParams Params = ToFacadeThreading(Threading);
   return reinterpret_cast<Context>(
-      LlamaFacade::LoadEmbeddingModel(Utf8Bytes(Utf8Path.Get())));
+      LlamaFacade::LoadEmbeddingModel(Utf8Bytes(Utf8Path.Get()), &Params));
 #else
   (void)Path;
+  (void)Threading;
   return nullptr;
 #endif
 }
 
+/**
+ * Re-applies CPU threading to a loaded context.
+ * User Story: As runtime tuning flows, I need thread counts and affinity
+ * changed on a live context so operators can rebalance without reloading.
+ */
+bool SetThreading(Context Ctx, const FCortexThreadingConfig &Threading) {
+#if WITH_FORBOC_NATIVE
+  const LlamaFacade::ThreadingParams Params = ToFacadeThreading(Threading);
+  return Ctx ? LlamaFacade::ApplyThreading(
+                   reinterpret_cast<struct llama_facade_context *>(Ctx),
+                   &Params)
+             : false;
+#else
+  (void)Ctx;
+  (void)Threading;
+  return false;
+#endif
+}
+
+/**
+ * Counts ggml threadpools the facade has created.
+ * User Story: As threading diagnostics, I need pool creation counted so tests
+ * can prove per-request threading reuses the pool already attached.
+ */
+int64 ThreadpoolCreations() {
+#if WITH_FORBOC_NATIVE
+  return static_cast<int64>(LlamaFacade::ThreadpoolCreations());
+#else
+  return 0;
+#endif
+}
+
+/**
+ * Installs or clears the abort flag polled by the generation loops.
+ * User Story: As cancellable inference, I need the flag forwarded to the
+ * facade so local generation stops at the next token after an abort.
+ */
+void SetAbortFlag(Context Ctx, const std::atomic<bool> *Flag) {
+#if WITH_FORBOC_NATIVE
+  LlamaFacade::SetAbortFlag(
+      reinterpret_cast<struct llama_facade_context *>(Ctx), Flag);
+#else
+  (void)Ctx;
+  (void)Flag;
+#endif
+}
+
+/**
+ * Reports host memory, cores and CPU backend SIMD features.
+ * User Story: As model variant selection, I need measured host capabilities so
+ * auto quantization does not guess from compile-time platform defines.
+ */
+FCortexHostCapabilities DetectHostCapabilities() {
+  FCortexHostCapabilities Caps;
+  Caps.AvailableMemoryBytes =
+      static_cast<int64>(FPlatformMemory::GetStats().AvailablePhysical);
+  Caps.PhysicalCores = FPlatformMisc::NumberOfCores();
+#if WITH_FORBOC_NATIVE
+  EnsureBackendSearchPath();
+  const unsigned Flags = LlamaFacade::CpuFeatureFlags();
+  Caps.bAvx2 = (Flags & LlamaFacade::CpuFeatureAvx2) != 0;
+  Caps.bAvx512 = (Flags & LlamaFacade::CpuFeatureAvx512) != 0;
+  Caps.bF16C = (Flags & LlamaFacade::CpuFeatureF16C) != 0;
+  Caps.bNeon = (Flags & LlamaFacade::CpuFeatureNeon) != 0;
+#else
+  Caps.bNeon = PLATFORM_CPU_ARM_FAMILY != 0;
+#endif
+  return Caps;
+}
+
+/**
+ * Requantizes a GGUF model through llama.cpp.
+ * User Story: As offline model preparation, I need requantization to use the
+ * same physical-core budget as inference so it does not starve the host.
+ */
+bool Quantize(const FString &SourcePath, const FString &OutPath, int32 FType,
+              bool bAllowRequantize) {
+#if WITH_FORBOC_NATIVE
+  EnsureBackendSearchPath();
+  auto Utf8In = StringCast<UTF8CHAR>(*SourcePath);
+  auto Utf8Out = StringCast<UTF8CHAR>(*OutPath);
+  return LlamaFacade::QuantizeModel(Utf8Bytes(Utf8In.Get()),
+                                    Utf8Bytes(Utf8Out.Get()), FType,
+                                    ResolveThreadCount(0), bAllowRequantize);
+#else
+  (void)SourcePath;
+  (void)OutPath;
+  (void)FType;
+  (void)bAllowRequantize;
+  return false;
+#endif
+}
+
 /**
  * Frees a previously loaded native model context.
  * User Story: As native-runtime teardown, I need loaded model contexts freed so
@@ -332,6 +925,9 @@ FString Infer(Context Ctx, const FString &Prompt, int32 MaxTokens) {
  * truncation is applied.
  */
 FString Infer(Context Ctx, const FString &Prompt, const FCortexConfig &Config) {
+  Ctx && Config.Threading.Threads > 0
+      ? (void)SetThreading(Ctx, Config.Threading)
+      : (void)0;
   return !Config.GbnfGrammar.IsEmpty()
              ?
 #if WITH_FORBOC_NATIVE
@@ -375,6 +971,9 @@ FString Infer(Context Ctx, const FString &Prompt, const FCortexConfig &Config) {
 FString InferStream(Context Ctx, const FString &Prompt,
                     const FCortexConfig &Config,
                     const TokenCallback &OnToken) {
+  Ctx && Config.Threading.Threads > 0
+      ? (void)SetThreading(Ctx, Config.Threading)
+      : (void)0;
   return !Ctx
              ? TEXT("Error: Model not loaded")
              :
@@ -451,14 +1050,17 @@ func::AsyncResult<FString> DownloadBinary(const FString &Url,
 
 namespace Sqlite {
 
+namespace {
+
 /**
  * Opens the sqlite-vec database handle for local memory storage.
  * User Story: As local-memory initialization, I need a sqlite-vec handle so
  * vector-backed memory rows can be persisted and queried locally. Relative
- * paths are normalized, traversal segments are rejected, and the vector table
- * is created before the handle is returned.
+ * paths are normalized, traversal segments are rejected, and the vector
+ * tables are created before the handle is returned.
  */
-DB Open(const FString &Path) {
+DB OpenWithStorage(const FString &Path, EVectorStorage Storage,
+                   bool bWarnOnMismatch) {
   const FString NormalizedPath = Path.IsEmpty()
                                      ? TEXT(":memory:")
                                      : FPaths::ConvertRelativePathToFull(Path);
@@ -487,14 +1089,33 @@ DB Open(const FString &Path) {
                                * extension uses the host sqlite3 API directly. */
                               sqlite3_vec_init(Db, nullptr, nullptr);
 
-                              const char *CreateSql =
-                                  "CREATE VIRTUAL TABLE IF NOT EXISTS memories "
-                                  "USING "
-                                  "vec0(embedding float[384], "
-                                  "+id text, +text text, +type text, "
-                                  "+importance float, +timestamp integer);";
-                              sqlite3_exec(Db, CreateSql, nullptr, nullptr,
-                                           nullptr);
+                              const EVectorStorage Effective =
+                                  PrepareStorageSchema(Db, Storage);
+                              (bWarnOnMismatch && Effective != Storage)
+                                  ? [&]() {
+                                      UE_LOG(LogTemp, Warning,
+                                             TEXT("ForbocAI: %s uses %s "
+                                                  "vector storage; requested "
+                                                  "%s. Run vector_migrate to "
+                                                  "convert."),
+                                             *NormalizedPath,
+                                             StorageName(Effective),
+                                             StorageName(Storage));
+                                    }()
+                                  : void();
+
+                              /* WAL lets pooled readers search while this
+                               * connection writes. In-memory databases keep
+                               * their default journal. */
+                              NormalizedPath != TEXT(":memory:")
+                                  ? (sqlite3_exec(
+                                         Db,
+                                         "PRAGMA journal_mode=WAL;"
+                                         "PRAGMA synchronous=NORMAL;",
+                                         nullptr, nullptr, nullptr),
+                                     void())
+                                  : void();
+                              sqlite3_busy_timeout(Db, BusyTimeoutMs);
                               return reinterpret_cast<DB>(Db);
                             }();
              }()
@@ -510,6 +1131,61 @@ DB Open(const FString &Path) {
       ;
 }
 
+} // namespace
+
+/**
+ * Opens the sqlite-vec database handle; new files use Float storage.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+DB Open(const FString &Path) { return Open(Path, EVectorStorage::Float); }
+
+/**
+ * Opens the sqlite-vec database handle with a storage mode for new files.
+ * User Story: As per-store configuration, I need the storage mode chosen at
+ * open so each database can be sized for its host.
+ */
+DB Open(const FString &Path, EVectorStorage Storage) {
+  return OpenWithStorage(Path, Storage, true);
+}
+
+/**
+ * Opens a read-only sqlite-vec connection for pooled recall.
+ * User Story: As concurrent vector recall, I need reader connections that
+ * share the writer's WAL file so each search gets its own connection. The
+ * connection skips sqlite's internal mutex because the pool hands it to one
+ * thread at a time.
+ */
+DB OpenReader(const FString &Path) {
+  const FString NormalizedPath = Path.IsEmpty()
+                                     ? TEXT(":memory:")
+                                     : FPaths::ConvertRelativePathToFull(Path);
+
+  return (NormalizedPath == TEXT(":memory:") ||
+          NormalizedPath.Contains(TEXT("..")))
+             ? static_cast<DB>(nullptr)
+             :
+#if WITH_FORBOC_SQLITE_VEC
+             [&]() -> DB {
+               sqlite3 *Db = nullptr;
+               const int Rc = sqlite3_open_v2(
+                   TCHAR_TO_UTF8(*NormalizedPath), &Db,
+                   SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, nullptr);
+               return (Rc != SQLITE_OK || !Db)
+                          ? (Db ? (sqlite3_close(Db), static_cast<DB>(nullptr))
+                                : static_cast<DB>(nullptr))
+                          : [&]() -> DB {
+                              sqlite3_vec_init(Db, nullptr, nullptr);
+                              sqlite3_busy_timeout(Db, BusyTimeoutMs);
+                              CacheStorage(Db, QueryStorage(Db));
+                              return reinterpret_cast<DB>(Db);
+                            }();
+             }()
+#else
+             static_cast<DB>(nullptr)
+#endif
+      ;
+}
+
 /**
  * Closes a sqlite-vec database handle created by Open.
  * User Story: As local-memory shutdown, I need opened sqlite handles closed so
@@ -537,6 +1213,11 @@ void Clear(DB Database) {
   Handle
       ? (sqlite3_exec(Handle, "DELETE FROM memories;", nullptr, nullptr,
                       nullptr),
+         ConnectionStorage(Handle) != EVectorStorage::Float
+             ? (sqlite3_exec(Handle, "DELETE FROM memory_vectors;", nullptr,
+                             nullptr, nullptr),
+                void())
+             : void(),
          void())
       : void();
 #else
@@ -578,44 +1259,109 @@ void ClearPath(const FString &Path) {
  */
 TArray<FMemoryItem> SearchRows(DB Database, const TArray<float> &Vector,
                                int32 TopK) {
-  TArray<FMemoryItem> Results;
 #if WITH_FORBOC_SQLITE_VEC
   sqlite3 *Handle = reinterpret_cast<sqlite3 *>(Database);
-  return !Handle
-             ? Results
-             : [&]() -> TArray<FMemoryItem> {
-                 const int32 Limit = TopK > 0 ? TopK : 10;
-                 const char *Sql =
-                     "SELECT id, text, type, importance, timestamp, distance "
-                     "FROM memories "
-                     "WHERE embedding MATCH ? "
-                     "ORDER BY distance "
-                     "LIMIT ?;";
-
-                 sqlite3_stmt *Stmt = nullptr;
-                 return sqlite3_prepare_v2(Handle, Sql, -1, &Stmt, nullptr) !=
-                                SQLITE_OK
-                            ? Results
-                            : [&]() -> TArray<FMemoryItem> {
-                                const FString JsonVec =
-                                    BuildJsonVector(Vector);
-
-                                sqlite3_bind_text(Stmt, 1,
-                                                  TCHAR_TO_UTF8(*JsonVec), -1,
-                                                  SQLITE_TRANSIENT);
-                                sqlite3_bind_int(Stmt, 2, Limit);
-                                CollectSearchRowsRecursive(Stmt, Results);
-
-                                sqlite3_finalize(Stmt);
-
-                                return Results;
-                              }();
+  return Handle ? RunSearch(Handle, Vector, TopK > 0 ? TopK : 10, false)
+                : TArray<FMemoryItem>();
+#else
+  (void)Database;
+  (void)Vector;
+  (void)TopK;
+  return TArray<FMemoryItem>();
+#endif
+}
+
+/**
+ * Ranks a candidate set. Weighted sorts by the weighted score; Mmr selects
+ * greedily over it; Similarity keeps the distance order. Scores only order
+ * results, so each item's Similarity stays the raw vector similarity that
+ * recall thresholds apply to.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+TArray<FMemoryItem> RankRecall(const TArray<FMemoryItem> &Candidates,
+                               int32 TopK, const FRecallScoring &Scoring) {
+  const int32 Keep = FMath::Clamp(TopK, 0, Candidates.Num());
+  TArray<double> Relevance;
+  Relevance.SetNumUninitialized(Candidates.Num());
+  std::transform(Candidates.GetData(),
+                 Candidates.GetData() + Candidates.Num(), Relevance.GetData(),
+                 [&Scoring](const FMemoryItem &Item) {
+                   return WeightedScore(Item, Scoring);
+                 });
+
+  TArray<int32> Order;
+  Scoring.Mode == ERecallScoring::Mmr
+      ? [&]() {
+          FMmrSelection Selection(
+              Candidates, Relevance,
+              FMath::Clamp(static_cast<double>(Scoring.MmrLambda), 0.0, 1.0));
+          Selection.Run(Keep);
+          Order = MoveTemp(Selection.Picked);
+        }()
+      : [&]() {
+          Order.SetNumUninitialized(Candidates.Num());
+          std::iota(Order.GetData(), Order.GetData() + Order.Num(), 0);
+          Scoring.Mode == ERecallScoring::Weighted
+              ? (void)std::stable_sort(Order.GetData(),
+                                       Order.GetData() + Order.Num(),
+                                       [&Relevance](int32 A, int32 B) {
+                                         return Relevance[A] > Relevance[B];
+                                       })
+              : void();
+          Order.SetNum(Keep);
+        }();
+
+  struct AppendInOrder {
+    static void apply(const TArray<FMemoryItem> &From,
+                      const TArray<int32> &Indices, int32 Index,
+                      TArray<FMemoryItem> &Out) {
+      Index < Indices.Num()
+          ? (Out.Add(From[Indices[Index]]), apply(From, Indices, Index + 1, Out))
+          : void();
+    }
+  };
+  TArray<FMemoryItem> Ranked;
+  Ranked.Reserve(Order.Num());
+  AppendInOrder::apply(Candidates, Order, 0, Ranked);
+  return Ranked;
+}
+
+/**
+ * Scored recall over an oversampled candidate set. Only Mmr reads candidate
+ * vectors; the returned items are stripped of them either way.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+TArray<FMemoryItem> SearchScored(DB Database, const TArray<float> &Vector,
+                                 int32 TopK, const FRecallScoring &Scoring) {
+#if WITH_FORBOC_SQLITE_VEC
+  struct StripEmbeddings {
+    static void apply(TArray<FMemoryItem> &Items, int32 Index) {
+      Index < Items.Num()
+          ? (Items[Index].Embedding.Empty(), apply(Items, Index + 1))
+          : void();
+    }
+  };
+  sqlite3 *Handle = reinterpret_cast<sqlite3 *>(Database);
+  const int32 Limit = TopK > 0 ? TopK : 10;
+  return !Handle ? TArray<FMemoryItem>()
+         : Scoring.Mode == ERecallScoring::Similarity
+             ? RunSearch(Handle, Vector, Limit, false)
+             : [&]() {
+                 TArray<FMemoryItem> Ranked = RankRecall(
+                     RunSearch(Handle, Vector,
+                               FMath::Min(Limit * RecallOversample,
+                                          MaxRecallCandidates),
+                               Scoring.Mode == ERecallScoring::Mmr),
+                     Limit, Scoring);
+                 StripEmbeddings::apply(Ranked, 0);
+                 return Ranked;
                }();
 #else
   (void)Database;
   (void)Vector;
   (void)TopK;
-  return Results;
+  (void)Scoring;
+  return TArray<FMemoryItem>();
 #endif
 }
 
@@ -645,6 +1391,37 @@ TArray<FMemoryItem> Search(DB Database, const TArray<float> &Vector,
   return SearchRows(Database, Vector, TopK);
 }
 
+/**
+ * Looks up one embedding by memory id. Float databases read the vec0 column
+ * directly (a point lookup, not a KNN scan); quantized ones read the cold
+ * table, since their search column holds only the compact vector.
+ * User Story: As lazy embedding fetch, I need one row read by id so export
+ * pays for the vectors it serializes and nothing else.
+ */
+TArray<float> FetchEmbedding(DB Database, const FString &Id) {
+  TArray<float> Vector;
+#if WITH_FORBOC_SQLITE_VEC
+  sqlite3 *Handle = reinterpret_cast<sqlite3 *>(Database);
+  sqlite3_stmt *Stmt = nullptr;
+  const char *Sql =
+      Handle && ConnectionStorage(Handle) == EVectorStorage::Float
+          ? "SELECT embedding FROM memories WHERE id = ?1 LIMIT 1;"
+          : "SELECT embedding FROM memory_vectors WHERE id = ?1;";
+  const bool bRow =
+      Handle && !Id.IsEmpty() &&
+      sqlite3_prepare_v2(Handle, Sql, -1, &Stmt, nullptr) == SQLITE_OK &&
+      sqlite3_bind_text(Stmt, 1, TCHAR_TO_UTF8(*Id), -1, SQLITE_TRANSIENT) ==
+          SQLITE_OK &&
+      sqlite3_step(Stmt) == SQLITE_ROW;
+  bRow ? (void)(Vector = ReadVectorColumn(Stmt, 0)) : void();
+  sqlite3_finalize(Stmt);
+#else
+  (void)Database;
+  (void)Id;
+#endif
+  return Vector;
+}
+
 /**
  * Upserts a memory item with an explicitly supplied embedding vector.
  * User Story: As local-memory writes, I need an explicit-vector upsert so
@@ -658,49 +1435,46 @@ bool Upsert(DB Database, const FMemoryItem &Item, const TArray<float> &Vector) {
              : Vector.Num() == 0
                    ? false
                    : [&]() -> bool {
-                       const char *Sql =
-                           "INSERT OR REPLACE INTO memories "
-                           "(id, text, type, importance, timestamp, embedding) "
-                           "VALUES (?, ?, ?, ?, ?, ?);";
-
-                       sqlite3_stmt *Stmt = nullptr;
-                       return sqlite3_prepare_v2(Handle, Sql, -1, &Stmt,
-                                                nullptr) != SQLITE_OK
-                                  ? false
-                                  : [&]() -> bool {
-                                      const FMemoryItem StoredItem =
-                                          PrepareStoredItem(Item);
-                                      const FString JsonVec =
-                                          BuildJsonVector(Vector);
-
-                                      sqlite3_bind_text(
-                                          Stmt, 1,
-                                          TCHAR_TO_UTF8(*StoredItem.Id), -1,
-                                          SQLITE_TRANSIENT);
-                                      sqlite3_bind_text(
-                                          Stmt, 2,
-                                          TCHAR_TO_UTF8(*StoredItem.Text), -1,
-                                          SQLITE_TRANSIENT);
-                                      sqlite3_bind_text(
-                                          Stmt, 3,
-                                          TCHAR_TO_UTF8(*StoredItem.Type), -1,
-                                          SQLITE_TRANSIENT);
-                                      sqlite3_bind_double(
-                                          Stmt, 4,
-                                          static_cast<double>(
-                                              StoredItem.Importance));
-                                      sqlite3_bind_int64(
-                                          Stmt, 5,
-                                          static_cast<sqlite3_int64>(
-                                              StoredItem.Timestamp));
-                                      sqlite3_bind_text(
-                                          Stmt, 6,
-                                          TCHAR_TO_UTF8(*JsonVec), -1,
-                                          SQLITE_TRANSIENT);
+                       const EVectorStorage Storage = ConnectionStorage(Handle);
+                       const FMemoryItem StoredItem = PrepareStoredItem(Item);
+                       const FString JsonVec = BuildJsonVector(Vector);
+                       const auto Bind = [&StoredItem,
+                                          &JsonVec](sqlite3_stmt *Stmt) {
+                         BindMemoryRow(Stmt, StoredItem, JsonVec);
+                       };
+                       const FString RowSql = FString::Printf(
+                           TEXT("INSERT OR REPLACE INTO memories "
+                                "(id, text, type, importance, timestamp, "
+                                "embedding) "
+                                "VALUES (?1, ?2, ?3, ?4, ?5, %s);"),
+                           *QuantizedValue(Storage, TEXT("vec_f32(?6)")));
 
+                       /**
+                        * Quantized rows and their cold fp32 vectors are
+                        * written together or not at all.
+                        * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+                        */
+                       return Storage == EVectorStorage::Float
+                                  ? RunStatement(Handle, RowSql, Bind)
+                                  : [&]() -> bool {
+                                      sqlite3_exec(Handle,
+                                                   "SAVEPOINT forboc_upsert;",
+                                                   nullptr, nullptr, nullptr);
                                       const bool bOk =
-                                          (sqlite3_step(Stmt) == SQLITE_DONE);
-                                      sqlite3_finalize(Stmt);
+                                          RunStatement(Handle, RowSql, Bind) &&
+                                          RunStatement(
+                                              Handle,
+                                              TEXT("INSERT OR REPLACE INTO "
+                                                   "memory_vectors "
+                                                   "(id, embedding) "
+                                                   "VALUES (?1, vec_f32(?6));"),
+                                              Bind);
+                                      sqlite3_exec(
+                                          Handle,
+                                          bOk ? "RELEASE forboc_upsert;"
+                                              : "ROLLBACK TO forboc_upsert;"
+                                                "RELEASE forboc_upsert;",
+                                          nullptr, nullptr, nullptr);
                                       return bOk;
                                     }();
                      }();
@@ -712,5 +1486,97 @@ bool Upsert(DB Database, const FMemoryItem &Item, const TArray<float> &Vector) {
 #endif
 }
 
+/**
+ * Reports the storage mode of an open database handle.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+EVectorStorage GetStorage(DB Database) {
+#if WITH_FORBOC_SQLITE_VEC
+  return Database ? ConnectionStorage(reinterpret_cast<sqlite3 *>(Database))
+                  : EVectorStorage::Float;
+#else
+  (void)Database;
+  return EVectorStorage::Float;
+#endif
+}
+
+/**
+ * Converts a database file to another storage mode. Rows are copied out with
+ * full-precision vectors, the search table is rebuilt for the target mode and
+ * refilled, all inside one savepoint.
+ * User Story: As operators switching storage modes, I need existing memories
+ * converted in place so a quantization change does not wipe NPC history.
+ */
+bool MigrateStorage(const FString &Path, EVectorStorage Target) {
+#if WITH_FORBOC_SQLITE_VEC
+  sqlite3 *Db =
+      reinterpret_cast<sqlite3 *>(OpenWithStorage(Path, Target, false));
+  return !Db
+             ? false
+             : [&]() -> bool {
+                 const EVectorStorage Current = ConnectionStorage(Db);
+                 const FString Script =
+                     Current == Target
+                         ? FString()
+                         : FString::Printf(
+                               TEXT("CREATE TEMP TABLE forboc_migrate_rows AS "
+                                    "%s;"
+                                    "DROP TABLE memories;"
+                                    "DROP TABLE IF EXISTS memory_vectors;"
+                                    "%s"
+                                    "INSERT INTO memories "
+                                    "(id, text, type, importance, timestamp, "
+                                    "embedding) "
+                                    "SELECT id, text, type, importance, "
+                                    "timestamp, %s "
+                                    "FROM temp.forboc_migrate_rows;"
+                                    "%s"
+                                    "INSERT OR REPLACE INTO forboc_meta "
+                                    "(key, value) "
+                                    "VALUES ('vector_storage', '%s');"
+                                    "DROP TABLE temp.forboc_migrate_rows;"),
+                               *FullPrecisionRowsSql(Current),
+                               *StorageSchemaSql(Target),
+                               *QuantizedValue(Target,
+                                               TEXT("vec_f32(embedding)")),
+                               Target != EVectorStorage::Float
+                                   ? TEXT("INSERT INTO memory_vectors "
+                                          "(id, embedding) "
+                                          "SELECT id, vec_f32(embedding) "
+                                          "FROM temp.forboc_migrate_rows;")
+                                   : TEXT(""),
+                               StorageName(Target));
+
+                 sqlite3_exec(Db, "SAVEPOINT forboc_migrate;", nullptr,
+                              nullptr, nullptr);
+                 char *Error = nullptr;
+                 const bool bOk =
+                     Script.IsEmpty() ||
+                     sqlite3_exec(Db, TCHAR_TO_UTF8(*Script), nullptr,
+                                  nullptr, &Error) == SQLITE_OK;
+                 sqlite3_exec(Db,
+                              bOk ? "RELEASE forboc_migrate;"
+                                  : "ROLLBACK TO forboc_migrate;"
+                                    "RELEASE forboc_migrate;",
+                              nullptr, nullptr, nullptr);
+                 !bOk ? [&]() {
+                   UE_LOG(LogTemp, Error,
+                          TEXT("ForbocAI: vector storage migration to %s "
+                               "failed: %s"),
+                          StorageName(Target),
+                          Error ? UTF8_TO_TCHAR(Error) : TEXT("unknown"));
+                 }()
+                      : void();
+                 sqlite3_free(Error);
+                 sqlite3_close(Db);
+                 return bOk;
+               }();
+#else
+  (void)Path;
+  (void)Target;
+  return false;
+#endif
+}
+
 } // namespace Sqlite
 } // namespace Native
@@ -0,0 +1,326 @@
+#include "RuntimeAsyncActions.h"
+#include "Async/Async.h"
+#include "CLI/CliOperations.h"
+#include "RuntimeStore.h"
+
+namespace {
+/**
+ * Returns the singleton store used by latent blueprint nodes.
+ * User Story: As latent blueprint nodes, I need the shared runtime store so
+ * async results update the same state the blocking nodes read.
+ */
+rtk::EnhancedStore<FStoreState> &GetAsyncStore() {
+  static rtk::EnhancedStore<FStoreState> Store = ConfigureStore();
+  return Store;
+}
+
+/**
+ * Runs Fn on the game thread, inline when already there.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void OnGameThread(TFunction<void()> Fn) {
+  IsInGameThread() ? Fn() : (AsyncTask(ENamedThreads::GameThread, MoveTemp(Fn)),
+                             void());
+}
+
+/**
+ * Executes a thunk result and routes its outcome to the node. The watch
+ * settles as soon as the node's signal aborts, even for requests that do not
+ * take the signal themselves. Handlers hold a weak pointer, so a node
+ * collected after cancel is simply skipped.
+ * User Story: As latent blueprint nodes, I need one watch helper so every
+ * node resolves on the game thread with the same lifetime rules.
+ */
+template <typename T, typename NodeT, typename DeliverFn>
+void Watch(NodeT *Node, const func::AsyncResult<T> &Result,
+           DeliverFn Deliver) {
+  const TWeakObjectPtr<NodeT> Weak(Node);
+  const func::AsyncResult<T> Watched =
+      func::abortable(Result, Node->GetAbortSignal());
+  Watched
+      .then([Weak, Deliver](T Value) {
+        OnGameThread([Weak, Deliver, Value]() {
+          Weak.IsValid() ? (Deliver(*Weak.Get(), Value), void()) : void();
+        });
+      })
+      .catch_([Weak](std::string Error) {
+        const FString Message = UTF8_TO_TCHAR(Error.c_str());
+        OnGameThread([Weak, Message]() {
+          Weak.IsValid() ? (Weak->Fail(Message), void()) : void();
+        });
+      });
+  Watched.execute();
+}
+
+/**
+ * Builds the protocol turn shared by the process and chat nodes.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+func::AsyncResult<FAgentResponse>
+DispatchProcessNpc(const FString &NpcId, const FString &Text,
+                   const func::AbortSignal &Signal) {
+  return GetAsyncStore().dispatch(rtk::processNPC(
+      NpcId, Text, TEXT("{}"), TEXT(""), FAgentState(),
+      rtk::LocalProtocolRuntime(Signal)));
+}
+} // namespace
+
+/**
+ * Fires the cancelled pin once, aborts the node's request and releases the
+ * node. The outcome slot is claimed first, so the rejection the abort causes
+ * fires nothing.
+ * User Story: As Blueprint gameplay flows, I need cancel to be idempotent so
+ * repeated cancels and late results cannot fire a second outcome.
+ */
+void UForbocAIAsyncAction::Cancel() {
+  TryFinish() ? (Abort.abort("Blueprint node cancelled"),
+                 OnCancelled.Broadcast(), SetReadyToDestroy(), void())
+              : void();
+}
+
+/**
+ * Reports whether no outcome has been delivered yet.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+bool UForbocAIAsyncAction::IsPending() const { return !bFinished; }
+
+/**
+ * Marks the node finished on first call only.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+bool UForbocAIAsyncAction::TryFinish() {
+  return bFinished ? false : (bFinished = true, true);
+}
+
+/**
+ * Fires the success pin with the string outcome.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void UForbocAIAsyncTextAction::Succeed(const FString &Result) {
+  TryFinish() ? (OnSuccess.Broadcast(Result, FString()), SetReadyToDestroy(),
+                 void())
+              : void();
+}
+
+/**
+ * Fires the failure pin with the error message.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void UForbocAIAsyncTextAction::Fail(const FString &Error) {
+  TryFinish() ? (OnFailure.Broadcast(FString(), Error), SetReadyToDestroy(),
+                 void())
+              : void();
+}
+
+/**
+ * Watches the stubbed result, delivering it as the success string.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+bool UForbocAIAsyncTextAction::WatchStubbedResult() {
+  return ResultStub ? (Watch(this, ResultStub(GetAbortSignal()),
+                             [](UForbocAIAsyncTextAction &Node,
+                                const FString &Result) {
+                               Node.Succeed(Result);
+                             }),
+                       true)
+                    : false;
+}
+
+/**
+ * Creates the latent process node.
+ * User Story: As blueprint interaction flows, I need a non-blocking protocol
+ * turn so NPC processing never stalls the frame.
+ */
+UForbocAIProcessNpcAsync *
+UForbocAIProcessNpcAsync::ProcessNpcAsync(UObject *WorldContextObject,
+                                          const FString &NpcId,
+                                          const FString &Text) {
+  UForbocAIProcessNpcAsync *Node = NewObject<UForbocAIProcessNpcAsync>();
+  Node->NpcId = NpcId;
+  Node->Text = Text;
+  Node->RegisterWithGameInstance(WorldContextObject);
+  return Node;
+}
+
+/**
+ * Dispatches the protocol turn and reports the dialogue.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void UForbocAIProcessNpcAsync::Activate() {
+  WatchStubbedResult()
+      ? void()
+      : Watch(this, DispatchProcessNpc(NpcId, Text, GetAbortSignal()),
+              [](UForbocAIProcessNpcAsync &Node, const FAgentResponse &Resp) {
+                Node.Succeed(Resp.Dialogue);
+              });
+}
+
+/**
+ * Creates the latent chat node.
+ * User Story: As blueprint chat flows, I need a non-blocking chat node so
+ * designers can wire dialogue into gameplay without multi-second freezes.
+ */
+UForbocAIChatNpcAsync *
+UForbocAIChatNpcAsync::ChatNpcAsync(UObject *WorldContextObject,
+                                    const FString &NpcId,
+                                    const FString &Message) {
+  UForbocAIChatNpcAsync *Node = NewObject<UForbocAIChatNpcAsync>();
+  Node->NpcId = NpcId;
+  Node->Message = Message;
+  Node->RegisterWithGameInstance(WorldContextObject);
+  return Node;
+}
+
+/**
+ * Dispatches the chat turn and reports the dialogue.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void UForbocAIChatNpcAsync::Activate() {
+  WatchStubbedResult()
+      ? void()
+      : Watch(this, DispatchProcessNpc(NpcId, Message, GetAbortSignal()),
+              [](UForbocAIChatNpcAsync &Node, const FAgentResponse &Resp) {
+                Node.Succeed(Resp.Dialogue);
+              });
+}
+
+/**
+ * Creates the latent soul export node.
+ * User Story: As blueprint soul-export flows, I need a non-blocking export so
+ * uploads run while gameplay continues.
+ */
+UForbocAIExportSoulAsync *
+UForbocAIExportSoulAsync::ExportSoulAsync(UObject *WorldContextObject,
+                                          const FString &NpcId) {
+  UForbocAIExportSoulAsync *Node = NewObject<UForbocAIExportSoulAsync>();
+  Node->NpcId = NpcId;
+  Node->RegisterWithGameInstance(WorldContextObject);
+  return Node;
+}
+
+/**
+ * Dispatches the remote export and reports the transaction id.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void UForbocAIExportSoulAsync::Activate() {
+  WatchStubbedResult()
+      ? void()
+      : Watch(this,
+              GetAsyncStore().dispatch(rtk::remoteExportSoulThunk(NpcId)),
+              [](UForbocAIExportSoulAsync &Node,
+                 const FSoulExportResult &Result) {
+                Node.Succeed(Result.TxId);
+              });
+}
+
+/**
+ * Creates the latent soul import node.
+ * User Story: As blueprint soul-import flows, I need a non-blocking import so
+ * restoring NPC data does not pause the game.
+ */
+UForbocAIImportSoulAsync *
+UForbocAIImportSoulAsync::ImportSoulAsync(UObject *WorldContextObject,
+                                          const FString &TxId) {
+  UForbocAIImportSoulAsync *Node = NewObject<UForbocAIImportSoulAsync>();
+  Node->TxId = TxId;
+  Node->RegisterWithGameInstance(WorldContextObject);
+  return Node;
+}
+
+/**
+ * Dispatches the import and reports the soul id.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void UForbocAIImportSoulAsync::Activate() {
+  WatchStubbedResult()
+      ? void()
+      : Watch(this,
+              GetAsyncStore().dispatch(rtk::importSoulFromArweaveThunk(TxId)),
+              [](UForbocAIImportSoulAsync &Node, const FSoul &Soul) {
+                Node.Succeed(Soul.Id);
+              });
+}
+
+/**
+ * Creates the latent ghost run node.
+ * User Story: As blueprint automation flows, I need a non-blocking ghost run
+ * so test sessions can start from gameplay tools without a hitch.
+ */
+UForbocAIGhostRunAsync *
+UForbocAIGhostRunAsync::GhostRunAsync(UObject *WorldContextObject,
+                                      const FString &TestSuite,
+                                      int32 Duration) {
+  UForbocAIGhostRunAsync *Node = NewObject<UForbocAIGhostRunAsync>();
+  Node->TestSuite = TestSuite;
+  Node->Duration = Duration;
+  Node->RegisterWithGameInstance(WorldContextObject);
+  return Node;
+}
+
+/**
+ * Dispatches the ghost start and reports the session id.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void UForbocAIGhostRunAsync::Activate() {
+  FGhostConfig Config;
+  Config.TestSuite = TestSuite;
+  Config.Duration = Duration;
+  WatchStubbedResult()
+      ? void()
+      : Watch(this,
+              GetAsyncStore().dispatch(
+                  rtk::startGhostThunk(Config, GetAbortSignal())),
+              [](UForbocAIGhostRunAsync &Node, const FGhostRunResponse &Resp) {
+                Node.Succeed(Resp.SessionId);
+              });
+}
+
+/**
+ * Creates the latent bridge validation node.
+ * User Story: As blueprint bridge-validation flows, I need a non-blocking
+ * validation node so rule checks can run inside gameplay graphs.
+ */
+UForbocAIValidateBridgeActionAsync *
+UForbocAIValidateBridgeActionAsync::ValidateBridgeActionAsync(
+    UObject *WorldContextObject, const FString &ActionJson) {
+  UForbocAIValidateBridgeActionAsync *Node =
+      NewObject<UForbocAIValidateBridgeActionAsync>();
+  Node->ActionJson = ActionJson;
+  Node->RegisterWithGameInstance(WorldContextObject);
+  return Node;
+}
+
+/**
+ * Dispatches the validation and reports the full result.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void UForbocAIValidateBridgeActionAsync::Activate() {
+  FAgentAction Action;
+  Action.PayloadJson = ActionJson;
+  Watch(this,
+        GetAsyncStore().dispatch(rtk::validateBridgeThunk(
+            Action, FBridgeValidationContext(), TEXT(""), GetAbortSignal())),
+        [](UForbocAIValidateBridgeActionAsync &Node,
+           const FValidationResult &Result) { Node.Succeed(Result); });
+}
+
+/**
+ * Fires the success pin with the validation result.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void UForbocAIValidateBridgeActionAsync::Succeed(
+    const FValidationResult &Result) {
+  TryFinish() ? (OnSuccess.Broadcast(Result, FString()), SetReadyToDestroy(),
+                 void())
+              : void();
+}
+
+/**
+ * Fires the failure pin with the error message.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+void UForbocAIValidateBridgeActionAsync::Fail(const FString &Error) {
+  TryFinish() ? (OnFailure.Broadcast(FValidationResult(), Error),
+                 SetReadyToDestroy(), void())
+              : void();
+}
@@ -1,3 +1,53 @@
+#include "Core/TimerWheel.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_MODULE(FDefaultModuleImpl, ForbocAI_SDK);
+namespace {
+/**
+ * Runs the process-wide timer service until the module stops it.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+class FTimerServiceRunnable final : public FRunnable {
+public:
+  virtual uint32 Run() override {
+    Timers::Run(Timers::Get());
+    return 0;
+  }
+
+  virtual void Stop() override { Timers::Stop(Timers::Get()); }
+};
+} // namespace
+
+/**
+ * ForbocAI SDK module. Owns the timer thread behind Timers::Get().
+ * User Story: As engine startup and shutdown, I need the SDK's background
+ * thread tied to the module lifetime so unloading the DLL never joins a
+ * thread from a static destructor.
+ */
+class FForbocAISDKModule final : public IModuleInterface {
+public:
+  virtual void StartupModule() override {
+    Timers::Restart(Timers::Get());
+    TimerRunnable = MakeUnique<FTimerServiceRunnable>();
+    TimerThread.Reset(FRunnableThread::Create(TimerRunnable.Get(),
+                                              TEXT("ForbocAITimers")));
+  }
+
+  /**
+   * Stops the service, which drops pending timers and wakes the loop; deleting
+   * the thread then waits for Run to return.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  virtual void ShutdownModule() override {
+    Timers::Stop(Timers::Get());
+    TimerThread.Reset();
+    TimerRunnable.Reset();
+  }
+
+private:
+  TUniquePtr<FTimerServiceRunnable> TimerRunnable;
+  TUniquePtr<FRunnableThread> TimerThread;
+};
+
+IMPLEMENT_MODULE(FForbocAISDKModule, ForbocAI_SDK);
@@ -4,7 +4,7 @@
 #include "Interfaces/IHttpResponse.h"
 #include "JsonObjectConverter.h"
 #include "RuntimeConfig.h"
-#include "RuntimeStore.h"
+#include "RuntimeFacade.h"
 #include "Serialization/JsonSerializer.h"
 #include "Soul/SoulSlice.h"
 #include "Soul/SoulThunks.h"
@@ -29,8 +29,16 @@ SoulOps::FromAgent(const FAgentState &State,
 
 SoulTypes::SoulSerializationResult SoulOps::Serialize(const FSoul &Soul) {
   try {
+    /**
+     * Memories taken from state carry no vectors; fetch them by id so the
+     * serialized soul is complete.
+     * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+     */
+    FSoul Complete = Soul;
+    Complete.Memories = rtk::detail::HydrateEmbeddings(Soul.Memories);
     FString JsonString;
-    return FJsonObjectConverter::UStructToJsonObjectString(Soul, JsonString)
+    return FJsonObjectConverter::UStructToJsonObjectString(Complete,
+                                                           JsonString)
                ? SoulTypes::make_right(FString(), JsonString)
                : SoulTypes::make_left(
                      FString(TEXT("Failed to serialize Soul to JSON")),
@@ -71,9 +79,7 @@ SoulTypes::SoulExportResult SoulOps::ExportToArweave(const FSoul &Soul,
       [Soul, ApiUrl](std::function<void(FSoulExportResult)> resolve,
                      std::function<void(std::string)> reject) {
         SDKConfig::SetApiConfig(ApiUrl, SDKConfig::GetApiKey());
-        auto Store = ConfigureStore();
-
-        Store.dispatch(rtk::exportSoulThunk(Soul))
+        FacadeDispatch::Run(rtk::exportSoulThunk(Soul))
             .then([resolve](const FSoulExportResult &Result) { resolve(Result); })
             .catch_([reject](std::string Error) { reject(Error); })
             .execute();
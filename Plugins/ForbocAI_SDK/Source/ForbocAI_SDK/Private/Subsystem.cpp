@@ -2,19 +2,24 @@
 #include "NPC/NPCSlice.h"
 #include "RuntimeConfig.h"
 #include "RuntimeStore.h"
+#include "Kismet/GameplayStatics.h"
 #include "Protocol/ProtocolThunks.h"
 #include "Soul/SoulThunks.h"
+#include "StoreSaveGame.h"
+#include "StoreSnapshot.h"
 
 /**
  * Initializes the runtime store and wires action middleware for broadcasts.
  * User Story: As game runtime startup, I need the subsystem to create and wire
  * the store so gameplay events can observe SDK state changes. This registers
  * the NPC-removal listener and the action-broadcast middleware before store
- * creation.
+ * creation, then starts the config file watcher and warm starts from the
+ * configured snapshot slot when one is set.
  */
 void UForbocAISubsystem::Initialize(FSubsystemCollectionBase &Collection) {
   Super::Initialize(Collection);
 
+  StoreInternal::InstallEffectRuntime();
   std::vector<rtk::Middleware<FStoreState>> Middlewares;
   Middlewares.push_back(createNpcRemovalListener());
 
@@ -31,14 +36,39 @@ void UForbocAISubsystem::Initialize(FSubsystemCollectionBase &Collection) {
   Store = MakeShared<rtk::EnhancedStore<FStoreState>>(
       rtk::configureStore<FStoreState>(&StoreReducer, FStoreState(),
                                        Middlewares));
+
+  SDKConfig::InitializeConfig();
+  SDKConfig::StartWatching();
+
+  const FString SnapshotSlot = SDKConfig::GetStoreSnapshotSlot();
+  !SnapshotSlot.IsEmpty() && UGameplayStatics::DoesSaveGameExist(SnapshotSlot, 0)
+      ? static_cast<void>(LoadStoreSnapshot(SnapshotSlot))
+      : void();
 }
 
 /**
- * Releases the runtime store during subsystem shutdown.
+ * Releases the runtime store during subsystem shutdown, saving it to the
+ * configured snapshot slot first when one is set.
  * User Story: As game runtime shutdown, I need the subsystem to release store
  * resources so teardown does not leak runtime state.
  */
 void UForbocAISubsystem::Deinitialize() {
+  const FString SnapshotSlot = SDKConfig::GetStoreSnapshotSlot();
+  !SnapshotSlot.IsEmpty() ? static_cast<void>(SaveStoreSnapshot(SnapshotSlot))
+                          : void();
+  SDKConfig::StopWatching();
+  struct CancelRuns {
+    static void apply(UForbocAISubsystem &Subsystem,
+                      const TArray<FString> &NpcIds, int32 Index) {
+      Index < NpcIds.Num()
+          ? (Subsystem.CancelNPC(NpcIds[Index]),
+             apply(Subsystem, NpcIds, Index + 1))
+          : void();
+    }
+  };
+  TArray<FString> RunningNpcs;
+  ActiveRuns.GetKeys(RunningNpcs);
+  CancelRuns::apply(*this, RunningNpcs, 0);
   Store.Reset();
   Super::Deinitialize();
 }
@@ -54,33 +84,64 @@ void UForbocAISubsystem::Init(FString ApiKey, FString ApiUrl) {
 }
 
 /**
- * Runs a protocol turn for an NPC and broadcasts dialogue or actions.
+ * Runs a protocol turn for an NPC and broadcasts dialogue or actions. A new
+ * turn aborts any run still in flight for the same NPC.
  * User Story: As gameplay interaction flows, I need NPC turns processed from
  * the subsystem so dialogue, typing, and action events are broadcast to game code.
  */
 void UForbocAISubsystem::ProcessNPC(FString NpcId, FString Input) {
   !Store.IsValid()
       ? void()
-      : (OnTypingStart.Broadcast(),
-         Store
-             ->dispatch(rtk::processNPC(NpcId, Input, TEXT("{}"), TEXT(""),
-                                        FAgentState(),
-                                        rtk::LocalProtocolRuntime()))
-             .then([this](const FAgentResponse &Result) {
-               !Result.Dialogue.IsEmpty()
-                   ? (OnMessageReceived.Broadcast(Result.Dialogue),
-                      OnTTSRequested.Broadcast(Result.Dialogue), void())
-                   : void();
-               !Result.Action.Type.IsEmpty()
-                   ? (OnNPCActionReceived.Broadcast(Result.Action), void())
-                   : void();
-               OnTypingEnd.Broadcast();
-             })
-             .catch_([this](std::string Error) {
-               static_cast<void>(Error);
-               OnTypingEnd.Broadcast();
-             })
-             .execute());
+      : [this, &NpcId, &Input]() {
+    CancelNPC(NpcId);
+    const func::AbortController Controller = func::createAbortController();
+    ActiveRuns.Add(NpcId, Controller);
+    const std::weak_ptr<func::AbortSignal::State> RunState =
+        Controller.signal.state;
+    const TWeakObjectPtr<UForbocAISubsystem> WeakThis(this);
+    const auto ReleaseRun = [WeakThis, NpcId, RunState]() {
+      const func::AbortController *Current =
+          WeakThis.IsValid() ? WeakThis->ActiveRuns.Find(NpcId) : nullptr;
+      Current && Current->signal.state == RunState.lock()
+          ? static_cast<void>(WeakThis->ActiveRuns.Remove(NpcId))
+          : void();
+    };
+    OnTypingStart.Broadcast();
+    Store
+        ->dispatch(rtk::processNPC(NpcId, Input, TEXT("{}"), TEXT(""),
+                                   FAgentState(),
+                                   rtk::LocalProtocolRuntime(
+                                       Controller.signal)))
+        .then([this, ReleaseRun](const FAgentResponse &Result) {
+          ReleaseRun();
+          !Result.Dialogue.IsEmpty()
+              ? (OnMessageReceived.Broadcast(Result.Dialogue),
+                 OnTTSRequested.Broadcast(Result.Dialogue), void())
+              : void();
+          !Result.Action.Type.IsEmpty()
+              ? (OnNPCActionReceived.Broadcast(Result.Action), void())
+              : void();
+          OnTypingEnd.Broadcast();
+        })
+        .catch_([this, ReleaseRun](std::string Error) {
+          static_cast<void>(Error);
+          ReleaseRun();
+          OnTypingEnd.Broadcast();
+        })
+        .execute();
+  }();
+}
+
+/**
+ * Aborts the tracked protocol run for an NPC, if any.
+ * User Story: As gameplay interaction flows, I need conversations cancelled
+ * by NPC id so abandoned turns stop consuming HTTP and inference time.
+ */
+void UForbocAISubsystem::CancelNPC(FString NpcId) {
+  func::AbortController Controller;
+  ActiveRuns.RemoveAndCopyValue(NpcId, Controller)
+      ? Controller.abort("NPC run cancelled")
+      : void();
 }
 
 /**
@@ -184,12 +245,65 @@ bool UForbocAISubsystem::GetLastImportedSoul(FSoul &OutSoul) const {
   }();
 }
 
+/**
+ * Writes a binary store snapshot into a save-game slot.
+ * User Story: As save flows, I need the store snapshot stored through the
+ * engine save system so platform save handling applies to SDK state.
+ */
+bool UForbocAISubsystem::SaveStoreSnapshot(FString SlotName, int32 UserIndex) {
+  return !Store.IsValid() ? false : [this, &SlotName, UserIndex]() -> bool {
+    UForbocAIStoreSaveGame *SaveGame = Cast<UForbocAIStoreSaveGame>(
+        UGameplayStatics::CreateSaveGameObject(
+            UForbocAIStoreSaveGame::StaticClass()));
+    return SaveGame
+               ? (SaveGame->Snapshot = StoreSnapshot::SaveStore(*Store),
+                  UGameplayStatics::SaveGameToSlot(SaveGame, SlotName,
+                                                   UserIndex))
+               : false;
+  }();
+}
+
+/**
+ * Restores the store from a snapshot held in a save-game slot.
+ * User Story: As load flows, I need a rejected or missing snapshot to leave the
+ * store untouched and report why, so a cold start remains possible.
+ */
+bool UForbocAISubsystem::LoadStoreSnapshot(FString SlotName, int32 UserIndex) {
+  return !Store.IsValid() ? false : [this, &SlotName, UserIndex]() -> bool {
+    const UForbocAIStoreSaveGame *SaveGame = Cast<UForbocAIStoreSaveGame>(
+        UGameplayStatics::LoadGameFromSlot(SlotName, UserIndex));
+    const func::Either<FString, StoreSnapshot::FRestoreReport> Restored =
+        SaveGame ? StoreSnapshot::RestoreStore(*Store, SaveGame->Snapshot)
+                 : func::make_left<FString, StoreSnapshot::FRestoreReport>(
+                       FString::Printf(TEXT("No store snapshot in slot %s"),
+                                       *SlotName));
+    Restored.isLeft ? [&Restored]() {
+      UE_LOG(LogTemp, Warning, TEXT("Store snapshot not restored: %s"),
+             *Restored.left);
+    }()
+                    : [&Restored, &SlotName]() {
+      UE_LOG(LogTemp, Log,
+             TEXT("Store snapshot restored from %s (%d sections, %d skipped)"),
+             *SlotName, Restored.right.RestoredSections.Num(),
+             Restored.right.SkippedSections.Num());
+    }();
+    return !Restored.isLeft;
+  }();
+}
+
 /**
  * Broadcasts selected store actions through the subsystem event delegates.
  * User Story: As gameplay event listeners, I need store actions translated
  * into delegates so blueprint and C++ subscribers can react to runtime changes.
  */
 void UForbocAISubsystem::HandleAction(const rtk::AnyAction &Action) {
+  NPCSlice::Actions::RemoveNPCActionCreator().match(Action)
+      ? [this, &Action]() {
+          const auto Payload =
+              NPCSlice::Actions::RemoveNPCActionCreator().extract(Action);
+          Payload.hasValue ? CancelNPC(Payload.value) : void();
+        }()
+      : void();
   NPCSlice::Actions::SetLastActionActionCreator().match(Action)
       ? [this, &Action]() {
           const auto Payload =
@@ -0,0 +1,332 @@
+/**
+ * Tests and microbenchmarks for functional_core.hpp §24 SharedLazy,
+ * ConcurrentMemo and SharedMemoizedLast
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+
+#include "Core/functional_core.hpp"
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+/** Runs Body on ThreadCount threads and returns the wall time in ms. */
+template <typename F> double TimeThreads(int32 ThreadCount, F Body) {
+  const auto Start = std::chrono::steady_clock::now();
+  std::vector<std::thread> Threads;
+  for (int32 Index = 0; Index < ThreadCount; ++Index) {
+    Threads.emplace_back(Body, Index);
+  }
+  for (std::thread &Thread : Threads) {
+    Thread.join();
+  }
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - Start)
+      .count();
+}
+
+/** Deliberately non-trivial derived value so cache hits are measurable. */
+uint64 Derive(uint64 Key) {
+  uint64 Hash = Key + 0x9E3779B97F4A7C15ull;
+  for (int32 Round = 0; Round < 200; ++Round) {
+    Hash = (Hash ^ (Hash >> 31)) * 0xBF58476D1CE4E5B9ull;
+  }
+  return Hash;
+}
+
+constexpr int32 BenchThreads = 8;
+constexpr int32 BenchCallsPerThread = 200000;
+constexpr uint64 BenchKeys = 512;
+} // namespace
+
+/**
+ * Test: SharedLazy evaluates once no matter how many threads force it
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSharedLazyOnceTest,
+                                 "ForbocAI.Core.FunctionalCore.SharedLazy.Once",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FSharedLazyOnceTest::RunTest(const FString &Parameters) {
+  std::atomic<int32> Evaluations(0);
+  const func::SharedLazy<std::vector<int32>> Table =
+      func::sharedLazy([&Evaluations]() {
+        ++Evaluations;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        return std::vector<int32>(64, 7);
+      });
+  const func::SharedLazy<std::vector<int32>> Copy = Table;
+
+  std::atomic<int32> Wrong(0);
+  TimeThreads(8, [&Table, &Copy, &Wrong](int32 Index) {
+    const std::vector<int32> &Value =
+        func::eval(Index % 2 == 0 ? Table : Copy);
+    if (Value.size() != 64 || Value[63] != 7) {
+      ++Wrong;
+    }
+  });
+
+  TestEqual("Evaluated exactly once", Evaluations.load(), 1);
+  TestEqual("Every thread saw the value", Wrong.load(), 0);
+  TestTrue("Copies share the evaluated value",
+           &func::eval(Table) == &func::eval(Copy));
+  return true;
+}
+
+/**
+ * Test: ConcurrentMemo caches, bounds each shard and evicts least recently
+ * used keys
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FConcurrentMemoBoundsTest,
+                                 "ForbocAI.Core.FunctionalCore.ConcurrentMemo.Bounds",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FConcurrentMemoBoundsTest::RunTest(const FString &Parameters) {
+  int32 Computations = 0;
+  const auto Square = [&Computations](const int32 &Key) {
+    ++Computations;
+    return Key * Key;
+  };
+  const func::ConcurrentMemo<int32, int32> Memo =
+      func::createConcurrentMemo<int32, int32>(2, 1);
+
+  TestEqual("Miss computes", *func::memoGetOrCompute(Memo, 3, Square), 9);
+  TestEqual("Hit reuses", *func::memoGetOrCompute(Memo, 3, Square), 9);
+  TestEqual("Computed once", Computations, 1);
+
+  func::memoGetOrCompute(Memo, 4, Square);
+  func::memoGetOrCompute(Memo, 3, Square);
+  const std::shared_ptr<const int32> Held = func::memoFind(Memo, 4);
+  func::memoGetOrCompute(Memo, 5, Square);
+
+  TestTrue("Recently used key kept", func::memoFind(Memo, 5) != nullptr);
+  TestTrue("Least recently used key evicted",
+           func::memoFind(Memo, 3) == nullptr);
+  TestTrue("Evicted values stay valid for holders", Held && *Held == 16);
+
+  const func::MemoCacheStats Stats = func::memoStats(Memo);
+  TestEqual("Size bounded by capacity", Stats.size, size_t(2));
+  TestEqual("One eviction", Stats.evictions, uint64_t(1));
+
+  func::memoClear(Memo);
+  TestEqual("Clear empties every shard", func::memoStats(Memo).size,
+            size_t(0));
+  return true;
+}
+
+/**
+ * Test: SharedLazy over a thunk returning a reference stores its own copy
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSharedLazyReferenceTest,
+                                 "ForbocAI.Core.FunctionalCore.SharedLazy.Reference",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FSharedLazyReferenceTest::RunTest(const FString &Parameters) {
+  std::vector<int32> Source(3, 5);
+  const func::SharedLazy<std::vector<int32>> Copied = func::sharedLazy(
+      [&Source]() -> const std::vector<int32> & { return Source; });
+
+  TestTrue("Value equals the referred value", func::eval(Copied) == Source);
+  TestTrue("Value is held by the cell, not referenced",
+           &func::eval(Copied) != &Source);
+  Source.push_back(9);
+  TestEqual("Later changes to the source are not seen",
+            func::eval(Copied).size(), size_t(3));
+  return true;
+}
+
+/**
+ * Test: each shard evicts in least-recently-used order across hits, misses
+ * and racing stores of an existing key
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FConcurrentMemoLruOrderTest,
+                                 "ForbocAI.Core.FunctionalCore.ConcurrentMemo.LruOrder",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FConcurrentMemoLruOrderTest::RunTest(const FString &Parameters) {
+  const auto Same = [](const int32 &Key) { return Key; };
+  const func::ConcurrentMemo<int32, int32> Memo =
+      func::createConcurrentMemo<int32, int32>(4, 1);
+
+  for (int32 Key = 1; Key <= 4; ++Key) {
+    func::memoGetOrCompute(Memo, Key, Same);
+  }
+  func::memoFind(Memo, 1);
+  func::memoGetOrCompute(Memo, 3, Same);
+  func::memoGetOrCompute(Memo, 5, Same);
+  TestTrue("Oldest untouched key evicted first",
+           func::memoFind(Memo, 2) == nullptr);
+  func::memoGetOrCompute(Memo, 6, Same);
+  TestTrue("Next oldest evicted second", func::memoFind(Memo, 4) == nullptr);
+
+  const int32 Kept[] = {1, 3, 5, 6};
+  for (const int32 Key : Kept) {
+    TestTrue(*FString::Printf(TEXT("Key %d kept"), Key),
+             func::memoFind(Memo, Key) != nullptr);
+  }
+
+  for (int32 Key = 7; Key < 1000; ++Key) {
+    func::memoGetOrCompute(Memo, Key, Same);
+  }
+  const func::MemoCacheStats Stats = func::memoStats(Memo);
+  TestEqual("Churn stays bounded", Stats.size, size_t(4));
+  TestEqual("Every overflow evicted one entry", Stats.evictions,
+            uint64_t(995));
+  TestTrue("Newest keys survive churn", func::memoFind(Memo, 999) != nullptr &&
+                                            func::memoFind(Memo, 996) != nullptr);
+
+  func::memoClear(Memo);
+  func::memoGetOrCompute(Memo, 1, Same);
+  TestEqual("Cache refills after clear", func::memoStats(Memo).size,
+            size_t(1));
+  return true;
+}
+
+/**
+ * Test: threads racing on the same keys all get the single stored value
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FConcurrentMemoRaceTest,
+                                 "ForbocAI.Core.FunctionalCore.ConcurrentMemo.Race",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FConcurrentMemoRaceTest::RunTest(const FString &Parameters) {
+  const func::ConcurrentMemo<uint64, uint64> Memo =
+      func::createConcurrentMemo<uint64, uint64>(4096);
+  std::vector<std::vector<const uint64 *>> Seen(
+      4, std::vector<const uint64 *>(64, nullptr));
+  std::atomic<int32> Wrong(0);
+
+  TimeThreads(4, [&Memo, &Seen, &Wrong](int32 Thread) {
+    for (uint64 Key = 0; Key < 64; ++Key) {
+      const std::shared_ptr<const uint64> Value = func::memoGetOrCompute(
+          Memo, Key, [](const uint64 &K) { return Derive(K); });
+      Seen[Thread][Key] = Value.get();
+      if (*Value != Derive(Key)) {
+        ++Wrong;
+      }
+    }
+  });
+
+  int32 Diverged = 0;
+  for (uint64 Key = 0; Key < 64; ++Key) {
+    for (int32 Thread = 1; Thread < 4; ++Thread) {
+      Diverged += Seen[Thread][Key] != Seen[0][Key] ? 1 : 0;
+    }
+  }
+  TestEqual("Values correct", Wrong.load(), 0);
+  TestEqual("Every thread shares the stored value", Diverged, 0);
+  return true;
+}
+
+/**
+ * Perf: SharedLazy and SharedMemoizedLast single-thread overhead against
+ * Lazy and MemoizedLast
+ * User Story: As a maintainer, I need the cost of the thread-safe variants
+ * measured so callers only pay it where values cross threads.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FConcurrentMemoSingleThreadPerf,
+                                 "ForbocAI.Perf.FunctionalCore.MemoSingleThread",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::PerfFilter)
+bool FConcurrentMemoSingleThreadPerf::RunTest(const FString &Parameters) {
+  const int32 Calls = BenchCallsPerThread * 4;
+  uint64 Sink = 0;
+
+  const func::Lazy<uint64> Plain = func::lazy([]() { return Derive(1); });
+  const func::SharedLazy<uint64> Shared =
+      func::sharedLazy([]() { return Derive(1); });
+  const double LazyMs = TimeThreads(1, [&Plain, &Sink, Calls](int32) {
+    for (int32 Call = 0; Call < Calls; ++Call) {
+      Sink += func::eval(Plain);
+    }
+  });
+  const double SharedLazyMs = TimeThreads(1, [&Shared, &Sink, Calls](int32) {
+    for (int32 Call = 0; Call < Calls; ++Call) {
+      Sink += func::eval(Shared);
+    }
+  });
+
+  const auto Memo = func::memoizeLast<uint64(uint64)>(&Derive);
+  const auto SharedMemo = func::memoizeLastShared<uint64(uint64)>(&Derive);
+  const double MemoMs = TimeThreads(1, [&Memo, &Sink, Calls](int32) {
+    for (int32 Call = 0; Call < Calls; ++Call) {
+      Sink += Memo(uint64(Call / 64));
+    }
+  });
+  const double SharedMemoMs = TimeThreads(1, [&SharedMemo, &Sink, Calls](int32) {
+    for (int32 Call = 0; Call < Calls; ++Call) {
+      Sink += SharedMemo(uint64(Call / 64));
+    }
+  });
+
+  AddInfo(FString::Printf(
+      TEXT("%d evals: Lazy %.2f ms, SharedLazy %.2f ms; memoizeLast %.2f ms, "
+           "memoizeLastShared %.2f ms (sink %llu)"),
+      Calls, LazyMs, SharedLazyMs, MemoMs, SharedMemoMs,
+      static_cast<unsigned long long>(Sink)));
+  TestTrue("Benchmarks ran", Sink != 0);
+  return true;
+}
+
+/**
+ * Perf: sharded ConcurrentMemo against one mutex-guarded map under
+ * BenchThreads threads of mostly-hit lookups
+ * User Story: As a maintainer, I need contention measured so the shard count
+ * default is backed by numbers rather than guesswork.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FConcurrentMemoContentionPerf,
+                                 "ForbocAI.Perf.FunctionalCore.MemoContention",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::PerfFilter)
+bool FConcurrentMemoContentionPerf::RunTest(const FString &Parameters) {
+  std::atomic<uint64> Sink(0);
+
+  std::mutex GlobalMutex;
+  std::unordered_map<uint64, uint64> Global;
+  const double GlobalMs =
+      TimeThreads(BenchThreads, [&GlobalMutex, &Global, &Sink](int32 Thread) {
+        uint64 Local = 0;
+        for (int32 Call = 0; Call < BenchCallsPerThread; ++Call) {
+          const uint64 Key = (uint64(Call) * 31 + Thread) % BenchKeys;
+          std::lock_guard<std::mutex> Lock(GlobalMutex);
+          auto Found = Global.find(Key);
+          Local += Found != Global.end()
+                       ? Found->second
+                       : Global.emplace(Key, Derive(Key)).first->second;
+        }
+        Sink += Local;
+      });
+
+  const func::ConcurrentMemo<uint64, uint64> Sharded =
+      func::createConcurrentMemo<uint64, uint64>(BenchKeys * 2);
+  const double ShardedMs =
+      TimeThreads(BenchThreads, [&Sharded, &Sink](int32 Thread) {
+        uint64 Local = 0;
+        for (int32 Call = 0; Call < BenchCallsPerThread; ++Call) {
+          const uint64 Key = (uint64(Call) * 31 + Thread) % BenchKeys;
+          Local += *func::memoGetOrCompute(
+              Sharded, Key, [](const uint64 &K) { return Derive(K); });
+        }
+        Sink += Local;
+      });
+
+  const func::MemoCacheStats Stats = func::memoStats(Sharded);
+  AddInfo(FString::Printf(
+      TEXT("%d threads x %d lookups over %llu keys: single mutex map %.2f ms, "
+           "ConcurrentMemo (%d shards) %.2f ms, hit rate %.4f"),
+      BenchThreads, BenchCallsPerThread,
+      static_cast<unsigned long long>(BenchKeys), GlobalMs,
+      static_cast<int32>(func::DefaultMemoShards), ShardedMs,
+      static_cast<double>(Stats.hits) /
+          static_cast<double>(Stats.hits + Stats.misses)));
+  TestEqual("Cache never evicted within capacity", Stats.evictions,
+            uint64_t(0));
+  TestTrue("Benchmarks ran", Sink.load() != 0);
+  return true;
+}
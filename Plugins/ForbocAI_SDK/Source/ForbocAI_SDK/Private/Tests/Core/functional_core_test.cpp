@@ -277,3 +277,283 @@ bool FRequireJustTest::RunTest(const FString &Parameters) {
 
   return true;
 }
+
+/**
+ * Test: StaticValidation — early exit, aggregation, in-place transforms
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FStaticValidationTest,
+    "ForbocAI.Core.FunctionalCore.StaticValidation",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FStaticValidationTest::RunTest(const FString &Parameters) {
+  auto positive = [](const int &v) {
+    return v > 0 ? func::nothing<std::string>()
+                 : func::just(std::string("not positive"));
+  };
+  auto even = [](const int &v) {
+    return v % 2 == 0 ? func::nothing<std::string>()
+                      : func::just(std::string("not even"));
+  };
+  auto checks = func::staticValidation<int, std::string>() |
+                func::check(positive) | func::check(even);
+
+  TestTrue("Valid input has no errors", func::validateRef(checks, 4).empty());
+
+  const std::vector<std::string> first = func::validateRef(checks, -3);
+  TestEqual("Early exit stops at first error", (int)first.size(), 1);
+  TestEqual("First error reported", first[0], std::string("not positive"));
+
+  const std::vector<std::string> all =
+      func::validateRef(checks, -3, func::ValidationMode::Aggregate);
+  TestEqual("Aggregate collects every error", (int)all.size(), 2);
+
+  auto clampThenCheck = func::staticValidation<int, std::string>() |
+                        func::transform([](int &v) { v = v < 0 ? -v : v; }) |
+                        func::check(even);
+  int value = -6;
+  TestTrue("Transform normalizes before check",
+           func::validateInPlace(clampThenCheck, value).empty());
+  TestEqual("Transform applied in place", value, 6);
+
+  auto either = func::runValidation(checks, 7);
+  TestTrue("Either adapter reports failure", either.isLeft);
+  TestEqual("Either adapter keeps message", either.left,
+            std::string("not even"));
+
+  return true;
+}
+
+namespace {
+
+/**
+ * Deferred work whose outcome the test decides later; records aborts.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FManualWork {
+  std::function<void(int)> resolve;
+  std::function<void(std::string)> reject;
+  bool bStarted = false;
+  bool bAborted = false;
+
+  func::AbortableWork<int> factory() {
+    return [this](const func::AbortSignal &Signal) {
+      Signal.onAbort([this](std::string) { bAborted = true; });
+      return func::AsyncResult<int>::create(
+          [this](std::function<void(int)> Resolve,
+                 std::function<void(std::string)> Reject) {
+            bStarted = true;
+            resolve = Resolve;
+            reject = Reject;
+          });
+    };
+  }
+};
+
+} // namespace
+
+/**
+ * Test: whenAll / whenAllSettled — ordered values, first error, settled view
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAsyncWhenAllTest, "ForbocAI.Core.FunctionalCore.Async.WhenAll",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FAsyncWhenAllTest::RunTest(const FString &Parameters) {
+  FManualWork Slow, Fast;
+  std::vector<func::AbortableWork<int>> Works;
+  Works.push_back(Slow.factory());
+  Works.push_back(Fast.factory());
+
+  std::vector<int> Values;
+  func::whenAll(Works)
+      .then([&Values](std::vector<int> Result) { Values = Result; })
+      .execute();
+  Fast.resolve(2);
+  TestTrue("Waits for every input", Values.empty());
+  Slow.resolve(1);
+  TestEqual("Resolves with every value", (int)Values.size(), 2);
+  TestTrue("Values keep input order", Values.size() == 2 && Values[0] == 1);
+
+  FManualWork Failing, Sibling;
+  std::vector<func::AbortableWork<int>> Doomed;
+  Doomed.push_back(Failing.factory());
+  Doomed.push_back(Sibling.factory());
+  std::string Error;
+  func::whenAll(Doomed)
+      .catch_([&Error](std::string E) { Error = E; })
+      .execute();
+  Failing.reject("boom");
+  TestEqual("First error rejects", Error, std::string("boom"));
+  TestTrue("Siblings aborted", Sibling.bAborted);
+
+  std::vector<func::AsyncResult<int>> Plain;
+  Plain.push_back(func::AsyncResult<int>::create(
+      [](std::function<void(int)> Resolve, std::function<void(std::string)>) {
+        Resolve(5);
+      }));
+  Plain.push_back(func::AsyncResult<int>::create(
+      [](std::function<void(int)>, std::function<void(std::string)> Reject) {
+        Reject("bad");
+      }));
+  std::vector<func::Either<std::string, int>> Outcomes;
+  func::whenAllSettled(Plain)
+      .then([&Outcomes](std::vector<func::Either<std::string, int>> Result) {
+        Outcomes = Result;
+      })
+      .execute();
+  TestEqual("Settled keeps every outcome", (int)Outcomes.size(), 2);
+  TestTrue("Success kept as right",
+           Outcomes.size() == 2 && !Outcomes[0].isLeft &&
+               Outcomes[0].right == 5);
+  TestTrue("Failure kept as left",
+           Outcomes.size() == 2 && Outcomes[1].isLeft &&
+               Outcomes[1].left == "bad");
+  return true;
+}
+
+/**
+ * Test: whenAny / race / timeout — winners, aggregated errors, loser aborts
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAsyncRaceTest, "ForbocAI.Core.FunctionalCore.Async.Race",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FAsyncRaceTest::RunTest(const FString &Parameters) {
+  FManualWork A, B;
+  std::vector<func::AbortableWork<int>> Works;
+  Works.push_back(A.factory());
+  Works.push_back(B.factory());
+  int Winner = 0;
+  func::whenAny(Works).then([&Winner](int V) { Winner = V; }).execute();
+  A.reject("a failed");
+  TestEqual("whenAny ignores a single failure", Winner, 0);
+  B.resolve(7);
+  TestEqual("whenAny resolves with first success", Winner, 7);
+
+  FManualWork C, D;
+  std::vector<func::AbortableWork<int>> AllFail;
+  AllFail.push_back(C.factory());
+  AllFail.push_back(D.factory());
+  std::string Aggregate;
+  func::whenAny(AllFail)
+      .catch_([&Aggregate](std::string E) { Aggregate = E; })
+      .execute();
+  D.reject("d failed");
+  C.reject("c failed");
+  TestEqual("Errors aggregated in input order", Aggregate,
+            std::string("All 2 tasks failed: [0] c failed; [1] d failed"));
+
+  FManualWork E, F;
+  std::vector<func::AbortableWork<int>> Racers;
+  Racers.push_back(E.factory());
+  Racers.push_back(F.factory());
+  std::string RaceError;
+  func::race(Racers)
+      .catch_([&RaceError](std::string Err) { RaceError = Err; })
+      .execute();
+  F.reject("f failed");
+  TestEqual("race settles on first failure", RaceError,
+            std::string("f failed"));
+  TestTrue("race aborts the loser", E.bAborted);
+
+  FManualWork Work;
+  std::function<void()> FireDeadline;
+  func::AbortableWork<void> Deadline = [&FireDeadline](
+                                           const func::AbortSignal &) {
+    return func::AsyncResult<void>::create(
+        [&FireDeadline](std::function<void()> Resolve,
+                        std::function<void(std::string)>) {
+          FireDeadline = Resolve;
+        });
+  };
+  std::string TimeoutError;
+  func::timeout(Work.factory(), Deadline)
+      .catch_([&TimeoutError](std::string Err) { TimeoutError = Err; })
+      .execute();
+  FireDeadline();
+  TestTrue("Deadline rejects with timeout",
+           func::isTimeoutError(TimeoutError));
+  TestTrue("Timed out work aborted", Work.bAborted);
+
+  func::AbortController Parent = func::createAbortController();
+  FManualWork G;
+  std::vector<func::AbortableWork<int>> Single;
+  Single.push_back(G.factory());
+  std::string ParentError;
+  func::whenAny(Single, Parent.signal)
+      .catch_([&ParentError](std::string Err) { ParentError = Err; })
+      .execute();
+  Parent.abort("left area");
+  TestTrue("Parent abort rejects the join",
+           func::isAbortError(ParentError));
+  TestTrue("Parent abort reaches inputs", G.bAborted);
+  return true;
+}
+
+/**
+ * Test: mapConcurrent — bounded in-flight calls, ordered results, fail fast
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FAsyncMapConcurrentTest,
+    "ForbocAI.Core.FunctionalCore.Async.MapConcurrent",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FAsyncMapConcurrentTest::RunTest(const FString &Parameters) {
+  std::vector<std::function<void(int)>> Pending;
+  int InFlight = 0;
+  int Peak = 0;
+  const std::vector<int> Items = {1, 2, 3, 4, 5};
+  std::vector<int> Doubled;
+  func::mapConcurrent(
+      Items, 2,
+      [&Pending, &InFlight, &Peak](const int &Item, const func::AbortSignal &) {
+        return func::AsyncResult<int>::create(
+            [&Pending, &InFlight, &Peak,
+             Item](std::function<void(int)> Resolve,
+                   std::function<void(std::string)>) {
+              ++InFlight;
+              Peak = InFlight > Peak ? InFlight : Peak;
+              Pending.push_back([Resolve, Item, &InFlight](int) {
+                --InFlight;
+                Resolve(Item * 2);
+              });
+            });
+      })
+      .then([&Doubled](std::vector<int> Result) { Doubled = Result; })
+      .execute();
+  TestEqual("Starts only up to the limit", (int)Pending.size(), 2);
+
+  // Complete out of order: newest first, until every item has run.
+  while (!Pending.empty()) {
+    std::function<void(int)> Next = Pending.back();
+    Pending.pop_back();
+    Next(0);
+  }
+  TestEqual("Never exceeds the limit", Peak, 2);
+  TestEqual("Maps every item", (int)Doubled.size(), 5);
+  TestTrue("Results keep item order",
+           Doubled.size() == 5 && Doubled[0] == 2 && Doubled[4] == 10);
+
+  int Launched = 0;
+  std::string Error;
+  func::mapConcurrent(
+      Items, 1,
+      [&Launched](const int &Item, const func::AbortSignal &) {
+        ++Launched;
+        return func::AsyncResult<int>::create(
+            [Item](std::function<void(int)> Resolve,
+                   std::function<void(std::string)> Reject) {
+              Item == 2 ? Reject("item 2 failed") : Resolve(Item);
+            });
+      })
+      .catch_([&Error](std::string E) { Error = E; })
+      .execute();
+  TestEqual("Failure rejects the map", Error, std::string("item 2 failed"));
+  TestEqual("No launches after a failure", Launched, 2);
+  return true;
+}
@@ -0,0 +1,195 @@
+/**
+ * Tests for the native handle manager — leases, hot swap and shutdown.
+ * User Story: As a maintainer, I need handle lifetimes covered so reloads and
+ * clears never free a handle that a worker thread is still using.
+ */
+
+#include "Core/NativeHandles.h"
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+int32 GReleasedCount = 0;
+
+void CountRelease(void *Handle) {
+  (void)Handle;
+  ++GReleasedCount;
+}
+
+} // namespace
+
+/**
+ * Test: swapped and retired handles are released only after their leases end
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNativeHandlesLifetimeTest,
+                                 "ForbocAI.Core.NativeHandles.Lifetime",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FNativeHandlesLifetimeTest::RunTest(const FString &Parameters) {
+  using namespace NativeHandles;
+  GReleasedCount = 0;
+  int32 First = 1;
+  int32 Second = 2;
+  int32 Third = 3;
+
+  FNativeSlot Slot;
+  TestFalse("Empty slot is not loaded", IsLoaded(Slot));
+  {
+    const FNativeLease Empty(Current(Slot), ELeaseMode::Shared);
+    TestFalse("Lease on an empty slot is falsy", static_cast<bool>(Empty));
+  }
+
+  Install(Slot, &First, &CountRelease);
+  TestTrue("Installed slot is loaded", IsLoaded(Slot));
+  {
+    const FNativeLease Held(Current(Slot), ELeaseMode::Exclusive);
+    Install(Slot, &Second, &CountRelease);
+    TestEqual("Swap keeps the leased handle alive", GReleasedCount, 0);
+    TestEqual("Lease still sees the old handle", Held.Get(),
+              static_cast<void *>(&First));
+    const FNativeLease Fresh(Current(Slot), ELeaseMode::Shared);
+    TestEqual("New leases see the new handle", Fresh.Get(),
+              static_cast<void *>(&Second));
+  }
+  TestEqual("Old handle released after its lease", GReleasedCount, 1);
+
+  {
+    const FNativeLease ReaderA(Current(Slot), ELeaseMode::Shared);
+    const FNativeLease ReaderB(Current(Slot), ELeaseMode::Shared);
+    TestTrue("Shared leases overlap",
+             static_cast<bool>(ReaderA) && static_cast<bool>(ReaderB));
+  }
+
+  const FResourceRef Retired = Retire(Slot);
+  TestFalse("Retired slot is empty", IsLoaded(Slot));
+  TestEqual("Retired resource is still referenced", GReleasedCount, 1);
+
+  int32 Cleared = 0;
+  Shutdown(Retired, [&Cleared](void *Handle) {
+    Cleared = *static_cast<int32 *>(Handle);
+  });
+  TestEqual("Shutdown runs the pre-release step", Cleared, 2);
+  TestEqual("Shutdown releases immediately", GReleasedCount, 2);
+  {
+    const FNativeLease Late(Retired, ELeaseMode::Shared);
+    TestFalse("Leases after shutdown see no handle", static_cast<bool>(Late));
+  }
+
+  Install(Slot, &Third, &CountRelease);
+  Retire(Slot);
+  TestEqual("Unleased retire releases at once", GReleasedCount, 3);
+  return true;
+}
+
+/**
+ * Test: pooled resources are handed out one per checkout and drained cleanly
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNativeHandlesPoolTest,
+                                 "ForbocAI.Core.NativeHandles.Pool",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FNativeHandlesPoolTest::RunTest(const FString &Parameters) {
+  using namespace NativeHandles;
+  GReleasedCount = 0;
+  int32 ReaderA = 1;
+  int32 ReaderB = 2;
+
+  FNativePool Pool;
+  {
+    const FPoolLease Empty(Pool);
+    TestFalse("Empty pool hands out nothing", static_cast<bool>(Empty));
+  }
+
+  TestEqual("Fill skips failed opens",
+            Fill(Pool, {&ReaderA, nullptr, &ReaderB}, &CountRelease), 2);
+  {
+    const FPoolLease First(Pool);
+    const FPoolLease Second(Pool);
+    TestTrue("Both readers checked out",
+             static_cast<bool>(First) && static_cast<bool>(Second));
+    TestNotEqual("Each checkout gets its own reader", First.Get(),
+                 Second.Get());
+    TestEqual("Checked-out readers are in use", Pool.InUse, 2);
+  }
+  TestEqual("Readers return to the pool", Pool.Idle.Num(), 2);
+  TestEqual("Returned readers stay open", GReleasedCount, 0);
+
+  {
+    const TArray<FResourceRef> Drained = Drain(Pool);
+    TestEqual("Drain takes every reader", Drained.Num(), 2);
+    const FPoolLease Late(Pool);
+    TestFalse("Drained pool hands out nothing", static_cast<bool>(Late));
+  }
+  TestEqual("Drained readers are released", GReleasedCount, 2);
+  return true;
+}
+
+/**
+ * Test: a checkout beyond the pool size blocks until a reader is returned,
+ * and a waiting checkout comes back empty when the pool is drained
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNativeHandlesPoolWaitTest,
+                                 "ForbocAI.Core.NativeHandles.PoolWait",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FNativeHandlesPoolWaitTest::RunTest(const FString &Parameters) {
+  using namespace NativeHandles;
+  int32 ReaderA = 1;
+  int32 ReaderB = 2;
+  FNativePool Pool;
+  Fill(Pool, {&ReaderA, &ReaderB}, FReleaseFn());
+
+  std::atomic<bool> bExtraGranted(false);
+  std::atomic<void *> ExtraHandle(nullptr);
+  void *ReturnedHandle = nullptr;
+  {
+    TUniquePtr<FPoolLease> First = MakeUnique<FPoolLease>(Pool);
+    const FPoolLease Second(Pool);
+    std::thread Extra([&Pool, &bExtraGranted, &ExtraHandle]() {
+      const FPoolLease Lease(Pool);
+      ExtraHandle = Lease.Get();
+      bExtraGranted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    TestFalse("Checkout beyond the pool size blocks", bExtraGranted.load());
+
+    ReturnedHandle = First->Get();
+    First.Reset();
+    Extra.join();
+    TestTrue("Blocked checkout proceeds after a release",
+             bExtraGranted.load());
+    TestEqual("Blocked checkout gets the returned reader", ExtraHandle.load(),
+              ReturnedHandle);
+  }
+
+  {
+    TUniquePtr<FPoolLease> HeldA = MakeUnique<FPoolLease>(Pool);
+    TUniquePtr<FPoolLease> HeldB = MakeUnique<FPoolLease>(Pool);
+    std::atomic<bool> bWaiterDone(false);
+    std::atomic<bool> bWaiterEmpty(false);
+    std::thread Waiter([&Pool, &bWaiterDone, &bWaiterEmpty]() {
+      const FPoolLease Lease(Pool);
+      bWaiterEmpty = !Lease;
+      bWaiterDone = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    TestFalse("Waiter blocks while the pool is busy", bWaiterDone.load());
+
+    std::thread Drainer([&Pool]() { Drain(Pool); });
+    Waiter.join();
+    TestTrue("Draining wakes waiters with an empty lease",
+             bWaiterEmpty.load());
+    HeldA.Reset();
+    HeldB.Reset();
+    Drainer.join();
+  }
+  TestEqual("Drained pool is empty", Pool.Idle.Num(), 0);
+  return true;
+}
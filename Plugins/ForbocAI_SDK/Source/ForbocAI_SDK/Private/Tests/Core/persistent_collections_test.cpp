@@ -0,0 +1,296 @@
+/**
+ * Tests for persistent collections — HAMT map, chunked vector, transients,
+ * and the persistent entity adapter backend.
+ * User Story: As a maintainer, I need structural sharing covered so a reducer
+ * update can never leak into a previous state version.
+ */
+
+#include "Core/PersistentCollections.h"
+#include "Core/rtk.hpp"
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "rtk_test_mocks.h"
+
+using namespace rtk;
+using namespace rtk::persistent;
+
+namespace {
+
+/** Key whose hash only has four values, to force full-hash collisions. */
+struct FCollidingKey {
+  int32 Value;
+
+  bool operator==(const FCollidingKey &Other) const {
+    return Value == Other.Value;
+  }
+};
+
+uint32 GetTypeHash(const FCollidingKey &Key) {
+  return static_cast<uint32>(Key.Value % 4);
+}
+
+} // namespace
+
+/**
+ * Test: map set/find/remove across many keys, old versions stay unchanged
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPersistentMapTest,
+                                 "ForbocAI.Core.Persistent.Map",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FPersistentMapTest::RunTest(const FString &Parameters) {
+  PersistentMap<FString, int32> Map;
+  for (int32 Index = 0; Index < 2000; ++Index) {
+    Map = Map.set(FString::FromInt(Index), Index);
+  }
+  TestEqual("All keys inserted", Map.size(), 2000);
+
+  bool bAllFound = true;
+  for (int32 Index = 0; Index < 2000; ++Index) {
+    const int32 *Found = Map.find(FString::FromInt(Index));
+    bAllFound = bAllFound && Found && *Found == Index;
+  }
+  TestTrue("Every key found with its value", bAllFound);
+  TestFalse("Missing key not found", Map.contains(TEXT("missing")));
+
+  const PersistentMap<FString, int32> Before = Map;
+  const PersistentMap<FString, int32> Replaced = Map.set(TEXT("7"), 700);
+  TestEqual("Replace keeps size", Replaced.size(), 2000);
+  TestEqual("Replace visible in new version", *Replaced.find(TEXT("7")), 700);
+  TestEqual("Old version unchanged", *Before.find(TEXT("7")), 7);
+
+  PersistentMap<FString, int32> Shrunk = Map;
+  for (int32 Index = 0; Index < 2000; Index += 2) {
+    Shrunk = Shrunk.remove(FString::FromInt(Index));
+  }
+  TestEqual("Half removed", Shrunk.size(), 1000);
+  TestFalse("Removed key gone", Shrunk.contains(TEXT("10")));
+  TestTrue("Kept key present", Shrunk.contains(TEXT("11")));
+  TestTrue("Source of removals unchanged", Map.contains(TEXT("10")));
+  TestTrue("Removing a missing key returns the same version",
+           Shrunk.remove(TEXT("10")).sameAs(Shrunk));
+
+  int32 Visited = 0;
+  int64 Sum = 0;
+  Shrunk.forEach([&](const FString &, int32 Value) {
+    ++Visited;
+    Sum += Value;
+  });
+  TestEqual("forEach visits every entry", Visited, 1000);
+  TestEqual("forEach sees every value", Sum, static_cast<int64>(1000000));
+
+  PersistentMap<FString, int32> Emptied = Shrunk;
+  for (int32 Index = 1; Index < 2000; Index += 2) {
+    Emptied = Emptied.remove(FString::FromInt(Index));
+  }
+  TestTrue("Removing every key empties the map", Emptied.isEmpty());
+  return true;
+}
+
+/**
+ * Test: keys with identical hashes share a collision node
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPersistentMapCollisionTest,
+                                 "ForbocAI.Core.Persistent.MapCollisions",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FPersistentMapCollisionTest::RunTest(const FString &Parameters) {
+  PersistentMap<FCollidingKey, int32> Map;
+  for (int32 Index = 0; Index < 64; ++Index) {
+    Map = Map.set(FCollidingKey{Index}, Index * 10);
+  }
+  TestEqual("Colliding keys all stored", Map.size(), 64);
+  TestEqual("Colliding key lookup", *Map.find(FCollidingKey{41}), 410);
+
+  const PersistentMap<FCollidingKey, int32> Replaced =
+      Map.set(FCollidingKey{41}, 1);
+  TestEqual("Collision replace keeps size", Replaced.size(), 64);
+  TestEqual("Collision replace visible", *Replaced.find(FCollidingKey{41}), 1);
+  TestEqual("Collision old version unchanged", *Map.find(FCollidingKey{41}),
+            410);
+
+  PersistentMap<FCollidingKey, int32> Shrunk = Map;
+  for (int32 Index = 0; Index < 63; ++Index) {
+    Shrunk = Shrunk.remove(FCollidingKey{Index});
+  }
+  TestEqual("Collision removals", Shrunk.size(), 1);
+  TestEqual("Last colliding key survives", *Shrunk.find(FCollidingKey{63}),
+            630);
+  return true;
+}
+
+/**
+ * Test: vector push, indexed set, insert and remove keep order and versions
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPersistentVectorTest,
+                                 "ForbocAI.Core.Persistent.Vector",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FPersistentVectorTest::RunTest(const FString &Parameters) {
+  PersistentVector<int32> Vector;
+  for (int32 Index = 0; Index < 5000; ++Index) {
+    Vector = Vector.pushBack(Index);
+  }
+  TestEqual("All items pushed", Vector.size(), 5000);
+  TestEqual("Indexed read", Vector[4321], 4321);
+
+  const PersistentVector<int32> Updated = Vector.set(100, -1);
+  TestEqual("set visible", Updated[100], -1);
+  TestEqual("set leaves old version", Vector[100], 100);
+
+  PersistentVector<int32> Evens = Vector;
+  for (int32 Index = 4999; Index >= 0; Index -= 2) {
+    Evens = Evens.removeAt(Index);
+  }
+  TestEqual("Odd positions removed", Evens.size(), 2500);
+  bool bOrdered = true;
+  for (int32 Index = 0; Index < Evens.size(); ++Index) {
+    bOrdered = bOrdered && Evens[Index] == Index * 2;
+  }
+  TestTrue("Remaining items keep order", bOrdered);
+  TestEqual("lowerBound on sorted items", Evens.lowerBound([](int32 Value) {
+    return Value < 1001;
+  }),
+            501);
+  TestEqual("lowerBound past the end",
+            Evens.lowerBound([](int32 Value) { return Value < 99999; }),
+            Evens.size());
+
+  const PersistentVector<int32> Inserted = Evens.insertAt(1, 1);
+  TestEqual("insertAt places item", Inserted[1], 1);
+  TestEqual("insertAt shifts later items", Inserted[2], 2);
+  TestEqual("insertAt leaves old version", Evens[1], 2);
+
+  PersistentVector<int32> Drained = Evens;
+  for (int32 Index = 0; Index < 2500; ++Index) {
+    Drained = Drained.removeAt(0);
+  }
+  TestTrue("Removing every item empties the vector", Drained.isEmpty());
+  TestEqual("toArray matches size", Evens.toArray().Num(), 2500);
+  return true;
+}
+
+/**
+ * Test: transients batch edits without touching the source version
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPersistentTransientTest,
+                                 "ForbocAI.Core.Persistent.Transient",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FPersistentTransientTest::RunTest(const FString &Parameters) {
+  PersistentMap<FString, int32> Base;
+  Base = Base.set(TEXT("a"), 1).set(TEXT("b"), 2);
+
+  PersistentMap<FString, int32>::Transient Edit = Base.transient();
+  for (int32 Index = 0; Index < 500; ++Index) {
+    Edit.set(FString::FromInt(Index), Index);
+  }
+  Edit.set(TEXT("a"), 100).remove(TEXT("b"));
+  const PersistentMap<FString, int32> First = Edit.persistent();
+  TestEqual("Transient result size", First.size(), 501);
+  TestEqual("Transient replace", *First.find(TEXT("a")), 100);
+  TestEqual("Source map untouched", Base.size(), 2);
+  TestEqual("Source value untouched", *Base.find(TEXT("a")), 1);
+
+  Edit.set(TEXT("a"), 200);
+  TestEqual("Edits after persistent() do not leak", *First.find(TEXT("a")),
+            100);
+  TestEqual("Transient keeps editing", *Edit.persistent().find(TEXT("a")), 200);
+
+  PersistentVector<int32> Items;
+  Items = Items.pushBack(1);
+  PersistentVector<int32>::Transient VectorEdit = Items.transient();
+  for (int32 Index = 2; Index <= 300; ++Index) {
+    VectorEdit.pushBack(Index);
+  }
+  VectorEdit.removeAt(0);
+  const PersistentVector<int32> Built = VectorEdit.persistent();
+  TestEqual("Vector transient size", Built.size(), 299);
+  TestEqual("Vector transient first item", Built[0], 2);
+  TestEqual("Source vector untouched", Items.size(), 1);
+  return true;
+}
+
+/**
+ * Test: the persistent entity adapter matches the map adapter
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPersistentEntityAdapterTest,
+                                 "ForbocAI.Core.Persistent.EntityAdapter",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FPersistentEntityAdapterTest::RunTest(const FString &Parameters) {
+  const auto Tier = [](const FNpcMockState &E) {
+    return E.Health >= 250 ? FString(TEXT("high")) : FString(TEXT("low"));
+  };
+  auto Adapter = withIndex(createPersistentEntityAdapter<FNpcMockState>(
+                               [](const FNpcMockState &E) { return E.Id; }),
+                           TEXT("tier"), Tier);
+  auto Selectors = Adapter.getSelectors();
+  auto State = Adapter.getInitialState();
+
+  State = Adapter.addMany(State, {FNpcMockState{TEXT("1"), 100},
+                                  FNpcMockState{TEXT("2"), 200},
+                                  FNpcMockState{TEXT("3"), 300}});
+  TestEqual("addMany total", Selectors.selectTotal(State), 3);
+  TestTrue("Insertion order kept",
+           Selectors.selectIds(State) ==
+               TArray<FString>({TEXT("1"), TEXT("2"), TEXT("3")}));
+
+  const auto Snapshot = State;
+  State = Adapter.addOne(State, FNpcMockState{TEXT("1"), 999});
+  TestEqual("addOne skips existing ids",
+            Selectors.selectById(State, TEXT("1")).value.Health, 100);
+
+  State = Adapter.upsertOne(State, FNpcMockState{TEXT("1"), 400});
+  TestEqual("upsert replaces", Selectors.selectById(State, TEXT("1")).value.Health,
+            400);
+  TestTrue("upsert keeps position",
+           Selectors.selectIds(State) ==
+               TArray<FString>({TEXT("1"), TEXT("2"), TEXT("3")}));
+  TestEqual("Earlier state untouched",
+            Selectors.selectById(Snapshot, TEXT("1")).value.Health, 100);
+  TestTrue("Index follows key change",
+           Selectors.selectIdsByIndex(State, TEXT("tier"), TEXT("high")) ==
+               TArray<FString>({TEXT("1"), TEXT("3")}));
+  TestTrue("Old bucket dropped id",
+           Selectors.selectIdsByIndex(State, TEXT("tier"), TEXT("low")) ==
+               TArray<FString>({TEXT("2")}));
+
+  State = Adapter.updateOne(State, TEXT("2"), [](const FNpcMockState &E) {
+    FNpcMockState Next = E;
+    Next.Health = 500;
+    return Next;
+  });
+  TestEqual("updateOne patch", Selectors.selectById(State, TEXT("2")).value.Health,
+            500);
+  TestEqual("Empty bucket reads empty",
+            Selectors.selectByIndex(State, TEXT("tier"), TEXT("low")).Num(), 0);
+
+  State = Adapter.removeMany(State, {TEXT("1"), TEXT("missing")});
+  TestTrue("removeMany drops from order",
+           Selectors.selectIds(State) ==
+               TArray<FString>({TEXT("2"), TEXT("3")}));
+  TestEqual("removeMany drops from index",
+            Selectors.selectByIndex(State, TEXT("tier"), TEXT("high")).Num(),
+            2);
+
+  TArray<FNpcMockState> Many;
+  for (int32 Index = 0; Index < 1000; ++Index) {
+    Many.Add(FNpcMockState{FString::FromInt(Index), Index});
+  }
+  State = Adapter.setAll(State, Many);
+  TestEqual("setAll replaces", Selectors.selectTotal(State), 1000);
+  TestEqual("setAll order", Selectors.selectAll(State)[999].Health, 999);
+  TestEqual("Index over a large set",
+            Selectors.selectIdsByIndex(State, TEXT("tier"), TEXT("low")).Num(),
+            250);
+
+  State = Adapter.removeAll(State);
+  TestEqual("removeAll empties", Selectors.selectTotal(State), 0);
+  return true;
+}
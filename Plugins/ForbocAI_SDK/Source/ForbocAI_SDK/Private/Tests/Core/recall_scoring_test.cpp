@@ -0,0 +1,102 @@
+/**
+ * Tests for recall scoring — weighted ranking and MMR diversity over a
+ * candidate set.
+ * User Story: As a maintainer, I need recall ranking covered so recency,
+ * importance and diversity rules order memories the way configs promise.
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "NativeEngine.h"
+
+namespace {
+
+FMemoryItem MakeCandidate(const TCHAR *Id, float Similarity, float Importance,
+                          int64 Timestamp, TArray<float> Embedding) {
+  FMemoryItem Item;
+  Item.Id = Id;
+  Item.Similarity = Similarity;
+  Item.Importance = Importance;
+  Item.Timestamp = Timestamp;
+  Item.Embedding = MoveTemp(Embedding);
+  return Item;
+}
+
+} // namespace
+
+/**
+ * Test: weighted scoring favours important, recent memories over raw distance
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRecallScoringWeightedTest,
+                                 "ForbocAI.Core.RecallScoring.Weighted",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRecallScoringWeightedTest::RunTest(const FString &Parameters) {
+  using namespace Native::Sqlite;
+  const int64 Now = 1000000;
+  const TArray<FMemoryItem> Candidates = {
+      MakeCandidate(TEXT("close_old"), 0.95f, 0.5f, Now - 864000, {}),
+      MakeCandidate(TEXT("close_trivial"), 0.9f, 0.1f, Now, {}),
+      MakeCandidate(TEXT("fresh_vital"), 0.8f, 0.9f, Now - 60, {}),
+  };
+
+  FRecallScoring Scoring;
+  Scoring.NowSeconds = Now;
+  Scoring.RecencyTauSeconds = 86400.0;
+
+  const TArray<FMemoryItem> ByDistance = RankRecall(Candidates, 2, Scoring);
+  TestEqual("Similarity keeps two", ByDistance.Num(), 2);
+  TestEqual("Similarity keeps distance order", ByDistance[0].Id,
+            FString(TEXT("close_old")));
+
+  Scoring.Mode = ERecallScoring::Weighted;
+  const TArray<FMemoryItem> Weighted = RankRecall(Candidates, 3, Scoring);
+  TestEqual("Fresh important memory first", Weighted[0].Id,
+            FString(TEXT("fresh_vital")));
+  TestEqual("Ten-day-old memory decays last", Weighted[2].Id,
+            FString(TEXT("close_old")));
+  TestEqual("Similarity is left as the raw value", Weighted[0].Similarity,
+            0.8f);
+
+  Scoring.RecencyTauSeconds = 0.0;
+  const TArray<FMemoryItem> NoDecay = RankRecall(Candidates, 1, Scoring);
+  TestEqual("Without decay importance x similarity decides", NoDecay[0].Id,
+            FString(TEXT("fresh_vital")));
+  TestEqual("TopK larger than the set is clamped",
+            RankRecall(Candidates, 10, Scoring).Num(), 3);
+  return true;
+}
+
+/**
+ * Test: MMR skips a near-duplicate in favour of a distinct memory
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRecallScoringMmrTest,
+                                 "ForbocAI.Core.RecallScoring.Mmr",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRecallScoringMmrTest::RunTest(const FString &Parameters) {
+  using namespace Native::Sqlite;
+  const TArray<FMemoryItem> Candidates = {
+      MakeCandidate(TEXT("dragon"), 0.9f, 0.5f, 0, {1.0f, 0.0f, 0.0f}),
+      MakeCandidate(TEXT("dragon_again"), 0.89f, 0.5f, 0, {0.99f, 0.1f, 0.0f}),
+      MakeCandidate(TEXT("bridge"), 0.7f, 0.5f, 0, {0.0f, 1.0f, 0.0f}),
+  };
+
+  FRecallScoring Scoring;
+  Scoring.Mode = ERecallScoring::Mmr;
+  Scoring.MmrLambda = 0.5f;
+
+  const TArray<FMemoryItem> Diverse = RankRecall(Candidates, 2, Scoring);
+  TestEqual("MMR keeps two", Diverse.Num(), 2);
+  TestEqual("Most relevant first", Diverse[0].Id, FString(TEXT("dragon")));
+  TestEqual("Distinct memory beats the near-duplicate", Diverse[1].Id,
+            FString(TEXT("bridge")));
+
+  Scoring.MmrLambda = 1.0f;
+  const TArray<FMemoryItem> Relevant = RankRecall(Candidates, 2, Scoring);
+  TestEqual("Lambda 1 is pure relevance", Relevant[1].Id,
+            FString(TEXT("dragon_again")));
+  return true;
+}
@@ -0,0 +1,139 @@
+#include "Core/rtk.hpp"
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "rtk_test_mocks.h"
+
+using namespace rtk;
+
+/**
+ * Test: abort controllers notify listeners once and wrap pending work
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkAbortSignalTest,
+                                 "ForbocAI.Core.RTK.AbortSignal",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkAbortSignalTest::RunTest(const FString &Parameters) {
+  TestFalse("Default signal never aborts", func::AbortSignal().aborted());
+
+  func::AbortController Controller = func::createAbortController();
+  int32 Calls = 0;
+  std::string Seen;
+  Controller.signal.onAbort([&Calls, &Seen](std::string Reason) {
+    ++Calls;
+    Seen = Reason;
+  });
+  auto Remove = Controller.signal.onAbort([&Calls](std::string) { ++Calls; });
+  Remove();
+
+  Controller.abort("player left");
+  Controller.abort("again");
+  TestTrue("Signal aborted", Controller.signal.aborted());
+  TestEqual("Listener ran once, removed listener skipped", Calls, 1);
+  TestTrue("Reason kept", Seen == "player left");
+  TestTrue("Flag mirrors state", Controller.signal.flag()->load());
+
+  bool bLateCalled = false;
+  Controller.signal.onAbort(
+      [&bLateCalled](std::string) { bLateCalled = true; });
+  TestTrue("Late listener runs immediately", bLateCalled);
+
+  TestTrue("Abort message recognized",
+           func::isAbortError(func::abortMessage("player left")));
+  TestFalse("Other errors not treated as aborts",
+            func::isAbortError("AbortedSomething"));
+
+  /**
+   * Pending work settles with an abort rejection the moment abort fires.
+   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
+   */
+  std::function<void(int)> HeldResolve;
+  const func::AsyncResult<int> Pending = func::AsyncResult<int>::create(
+      [&HeldResolve](std::function<void(int)> Resolve,
+                     std::function<void(std::string)>) {
+        HeldResolve = Resolve;
+      });
+  func::AbortController Live = func::createAbortController();
+  bool bResolved = false;
+  std::string Rejection;
+  func::abortable(Pending, Live.signal)
+      .then([&bResolved](int) { bResolved = true; })
+      .catch_([&Rejection](std::string Error) { Rejection = Error; })
+      .execute();
+  Live.abort();
+  if (HeldResolve) {
+    HeldResolve(7);
+  }
+  TestFalse("Late completion dropped", bResolved);
+  TestTrue("Rejected as aborted", func::isAbortError(Rejection));
+  return true;
+}
+
+/**
+ * Test: aborted async thunks dispatch rejected and never fulfilled
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkAbortThunkTest,
+                                 "ForbocAI.Core.RTK.AbortThunk",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkAbortThunkTest::RunTest(const FString &Parameters) {
+  std::function<void(int)> HeldResolve;
+  bool bSawSignal = false;
+  int32 PayloadRuns = 0;
+  auto SlowThunk = createAsyncThunk<int, FString, FAppMockState>(
+      TEXT("test/slow"),
+      [&HeldResolve, &bSawSignal, &PayloadRuns](
+          const FString &, const ThunkApi<FAppMockState> &Api) {
+        ++PayloadRuns;
+        bSawSignal = static_cast<bool>(Api.signal.state);
+        return func::AsyncResult<int>::create(
+            [&HeldResolve](std::function<void(int)> Resolve,
+                           std::function<void(std::string)>) {
+              HeldResolve = Resolve;
+            });
+      });
+
+  TArray<AnyAction> Dispatched;
+  std::function<AnyAction(const AnyAction &)> MockDispatch =
+      [&Dispatched](const AnyAction &Action) {
+        Dispatched.Add(Action);
+        return Action;
+      };
+  std::function<FAppMockState()> MockGetState = []() {
+    return FAppMockState{};
+  };
+
+  func::AbortController Controller = func::createAbortController();
+  SlowThunk(TEXT("arg"), Controller.signal)(MockDispatch, MockGetState)
+      .execute();
+  TestTrue("Payload creator received the signal", bSawSignal);
+  Controller.abort();
+  if (HeldResolve) {
+    HeldResolve(42);
+  }
+
+  TestEqual("Pending then rejected", Dispatched.Num(), 2);
+  TestTrue("Rejected dispatched", SlowThunk.rejected.match(Dispatched.Last()));
+  TestTrue("Rejection flagged as abort",
+           SlowThunk.isAborted(Dispatched.Last()));
+
+  /**
+   * A thunk aborted before it runs never calls its payload creator.
+   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
+   */
+  Dispatched.Empty();
+  SlowThunk(TEXT("arg"), Controller.signal)(MockDispatch, MockGetState)
+      .execute();
+  TestEqual("Payload creator skipped", PayloadRuns, 1);
+  TestTrue("Rejected without running",
+           Dispatched.Num() == 2 && SlowThunk.isAborted(Dispatched.Last()));
+
+  /**
+   * Plain failures are not reported as aborts.
+   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
+   */
+  TestFalse("Plain rejection is not an abort",
+            SlowThunk.isAborted(SlowThunk.rejected(TEXT("Mock error"))));
+  return true;
+}
@@ -45,3 +45,58 @@ bool FRtkEntityAdapterTest::RunTest(const FString &Parameters) {
 
   return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkEntityIndexTest,
+                                 "ForbocAI.Core.RTK.EntityIndex",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkEntityIndexTest::RunTest(const FString &Parameters) {
+  auto Adapter = withIndex(
+      createEntityAdapter<FNpcMockState>(
+          [](const FNpcMockState &E) { return E.Id; }),
+      TEXT("tier"), [](const FNpcMockState &E) {
+        return E.Health >= 250 ? FString(TEXT("high")) : FString(TEXT("low"));
+      });
+  auto Selectors = Adapter.getSelectors();
+  auto State = Adapter.addMany(Adapter.getInitialState(),
+                               {FNpcMockState{TEXT("1"), 100},
+                                FNpcMockState{TEXT("2"), 300},
+                                FNpcMockState{TEXT("3"), 200}});
+
+  TestEqual("low bucket ids",
+            Selectors.selectIdsByIndex(State, TEXT("tier"), TEXT("low")),
+            TArray<FString>({TEXT("1"), TEXT("3")}));
+  TestEqual("high bucket entities",
+            Selectors.selectByIndex(State, TEXT("tier"), TEXT("high")).Num(),
+            1);
+
+  State = Adapter.updateOne(State, TEXT("3"), [](const FNpcMockState &E) {
+    return FNpcMockState{E.Id, 400};
+  });
+  TestEqual("update moves bucket",
+            Selectors.selectIdsByIndex(State, TEXT("tier"), TEXT("high")),
+            TArray<FString>({TEXT("2"), TEXT("3")}));
+
+  State = Adapter.setOne(State, FNpcMockState{TEXT("1"), 150});
+  TestEqual("same-key set keeps order",
+            Selectors.selectIdsByIndex(State, TEXT("tier"), TEXT("low")),
+            TArray<FString>({TEXT("1")}));
+
+  State = Adapter.removeMany(State, {TEXT("1"), TEXT("missing")});
+  TestEqual("removeMany keeps remaining order", Selectors.selectIds(State),
+            TArray<FString>({TEXT("2"), TEXT("3")}));
+  TestFalse("empty bucket dropped",
+            State.indexes.FindRef(TEXT("tier")).Contains(TEXT("low")));
+  TestEqual("unknown key is empty",
+            Selectors.selectIdsByIndex(State, TEXT("tier"), TEXT("mid")).Num(),
+            0);
+
+  State = Adapter.setAll(State, {FNpcMockState{TEXT("9"), 10}});
+  TestEqual("setAll rebuilds index",
+            Selectors.selectIdsByIndex(State, TEXT("tier"), TEXT("low")),
+            TArray<FString>({TEXT("9")}));
+  TestEqual("setAll drops stale buckets",
+            Selectors.selectIdsByIndex(State, TEXT("tier"), TEXT("high")).Num(),
+            0);
+  return true;
+}
@@ -138,3 +138,74 @@ bool FRtkConfigureStoreTest::RunTest(const FString &Parameters) {
 
   return true;
 }
+
+/**
+ * Test: action payloads are stored inline or pooled and read back by type
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkActionPayloadTest,
+                                 "ForbocAI.Core.RTK.ActionPayload",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkActionPayloadTest::RunTest(const FString &Parameters) {
+  const EmptyActionCreator Started = createAction(TEXT("test/started"));
+  const ActionCreator<int32> Progress =
+      createAction<int32>(TEXT("test/progress"));
+  const ActionCreator<FString> Token = createAction<FString>(TEXT("test/token"));
+
+  TestTrue("Empty payload is inline", Started().PayloadStorage.IsInline());
+  const AnyAction Step = Progress(42);
+  TestTrue("Scalar payload is inline", Step.PayloadStorage.IsInline());
+  TestEqual("Scalar payload reads back", Progress.extract(Step).value, 42);
+  TestFalse("Mismatched type reads nothing",
+            Step.getPayload<float>().hasValue);
+
+  const AnyAction Text = Token(TEXT("dragon"));
+  TestFalse("String payload is pooled", Text.PayloadStorage.IsInline());
+  const AnyAction Copy = Text;
+  TestTrue("Copies share the pooled value",
+           Copy.peekPayload<FString>() == Text.peekPayload<FString>());
+  TestEqual("Pooled payload reads back", Token.extract(Copy).value,
+            FString(TEXT("dragon")));
+
+  const FString *Released = nullptr;
+  {
+    const AnyAction Temp = Token(TEXT("first"));
+    Released = Temp.peekPayload<FString>();
+  }
+  const AnyAction Reused = Token(TEXT("second"));
+  TestTrue("Released block is reused on this thread",
+           Reused.peekPayload<FString>() == Released);
+
+  const AnyAction Legacy(TEXT("test/legacy"), std::make_shared<int32>(7));
+  TestEqual("shared_ptr construction still works",
+            Legacy.getPayload<int32>().value, 7);
+  return true;
+}
+
+/**
+ * Test: payload type ids agree across translation units and tell types apart
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkPayloadTypeIdTest,
+                                 "ForbocAI.Core.RTK.PayloadTypeId",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkPayloadTypeIdTest::RunTest(const FString &Parameters) {
+  static_assert(PayloadTypeId<int32>() != PayloadTypeId<uint32>(),
+                "Ids are compile-time constants that tell types apart");
+
+  TestTrue("Id from another translation unit matches",
+           PayloadProbe::MockStateTypeId() == PayloadTypeId<FNpcMockState>());
+  TestTrue("Id differs from an unrelated type",
+           PayloadProbe::MockStateTypeId() != PayloadTypeId<FAppMockState>());
+
+  const FActionPayload Foreign =
+      PayloadProbe::MakeMockStatePayload(FNpcMockState{TEXT("npc_1"), 40});
+  const FNpcMockState *Read = Foreign.TryGet<FNpcMockState>();
+  TestTrue("Payload built elsewhere reads back by type",
+           Read && *Read == FNpcMockState{TEXT("npc_1"), 40});
+  TestTrue("Payload built elsewhere rejects other types",
+           Foreign.TryGet<FAppMockState>() == nullptr);
+  return true;
+}
@@ -84,3 +84,291 @@ bool FRtkMiddlewareTest::RunTest(const FString &Parameters) {
 
   return true;
 }
+
+/**
+ * Test: flat and curried middleware share one pipeline; type filters skip
+ * stages, and listener maps are shared rather than copied.
+ * User Story: As a maintainer, I need the flattened dispatch path covered so
+ * ordering and filtering stay RTK-compatible while the plumbing changes.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkMiddlewarePipelineTest,
+                                 "ForbocAI.Core.RTK.MiddlewarePipeline",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkMiddlewarePipelineTest::RunTest(const FString &Parameters) {
+  TArray<FString> EventLog;
+  int32 FilteredCalls = 0;
+
+  Dispatcher BaseDispatch = [&EventLog](const AnyAction &Action) {
+    EventLog.Add(FString::Printf(TEXT("Base:%s"), *Action.Type));
+    return Action;
+  };
+  std::function<FAppMockState()> GetState = []() { return FAppMockState{}; };
+
+  Middleware<FAppMockState> Curried =
+      [&EventLog](const MiddlewareApi<FAppMockState> &Api)
+          -> std::function<Dispatcher(Dispatcher)> {
+    return [&EventLog](Dispatcher Next) -> Dispatcher {
+      return [&EventLog, Next](const AnyAction &Action) -> AnyAction {
+        EventLog.Add(TEXT("Curried"));
+        return Next(Action);
+      };
+    };
+  };
+
+  Middleware<FAppMockState> Filtered = Middleware<FAppMockState>::filtered(
+      {TEXT("followUp")},
+      [&EventLog, &FilteredCalls](const AnyAction &Action,
+                                  const MiddlewareApi<FAppMockState> &Api,
+                                  const NextDispatch<FAppMockState> &Next) {
+        ++FilteredCalls;
+        EventLog.Add(TEXT("Filtered"));
+        return Next(Action);
+      });
+
+  ListenerMiddleware<FAppMockState> Base =
+      addListener(createListenerMiddleware<FAppMockState>(), TEXT("trigger"),
+                  [](const AnyAction &Action,
+                     const MiddlewareApi<FAppMockState> &Api) {
+                    Api.dispatch(createAction(TEXT("followUp"))());
+                  });
+  ListenerMiddleware<FAppMockState> Extended = addListener(
+      Base, TEXT("other"),
+      [](const AnyAction &Action, const MiddlewareApi<FAppMockState> &Api) {});
+  TestEqual("addListener leaves the source map untouched",
+            Base.listeners->Num(), 1);
+  TestEqual("Extended map has both types", Extended.listeners->Num(), 2);
+
+  Middleware<FAppMockState> Listener = buildListenerMiddleware(Base);
+  TestTrue("Listener middleware filters on its action types",
+           Listener.bFilterTypes && Listener.ActionTypes.Contains(
+                                        FString(TEXT("trigger"))));
+
+  std::vector<Middleware<FAppMockState>> Chain = {Curried, Filtered, Listener};
+  Dispatcher Dispatch = applyMiddleware(BaseDispatch, GetState, Chain);
+
+  Dispatch(createAction(TEXT("unrelated"))());
+  TestEqual("Filtered stages are skipped for other types", FilteredCalls, 0);
+  TestEqual("Unrelated action only passes the curried stage", EventLog.Num(),
+            2);
+
+  EventLog.Reset();
+  Dispatch(createAction(TEXT("trigger"))());
+  TestEqual("Listener re-dispatch runs the whole pipeline", FilteredCalls, 1);
+  TestEqual("Event Log Length", EventLog.Num(), 5);
+  if (EventLog.Num() == 5) {
+    TestEqual("0: curried stage", EventLog[0], FString(TEXT("Curried")));
+    TestEqual("1: reducers", EventLog[1], FString(TEXT("Base:trigger")));
+    TestEqual("2: re-dispatch enters at the top", EventLog[2],
+              FString(TEXT("Curried")));
+    TestEqual("3: filtered stage sees its type", EventLog[3],
+              FString(TEXT("Filtered")));
+    TestEqual("4: follow-up reaches reducers", EventLog[4],
+              FString(TEXT("Base:followUp")));
+  }
+
+  TestEqual("Empty chain returns the base dispatcher",
+            applyMiddleware<FAppMockState>(BaseDispatch, GetState, {})(
+                createAction(TEXT("direct"))())
+                .Type,
+            FString(TEXT("direct")));
+  return true;
+}
+
+/**
+ * Test: listener effect modes and policies — deferred effects run after the
+ * outermost dispatch without nesting, worker effects leave dispatch, and
+ * take-latest, debounce and cancel drop superseded runs.
+ * User Story: As a maintainer, I need effect scheduling covered so slow
+ * listeners can move out of dispatch without changing what they observe.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkListenerEffectsTest,
+                                 "ForbocAI.Core.RTK.ListenerEffects",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkListenerEffectsTest::RunTest(const FString &Parameters) {
+  TArray<FString> EventLog;
+  TArray<EffectTask> WorkerQueue;
+  TArray<EffectTask> TimerQueue;
+
+  ListenerOptions Deferred;
+  Deferred.Mode = EffectMode::Deferred;
+
+  ListenerOptions Worker;
+  Worker.Mode = EffectMode::Worker;
+  Worker.Policy = EffectPolicy::TakeLatest;
+  Worker.Executor = [&WorkerQueue](EffectTask Task) {
+    WorkerQueue.Add(MoveTemp(Task));
+  };
+
+  ListenerOptions Debounced;
+  Debounced.Policy = EffectPolicy::Debounce;
+  Debounced.DebounceSeconds = 0.25;
+  Debounced.Delay = [&TimerQueue](double Seconds, EffectTask Task) {
+    TimerQueue.Add(MoveTemp(Task));
+  };
+
+  ListenerMiddleware<FAppMockState> Listeners =
+      createListenerMiddleware<FAppMockState>();
+  Listeners = addListener<FAppMockState>(
+      Listeners, TEXT("outer"),
+      [&EventLog](const AnyAction &Action,
+                  const MiddlewareApi<FAppMockState> &Api,
+                  const EffectHandle &Handle) {
+        EventLog.Add(TEXT("Effect:outer"));
+        Api.dispatch(createAction(TEXT("inner"))());
+        EventLog.Add(TEXT("Effect:outer:done"));
+      },
+      Deferred);
+  Listeners = addListener<FAppMockState>(
+      Listeners, TEXT("inner"),
+      [&EventLog](const AnyAction &Action,
+                  const MiddlewareApi<FAppMockState> &Api,
+                  const EffectHandle &Handle) {
+        EventLog.Add(TEXT("Effect:inner"));
+      },
+      Deferred);
+  Listeners = addListener<FAppMockState>(
+      Listeners, TEXT("work"),
+      [&EventLog](const AnyAction &Action,
+                  const MiddlewareApi<FAppMockState> &Api,
+                  const EffectHandle &Handle) {
+        EventLog.Add(TEXT("Effect:work"));
+      },
+      Worker);
+  Listeners = addListener<FAppMockState>(
+      Listeners, TEXT("typing"),
+      [&EventLog](const AnyAction &Action,
+                  const MiddlewareApi<FAppMockState> &Api,
+                  const EffectHandle &Handle) {
+        EventLog.Add(TEXT("Effect:typing"));
+      },
+      Debounced);
+
+  Dispatcher BaseDispatch = [&EventLog](const AnyAction &Action) {
+    EventLog.Add(FString::Printf(TEXT("Base:%s"), *Action.Type));
+    return Action;
+  };
+  std::function<FAppMockState()> GetState = []() { return FAppMockState{}; };
+  std::vector<Middleware<FAppMockState>> Chain = {
+      buildListenerMiddleware(Listeners)};
+  Dispatcher Dispatch = applyMiddleware(BaseDispatch, GetState, Chain);
+
+  Dispatch(createAction(TEXT("outer"))());
+  TestEqual("Deferred Log Length", EventLog.Num(), 5);
+  if (EventLog.Num() == 5) {
+    TestEqual("0: reducers first", EventLog[0], FString(TEXT("Base:outer")));
+    TestEqual("1: effect after dispatch", EventLog[1],
+              FString(TEXT("Effect:outer")));
+    TestEqual("2: effect dispatch reaches reducers", EventLog[2],
+              FString(TEXT("Base:inner")));
+    TestEqual("3: outer effect finishes before the nested effect",
+              EventLog[3], FString(TEXT("Effect:outer:done")));
+    TestEqual("4: nested effect runs after", EventLog[4],
+              FString(TEXT("Effect:inner")));
+  }
+
+  EventLog.Reset();
+  Dispatch(createAction(TEXT("work"))());
+  Dispatch(createAction(TEXT("work"))());
+  TestEqual("Worker effects leave dispatch", EventLog.Num(), 2);
+  TestEqual("Both runs were handed to the executor", WorkerQueue.Num(), 2);
+  for (const EffectTask &Task : WorkerQueue) {
+    Task();
+  }
+  TestEqual("Take-latest runs only the newest", EventLog.Num(), 3);
+
+  EventLog.Reset();
+  WorkerQueue.Reset();
+  Dispatch(createAction(TEXT("work"))());
+  cancelListenerEffects(Listeners, TEXT("work"));
+  for (const EffectTask &Task : WorkerQueue) {
+    Task();
+  }
+  TestEqual("Cancelled run is dropped", EventLog.Num(), 1);
+
+  EventLog.Reset();
+  Dispatch(createAction(TEXT("typing"))());
+  Dispatch(createAction(TEXT("typing"))());
+  Dispatch(createAction(TEXT("typing"))());
+  TestEqual("Debounce waits for the timer", EventLog.Num(), 3);
+  for (const EffectTask &Task : TimerQueue) {
+    Task();
+  }
+  TestEqual("Debounce runs once for the burst", EventLog.Num(), 4);
+
+  EffectHandle Standalone = EffectHandle::start(
+      std::make_shared<ListenerControl>(), false);
+  TestFalse("Fresh handle is live", Standalone.isCancelled());
+  Standalone.cancel();
+  TestTrue("Cancelled handle reports it", Standalone.isCancelled());
+  return true;
+}
+
+/**
+ * Test: worker effects read a snapshot taken at hand-off and post their
+ * dispatches through the dispatch executor instead of reducing on the worker
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkWorkerEffectApiTest,
+                                 "ForbocAI.Core.RTK.WorkerEffectApi",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkWorkerEffectApiTest::RunTest(const FString &Parameters) {
+  FAppMockState Current{FNpcMockState{TEXT("npc"), 100}};
+  TArray<EffectTask> WorkerQueue;
+  TArray<EffectTask> DispatchQueue;
+
+  ListenerOptions Worker;
+  Worker.Mode = EffectMode::Worker;
+  Worker.Executor = [&WorkerQueue](EffectTask Task) {
+    WorkerQueue.Add(MoveTemp(Task));
+  };
+  Worker.DispatchExecutor = [&DispatchQueue](EffectTask Task) {
+    DispatchQueue.Add(MoveTemp(Task));
+  };
+
+  int32 Observed = 0;
+  FString Returned;
+  ListenerMiddleware<FAppMockState> Listeners =
+      addListener<FAppMockState>(
+          createListenerMiddleware<FAppMockState>(), TEXT("scan"),
+          [&Observed, &Returned](const AnyAction &Action,
+                                 const MiddlewareApi<FAppMockState> &Api,
+                                 const EffectHandle &Handle) {
+            Observed = Api.getState().ActiveNpc.Health;
+            Returned = Api.dispatch(createAction(TEXT("hit"))()).Type;
+          },
+          Worker);
+
+  Dispatcher BaseDispatch = [&Current](const AnyAction &Action) {
+    Current.ActiveNpc.Health -= Action.Type == TEXT("hit") ? 10 : 0;
+    return Action;
+  };
+  std::function<FAppMockState()> GetState = [&Current]() { return Current; };
+  std::vector<Middleware<FAppMockState>> Chain = {
+      buildListenerMiddleware(Listeners)};
+  Dispatcher Dispatch = applyMiddleware(BaseDispatch, GetState, Chain);
+
+  Dispatch(createAction(TEXT("scan"))());
+  Dispatch(createAction(TEXT("hit"))());
+  TestEqual("Store moved on before the worker ran", Current.ActiveNpc.Health,
+            90);
+
+  for (const EffectTask &Task : WorkerQueue) {
+    Task();
+  }
+  TestEqual("Worker read the hand-off snapshot", Observed, 100);
+  TestEqual("Worker dispatch returns the posted action", Returned,
+            FString(TEXT("hit")));
+  TestEqual("Worker dispatch did not reduce on the worker",
+            Current.ActiveNpc.Health, 90);
+  TestEqual("Worker dispatch was posted", DispatchQueue.Num(), 1);
+
+  for (const EffectTask &Task : DispatchQueue) {
+    Task();
+  }
+  TestEqual("Posted dispatch reduces on the store's thread",
+            Current.ActiveNpc.Health, 80);
+  return true;
+}
@@ -0,0 +1,21 @@
+/**
+ * Payload type ids taken in a translation unit of their own, for the
+ * cross-unit comparison in rtk_core_test.cpp.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+
+#include "Core/ActionPayload.h"
+#include "CoreMinimal.h"
+#include "rtk_test_mocks.h"
+
+namespace PayloadProbe {
+
+rtk::FPayloadTypeId MockStateTypeId() {
+  return rtk::PayloadTypeId<FNpcMockState>();
+}
+
+rtk::FActionPayload MakeMockStatePayload(const FNpcMockState &State) {
+  return rtk::FActionPayload::Make(State);
+}
+
+} // namespace PayloadProbe
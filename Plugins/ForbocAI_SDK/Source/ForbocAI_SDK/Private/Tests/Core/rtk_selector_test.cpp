@@ -2,6 +2,8 @@
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
 #include "rtk_test_mocks.h"
+#include <atomic>
+#include <thread>
 
 using namespace rtk;
 
@@ -56,3 +58,155 @@ bool FRtkSelectorTest::RunTest(const FString &Parameters) {
 
   return true;
 }
+
+/**
+ * Test: keyed selectors keep one cache entry per key, evict the least
+ * recently used key and recompute when a key's inputs change.
+ * User Story: As a maintainer, I need per-key memoization covered so list UI
+ * calling a selector for many ids each frame keeps its cache hits.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkKeyedSelectorTest,
+                                 "ForbocAI.Core.RTK.KeyedSelector",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkKeyedSelectorTest::RunTest(const FString &Parameters) {
+  struct FRosterState {
+    TMap<FString, int32> Health;
+  };
+
+  int32 Computations = 0;
+  auto SelectHealthLabel = createKeyedSelector<FRosterState, FString, FString>(
+      std::make_tuple([](const FRosterState &State, const FString &Id) {
+        const int32 *Health = State.Health.Find(Id);
+        return Health ? *Health : -1;
+      }),
+      [&Computations](const int32 &Health) {
+        Computations++;
+        return FString::Printf(TEXT("hp:%d"), Health);
+      },
+      2);
+
+  FRosterState State;
+  State.Health.Add(TEXT("a"), 10);
+  State.Health.Add(TEXT("b"), 20);
+  State.Health.Add(TEXT("c"), 30);
+
+  TestEqual("Key a computes", SelectHealthLabel(State, TEXT("a")),
+            FString(TEXT("hp:10")));
+  TestEqual("Key b computes", SelectHealthLabel(State, TEXT("b")),
+            FString(TEXT("hp:20")));
+  SelectHealthLabel(State, TEXT("a"));
+  SelectHealthLabel(State, TEXT("b"));
+  TestEqual("Alternating keys hit their own entries", Computations, 2);
+
+  SelectHealthLabel(State, TEXT("c"));
+  SelectHealthLabel(State, TEXT("b"));
+  TestEqual("Recently used key survives eviction", Computations, 3);
+  SelectHealthLabel(State, TEXT("a"));
+  TestEqual("Least recently used key was evicted", Computations, 4);
+
+  State.Health.Add(TEXT("a"), 15);
+  TestEqual("Changed input recomputes", SelectHealthLabel(State, TEXT("a")),
+            FString(TEXT("hp:15")));
+
+  const SelectorCacheStats Stats = SelectHealthLabel.stats();
+  TestEqual("Hits", Stats.Hits, static_cast<uint64>(3));
+  TestEqual("Misses", Stats.Misses, static_cast<uint64>(5));
+  TestEqual("Evictions", Stats.Evictions, static_cast<uint64>(2));
+  TestEqual("Size is bounded", Stats.Size, 2);
+
+  SelectHealthLabel.clear();
+  TestEqual("Clear empties the cache", SelectHealthLabel.stats().Size, 0);
+  return true;
+}
+
+/**
+ * Test: identity selectors cache per shared input and reuse the entries of
+ * released inputs first.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkIdentitySelectorTest,
+                                 "ForbocAI.Core.RTK.IdentitySelector",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkIdentitySelectorTest::RunTest(const FString &Parameters) {
+  int32 Computations = 0;
+  auto CountIds = createIdentitySelector<TArray<FString>, int32>(
+      [&Computations](const TArray<FString> &Ids) {
+        Computations++;
+        return Ids.Num();
+      },
+      2);
+
+  const auto Kept = std::make_shared<const TArray<FString>>(
+      TArray<FString>{TEXT("a"), TEXT("b"), TEXT("c")});
+  TestEqual("First call computes", CountIds(Kept), 3);
+  TestEqual("Same object hits", CountIds(Kept), 3);
+  TestEqual("One computation", Computations, 1);
+
+  {
+    const auto Released =
+        std::make_shared<const TArray<FString>>(TArray<FString>{TEXT("x")});
+    CountIds(Released);
+  }
+  const auto Fresh = std::make_shared<const TArray<FString>>(
+      TArray<FString>{TEXT("y"), TEXT("z")});
+  TestEqual("Fresh object computes", CountIds(Fresh), 2);
+  TestEqual("Live entry kept over released one", CountIds(Kept), 3);
+  TestEqual("Three computations", Computations, 3);
+  TestEqual("Null input yields default", CountIds(nullptr), 0);
+  return true;
+}
+
+/**
+ * Test: shared selectors stay memoized and consistent when called from
+ * several threads at once.
+ * User Story: As a maintainer, I need the thread-safe selector covered so
+ * worker-thread thunks can read derived state without recomputing it.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRtkSharedSelectorTest,
+                                 "ForbocAI.Core.RTK.SharedSelector",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FRtkSharedSelectorTest::RunTest(const FString &Parameters) {
+  struct FTestState {
+    int32 A;
+    int32 B;
+  };
+
+  std::atomic<int32> Computations(0);
+  auto SharedSelector = createSharedSelector<FTestState, int32>(
+      std::make_tuple([](const FTestState &State) { return State.A; },
+                      [](const FTestState &State) { return State.B; }),
+      [&Computations](int32 A, int32 B) {
+        ++Computations;
+        return A * 100 + B;
+      });
+
+  TestEqual("Initial computation", SharedSelector(FTestState{1, 2}), 102);
+  TestEqual("Cache hit", SharedSelector(FTestState{1, 2}), 102);
+  TestEqual("Computed once", Computations.load(), 1);
+
+  /**
+   * Readers on several threads alternate two states; every result must
+   * match its own inputs even while the snapshot is being replaced.
+   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
+   */
+  std::atomic<int32> Mismatches(0);
+  std::vector<std::thread> Readers;
+  for (int32 Thread = 0; Thread < 4; ++Thread) {
+    Readers.emplace_back([&SharedSelector, &Mismatches, Thread]() {
+      for (int32 Call = 0; Call < 2000; ++Call) {
+        const int32 B = (Call + Thread) % 2;
+        if (SharedSelector(FTestState{3, B}) != 300 + B) {
+          ++Mismatches;
+        }
+      }
+    });
+  }
+  for (std::thread &Reader : Readers) {
+    Reader.join();
+  }
+  TestEqual("No torn results", Mismatches.load(), 0);
+  return true;
+}
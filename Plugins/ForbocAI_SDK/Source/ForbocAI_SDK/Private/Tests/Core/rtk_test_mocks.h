@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/ActionPayload.h"
 #include "CoreMinimal.h"
 
 struct FNpcMockState {
@@ -14,3 +15,13 @@ struct FNpcMockState {
 struct FAppMockState {
   FNpcMockState ActiveNpc;
 };
+
+/**
+ * Payload helpers compiled in rtk_payload_probe.cpp, so tests can compare
+ * payload type ids produced by another translation unit.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+namespace PayloadProbe {
+rtk::FPayloadTypeId MockStateTypeId();
+rtk::FActionPayload MakeMockStatePayload(const FNpcMockState &State);
+} // namespace PayloadProbe
@@ -0,0 +1,310 @@
+/**
+ * Tests for TimerWheel.h — wheel ordering, cancellation and the async helpers
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+
+#include "Core/TimerWheel.h"
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+namespace {
+/** Manual clock for services driven by Pump. */
+struct FManualClock {
+  std::shared_ptr<uint64> Ms = std::make_shared<uint64>(0);
+
+  std::function<uint64()> AsClock() const {
+    std::shared_ptr<uint64> Shared = Ms;
+    return [Shared]() { return *Shared; };
+  }
+};
+
+void AdvanceTo(Timers::FTimerService &Service, const FManualClock &Clock,
+               uint64 Ms) {
+  while (*Clock.Ms < Ms) {
+    ++*Clock.Ms;
+    Timers::Pump(Service);
+  }
+}
+} // namespace
+
+/**
+ * Test: timers fire in deadline order across every wheel level
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerWheelOrderingTest,
+                                 "ForbocAI.Core.TimerWheel.Ordering",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FTimerWheelOrderingTest::RunTest(const FString &Parameters) {
+  Timers::FTimerWheel Wheel;
+  std::vector<uint64> Fired;
+  const uint64 Delays[] = {70000, 5, 300, 1, 4100, 64, 63, 262145};
+  for (uint64 Delay : Delays) {
+    Timers::Schedule(Wheel, Delay, [&Fired, &Wheel]() {
+      Fired.push_back(Wheel.Now);
+    });
+  }
+
+  std::vector<Timers::FTimerTask> Due;
+  for (uint64 Tick = 0; Tick < 262145; ++Tick) {
+    Timers::Advance(Wheel, 1, Due);
+    for (const Timers::FTimerTask &Task : Due) {
+      Task();
+    }
+    Due.clear();
+  }
+
+  const std::vector<uint64> Expected = {1,    5,     63,    64,
+                                        300,  4100,  70000, 262145};
+  TestTrue("Every timer fired on its deadline tick", Fired == Expected);
+  TestTrue("Wheel idle afterwards",
+           Timers::TicksUntilNext(Wheel) == Timers::NoPendingTimer);
+
+  /**
+   * Large advances batch due tasks in deadline order.
+   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
+   */
+  std::vector<int32> Order;
+  Timers::Schedule(Wheel, 500, [&Order]() { Order.push_back(2); });
+  Timers::Schedule(Wheel, 10, [&Order]() { Order.push_back(1); });
+  Timers::Schedule(Wheel, 9000, [&Order]() { Order.push_back(3); });
+  Timers::Advance(Wheel, 10000, Due);
+  for (const Timers::FTimerTask &Task : Due) {
+    Task();
+  }
+  TestTrue("Batch runs in deadline order",
+           Order == std::vector<int32>({1, 2, 3}));
+  return true;
+}
+
+/**
+ * Test: cancelled timers never run and the next-deadline hint stays safe
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerWheelCancelTest,
+                                 "ForbocAI.Core.TimerWheel.Cancel",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FTimerWheelCancelTest::RunTest(const FString &Parameters) {
+  Timers::FTimerWheel Wheel;
+  int32 Runs = 0;
+  const Timers::FTimerId Kept =
+      Timers::Schedule(Wheel, 20, [&Runs]() { ++Runs; });
+  const Timers::FTimerId Dropped =
+      Timers::Schedule(Wheel, 10, [&Runs]() { Runs += 100; });
+
+  TestTrue("Next hint points at the earliest timer",
+           Timers::TicksUntilNext(Wheel) == 10);
+  TestTrue("Cancel succeeds once", Timers::Cancel(Wheel, Dropped));
+  TestFalse("Second cancel reports nothing pending",
+            Timers::Cancel(Wheel, Dropped));
+
+  std::vector<Timers::FTimerTask> Due;
+  Timers::Advance(Wheel, 30, Due);
+  for (const Timers::FTimerTask &Task : Due) {
+    Task();
+  }
+  TestEqual("Only the kept timer ran", Runs, 1);
+  TestFalse("Fired timer cannot be cancelled", Timers::Cancel(Wheel, Kept));
+  return true;
+}
+
+/**
+ * Test: delay, interval and timeout settle on a pumped service
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerServiceAsyncTest,
+                                 "ForbocAI.Core.TimerWheel.Async",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FTimerServiceAsyncTest::RunTest(const FString &Parameters) {
+  FManualClock Clock;
+  Timers::FTimerService Service(Clock.AsClock(), false);
+
+  bool bDelayed = false;
+  Timers::delay(100, func::AbortSignal(), Service)
+      .then([&bDelayed]() { bDelayed = true; })
+      .execute();
+  AdvanceTo(Service, Clock, 99);
+  TestFalse("Delay pending before its deadline", bDelayed);
+  AdvanceTo(Service, Clock, 100);
+  TestTrue("Delay resolved on its deadline", bDelayed);
+
+  /**
+   * Aborting a delay rejects it and its timer never fires.
+   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
+   */
+  func::AbortController Controller = func::createAbortController();
+  bool bAbortedResolved = false;
+  std::string AbortError;
+  Timers::delay(50, Controller.signal, Service)
+      .then([&bAbortedResolved]() { bAbortedResolved = true; })
+      .catch_([&AbortError](std::string Error) { AbortError = Error; })
+      .execute();
+  Controller.abort("stop");
+  AdvanceTo(Service, Clock, 200);
+  TestFalse("Aborted delay never resolves", bAbortedResolved);
+  TestTrue("Aborted delay rejects as abort", func::isAbortError(AbortError));
+
+  /**
+   * Interval calls its step each period until the step declines.
+   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
+   */
+  std::vector<uint64> StepTimes;
+  int64 Calls = -1;
+  Timers::interval(
+      10,
+      [&StepTimes, &Clock](int64 Tick) {
+        StepTimes.push_back(*Clock.Ms);
+        return Tick < 2;
+      },
+      func::AbortSignal(), Service)
+      .then([&Calls](int64 Count) { Calls = Count; })
+      .execute();
+  AdvanceTo(Service, Clock, 260);
+  TestEqual("Interval resolved with its call count", Calls, int64(3));
+  TestTrue("Interval stepped once per period",
+           StepTimes == std::vector<uint64>({210, 220, 230}));
+
+  /**
+   * Timeout rejects stalled work and aborts it.
+   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
+   */
+  bool bWorkAborted = false;
+  std::string TimeoutError;
+  Timers::timeout<int>(
+      func::AbortableWork<int>([&bWorkAborted](const func::AbortSignal &Signal) {
+        Signal.onAbort([&bWorkAborted](std::string) { bWorkAborted = true; });
+        return func::AsyncResult<int>::create(
+            [](std::function<void(int)>, std::function<void(std::string)>) {});
+      }),
+      30, func::AbortSignal(), Service)
+      .catch_([&TimeoutError](std::string Error) { TimeoutError = Error; })
+      .execute();
+  AdvanceTo(Service, Clock, 289);
+  TestTrue("Timeout pending before its deadline", TimeoutError.empty());
+  AdvanceTo(Service, Clock, 290);
+  TestTrue("Timeout rejected", func::isTimeoutError(TimeoutError));
+  TestTrue("Timed out work was aborted", bWorkAborted);
+  return true;
+}
+
+/**
+ * Test: retryWithBackoff waits the backoff schedule between attempts
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerServiceRetryTest,
+                                 "ForbocAI.Core.TimerWheel.RetryWithBackoff",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FTimerServiceRetryTest::RunTest(const FString &Parameters) {
+  FManualClock Clock;
+  Timers::FTimerService Service(Clock.AsClock(), false);
+  Timers::FBackoff Backoff;
+  Backoff.MaxAttempts = 4;
+  Backoff.InitialDelayMs = 100;
+  Backoff.MaxDelayMs = 300;
+
+  TestEqual("Backoff doubles", Timers::BackoffDelayMs(Backoff, 2), int64(200));
+  TestEqual("Backoff capped", Timers::BackoffDelayMs(Backoff, 3), int64(300));
+
+  std::vector<uint64> AttemptTimes;
+  int32 Result = 0;
+  Timers::retryWithBackoff<int32>(
+      func::AbortableWork<int32>(
+          [&AttemptTimes, &Clock](const func::AbortSignal &) {
+            AttemptTimes.push_back(*Clock.Ms);
+            const bool bSucceed = AttemptTimes.size() == 3;
+            return func::AsyncResult<int32>::create(
+                [bSucceed](std::function<void(int32)> Resolve,
+                           std::function<void(std::string)> Reject) {
+                  if (bSucceed) {
+                    Resolve(7);
+                  } else {
+                    Reject("HTTP 503");
+                  }
+                });
+          }),
+      Backoff, &Timers::RetryUnlessAborted, func::AbortSignal(), Service)
+      .then([&Result](int32 Value) { Result = Value; })
+      .execute();
+  AdvanceTo(Service, Clock, 1000);
+  TestEqual("Succeeded on the third attempt", Result, 7);
+  TestTrue("Attempts spaced by the backoff schedule",
+           AttemptTimes == std::vector<uint64>({0, 100, 300}));
+
+  /**
+   * Errors the filter rejects stop retrying at once.
+   * User Story: As a maintainer, I need this step note so I can follow the scenario progression and reason about the expected state changes.
+   */
+  int32 Attempts = 0;
+  std::string LastError;
+  Timers::retryWithBackoff<int32>(
+      func::AbortableWork<int32>([&Attempts](const func::AbortSignal &) {
+        ++Attempts;
+        return func::AsyncResult<int32>::create(
+            [](std::function<void(int32)>,
+               std::function<void(std::string)> Reject) { Reject("HTTP 400"); });
+      }),
+      Backoff,
+      [](const std::string &Error) { return Error != "HTTP 400"; },
+      func::AbortSignal(), Service)
+      .catch_([&LastError](std::string Error) { LastError = Error; })
+      .execute();
+  AdvanceTo(Service, Clock, 2000);
+  TestEqual("No retry for filtered error", Attempts, 1);
+  TestTrue("Last error surfaced", LastError == "HTTP 400");
+  return true;
+}
+
+/**
+ * Test: the shared service fires on its timer thread and awaitResult wakes
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerServiceThreadTest,
+                                 "ForbocAI.Core.TimerWheel.Thread",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FTimerServiceThreadTest::RunTest(const FString &Parameters) {
+  Timers::FTimerService Service;
+  const uint64 Start = Timers::SteadyClockMs();
+  const func::Either<std::string, int64> Result = Timers::awaitResult(
+      Timers::interval(
+          10, [](int64 Tick) { return Tick < 1; }, func::AbortSignal(),
+          Service));
+  TestFalse("Interval resolved", Result.isLeft);
+  TestEqual("Interval stepped twice", Result.right, int64(2));
+  TestTrue("Waited at least the delay", Timers::SteadyClockMs() - Start >= 20);
+  return true;
+}
+
+/**
+ * Test: a service without its own thread fires on the thread that calls Run,
+ * Stop ends Run, and Restart lets it run again
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerServiceOwnedThreadTest,
+                                 "ForbocAI.Core.TimerWheel.OwnedThread",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FTimerServiceOwnedThreadTest::RunTest(const FString &Parameters) {
+  Timers::FTimerService Service(&Timers::SteadyClockMs, false);
+
+  for (int32 Round = 0; Round < 2; ++Round) {
+    Timers::Restart(Service);
+    std::thread Owner([&Service]() { Timers::Run(Service); });
+    const func::Either<std::string, int64> Result = Timers::awaitResult(
+        Timers::interval(
+            5, [](int64 Tick) { return Tick < 1; }, func::AbortSignal(),
+            Service));
+    TestFalse(*FString::Printf(TEXT("Round %d fired on the owned thread"),
+                               Round),
+              Result.isLeft);
+    TestFalse("Service started no thread of its own",
+              Service.Thread.joinable());
+
+    Timers::Stop(Service);
+    Owner.join();
+  }
+  return true;
+}
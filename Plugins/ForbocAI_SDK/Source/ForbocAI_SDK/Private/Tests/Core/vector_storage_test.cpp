@@ -0,0 +1,258 @@
+/**
+ * Tests for sqlite-vec storage modes — int8 and binary search with the fp32
+ * rerank, and in-place migration between modes.
+ * User Story: As a maintainer, I need quantized storage covered so shrinking
+ * the vector column never changes which memories recall returns.
+ */
+
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "NativeEngine.h"
+
+namespace {
+
+/** Matches the vec0 column width NativeEngine creates. */
+constexpr int32 Dimensions = 384;
+constexpr int32 NearCount = 8;
+constexpr int32 FarCount = 56;
+constexpr float SimilarityTolerance = 1e-4f;
+
+FString MakeTempStorageDir() {
+  return FPaths::Combine(
+      FPaths::ProjectSavedDir(),
+      FString::Printf(TEXT("forbocai-vector-storage-%s"),
+                      *FGuid::NewGuid().ToString(EGuidFormats::Digits)));
+}
+
+TArray<float> Normalized(TArray<float> Vector) {
+  float Norm = 0.0f;
+  for (const float Value : Vector) {
+    Norm += Value * Value;
+  }
+  Norm = FMath::Sqrt(Norm);
+  for (float &Value : Vector) {
+    Value /= Norm;
+  }
+  return Vector;
+}
+
+TArray<float> RandomVector(FRandomStream &Stream) {
+  TArray<float> Vector;
+  Vector.SetNumUninitialized(Dimensions);
+  for (float &Value : Vector) {
+    Value = Stream.FRandRange(-1.0f, 1.0f);
+  }
+  return Normalized(MoveTemp(Vector));
+}
+
+/**
+ * Unit vectors around one anchor at growing noise, plus unrelated ones, so
+ * the true nearest neighbours of the anchor have a known order.
+ */
+struct FStorageFixture {
+  TArray<float> Query;
+  TArray<FMemoryItem> Items;
+
+  FStorageFixture() {
+    FRandomStream Stream(20240611);
+    Query = RandomVector(Stream);
+    for (int32 Index = 0; Index < NearCount; ++Index) {
+      const TArray<float> Noise = RandomVector(Stream);
+      TArray<float> Vector = Query;
+      for (int32 Dim = 0; Dim < Dimensions; ++Dim) {
+        Vector[Dim] += Noise[Dim] * 0.08f * Index;
+      }
+      Add(FString::Printf(TEXT("near_%d"), Index),
+          Normalized(MoveTemp(Vector)));
+    }
+    for (int32 Index = 0; Index < FarCount; ++Index) {
+      Add(FString::Printf(TEXT("far_%d"), Index), RandomVector(Stream));
+    }
+  }
+
+  void Add(const FString &Id, TArray<float> Embedding) {
+    FMemoryItem Item;
+    Item.Id = Id;
+    Item.Text = Id;
+    Item.Type = TEXT("observation");
+    Item.Importance = 0.5f;
+    Item.Timestamp = 1000 + Items.Num();
+    Item.Embedding = MoveTemp(Embedding);
+    Items.Add(MoveTemp(Item));
+  }
+
+  const FMemoryItem *Find(const FString &Id) const {
+    return Items.FindByPredicate(
+        [&Id](const FMemoryItem &Item) { return Item.Id == Id; });
+  }
+};
+
+Native::Sqlite::DB OpenFilled(const FString &Path,
+                              Native::Sqlite::EVectorStorage Storage,
+                              const FStorageFixture &Fixture) {
+  Native::Sqlite::DB Database = Native::Sqlite::Open(Path, Storage);
+  for (const FMemoryItem &Item : Fixture.Items) {
+    Native::Sqlite::Upsert(Database, Item);
+  }
+  return Database;
+}
+
+/** Vectors are written as decimal JSON, so stored copies match to rounding. */
+bool NearlySameVector(const TArray<float> &Stored, const FMemoryItem *Source) {
+  bool bSame = Source && Stored.Num() == Source->Embedding.Num();
+  for (int32 Dim = 0; bSame && Dim < Stored.Num(); ++Dim) {
+    bSame = FMath::IsNearlyEqual(Stored[Dim], Source->Embedding[Dim], 1e-5f);
+  }
+  return bSame;
+}
+
+TMap<FString, float> SimilarityById(const TArray<FMemoryItem> &Rows) {
+  TMap<FString, float> Out;
+  for (const FMemoryItem &Row : Rows) {
+    Out.Add(Row.Id, Row.Similarity);
+  }
+  return Out;
+}
+
+} // namespace
+
+/**
+ * Test: int8 and binary stores return the float store's ranking and exact
+ * similarities once the fp32 rerank has run
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVectorStorageQuantizedSearchTest,
+                                 "ForbocAI.Core.VectorStorage.QuantizedSearch",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FVectorStorageQuantizedSearchTest::RunTest(const FString &Parameters) {
+#if !WITH_FORBOC_SQLITE_VEC
+  AddInfo(TEXT("Skipping vector storage: built without sqlite-vec"));
+  return true;
+#else
+  using namespace Native::Sqlite;
+  const FStorageFixture Fixture;
+  const FString Dir = MakeTempStorageDir();
+  IFileManager::Get().MakeDirectory(*Dir, true);
+
+  DB FloatDb =
+      OpenFilled(FPaths::Combine(Dir, TEXT("float.db")), EVectorStorage::Float,
+                 Fixture);
+  const TArray<FMemoryItem> Expected = Search(FloatDb, Fixture.Query, 5);
+  Close(FloatDb);
+
+  TestEqual("Float returns TopK rows", Expected.Num(), 5);
+  TestTrue("Float ranks the anchor first",
+           Expected.Num() > 0 && Expected[0].Id == TEXT("near_0"));
+
+  const EVectorStorage Modes[] = {EVectorStorage::Int8,
+                                  EVectorStorage::Binary};
+  for (const EVectorStorage Mode : Modes) {
+    const FString Name = StorageName(Mode);
+    DB Database = OpenFilled(
+        FPaths::Combine(Dir, FString::Printf(TEXT("%s.db"), *Name)), Mode,
+        Fixture);
+    TestTrue(*FString::Printf(TEXT("%s store reports its mode"), *Name),
+             GetStorage(Database) == Mode);
+
+    const TArray<FMemoryItem> Rows = Search(Database, Fixture.Query, 5);
+    TestEqual(*FString::Printf(TEXT("%s returns TopK rows"), *Name),
+              Rows.Num(), Expected.Num());
+    for (int32 Index = 0; Index < FMath::Min(Rows.Num(), Expected.Num());
+         ++Index) {
+      TestEqual(*FString::Printf(TEXT("%s rank %d matches float"), *Name,
+                                 Index),
+                Rows[Index].Id, Expected[Index].Id);
+      TestTrue(*FString::Printf(TEXT("%s rank %d similarity is the fp32 "
+                                     "rerank distance"),
+                                *Name, Index),
+               FMath::IsNearlyEqual(Rows[Index].Similarity,
+                                    Expected[Index].Similarity,
+                                    SimilarityTolerance));
+    }
+
+    TestTrue(*FString::Printf(TEXT("%s keeps the full-precision vector"),
+                              *Name),
+             NearlySameVector(FetchEmbedding(Database, TEXT("near_3")),
+                              Fixture.Find(TEXT("near_3"))));
+    Close(Database);
+  }
+
+  IFileManager::Get().DeleteDirectory(*Dir, false, true);
+  return true;
+#endif
+}
+
+/**
+ * Test: migrating float to int8 to binary and back keeps every row, its id
+ * and its similarity to the query
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVectorStorageMigrateTest,
+                                 "ForbocAI.Core.VectorStorage.Migrate",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FVectorStorageMigrateTest::RunTest(const FString &Parameters) {
+#if !WITH_FORBOC_SQLITE_VEC
+  AddInfo(TEXT("Skipping vector storage: built without sqlite-vec"));
+  return true;
+#else
+  using namespace Native::Sqlite;
+  const FStorageFixture Fixture;
+  const int32 RowCount = Fixture.Items.Num();
+  const FString Dir = MakeTempStorageDir();
+  const FString Path = FPaths::Combine(Dir, TEXT("memories.db"));
+  IFileManager::Get().MakeDirectory(*Dir, true);
+
+  DB Database = OpenFilled(Path, EVectorStorage::Float, Fixture);
+  const TArray<FMemoryItem> Baseline =
+      Search(Database, Fixture.Query, RowCount);
+  const TMap<FString, float> BaselineSimilarity = SimilarityById(Baseline);
+  Close(Database);
+  TestEqual("Float store holds every row", Baseline.Num(), RowCount);
+
+  const EVectorStorage Steps[] = {EVectorStorage::Int8, EVectorStorage::Binary,
+                                  EVectorStorage::Float};
+  for (const EVectorStorage Target : Steps) {
+    const FString Name = StorageName(Target);
+    TestTrue(*FString::Printf(TEXT("Migrate to %s succeeds"), *Name),
+             MigrateStorage(Path, Target));
+
+    Database = Open(Path, Target);
+    TestTrue(*FString::Printf(TEXT("%s recorded as the storage mode"), *Name),
+             GetStorage(Database) == Target);
+
+    const TArray<FMemoryItem> Rows = Search(Database, Fixture.Query, RowCount);
+    TestEqual(*FString::Printf(TEXT("%s keeps the row count"), *Name),
+              Rows.Num(), RowCount);
+    TestEqual(*FString::Printf(TEXT("%s keeps the anchor first"), *Name),
+              Rows.Num() > 0 ? Rows[0].Id : FString(), FString(TEXT("near_0")));
+
+    int32 Missing = 0;
+    int32 Drifted = 0;
+    for (const FMemoryItem &Row : Rows) {
+      const float *Before = BaselineSimilarity.Find(Row.Id);
+      Missing += Before ? 0 : 1;
+      Drifted += Before && !FMath::IsNearlyEqual(Row.Similarity, *Before,
+                                                 SimilarityTolerance)
+                     ? 1
+                     : 0;
+    }
+    TestEqual(*FString::Printf(TEXT("%s keeps every id"), *Name), Missing, 0);
+    TestEqual(*FString::Printf(TEXT("%s keeps each similarity"), *Name),
+              Drifted, 0);
+
+    TestTrue(*FString::Printf(TEXT("%s keeps the full-precision vector"),
+                              *Name),
+             NearlySameVector(FetchEmbedding(Database, TEXT("far_7")),
+                              Fixture.Find(TEXT("far_7"))));
+    Close(Database);
+  }
+
+  IFileManager::Get().DeleteDirectory(*Dir, false, true);
+  return true;
+#endif
+}
@@ -0,0 +1,227 @@
+/**
+ * Tests for model variant selection and cached GGUF requantization.
+ * User Story: As a maintainer, I need variant planning covered so quant
+ * choice stays deterministic per host and requantized files are reused.
+ */
+
+#include "CLI/CliOperations.h"
+#include "CoreMinimal.h"
+#include "Cortex/ModelVariants.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+// @covers:cliOp:QuantizeModel
+// @covers:cli:cortex_quantize
+
+namespace {
+
+FString MakeTempModelsDir() {
+  return FPaths::Combine(
+      FPaths::ProjectSavedDir(),
+      FString::Printf(TEXT("forbocai-variants-%s"),
+                      *FGuid::NewGuid().ToString(EGuidFormats::Digits)));
+}
+
+FCortexHostCapabilities MakeCaps(int64 MemoryBytes, bool bAvx2) {
+  FCortexHostCapabilities Caps;
+  Caps.AvailableMemoryBytes = MemoryBytes;
+  Caps.PhysicalCores = 8;
+  Caps.bAvx2 = bAvx2;
+  Caps.bF16C = bAvx2;
+  return Caps;
+}
+
+constexpr int64 MiB = 1024LL * 1024LL;
+
+} // namespace
+
+/**
+ * Test: auto selection picks the best quant that fits the budget and skips
+ * K-quants on hosts without fast kernels
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FModelVariantSelectTest, "ForbocAI.Cortex.ModelVariants.SelectQuant",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FModelVariantSelectTest::RunTest(const FString &Parameters) {
+  const func::Maybe<ModelVariants::FModelFamily> Llama =
+      ModelVariants::FindFamily(TEXT("LLAMA3-8B"));
+  TestTrue("Family lookup ignores case", Llama.hasValue);
+
+  const FCortexHostCapabilities Avx2 = MakeCaps(0, true);
+  const FCortexHostCapabilities Sse = MakeCaps(0, false);
+
+  TestEqual("Large budget stops at the source quant",
+            ModelVariants::SelectQuant(Llama.value, Avx2, 32768 * MiB),
+            Llama.value.SourceQuant);
+  TestEqual("F16-sourced family can pick F16",
+            ModelVariants::SelectQuant(
+                ModelVariants::FindFamily(TEXT("smollm2-135m")).value, Avx2,
+                32768 * MiB),
+            FString(TEXT("F16")));
+  TestEqual("8 GiB budget picks Q6_K",
+            ModelVariants::SelectQuant(Llama.value, Avx2, 8192 * MiB),
+            FString(TEXT("Q6_K")));
+  TestEqual("4.5 GiB budget picks Q3_K_M",
+            ModelVariants::SelectQuant(Llama.value, Avx2, 4608 * MiB),
+            FString(TEXT("Q3_K_M")));
+  TestEqual("No AVX2 skips K-quants",
+            ModelVariants::SelectQuant(Llama.value, Sse, 8192 * MiB),
+            FString(TEXT("Q4_0")));
+  TestEqual("Nothing fits falls back to default",
+            ModelVariants::SelectQuant(Llama.value, Avx2, 1 * MiB),
+            FString(TEXT("Q4_K_M")));
+
+  TestEqual("Empty policy keeps default",
+            ModelVariants::ResolveQuant(Llama.value, TEXT(""), Avx2, 0),
+            FString(TEXT("Q4_K_M")));
+  TestEqual("Pinned policy is normalized",
+            ModelVariants::ResolveQuant(Llama.value, TEXT("q8_0"), Avx2, 0),
+            FString(TEXT("Q8_0")));
+  TestEqual("Unknown policy keeps default",
+            ModelVariants::ResolveQuant(Llama.value, TEXT("Q1"), Avx2, 0),
+            FString(TEXT("Q4_K_M")));
+  TestEqual("Configured budget wins",
+            ModelVariants::ResolveBudgetBytes(512, MakeCaps(8192 * MiB, true)),
+            512 * MiB);
+  TestEqual("Auto budget is half of available",
+            ModelVariants::ResolveBudgetBytes(0, MakeCaps(8192 * MiB, true)),
+            4096 * MiB);
+  return true;
+}
+
+/**
+ * Test: published variants download directly; unpublished ones download the
+ * family source and requantize
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FModelVariantPlanTest, "ForbocAI.Cortex.ModelVariants.Plan",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FModelVariantPlanTest::RunTest(const FString &Parameters) {
+  const FString Dir = TEXT("/tmp/models/");
+  const FCortexHostCapabilities Caps = MakeCaps(0, true);
+
+  const ModelVariants::FVariantPlan Default =
+      ModelVariants::PlanForModel(TEXT("smollm2-135m"), Dir, TEXT(""), Caps, 0);
+  TestTrue("Default is known", Default.bKnown);
+  TestFalse("Default is published", Default.bRequantize);
+  TestEqual("Default URL matches the legacy download",
+            Default.DownloadUrl,
+            FString(TEXT("https://huggingface.co/bartowski/SmolLM2-135M-"
+                         "Instruct-GGUF/resolve/main/SmolLM2-135M-Instruct-"
+                         "Q4_K_M.gguf")));
+  TestEqual("Published variant downloads in place", Default.DownloadPath,
+            Default.LocalPath);
+
+  const ModelVariants::FVariantPlan Q2 =
+      ModelVariants::PlanForModel(TEXT("llama3-8b"), Dir, TEXT("Q2_K"), Caps,
+                                  0);
+  TestTrue("Q2_K is built locally", Q2.bRequantize);
+  TestTrue("Source is the Q8_0 file",
+           Q2.DownloadUrl.EndsWith(TEXT("Meta-Llama-3-8B-Instruct-Q8_0.gguf")));
+  TestTrue("Output is the Q2_K file",
+           Q2.LocalPath.EndsWith(TEXT("Meta-Llama-3-8B-Instruct-Q2_K.gguf")));
+
+  const ModelVariants::FVariantPlan Custom =
+      ModelVariants::PlanForModel(TEXT("my-model.gguf"), Dir, TEXT("auto"),
+                                  Caps, 0);
+  TestFalse("Custom file is unknown", Custom.bKnown);
+  TestTrue("Custom file has no download", Custom.DownloadUrl.IsEmpty());
+  return true;
+}
+
+/**
+ * Test: EnsureVariant builds once, reuses an up-to-date output, and reports
+ * missing sources and failed builds without leaving temp files
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FModelVariantCacheTest, "ForbocAI.Cortex.ModelVariants.CachedRequantize",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FModelVariantCacheTest::RunTest(const FString &Parameters) {
+  const FString Dir = MakeTempModelsDir();
+  const FString Source = Dir / TEXT("tiny-F16.gguf");
+  const FString Out = Dir / TEXT("tiny-Q4_0.gguf");
+  IFileManager::Get().MakeDirectory(*Dir, true);
+  FFileHelper::SaveStringToFile(TEXT("GGUF-fixture"), *Source);
+
+  int32 Calls = 0;
+  int32 LastFType = -1;
+  const ModelVariants::QuantizeFn Fake =
+      [&Calls, &LastFType](const FString &In, const FString &Tmp, int32 FType,
+                           bool) {
+        ++Calls;
+        LastFType = FType;
+        return FFileHelper::SaveStringToFile(TEXT("GGUF-q4"), *Tmp);
+      };
+
+  const func::Either<FString, FString> First =
+      ModelVariants::EnsureVariant(Source, Out, TEXT("Q4_0"), Fake);
+  TestFalse("First build succeeds", First.isLeft);
+  TestEqual("Quantizer called once", Calls, 1);
+  TestEqual("Q4_0 ftype passed", LastFType, 2);
+  TestTrue("Output exists", FPaths::FileExists(Out));
+  TestFalse("Temp file moved", FPaths::FileExists(Out + TEXT(".tmp")));
+
+  const func::Either<FString, FString> Second =
+      ModelVariants::EnsureVariant(Source, Out, TEXT("Q4_0"), Fake);
+  TestFalse("Second call succeeds", Second.isLeft);
+  TestEqual("Cached output is reused", Calls, 1);
+
+  const func::Either<FString, FString> Missing = ModelVariants::EnsureVariant(
+      Dir / TEXT("missing.gguf"), Out, TEXT("Q4_0"), Fake);
+  TestTrue("Missing source fails", Missing.isLeft);
+
+  const func::Either<FString, FString> Failed = ModelVariants::EnsureVariant(
+      Source, Dir / TEXT("tiny-Q8_0.gguf"), TEXT("Q8_0"),
+      [](const FString &, const FString &Tmp, int32, bool) {
+        FFileHelper::SaveStringToFile(TEXT("partial"), *Tmp);
+        return false;
+      });
+  TestTrue("Failed build reports error", Failed.isLeft);
+  TestFalse("Failed build cleans temp file",
+            FPaths::FileExists(Dir / TEXT("tiny-Q8_0.gguf.tmp")));
+
+  IFileManager::Get().DeleteDirectory(*Dir, false, true);
+  return true;
+}
+
+/**
+ * Test: the CLI op rejects a missing source and, when the default local model
+ * is present on a native build, produces a loadable Q4_0 variant
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FModelVariantCliTest, "ForbocAI.Cortex.ModelVariants.CliQuantize",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FModelVariantCliTest::RunTest(const FString &Parameters) {
+  const FString Dir = MakeTempModelsDir();
+  TestTrue("Missing source fails",
+           Ops::QuantizeModel(Dir / TEXT("missing.gguf"), TEXT("Q4_0")).isLeft);
+
+  const FString Smol = FPaths::ConvertRelativePathToFull(
+      rtk::detail::GetLocalInfrastructureDir() +
+      TEXT("models/SmolLM2-135M-Instruct-Q4_K_M.gguf"));
+  if (!WITH_FORBOC_NATIVE || !FPaths::FileExists(Smol)) {
+    AddInfo(TEXT("Skipping native requantize: no local SmolLM2 model"));
+  } else {
+    const FString Out = Dir / TEXT("smol-Q4_0.gguf");
+    const func::Either<FString, FString> Built =
+        Ops::QuantizeModel(Smol, TEXT("Q4_0"), Out);
+    TestFalse("Requantize succeeds", Built.isLeft);
+    Native::Llama::Context Ctx = Native::Llama::LoadModel(Out);
+    TestNotNull("Requantized model loads", Ctx);
+    Native::Llama::FreeModel(Ctx);
+  }
+
+  IFileManager::Get().DeleteDirectory(*Dir, false, true);
+  return true;
+}
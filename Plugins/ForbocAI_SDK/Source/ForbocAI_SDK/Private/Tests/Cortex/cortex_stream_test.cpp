@@ -4,6 +4,7 @@
  */
 
 #include "Cortex/CortexSlice.h"
+#include "Cortex/TokenStream.h"
 #include "Core/functional_core.hpp"
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
@@ -105,6 +106,86 @@ bool FCortexStreamCompleteTest::RunTest(const FString &Parameters) {
   return true;
 }
 
+/**
+ * Test: CortexStreamProgress records the token count and StreamStart resets it
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FCortexStreamProgressTest,
+    "ForbocAI.Cortex.Stream.ProgressAction",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FCortexStreamProgressTest::RunTest(const FString &Parameters) {
+  auto Slice = CortexSlice::CreateCortexSlice();
+  CortexSlice::FCortexSliceState State;
+
+  State = Slice.Reducer(State, CortexSlice::Actions::CortexStreamStart(TEXT("p")));
+  State = Slice.Reducer(State, CortexSlice::Actions::CortexStreamProgress(42));
+  TestEqual("Progress recorded", State.StreamTokenCount, 42);
+  TestTrue("Accumulated text untouched", State.StreamAccumulated.IsEmpty());
+
+  State = Slice.Reducer(State, CortexSlice::Actions::CortexStreamStart(TEXT("q")));
+  TestEqual("Start resets progress", State.StreamTokenCount, 0);
+
+  return true;
+}
+
+/**
+ * Test: a full ring holds tokens back and coalesces them into later chunks;
+ * close flushes the rest before the close callback
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FTokenStreamChannelTest,
+    "ForbocAI.Cortex.Stream.TokenChannel",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FTokenStreamChannelTest::RunTest(const FString &Parameters) {
+  /**
+   * Callbacks capture shared state: queued drain tasks may run after return
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  const auto Chunks = std::make_shared<TArray<FString>>();
+  const auto Progress = std::make_shared<TArray<int32>>();
+  const auto Closed = std::make_shared<TArray<FString>>();
+
+  const TokenStream::FChannelRef Channel = TokenStream::Open(
+      [Chunks](const FString &Chunk) { Chunks->Add(Chunk); },
+      [Progress](int32 Count) { Progress->Add(Count); },
+      [Chunks, Closed](const FString &Text) {
+        Closed->Add(FString::Printf(TEXT("%d:%s"), Chunks->Num(), *Text));
+      },
+      2, 3600.0);
+
+  TokenStream::Push(Channel, TEXT("a"));
+  TokenStream::Push(Channel, TEXT("b"));
+  TokenStream::Push(Channel, TEXT("c"));
+  TokenStream::Push(Channel, TEXT("d"));
+
+  TestFalse("Open channel does not finish", TokenStream::Drain(*Channel));
+  TestEqual("One coalesced chunk", Chunks->Num(), 1);
+  TestEqual("Ring pieces delivered in order",
+            Chunks->Num() > 0 ? (*Chunks)[0] : FString(), FString(TEXT("ab")));
+  TestEqual("Progress throttled", Progress->Num(), 0);
+
+  TokenStream::Push(Channel, TEXT("e"));
+  TokenStream::Close(Channel, TEXT("abcde"));
+
+  TestTrue("Closed channel finishes", TokenStream::Drain(*Channel));
+  TestEqual("Held tokens flushed", Chunks->Num() > 1 ? (*Chunks)[1] : FString(),
+            FString(TEXT("cde")));
+  TestEqual("Final progress reported",
+            Progress->Num() > 0 ? Progress->Last() : -1, 5);
+  TestEqual("Close fires after chunks",
+            Closed->Num() > 0 ? (*Closed)[0] : FString(),
+            FString(TEXT("2:abcde")));
+
+  TokenStream::Drain(*Channel);
+  TestEqual("Close fires once", Closed->Num(), 1);
+
+  return true;
+}
+
 /**
  * Test: LoadModel returns nullptr for non-existent model path
  * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
@@ -0,0 +1,171 @@
+/**
+ * Tests for native inference threading config — SDKConfig per-model lookup,
+ * config-file round trip, and NativeEngine runtime re-application.
+ * User Story: As a maintainer, I need threading config covered so per-model
+ * overrides and persisted affinity sets keep resolving the same way.
+ */
+
+#include "Core/ThunkDetail.h"
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "NativeEngine.h"
+#include "RuntimeConfig.h"
+
+namespace {
+
+FString MakeTempConfigPath() {
+  return FPaths::Combine(
+      FPaths::ProjectSavedDir(),
+      FString::Printf(TEXT("forbocai-threading-%s.json"),
+                      *FGuid::NewGuid().ToString(EGuidFormats::Digits)));
+}
+
+void UseConfigFile(const FString &Path) {
+  SDKConfig::SetConfigFilePathOverride(Path);
+  SDKConfig::ReloadConfig();
+}
+
+} // namespace
+
+/**
+ * Test: model entries override the default entry, unknown models fall back
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FCortexThreadingLookupTest, "ForbocAI.Cortex.Threading.PerModelLookup",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FCortexThreadingLookupTest::RunTest(const FString &Parameters) {
+  const FString TempConfigPath = MakeTempConfigPath();
+  IFileManager::Get().Delete(*TempConfigPath, false, true);
+  UseConfigFile(TempConfigPath);
+
+  const FCortexThreadingConfig Unset =
+      SDKConfig::GetThreadingConfig(TEXT("smollm2-135m"));
+  TestEqual("Unset threads is auto", Unset.Threads, 0);
+  TestTrue("Unset pool is shared", Unset.bSharedPool);
+
+  FCortexThreadingConfig Default;
+  Default.Threads = 4;
+  SDKConfig::SetThreadingConfig(TEXT(""), Default);
+
+  FCortexThreadingConfig Big;
+  Big.Threads = 12;
+  Big.BatchThreads = 16;
+  Big.AffinityCores = {2, 3, 4, 5};
+  SDKConfig::SetThreadingConfig(TEXT("llama3-8b"), Big);
+
+  TestEqual("Model entry wins",
+            SDKConfig::GetThreadingConfig(TEXT("llama3-8b")).Threads, 12);
+  TestEqual("Unknown model uses default",
+            SDKConfig::GetThreadingConfig(TEXT("other")).Threads, 4);
+
+  IFileManager::Get().Delete(*TempConfigPath, false, true);
+  UseConfigFile(TEXT(""));
+  return true;
+}
+
+/**
+ * Test: threading table survives SaveToConfigFile and reload, and model
+ * entries inherit fields they omit from the default entry
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FCortexThreadingPersistTest, "ForbocAI.Cortex.Threading.ConfigRoundTrip",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FCortexThreadingPersistTest::RunTest(const FString &Parameters) {
+  const FString TempConfigPath = MakeTempConfigPath();
+  FFileHelper::SaveStringToFile(
+      TEXT("{\"threading\":{"
+           "\"default\":{\"threads\":6,\"numa\":\"distribute\",\"poll\":10},"
+           "\"embedder\":{\"threads\":2,\"affinity\":[0,1],"
+           "\"strictAffinity\":true}}}"),
+      *TempConfigPath);
+  UseConfigFile(TempConfigPath);
+
+  const FCortexThreadingConfig Embedder =
+      SDKConfig::GetThreadingConfig(TEXT("embedder"));
+  TestEqual("Embedder threads", Embedder.Threads, 2);
+  TestEqual("Embedder affinity size", Embedder.AffinityCores.Num(), 2);
+  TestTrue("Embedder strict affinity", Embedder.bStrictAffinity);
+  TestEqual("Embedder inherits poll", Embedder.PollLevel, 10);
+  TestTrue("Embedder inherits numa",
+           Embedder.Numa == ECortexNumaStrategy::Distribute);
+
+  TestTrue("Config saved", SDKConfig::SaveToConfigFile());
+  SDKConfig::ReloadConfig();
+
+  const FCortexThreadingConfig Reloaded =
+      SDKConfig::GetThreadingConfig(TEXT("embedder"));
+  TestEqual("Reloaded threads", Reloaded.Threads, 2);
+  TestEqual("Reloaded affinity core",
+            Reloaded.AffinityCores.Num() > 1 ? Reloaded.AffinityCores[1] : -1,
+            1);
+  TestEqual("Reloaded default threads",
+            SDKConfig::GetThreadingConfig(TEXT("")).Threads, 6);
+
+  IFileManager::Get().Delete(*TempConfigPath, false, true);
+  UseConfigFile(TEXT(""));
+  return true;
+}
+
+/**
+ * Test: SetThreading on an unloaded context reports failure
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FCortexThreadingNullContextTest, "ForbocAI.Cortex.Threading.NullContext",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FCortexThreadingNullContextTest::RunTest(const FString &Parameters) {
+  FCortexThreadingConfig Threading;
+  Threading.Threads = 2;
+  TestFalse("SetThreading(nullptr) is false",
+            Native::Llama::SetThreading(nullptr, Threading));
+  return true;
+}
+
+/**
+ * Test: repeated Infer calls with unchanged threading reuse the attached
+ * private pool instead of creating one per request
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FCortexThreadingPoolReuseTest, "ForbocAI.Cortex.Threading.PoolReuse",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FCortexThreadingPoolReuseTest::RunTest(const FString &Parameters) {
+  const FString Smol = FPaths::ConvertRelativePathToFull(
+      rtk::detail::GetLocalInfrastructureDir() +
+      TEXT("models/SmolLM2-135M-Instruct-Q4_K_M.gguf"));
+  if (!WITH_FORBOC_NATIVE || !FPaths::FileExists(Smol)) {
+    AddInfo(TEXT("Skipping pool reuse: no local SmolLM2 model"));
+    return true;
+  }
+
+  FCortexConfig Config;
+  Config.MaxTokens = 4;
+  Config.Threading.Threads = 2;
+  Config.Threading.bSharedPool = false;
+  Native::Llama::Context Ctx = Native::Llama::LoadModel(Smol, Config.Threading);
+  TestNotNull("Model loads", Ctx);
+
+  Native::Llama::Infer(Ctx, TEXT("Hello"), Config);
+  const int64 AfterFirst = Native::Llama::ThreadpoolCreations();
+  Native::Llama::Infer(Ctx, TEXT("Hello again"), Config);
+  TestEqual("Second Infer reuses the pool",
+            Native::Llama::ThreadpoolCreations(), AfterFirst);
+
+  Config.Threading.Threads = 3;
+  Native::Llama::Infer(Ctx, TEXT("Hello"), Config);
+  TestTrue("Changed threading creates a new pool",
+           Native::Llama::ThreadpoolCreations() > AfterFirst);
+
+  Native::Llama::FreeModel(Ctx);
+  return true;
+}
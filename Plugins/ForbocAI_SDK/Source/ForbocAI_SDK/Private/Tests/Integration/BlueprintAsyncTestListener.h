@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "BlueprintAsyncTestListener.generated.h"
+
+/**
+ * Counts the pins a latent node fires; bound with AddDynamic in tests.
+ * User Story: As a maintainer, I need pin firings observable so node tests
+ * can assert each outcome is delivered exactly once.
+ */
+UCLASS()
+class UForbocAIAsyncTestListener : public UObject {
+  GENERATED_BODY()
+
+public:
+  int32 Successes = 0;
+  int32 Failures = 0;
+  int32 Cancels = 0;
+  FString LastResult;
+  FString LastError;
+
+  UFUNCTION()
+  void HandleSuccess(const FString &Result, const FString &Error) {
+    ++Successes;
+    LastResult = Result;
+  }
+
+  UFUNCTION()
+  void HandleFailure(const FString &Result, const FString &Error) {
+    ++Failures;
+    LastError = Error;
+  }
+
+  UFUNCTION()
+  void HandleCancelled() { ++Cancels; }
+};
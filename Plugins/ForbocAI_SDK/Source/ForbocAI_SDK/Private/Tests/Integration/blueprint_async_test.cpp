@@ -0,0 +1,169 @@
+/**
+ * Tests for latent Blueprint nodes — single outcome, stubbed activation and
+ * cancellation.
+ * User Story: As a maintainer, I need node lifecycle covered so cancelled
+ * nodes never fire a late success or failure pin.
+ */
+
+#include "BlueprintAsyncTestListener.h"
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "RuntimeAsyncActions.h"
+#include <functional>
+
+/**
+ * Test: cancel finishes the node once; later outcomes are ignored
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FBlueprintAsyncCancelTest, "ForbocAI.Integration.BlueprintAsync.Cancel",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FBlueprintAsyncCancelTest::RunTest(const FString &Parameters) {
+  UForbocAIChatNpcAsync *Chat = UForbocAIChatNpcAsync::ChatNpcAsync(
+      nullptr, TEXT("npc_async"), TEXT("hello"));
+  TestTrue("New node is pending", Chat->IsPending());
+
+  Chat->Cancel();
+  TestFalse("Cancelled node is finished", Chat->IsPending());
+  TestFalse("Outcome slot already claimed", Chat->TryFinish());
+
+  Chat->Succeed(TEXT("late"));
+  Chat->Cancel();
+  TestFalse("Late outcome keeps node finished", Chat->IsPending());
+
+  UForbocAIValidateBridgeActionAsync *Validate =
+      UForbocAIValidateBridgeActionAsync::ValidateBridgeActionAsync(
+          nullptr, TEXT("{}"));
+  Validate->Fail(TEXT("boom"));
+  TestFalse("Failure finishes node", Validate->IsPending());
+  TestFalse("Cancel after failure is ignored", Validate->TryFinish());
+  return true;
+}
+
+/**
+ * Test-only access to a text node's result stub.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FForbocAIAsyncActionTestAccess {
+  static void StubResult(
+      UForbocAIAsyncTextAction *Node,
+      TFunction<func::AsyncResult<FString>(const func::AbortSignal &)> Stub) {
+    Node->ResultStub = MoveTemp(Stub);
+  }
+};
+
+namespace {
+
+/**
+ * Binds a fresh listener to every pin of a text node.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+UForbocAIAsyncTestListener *Listen(UForbocAIAsyncTextAction *Node) {
+  UForbocAIAsyncTestListener *Listener =
+      NewObject<UForbocAIAsyncTestListener>();
+  Node->OnSuccess.AddDynamic(Listener,
+                             &UForbocAIAsyncTestListener::HandleSuccess);
+  Node->OnFailure.AddDynamic(Listener,
+                             &UForbocAIAsyncTestListener::HandleFailure);
+  Node->OnCancelled.AddDynamic(Listener,
+                               &UForbocAIAsyncTestListener::HandleCancelled);
+  return Listener;
+}
+
+/** Settle callbacks captured from a stubbed result's executor. */
+struct FStubbedResult {
+  std::function<void(FString)> Resolve;
+  std::function<void(std::string)> Reject;
+  bool bAborted = false;
+};
+
+/**
+ * Stubs Node with a result that settles only when the test says so.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+TSharedRef<FStubbedResult> StubPending(UForbocAIAsyncTextAction *Node) {
+  const TSharedRef<FStubbedResult> Stub = MakeShared<FStubbedResult>();
+  FForbocAIAsyncActionTestAccess::StubResult(
+      Node, [Stub](const func::AbortSignal &Signal) {
+        Signal.onAbort([Stub](std::string) { Stub->bAborted = true; });
+        return func::AsyncResult<FString>::create(
+            [Stub](std::function<void(FString)> Resolve,
+                   std::function<void(std::string)> Reject) {
+              Stub->Resolve = Resolve;
+              Stub->Reject = Reject;
+            });
+      });
+  return Stub;
+}
+
+} // namespace
+
+/**
+ * Test: Activate delivers a stubbed success or failure through exactly one
+ * pin, even when the result settles again
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FBlueprintAsyncActivateTest, "ForbocAI.Integration.BlueprintAsync.Activate",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FBlueprintAsyncActivateTest::RunTest(const FString &Parameters) {
+  UForbocAIProcessNpcAsync *Process = UForbocAIProcessNpcAsync::ProcessNpcAsync(
+      nullptr, TEXT("npc_async"), TEXT("hello"));
+  UForbocAIAsyncTestListener *ProcessPins = Listen(Process);
+  const TSharedRef<FStubbedResult> ProcessResult = StubPending(Process);
+  Process->Activate();
+  TestTrue("Activated node waits for its result", Process->IsPending());
+
+  ProcessResult->Resolve(TEXT("Greetings."));
+  ProcessResult->Resolve(TEXT("again"));
+  ProcessResult->Reject("late failure");
+  TestEqual("Success pin fired once", ProcessPins->Successes, 1);
+  TestEqual("Success carries the result", ProcessPins->LastResult,
+            FString(TEXT("Greetings.")));
+  TestEqual("Failure pin never fired", ProcessPins->Failures, 0);
+  TestFalse("Node finished", Process->IsPending());
+
+  UForbocAIGhostRunAsync *Ghost =
+      UForbocAIGhostRunAsync::GhostRunAsync(nullptr, TEXT("smoke"), 10);
+  UForbocAIAsyncTestListener *GhostPins = Listen(Ghost);
+  const TSharedRef<FStubbedResult> GhostResult = StubPending(Ghost);
+  Ghost->Activate();
+  GhostResult->Reject("HTTP 503");
+  GhostResult->Resolve(TEXT("late"));
+  TestEqual("Failure pin fired once", GhostPins->Failures, 1);
+  TestEqual("Failure carries the error", GhostPins->LastError,
+            FString(TEXT("HTTP 503")));
+  TestEqual("Success pin never fired", GhostPins->Successes, 0);
+  return true;
+}
+
+/**
+ * Test: a node cancelled after Activate delivers nothing when its result
+ * settles later
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FBlueprintAsyncCancelActiveTest,
+    "ForbocAI.Integration.BlueprintAsync.CancelAfterActivate",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FBlueprintAsyncCancelActiveTest::RunTest(const FString &Parameters) {
+  UForbocAIChatNpcAsync *Chat = UForbocAIChatNpcAsync::ChatNpcAsync(
+      nullptr, TEXT("npc_async"), TEXT("hello"));
+  UForbocAIAsyncTestListener *Pins = Listen(Chat);
+  const TSharedRef<FStubbedResult> Result = StubPending(Chat);
+  Chat->Activate();
+
+  TestFalse("Request live before cancel", Result->bAborted);
+  Chat->Cancel();
+  TestTrue("Cancel aborts the request's signal", Result->bAborted);
+  Chat->Cancel();
+  Result->Resolve(TEXT("too late"));
+  Result->Reject("too late");
+  TestEqual("Cancelled pin fired once", Pins->Cancels, 1);
+  TestEqual("No success after cancel", Pins->Successes, 0);
+  TestEqual("No failure after cancel", Pins->Failures, 0);
+  return true;
+}
@@ -92,6 +92,7 @@
 // @covers:cli:status
 // @covers:cli:system_status
 // @covers:cli:vector_init
+// @covers:cli:vector_migrate
 // @covers:cli:version
 
 
@@ -0,0 +1,124 @@
+/**
+ * Tests for facade store sync — direct calls skip the store, batched calls
+ * apply on flush, store calls dispatch immediately.
+ * User Story: As a maintainer, I need the facade modes covered so gameplay
+ * calls stay off the store unless a project opts in.
+ */
+
+#include "Bridge/BridgeSlice.h"
+#include "Cortex/CortexSlice.h"
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "RuntimeConfig.h"
+#include "RuntimeFacade.h"
+
+namespace {
+
+int32 StoreTokenCount() {
+  return ConfigureStore().getState().Cortex.StreamTokenCount;
+}
+
+FDirectiveRuleSet MakeRuleset(const FString &Id, const FString &Version) {
+  FDirectiveRuleSet Ruleset;
+  Ruleset.Id = Id;
+  Ruleset.RulesetId = Id + Version;
+  return Ruleset;
+}
+
+TArray<FString> StoreRulesetIds() {
+  TArray<FString> Ids;
+  for (const FDirectiveRuleSet &Ruleset :
+       ConfigureStore().getState().Bridge.AvailableRulesets) {
+    Ids.Add(Ruleset.Id);
+  }
+  return Ids;
+}
+
+} // namespace
+
+/**
+ * Test: each facade store-sync mode reaches the store as documented
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FFacadeStoreSyncTest, "ForbocAI.Integration.Facade.StoreSync",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FFacadeStoreSyncTest::RunTest(const FString &Parameters) {
+  const int32 Baseline = StoreTokenCount();
+
+  SDKConfig::SetFacadeStoreSync(SDKConfig::FACADE_SYNC_DIRECT);
+  TestTrue("Direct mode resolves",
+           FacadeDispatch::CurrentMode() ==
+               FacadeDispatch::EFacadeStoreSync::Direct);
+  FacadeDispatch::Dispatch(
+      CortexSlice::Actions::CortexStreamProgress(Baseline + 1));
+  TestEqual("Direct mode leaves the store alone", StoreTokenCount(), Baseline);
+
+  SDKConfig::SetFacadeStoreSync(SDKConfig::FACADE_SYNC_BATCHED);
+  FacadeDispatch::Dispatch(
+      CortexSlice::Actions::CortexStreamProgress(Baseline + 2));
+  FacadeDispatch::Dispatch(
+      CortexSlice::Actions::CortexStreamProgress(Baseline + 3));
+  TestEqual("Batched mode defers", StoreTokenCount(), Baseline);
+  TestEqual("Flush applies the batch", FacadeDispatch::Flush(), 2);
+  TestEqual("Batch applied in order", StoreTokenCount(), Baseline + 3);
+  TestEqual("Second flush is empty", FacadeDispatch::Flush(), 0);
+
+  SDKConfig::SetFacadeStoreSync(SDKConfig::FACADE_SYNC_STORE);
+  FacadeDispatch::Dispatch(
+      CortexSlice::Actions::CortexStreamProgress(Baseline + 4));
+  TestEqual("Store mode dispatches immediately", StoreTokenCount(),
+            Baseline + 4);
+
+  AddExpectedError(TEXT("invalid config"),
+                   EAutomationExpectedErrorFlags::Contains, 0);
+  SDKConfig::SetFacadeStoreSync(TEXT("eventually"));
+  TestEqual("Unknown mode falls back to direct",
+            SDKConfig::GetFacadeStoreSync(),
+            FString(SDKConfig::FACADE_SYNC_DIRECT));
+
+  SDKConfig::ReloadConfig();
+  return true;
+}
+
+/**
+ * Test: ruleset registrations and deletes queued in one batch all apply,
+ * as registerRulesetThunk and deleteRulesetThunk dispatch them
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FFacadeBatchedRulesetTest, "ForbocAI.Integration.Facade.BatchedRulesets",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FFacadeBatchedRulesetTest::RunTest(const FString &Parameters) {
+  ConfigureStore().dispatch(BridgeSlice::Actions::SetAvailableRulesets(
+      {MakeRuleset(TEXT("rs_old"), TEXT("_v1"))}));
+
+  SDKConfig::SetFacadeStoreSync(SDKConfig::FACADE_SYNC_BATCHED);
+  FacadeDispatch::Dispatch(BridgeSlice::Actions::UpsertAvailableRuleset(
+      MakeRuleset(TEXT("rs_a"), TEXT("_v1"))));
+  FacadeDispatch::Dispatch(BridgeSlice::Actions::UpsertAvailableRuleset(
+      MakeRuleset(TEXT("rs_b"), TEXT("_v1"))));
+  TestEqual("Batch holds both registrations", FacadeDispatch::Flush(), 2);
+  TestTrue("Both registrations land",
+           StoreRulesetIds() ==
+               TArray<FString>({TEXT("rs_old"), TEXT("rs_a"), TEXT("rs_b")}));
+
+  FacadeDispatch::Dispatch(BridgeSlice::Actions::UpsertAvailableRuleset(
+      MakeRuleset(TEXT("rs_a"), TEXT("_v2"))));
+  FacadeDispatch::Dispatch(
+      BridgeSlice::Actions::RemoveAvailableRuleset(TEXT("rs_old")));
+  FacadeDispatch::Flush();
+  TestTrue("Delete removes only its ruleset",
+           StoreRulesetIds() ==
+               TArray<FString>({TEXT("rs_a"), TEXT("rs_b")}));
+  TestEqual("Re-registration replaces in place",
+            ConfigureStore().getState().Bridge.AvailableRulesets[0].RulesetId,
+            FString(TEXT("rs_a_v2")));
+
+  ConfigureStore().dispatch(
+      BridgeSlice::Actions::SetAvailableRulesets(TArray<FDirectiveRuleSet>()));
+  SDKConfig::ReloadConfig();
+  return true;
+}
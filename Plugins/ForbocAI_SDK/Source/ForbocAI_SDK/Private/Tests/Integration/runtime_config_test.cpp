@@ -0,0 +1,192 @@
+/**
+ * Tests for SDKConfig snapshots — publication, up-front validation, and
+ * config file change detection.
+ * User Story: As a maintainer, I need snapshot semantics covered so readers
+ * keep seeing stable values while edits and overrides publish new ones.
+ */
+
+#include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "RuntimeConfig.h"
+
+namespace {
+
+FString MakeTempConfigPath() {
+  return FPaths::Combine(
+      FPaths::ProjectSavedDir(),
+      FString::Printf(TEXT("forbocai-snapshot-%s.json"),
+                      *FGuid::NewGuid().ToString(EGuidFormats::Digits)));
+}
+
+void UseConfigFile(const FString &Path) {
+  SDKConfig::SetConfigFilePathOverride(Path);
+  SDKConfig::ReloadConfig();
+}
+
+} // namespace
+
+/**
+ * Test: a held snapshot stays unchanged while overrides publish new ones
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FConfigSnapshotPublishTest, "ForbocAI.Integration.Config.SnapshotPublish",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FConfigSnapshotPublishTest::RunTest(const FString &Parameters) {
+  const FString TempConfigPath = MakeTempConfigPath();
+  IFileManager::Get().Delete(*TempConfigPath, false, true);
+  UseConfigFile(TempConfigPath);
+
+  const SDKConfig::FSDKConfigSnapshot &Before = SDKConfig::Snapshot();
+  TestTrue("Reads reuse the published snapshot",
+           &SDKConfig::Snapshot() == &Before);
+
+  const FString OldKey = Before.ApiKey;
+  SDKConfig::SetApiConfig(Before.ApiUrl, TEXT("sk_snapshot_override"));
+  const SDKConfig::FSDKConfigSnapshot &After = SDKConfig::Snapshot();
+
+  TestTrue("Generation advances",
+           After.Generation == Before.Generation + 1);
+  TestEqual("Held snapshot is unchanged", Before.ApiKey, OldKey);
+  TestTrue("Replaced snapshot is retired for its grace period",
+           SDKConfig::RetiredSnapshots().ContainsByPredicate(
+               [&Before](const SDKConfig::FRetiredSnapshot &Retired) {
+                 return Retired.Snapshot.Get() == &Before;
+               }));
+  TestEqual("New snapshot has override", SDKConfig::GetApiKey(),
+            FString(TEXT("sk_snapshot_override")));
+
+  UseConfigFile(TEXT(""));
+  return true;
+}
+
+/**
+ * Test: invalid file values fall back to defaults and are reported
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FConfigSnapshotValidateTest, "ForbocAI.Integration.Config.Validation",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FConfigSnapshotValidateTest::RunTest(const FString &Parameters) {
+  const FString TempConfigPath = MakeTempConfigPath();
+  FFileHelper::SaveStringToFile(
+      TEXT("{\"vectorDimension\":-3,\"maxRecallResults\":0,"
+           "\"modelQuant\":\"Q9_X\",\"memoryVectorStorage\":\"int4\","
+           "\"memoryRecallScoring\":\"newest\",\"memoryMmrLambda\":1.5,"
+           "\"threading\":{\"default\":"
+           "{\"threads\":-2,\"poll\":250,\"affinity\":[0,-1]}}}"),
+      *TempConfigPath);
+  AddExpectedError(TEXT("invalid config"),
+                   EAutomationExpectedErrorFlags::Contains, 0);
+  UseConfigFile(TempConfigPath);
+
+  TestEqual("Vector dimension falls back", SDKConfig::GetVectorDimension(),
+            SDKConfig::DEFAULT_VECTOR_DIMENSION);
+  TestEqual("Recall limit falls back", SDKConfig::GetMaxRecallResults(),
+            SDKConfig::DEFAULT_MAX_RECALL_RESULTS);
+  TestTrue("Unknown quant cleared", SDKConfig::GetModelQuant().IsEmpty());
+  TestEqual("Unknown vector storage falls back to float",
+            SDKConfig::GetMemoryVectorStorage(),
+            FString(SDKConfig::VECTOR_STORAGE_FLOAT));
+  TestEqual("Unknown recall scoring falls back to similarity",
+            SDKConfig::GetMemoryRecallScoring(),
+            FString(SDKConfig::RECALL_SCORING_SIMILARITY));
+  TestEqual("Out-of-range mmr lambda falls back",
+            SDKConfig::GetMemoryMmrLambda(),
+            SDKConfig::DEFAULT_MEMORY_MMR_LAMBDA);
+
+  const FCortexThreadingConfig Threading =
+      SDKConfig::GetThreadingConfig(TEXT(""));
+  TestEqual("Negative threads become auto", Threading.Threads, 0);
+  TestEqual("Poll is clamped", Threading.PollLevel, 100);
+  TestEqual("Negative core dropped", Threading.AffinityCores.Num(), 1);
+
+  TestTrue("Errors are reported",
+           SDKConfig::GetValidationErrors().Num() >= 8);
+
+  IFileManager::Get().Delete(*TempConfigPath, false, true);
+  UseConfigFile(TEXT(""));
+  return true;
+}
+
+/**
+ * Test: CheckForChanges publishes only when the file changed, and keeps
+ * in-process overrides across the reload
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FConfigSnapshotWatchTest, "ForbocAI.Integration.Config.FileWatch",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FConfigSnapshotWatchTest::RunTest(const FString &Parameters) {
+  const FString TempConfigPath = MakeTempConfigPath();
+  FFileHelper::SaveStringToFile(TEXT("{\"maxRecallResults\":7}"),
+                                *TempConfigPath);
+  UseConfigFile(TempConfigPath);
+
+  TestEqual("Initial value", SDKConfig::GetMaxRecallResults(), 7);
+  TestFalse("Unchanged file publishes nothing", SDKConfig::CheckForChanges());
+
+  SDKConfig::SetApiConfig(SDKConfig::GetApiUrl(), TEXT("sk_watch_override"));
+  FFileHelper::SaveStringToFile(TEXT("{\"maxRecallResults\":25}"),
+                                *TempConfigPath);
+  TestTrue("Edited file publishes", SDKConfig::CheckForChanges());
+  TestEqual("Edited value visible", SDKConfig::GetMaxRecallResults(), 25);
+  TestEqual("Override survives watch reload", SDKConfig::GetApiKey(),
+            FString(TEXT("sk_watch_override")));
+
+  SDKConfig::ReloadConfig();
+  TestNotEqual("Explicit reload drops override", SDKConfig::GetApiKey(),
+               FString(TEXT("sk_watch_override")));
+
+  IFileManager::Get().Delete(*TempConfigPath, false, true);
+  UseConfigFile(TEXT(""));
+  return true;
+}
+
+/**
+ * Test: overrides that change nothing publish nothing, and repeated override
+ * publishes keep each validation error exactly once
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FConfigSnapshotOverrideTest, "ForbocAI.Integration.Config.OverridePublish",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FConfigSnapshotOverrideTest::RunTest(const FString &Parameters) {
+  const FString TempConfigPath = MakeTempConfigPath();
+  FFileHelper::SaveStringToFile(TEXT("{\"vectorDimension\":-3}"),
+                                *TempConfigPath);
+  AddExpectedError(TEXT("invalid config"),
+                   EAutomationExpectedErrorFlags::Contains, 0);
+  UseConfigFile(TempConfigPath);
+  const int32 SourceErrors = SDKConfig::GetValidationErrors().Num();
+  TestEqual("File error reported once", SourceErrors, 1);
+
+  SDKConfig::SetApiConfig(SDKConfig::GetApiUrl(), TEXT("sk_same"));
+  const SDKConfig::FSDKConfigSnapshot &Published = SDKConfig::Snapshot();
+  SDKConfig::SetApiConfig(SDKConfig::GetApiUrl(), TEXT("sk_same"));
+  TestTrue("Unchanged override keeps the snapshot",
+           &SDKConfig::Snapshot() == &Published);
+
+  SDKConfig::SetApiConfig(TEXT("ftp://bad"), TEXT("sk_same"));
+  FCortexThreadingConfig Threading;
+  Threading.Threads = 2;
+  SDKConfig::SetThreadingConfig(TEXT(""), Threading);
+  Threading.Threads = 3;
+  SDKConfig::SetThreadingConfig(TEXT(""), Threading);
+  TestEqual("Errors not duplicated across publishes",
+            SDKConfig::GetValidationErrors().Num(), SourceErrors + 1);
+  TestEqual("Threading override applied",
+            SDKConfig::GetThreadingConfig(TEXT("")).Threads, 3);
+
+  IFileManager::Get().Delete(*TempConfigPath, false, true);
+  UseConfigFile(TEXT(""));
+  return true;
+}
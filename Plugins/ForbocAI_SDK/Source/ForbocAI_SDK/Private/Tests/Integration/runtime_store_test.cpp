@@ -5,6 +5,31 @@
 
 using namespace rtk;
 
+namespace {
+
+/**
+ * Probe slice mounted on the Extra bag to exercise late injection.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+const Slice<TMap<FString, FString>> &GetRouteProbeSlice() {
+  static const Slice<TMap<FString, FString>> ProbeSlice = [] {
+    SliceBuilder<TMap<FString, FString>> Builder =
+        sliceBuilder<TMap<FString, FString>>(TEXT("routeProbe"),
+                                             TMap<FString, FString>());
+    createCase(Builder, TEXT("hit"),
+               [](const TMap<FString, FString> &State,
+                  const Action<FEmptyPayload> &) {
+                 TMap<FString, FString> Next = State;
+                 Next.Add(TEXT("routeProbe"), TEXT("hit"));
+                 return Next;
+               });
+    return buildSlice(Builder);
+  }();
+  return ProbeSlice;
+}
+
+} // namespace
+
 /**
  * Test: StoreReducer processes NPC creation across all slices
  * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
@@ -215,3 +240,78 @@ bool FStoreRemoveNonActiveTest::RunTest(const FString &Parameters) {
 
   return true;
 }
+
+/**
+ * Test: inside one effect batch, removing an NPC and adding it back keeps the
+ * new NPC's directive; the removal cascade does not run after the re-add
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FStoreRemoveReaddBatchTest, "ForbocAI.Integration.Store.RemoveReaddBatch",
+    EAutomationTestFlags_ApplicationContextMask |
+        EAutomationTestFlags::EngineFilter)
+bool FStoreRemoveReaddBatchTest::RunTest(const FString &Parameters) {
+  EnhancedStore<FStoreState> Store = createStore();
+
+  FNPCInternalState Npc;
+  Npc.Id = TEXT("npc_readd");
+  Npc.Persona = TEXT("Returning");
+  Store.dispatch(NPCSlice::Actions::SetNPCInfo(Npc));
+
+  {
+    const ScopedEffectBatch Batch;
+    Store.dispatch(NPCSlice::Actions::RemoveNPC(TEXT("npc_readd")));
+    Store.dispatch(NPCSlice::Actions::SetNPCInfo(Npc));
+    Store.dispatch(DirectiveSlice::Actions::DirectiveRunStarted(
+        TEXT("dir_readd"), TEXT("npc_readd"), TEXT("observe")));
+  }
+
+  TestTrue("NPC is back",
+           NPCSlice::SelectNPCById(Store.getState().NPCs, TEXT("npc_readd"))
+               .hasValue);
+  TestEqual("Re-added NPC keeps its directive",
+            Store.getState().Directives.ActiveDirectiveId,
+            FString(TEXT("dir_readd")));
+  return true;
+}
+
+/**
+ * Test: actions reach only the slices with a case for their type, and slices
+ * mounted after startup join the routing table
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStoreSliceRoutingTest,
+                                 "ForbocAI.Integration.Store.SliceRouting",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FStoreSliceRoutingTest::RunTest(const FString &Parameters) {
+  const AnyAction Started =
+      GhostSlice::Actions::GhostSessionStarted(TEXT("gs_r"), TEXT("running"));
+  const TArray<FString> GhostRoutes = routedSliceNames(Started.Type);
+  TestEqual("Ghost action has one route", GhostRoutes.Num(), 1);
+  TestTrue("Ghost action routes to ghost",
+           GhostRoutes.Contains(TEXT("ghost")));
+  TestEqual("Unknown action has no route",
+            routedSliceNames(TEXT("nobody/handles")).Num(), 0);
+
+  FStoreState State;
+  State = StoreReducer(State, Started);
+  TestEqual("Routed slice updated", State.Ghost.Status,
+            FString(TEXT("running")));
+  TestEqual("Unrouted slice untouched", State.Bridge.Status,
+            FString(TEXT("idle")));
+
+  const AnyAction Probe = createAction(TEXT("routeProbe/hit"))();
+  if (routedSliceNames(Probe.Type).Num() == 0) {
+    TestFalse("Probe ignored before mount",
+              StoreReducer(State, Probe).Extra.Contains(TEXT("routeProbe")));
+    mountSlice(&FStoreState::Extra, &GetRouteProbeSlice);
+  }
+  TestTrue("Probe routed after mount",
+           routedSliceNames(Probe.Type).Contains(TEXT("routeProbe")));
+  const FStoreState Probed = StoreReducer(State, Probe);
+  TestTrue("Mounted slice reduces", Probed.Extra.Contains(TEXT("routeProbe")));
+  TestEqual("Earlier state kept", Probed.Ghost.Status,
+            FString(TEXT("running")));
+  return true;
+}
@@ -0,0 +1,180 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "RuntimeStore.h"
+#include "StoreSnapshot.h"
+
+namespace {
+
+/**
+ * Root state with one record in every persisted section.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+FStoreState MakeSnapshotFixture() {
+  FStoreState State;
+
+  FNPCInternalState Npc;
+  Npc.Id = TEXT("snap_npc");
+  Npc.Persona = TEXT("Lighthouse keeper");
+  State = StoreReducer(State, NPCSlice::Actions::SetNPCInfo(Npc));
+
+  FMemoryItem Memory;
+  Memory.Id = TEXT("mem_1");
+  Memory.Text = TEXT("The lamp went dark at midnight");
+  Memory.Embedding = {0.25f, -0.5f, 1.0f};
+  Memory.Timestamp = 1700000000;
+  State = StoreReducer(State, MemorySlice::Actions::MemoryStoreSuccess(Memory));
+
+  State = StoreReducer(State, DirectiveSlice::Actions::DirectiveRunStarted(
+                                  TEXT("run_1"), TEXT("snap_npc"),
+                                  TEXT("A ship approaches")));
+
+  State.Extra.Add(TEXT("game.weather"), TEXT("storm"));
+  return State;
+}
+
+} // namespace
+
+/**
+ * Test: snapshots round-trip every persisted section, compressed or not
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStoreSnapshotRoundTripTest,
+                                 "ForbocAI.Integration.Snapshot.RoundTrip",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FStoreSnapshotRoundTripTest::RunTest(const FString &Parameters) {
+  const FStoreState Source = MakeSnapshotFixture();
+
+  for (const StoreSnapshot::ECompression Compression :
+       {StoreSnapshot::ECompression::None, StoreSnapshot::ECompression::Zlib}) {
+    StoreSnapshot::FSaveOptions Options;
+    Options.Compression = Compression;
+    const TArray<uint8> Bytes = StoreSnapshot::SaveState(Source, Options);
+    const auto Loaded = StoreSnapshot::LoadState(Bytes, FStoreState());
+
+    TestFalse("Snapshot accepted", Loaded.isLeft);
+    if (Loaded.isLeft) {
+      return false;
+    }
+    const FStoreState &State = Loaded.right.State;
+    TestEqual("All SDK sections restored",
+              Loaded.right.Report.RestoredSections.Num(), 5);
+    TestEqual("Nothing skipped", Loaded.right.Report.SkippedSections.Num(), 0);
+
+    const auto Npc = NPCSlice::SelectNPCById(State.NPCs, TEXT("snap_npc"));
+    TestTrue("NPC restored", Npc.hasValue);
+    TestEqual("NPC persona", Npc.value.Persona,
+              FString(TEXT("Lighthouse keeper")));
+    TestEqual("Active NPC", State.NPCs.ActiveNpcId,
+              FString(TEXT("snap_npc")));
+
+    const auto Memory =
+        MemorySlice::SelectMemoryById(State.Memory, TEXT("mem_1"));
+    TestTrue("Memory restored", Memory.hasValue);
+    TestEqual("Memory embedding", Memory.value.Embedding.Num(), 3);
+    TestEqual("Memory timestamp", Memory.value.Timestamp,
+              static_cast<int64>(1700000000));
+
+    TestEqual("Directive restored",
+              DirectiveSlice::SelectDirectivesForNpc(State.Directives,
+                                                     TEXT("snap_npc"))
+                  .Num(),
+              1);
+    TestEqual("Extra restored", State.Extra.FindRef(TEXT("game.weather")),
+              FString(TEXT("storm")));
+  }
+  return true;
+}
+
+/**
+ * Test: foreign, truncated and newer-format snapshots are rejected
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStoreSnapshotRejectTest,
+                                 "ForbocAI.Integration.Snapshot.Reject",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FStoreSnapshotRejectTest::RunTest(const FString &Parameters) {
+  const TArray<uint8> Bytes = StoreSnapshot::SaveState(MakeSnapshotFixture());
+
+  TArray<uint8> Foreign = Bytes;
+  Foreign[0] ^= 0xFF;
+  TestTrue("Bad magic rejected",
+           StoreSnapshot::LoadState(Foreign, FStoreState()).isLeft);
+
+  TArray<uint8> Newer = Bytes;
+  Newer[4] = static_cast<uint8>(StoreSnapshot::SnapshotFormatVersion + 1);
+  TestTrue("Newer format rejected",
+           StoreSnapshot::LoadState(Newer, FStoreState()).isLeft);
+
+  TArray<uint8> Truncated = Bytes;
+  Truncated.SetNum(Bytes.Num() / 2);
+  TestTrue("Truncated snapshot rejected",
+           StoreSnapshot::LoadState(Truncated, FStoreState()).isLeft);
+
+  TestTrue("Empty input rejected",
+           StoreSnapshot::LoadState(TArray<uint8>(), FStoreState()).isLeft);
+  return true;
+}
+
+/**
+ * Test: sections unknown to the reader are skipped and reported
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStoreSnapshotUnknownSectionTest,
+                                 "ForbocAI.Integration.Snapshot.UnknownSection",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FStoreSnapshotUnknownSectionTest::RunTest(const FString &Parameters) {
+  StoreSnapshot::registerSnapshotSection(StoreSnapshot::FSnapshotSection{
+      TEXT("test.retired"), 3,
+      [](FArchive &Ar, const FStoreState &) {
+        int32 Marker = 42;
+        Ar << Marker;
+      },
+      [](FArchive &Ar, FStoreState &, uint32) {
+        int32 Marker = 0;
+        Ar << Marker;
+      }});
+  const TArray<uint8> Bytes = StoreSnapshot::SaveState(MakeSnapshotFixture());
+  StoreSnapshot::unregisterSnapshotSection(TEXT("test.retired"));
+
+  const auto Loaded = StoreSnapshot::LoadState(Bytes, FStoreState());
+  TestFalse("Snapshot accepted", Loaded.isLeft);
+  TestTrue("Retired section skipped",
+           Loaded.right.Report.SkippedSections.Contains(
+               FString(TEXT("test.retired"))));
+  TestTrue("Remaining sections restored",
+           NPCSlice::SelectNPCById(Loaded.right.State.NPCs, TEXT("snap_npc"))
+               .hasValue);
+  return true;
+}
+
+/**
+ * Test: restoring into a live store hydrates it through one dispatch
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStoreSnapshotHydrateTest,
+                                 "ForbocAI.Integration.Snapshot.Hydrate",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FStoreSnapshotHydrateTest::RunTest(const FString &Parameters) {
+  rtk::EnhancedStore<FStoreState> Source = ConfigureStore();
+  Source.dispatch(StoreActions::HydrateStore(MakeSnapshotFixture()));
+  const TArray<uint8> Bytes = StoreSnapshot::SaveStore(Source);
+
+  rtk::EnhancedStore<FStoreState> Target = ConfigureStore();
+  int32 Notifications = 0;
+  Target.subscribe([&Notifications]() { ++Notifications; });
+  const auto Restored = StoreSnapshot::RestoreStore(Target, Bytes);
+
+  TestFalse("Restore succeeded", Restored.isLeft);
+  TestEqual("One notification", Notifications, 1);
+  TestEqual("Active NPC hydrated", Target.getState().NPCs.ActiveNpcId,
+            FString(TEXT("snap_npc")));
+  TestTrue("Memory hydrated",
+           MemorySlice::SelectMemoryById(Target.getState().Memory,
+                                         TEXT("mem_1"))
+               .hasValue);
+  return true;
+}
@@ -1,5 +1,6 @@
 #include "Core/rtk.hpp"
 #include "CoreMinimal.h"
+#include "Memory/EmbeddingStore.h"
 #include "Memory/MemorySlice.h"
 #include "Misc/AutomationTest.h"
 
@@ -176,3 +177,105 @@ bool FMemorySliceClearTest::RunTest(const FString &Parameters) {
 
   return true;
 }
+
+/**
+ * Test: detached records carry no vectors into state and their embeddings are
+ * held by id in the side store
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMemorySliceEmbeddingSideStoreTest,
+                                 "ForbocAI.Slices.Memory.EmbeddingSideStore",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FMemorySliceEmbeddingSideStoreTest::RunTest(const FString &Parameters) {
+  Slice<FMemorySliceState> MemSlice = CreateMemorySlice();
+  FMemorySliceState State;
+  EmbeddingStore::Reset();
+
+  FMemoryItem Stored;
+  Stored.Id = TEXT("mem_vec_1");
+  Stored.Text = TEXT("The bridge is out");
+  Stored.Embedding = {0.25f, -0.5f, 1.0f};
+  TestEqual("Action creator keeps the payload as given",
+            MemorySlice::Actions::MemoryStoreSuccess(Stored)
+                .getPayload<FMemoryItem>()
+                .value.Embedding.Num(),
+            3);
+  TestEqual("Action creator leaves the side store alone",
+            EmbeddingStore::Num(), 0);
+  State = MemSlice.Reducer(State, MemorySlice::Actions::MemoryStoreSuccess(
+                                      EmbeddingStore::Detach(Stored)));
+
+  FMemoryItem Recalled;
+  Recalled.Id = TEXT("mem_vec_2");
+  Recalled.Text = TEXT("The ferry runs at dawn");
+  Recalled.Embedding = {1.0f, 0.0f, 0.0f};
+  FMemoryItem Bare;
+  Bare.Id = TEXT("mem_vec_3");
+  State = MemSlice.Reducer(State, MemorySlice::Actions::MemoryRecallSuccess(
+                                      EmbeddingStore::DetachAll(
+                                          {Recalled, Bare})));
+
+  func::Maybe<FMemoryItem> InState = SelectMemoryById(State, TEXT("mem_vec_1"));
+  TestTrue("Stored record in state", InState.hasValue);
+  TestEqual("State record carries no embedding",
+            InState.value.Embedding.Num(), 0);
+  TestEqual("Recalled record carries no embedding",
+            SelectMemoryById(State, TEXT("mem_vec_2")).value.Embedding.Num(), 0);
+
+  func::Maybe<TArray<float>> Vector = EmbeddingStore::Find(TEXT("mem_vec_1"));
+  TestTrue("Stored embedding held by id", Vector.hasValue);
+  TestEqual("Stored embedding intact", Vector.value,
+            TArray<float>({0.25f, -0.5f, 1.0f}));
+  TestTrue("Recalled embedding held by id",
+           EmbeddingStore::Find(TEXT("mem_vec_2")).hasValue);
+  TestFalse("Items without vectors add nothing",
+            EmbeddingStore::Find(TEXT("mem_vec_3")).hasValue);
+
+  EmbeddingStore::Reset();
+  TestEqual("Reset empties the side store", EmbeddingStore::Num(), 0);
+  return true;
+}
+
+/**
+ * Test: the side store stays within its cap, evicting oldest first, and
+ * stripping a locally stored record drops its held copy
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMemorySliceEmbeddingStoreBoundTest,
+                                 "ForbocAI.Slices.Memory.EmbeddingStoreBound",
+                                 EAutomationTestFlags_ApplicationContextMask |
+                                     EAutomationTestFlags::EngineFilter)
+bool FMemorySliceEmbeddingStoreBoundTest::RunTest(const FString &Parameters) {
+  EmbeddingStore::Reset();
+  for (int32 Index = 0; Index <= EmbeddingStore::MAX_HELD_EMBEDDINGS;
+       ++Index) {
+    EmbeddingStore::Put(FString::Printf(TEXT("mem_cap_%d"), Index),
+                        TArray<float>({1.0f}));
+  }
+  TestEqual("Store holds at most the cap", EmbeddingStore::Num(),
+            EmbeddingStore::MAX_HELD_EMBEDDINGS);
+  TestFalse("Oldest embedding evicted",
+            EmbeddingStore::Find(TEXT("mem_cap_0")).hasValue);
+  TestTrue("Next oldest still held",
+           EmbeddingStore::Find(TEXT("mem_cap_1")).hasValue);
+
+  EmbeddingStore::Put(TEXT("mem_cap_1"), TArray<float>({2.0f}));
+  TestEqual("Overwrite does not grow the store", EmbeddingStore::Num(),
+            EmbeddingStore::MAX_HELD_EMBEDDINGS);
+  TestEqual("Overwrite replaces the vector",
+            EmbeddingStore::Find(TEXT("mem_cap_1")).value,
+            TArray<float>({2.0f}));
+
+  FMemoryItem Local;
+  Local.Id = TEXT("mem_cap_5");
+  Local.Embedding = {0.5f};
+  const FMemoryItem Record = EmbeddingStore::Strip(Local);
+  TestEqual("Stripped record carries no embedding", Record.Embedding.Num(),
+            0);
+  TestFalse("Strip drops the held copy",
+            EmbeddingStore::Find(TEXT("mem_cap_5")).hasValue);
+
+  EmbeddingStore::Reset();
+  return true;
+}
@@ -331,17 +331,18 @@ BuildCortexCompletePayload(const FCortexCompleteRequest &Request) {
 template <typename Arg, typename Result>
 inline ThunkAction<Result, FStoreState> MakeEndpoint(
     const FString &EndpointName, const Arg &ArgValue,
-    std::function<func::AsyncResult<func::HttpResult<Result>>(const Arg &)>
+    std::function<func::AsyncResult<func::HttpResult<Result>>(
+        const Arg &, const func::AbortSignal &)>
         RequestBuilder,
     const TArray<FApiEndpointTag> &ProvidesTags = TArray<FApiEndpointTag>(),
-    const TArray<FApiEndpointTag> &InvalidatesTags =
-        TArray<FApiEndpointTag>()) {
+    const TArray<FApiEndpointTag> &InvalidatesTags = TArray<FApiEndpointTag>(),
+    const func::AbortSignal &Signal = func::AbortSignal()) {
   ApiEndpoint<Arg, Result> Endpoint;
   Endpoint.EndpointName = EndpointName;
   Endpoint.ProvidesTags = ProvidesTags;
   Endpoint.InvalidatesTags = InvalidatesTags;
-  Endpoint.RequestBuilder = RequestBuilder;
-  return injectEndpoint(ForbocAiApi, Endpoint)(ArgValue);
+  Endpoint.AbortableRequestBuilder = RequestBuilder;
+  return injectEndpoint(ForbocAiApi, Endpoint)(ArgValue, Signal);
 }
 
 /**
@@ -352,13 +353,15 @@ inline ThunkAction<Result, FStoreState> MakeEndpoint(
 template <typename Result>
 inline ThunkAction<Result, FStoreState>
 MakeGet(const FString &EndpointName, const FString &Url,
-        const TArray<FApiEndpointTag> &Tags = TArray<FApiEndpointTag>()) {
+        const TArray<FApiEndpointTag> &Tags = TArray<FApiEndpointTag>(),
+        const func::AbortSignal &Signal = func::AbortSignal()) {
   return MakeEndpoint<rtk::FEmptyPayload, Result>(
       EndpointName, rtk::FEmptyPayload{},
-      [Url](const rtk::FEmptyPayload &) {
-        return func::AsyncHttp::Get<Result>(Url, SDKConfig::GetApiKey());
+      [Url](const rtk::FEmptyPayload &, const func::AbortSignal &RunSignal) {
+        return func::AsyncHttp::Get<Result>(Url, SDKConfig::GetApiKey(),
+                                            RunSignal);
       },
-      Tags);
+      Tags, TArray<FApiEndpointTag>(), Signal);
 }
 
 /**
@@ -370,14 +373,15 @@ template <typename Request, typename Result>
 inline ThunkAction<Result, FStoreState> MakePost(
     const FString &EndpointName, const FString &Url,
     const Request &RequestValue,
-    const TArray<FApiEndpointTag> &Invalidates = TArray<FApiEndpointTag>()) {
+    const TArray<FApiEndpointTag> &Invalidates = TArray<FApiEndpointTag>(),
+    const func::AbortSignal &Signal = func::AbortSignal()) {
   return MakeEndpoint<Request, Result>(
       EndpointName, RequestValue,
-      [Url](const Request &Arg) {
+      [Url](const Request &Arg, const func::AbortSignal &RunSignal) {
         return func::AsyncHttp::Post<Result>(Url, ToJson(Arg),
-                                             SDKConfig::GetApiKey());
+                                             SDKConfig::GetApiKey(), RunSignal);
       },
-      TArray<FApiEndpointTag>(), Invalidates);
+      TArray<FApiEndpointTag>(), Invalidates, Signal);
 }
 
 /**
@@ -388,13 +392,15 @@ inline ThunkAction<Result, FStoreState> MakePost(
 template <typename Result>
 inline ThunkAction<Result, FStoreState> MakeDelete(
     const FString &EndpointName, const FString &Url,
-    const TArray<FApiEndpointTag> &Invalidates = TArray<FApiEndpointTag>()) {
+    const TArray<FApiEndpointTag> &Invalidates = TArray<FApiEndpointTag>(),
+    const func::AbortSignal &Signal = func::AbortSignal()) {
   return MakeEndpoint<rtk::FEmptyPayload, Result>(
       EndpointName, rtk::FEmptyPayload{},
-      [Url](const rtk::FEmptyPayload &) {
-        return func::AsyncHttp::Delete<Result>(Url, SDKConfig::GetApiKey());
+      [Url](const rtk::FEmptyPayload &, const func::AbortSignal &RunSignal) {
+        return func::AsyncHttp::Delete<Result>(Url, SDKConfig::GetApiKey(),
+                                               RunSignal);
       },
-      TArray<FApiEndpointTag>(), Invalidates);
+      TArray<FApiEndpointTag>(), Invalidates, Signal);
 }
 
 /**
@@ -446,16 +452,18 @@ inline ThunkAction<Result, FStoreState> MakePostWithCodec(
     const Request &RequestValue,
     std::function<FString(const Request &)> Encoder,
     std::function<bool(const FString &, Result &)> Decoder,
-    const TArray<FApiEndpointTag> &Invalidates = TArray<FApiEndpointTag>()) {
+    const TArray<FApiEndpointTag> &Invalidates = TArray<FApiEndpointTag>(),
+    const func::AbortSignal &Signal = func::AbortSignal()) {
   return MakeEndpoint<Request, Result>(
       EndpointName, RequestValue,
-      [Url, Encoder, Decoder](const Request &Arg) {
+      [Url, Encoder, Decoder](const Request &Arg,
+                              const func::AbortSignal &RunSignal) {
         return DecodeHttpResult<Result>(
             func::AsyncHttp::Post<FString>(Url, Encoder(Arg),
-                                           SDKConfig::GetApiKey()),
+                                           SDKConfig::GetApiKey(), RunSignal),
             Decoder);
       },
-      TArray<FApiEndpointTag>(), Invalidates);
+      TArray<FApiEndpointTag>(), Invalidates, Signal);
 }
 
 /**
@@ -470,9 +478,11 @@ inline ThunkAction<Result, FStoreState> MakeGetWithCodec(
     const TArray<FApiEndpointTag> &Tags = TArray<FApiEndpointTag>()) {
   return MakeEndpoint<rtk::FEmptyPayload, Result>(
       EndpointName, rtk::FEmptyPayload{},
-      [Url, Decoder](const rtk::FEmptyPayload &) {
+      [Url, Decoder](const rtk::FEmptyPayload &,
+                     const func::AbortSignal &Signal) {
         return DecodeHttpResult<Result>(
-            func::AsyncHttp::Get<FString>(Url, SDKConfig::GetApiKey()),
+            func::AsyncHttp::Get<FString>(Url, SDKConfig::GetApiKey(),
+                                          Signal),
             Decoder);
       },
       Tags);
@@ -489,9 +499,11 @@ MakePostRawWithCodec(const FString &EndpointName, const FString &Url,
                      const FString &PayloadJson,
                      std::function<bool(const FString &, Result &)> Decoder) {
   return MakeEndpoint<FString, Result>(
-      EndpointName, PayloadJson, [Url, Decoder](const FString &Arg) {
+      EndpointName, PayloadJson,
+      [Url, Decoder](const FString &Arg, const func::AbortSignal &Signal) {
         return DecodeHttpResult<Result>(
-            func::AsyncHttp::Post<FString>(Url, Arg, SDKConfig::GetApiKey()),
+            func::AsyncHttp::Post<FString>(Url, Arg, SDKConfig::GetApiKey(),
+                                           Signal),
             Decoder);
       });
 }
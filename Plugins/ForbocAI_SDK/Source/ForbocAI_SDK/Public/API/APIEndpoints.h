@@ -88,16 +88,21 @@ inline Thunk<FCortexInitResponse> postCortexInit(const FCortexInitRequest &Reque
  * User Story: As remote inference flows, I need a reusable endpoint thunk so a
  * configured cortex session can produce a completion from one helper.
  */
-inline Thunk<FCortexResponse> postCortexComplete(const FString &CortexId,
-                               const FCortexCompleteRequest &Request) {
+inline Thunk<FCortexResponse>
+postCortexComplete(const FString &CortexId,
+                   const FCortexCompleteRequest &Request,
+                   const func::AbortSignal &Signal = func::AbortSignal()) {
   return Detail::MakeEndpoint<FCortexCompleteRequest, FCortexResponse>(
       TEXT("postCortexComplete"), Request,
-      [CortexId](const FCortexCompleteRequest &Arg) {
+      [CortexId](const FCortexCompleteRequest &Arg,
+                 const func::AbortSignal &RunSignal) {
         return func::AsyncHttp::Post<FCortexResponse>(
             SDKConfig::GetApiUrl() + TEXT("/cortex/") +
                 Detail::Encode(CortexId) + TEXT("/complete"),
-            Detail::BuildCortexCompletePayload(Arg), SDKConfig::GetApiKey());
-      });
+            Detail::BuildCortexCompletePayload(Arg), SDKConfig::GetApiKey(),
+            RunSignal);
+      },
+      TArray<FApiEndpointTag>(), TArray<FApiEndpointTag>(), Signal);
 }
 
 /**
@@ -105,14 +110,15 @@ inline Thunk<FCortexResponse> postCortexComplete(const FString &CortexId,
  * User Story: As NPC processing flows, I need a reusable endpoint thunk so the
  * SDK can run one process turn against a remote NPC.
  */
-inline Thunk<FNPCProcessResponse> postNpcProcess(const FString &NpcId,
-                           const FNPCProcessRequest &Request) {
+inline Thunk<FNPCProcessResponse>
+postNpcProcess(const FString &NpcId, const FNPCProcessRequest &Request,
+               const func::AbortSignal &Signal = func::AbortSignal()) {
   return Detail::MakePostWithCodec<FNPCProcessRequest, FNPCProcessResponse>(
       TEXT("postNpcProcess"),
       SDKConfig::GetApiUrl() + TEXT("/npcs/") + Detail::Encode(NpcId) +
           TEXT("/process"),
       Request, Detail::EncodeNpcProcessRequest,
-      Detail::DecodeNpcProcessResponse);
+      Detail::DecodeNpcProcessResponse, TArray<FApiEndpointTag>(), Signal);
 }
 
 /**
@@ -160,15 +166,16 @@ inline Thunk<FVerdictResponse> postVerdict(const FString &NpcId, const FVerdictR
  * User Story: As remote memory persistence flows, I need a reusable endpoint
  * thunk so memory items can be stored for a specific NPC.
  */
-inline Thunk<rtk::FEmptyPayload> postMemoryStore(const FString &NpcId,
-                            const FRemoteMemoryStoreRequest &Request) {
+inline Thunk<rtk::FEmptyPayload>
+postMemoryStore(const FString &NpcId, const FRemoteMemoryStoreRequest &Request,
+                const func::AbortSignal &Signal = func::AbortSignal()) {
   TArray<FApiEndpointTag> Invalidates;
   Invalidates.Add(FApiEndpointTag{TEXT("Memory"), NpcId});
   return Detail::MakePost<FRemoteMemoryStoreRequest, rtk::FEmptyPayload>(
       TEXT("postMemoryStore"),
       SDKConfig::GetApiUrl() + TEXT("/npcs/") + Detail::Encode(NpcId) +
           TEXT("/memory"),
-      Request, Invalidates);
+      Request, Invalidates, Signal);
 }
 
 /**
@@ -176,13 +183,15 @@ inline Thunk<rtk::FEmptyPayload> postMemoryStore(const FString &NpcId,
  * User Story: As remote memory browsing flows, I need a reusable endpoint
  * thunk so stored memories can be listed for a specific NPC.
  */
-inline Thunk<TArray<FMemoryItem>> getMemoryList(const FString &NpcId) {
+inline Thunk<TArray<FMemoryItem>>
+getMemoryList(const FString &NpcId,
+              const func::AbortSignal &Signal = func::AbortSignal()) {
   TArray<FApiEndpointTag> Tags;
   Tags.Add(FApiEndpointTag{TEXT("Memory"), NpcId});
   return Detail::MakeGet<TArray<FMemoryItem>>(
       TEXT("getMemoryList"), SDKConfig::GetApiUrl() + TEXT("/npcs/") +
                                  Detail::Encode(NpcId) + TEXT("/memory"),
-      Tags);
+      Tags, Signal);
 }
 
 /**
@@ -190,13 +199,15 @@ inline Thunk<TArray<FMemoryItem>> getMemoryList(const FString &NpcId) {
  * User Story: As remote recall flows, I need a reusable endpoint thunk so the
  * runtime can fetch relevant memories for a specific NPC.
  */
-inline Thunk<TArray<FMemoryItem>> postMemoryRecall(const FString &NpcId,
-                             const FRemoteMemoryRecallRequest &Request) {
+inline Thunk<TArray<FMemoryItem>>
+postMemoryRecall(const FString &NpcId,
+                 const FRemoteMemoryRecallRequest &Request,
+                 const func::AbortSignal &Signal = func::AbortSignal()) {
   return Detail::MakePost<FRemoteMemoryRecallRequest, TArray<FMemoryItem>>(
       TEXT("postMemoryRecall"),
       SDKConfig::GetApiUrl() + TEXT("/npcs/") + Detail::Encode(NpcId) +
           TEXT("/memory/recall"),
-      Request);
+      Request, TArray<FApiEndpointTag>(), Signal);
 }
 
 /**
@@ -204,14 +215,16 @@ inline Thunk<TArray<FMemoryItem>> postMemoryRecall(const FString &NpcId,
  * User Story: As memory reset flows, I need a reusable endpoint thunk so the
  * runtime can clear stored remote memories for a specific NPC.
  */
-inline Thunk<rtk::FEmptyPayload> deleteMemoryClear(const FString &NpcId) {
+inline Thunk<rtk::FEmptyPayload>
+deleteMemoryClear(const FString &NpcId,
+                  const func::AbortSignal &Signal = func::AbortSignal()) {
   TArray<FApiEndpointTag> Invalidates;
   Invalidates.Add(FApiEndpointTag{TEXT("Memory"), NpcId});
   return Detail::MakeDelete<rtk::FEmptyPayload>(
       TEXT("deleteMemoryClear"),
       SDKConfig::GetApiUrl() + TEXT("/npcs/") + Detail::Encode(NpcId) +
           TEXT("/memory/clear"),
-      Invalidates);
+      Invalidates, Signal);
 }
 
 /**
@@ -235,15 +248,17 @@ inline Thunk<FValidationResult> postBridgeValidate(const FString &NpcId,
  * User Story: As typed bridge validation flows, I need a reusable endpoint
  * thunk so structured validation requests can be submitted consistently.
  */
-inline Thunk<FValidationResult> postBridgeValidate(const FString &NpcId,
-                               const FBridgeValidateRequest &Request) {
+inline Thunk<FValidationResult>
+postBridgeValidate(const FString &NpcId, const FBridgeValidateRequest &Request,
+                   const func::AbortSignal &Signal = func::AbortSignal()) {
   const FString Url = NpcId.IsEmpty()
                           ? SDKConfig::GetApiUrl() + TEXT("/bridge/validate")
                           : SDKConfig::GetApiUrl() + TEXT("/bridge/validate/") +
                                 Detail::Encode(NpcId);
   return Detail::MakePostWithCodec<FBridgeValidateRequest, FValidationResult>(
       TEXT("postBridgeValidate"), Url, Request,
-      Detail::EncodeBridgeValidateRequest, Detail::DecodeValidationResult);
+      Detail::EncodeBridgeValidateRequest, Detail::DecodeValidationResult,
+      TArray<FApiEndpointTag>(), Signal);
 }
 
 /**
@@ -324,11 +339,13 @@ inline Thunk<rtk::FEmptyPayload> deleteRule(const FString &RulesetId) {
  * User Story: As ghost test execution flows, I need a reusable endpoint thunk
  * so a fully specified ghost run can be started remotely.
  */
-inline Thunk<FGhostRunResponse> postGhostRun(const FGhostRunRequest &Request) {
+inline Thunk<FGhostRunResponse>
+postGhostRun(const FGhostRunRequest &Request,
+             const func::AbortSignal &Signal = func::AbortSignal()) {
   return Detail::MakePostWithCodec<FGhostRunRequest, FGhostRunResponse>(
       TEXT("postGhostRun"), SDKConfig::GetApiUrl() + TEXT("/ghost/run"),
       Request, Detail::ToJson<FGhostRunRequest>,
-      Detail::DecodeGhostRunResponse);
+      Detail::DecodeGhostRunResponse, TArray<FApiEndpointTag>(), Signal);
 }
 
 /**
@@ -336,9 +353,11 @@ inline Thunk<FGhostRunResponse> postGhostRun(const FGhostRunRequest &Request) {
  * User Story: As ghost test setup flows, I need a convenience endpoint thunk
  * so config values can be turned into a run request automatically.
  */
-inline Thunk<FGhostRunResponse> postGhostRun(const FGhostConfig &Config) {
+inline Thunk<FGhostRunResponse>
+postGhostRun(const FGhostConfig &Config,
+             const func::AbortSignal &Signal = func::AbortSignal()) {
   return postGhostRun(
-      TypeFactory::GhostRunRequest(Config.TestSuite, Config.Duration));
+      TypeFactory::GhostRunRequest(Config.TestSuite, Config.Duration), Signal);
 }
 
 /**
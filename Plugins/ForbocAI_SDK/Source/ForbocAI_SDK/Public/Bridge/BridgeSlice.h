@@ -97,6 +97,30 @@ SetAvailableRulesetsActionCreator() {
   return ActionCreator;
 }
 
+/**
+ * Returns the memoized action creator for inserting or replacing one
+ * available ruleset by id.
+ * User Story: As ruleset registration, I need a delta action so registrations
+ * applied in one batch each land instead of the last list winning.
+ */
+inline const ActionCreator<FDirectiveRuleSet> &
+UpsertAvailableRulesetActionCreator() {
+  static const ActionCreator<FDirectiveRuleSet> ActionCreator =
+      createAction<FDirectiveRuleSet>(TEXT("bridge/upsertAvailableRuleset"));
+  return ActionCreator;
+}
+
+/**
+ * Returns the memoized action creator for removing one available ruleset.
+ * User Story: As ruleset deletion, I need a delta action so a delete batched
+ * with other edits removes only its own ruleset.
+ */
+inline const ActionCreator<FString> &RemoveAvailableRulesetActionCreator() {
+  static const ActionCreator<FString> ActionCreator =
+      createAction<FString>(TEXT("bridge/removeAvailableRuleset"));
+  return ActionCreator;
+}
+
 /**
  * Returns the memoized action creator for replacing preset ids.
  * User Story: As preset discovery flows, I need a cached action creator so
@@ -175,6 +199,24 @@ SetAvailableRulesets(const TArray<FDirectiveRuleSet> &Rulesets) {
   return SetAvailableRulesetsActionCreator()(Rulesets);
 }
 
+/**
+ * Builds the action that inserts or replaces one available ruleset.
+ * User Story: As ruleset registration, I need a helper so a saved ruleset is
+ * merged into the catalog without reading state first.
+ */
+inline AnyAction UpsertAvailableRuleset(const FDirectiveRuleSet &Ruleset) {
+  return UpsertAvailableRulesetActionCreator()(Ruleset);
+}
+
+/**
+ * Builds the action that removes a ruleset by Id or RulesetId.
+ * User Story: As ruleset deletion, I need a helper so a removed ruleset is
+ * dropped from the catalog without reading state first.
+ */
+inline AnyAction RemoveAvailableRuleset(const FString &RulesetId) {
+  return RemoveAvailableRulesetActionCreator()(RulesetId);
+}
+
 /**
  * Builds the action that replaces the available preset id list.
  * User Story: As preset discovery flows, I need a helper so available preset
@@ -268,6 +310,32 @@ inline Slice<FBridgeSliceState> CreateBridgeSlice() {
                       Next.AvailableRulesets = Action.PayloadValue;
                       return Next;
                     })
+      | addExtraCase(
+          Actions::UpsertAvailableRulesetActionCreator(),
+          [](const FBridgeSliceState &State,
+             const Action<FDirectiveRuleSet> &Action) -> FBridgeSliceState {
+            FBridgeSliceState Next = State;
+            const int32 Found = Next.AvailableRulesets.IndexOfByPredicate(
+                [&Action](const FDirectiveRuleSet &Ruleset) {
+                  return Ruleset.Id == Action.PayloadValue.Id;
+                });
+            Found != INDEX_NONE
+                ? (void)(Next.AvailableRulesets[Found] = Action.PayloadValue)
+                : (void)Next.AvailableRulesets.Add(Action.PayloadValue);
+            return Next;
+          })
+      | addExtraCase(
+          Actions::RemoveAvailableRulesetActionCreator(),
+          [](const FBridgeSliceState &State,
+             const Action<FString> &Action) -> FBridgeSliceState {
+            FBridgeSliceState Next = State;
+            Next.AvailableRulesets.RemoveAll(
+                [&Action](const FDirectiveRuleSet &Ruleset) {
+                  return Ruleset.Id == Action.PayloadValue ||
+                         Ruleset.RulesetId == Action.PayloadValue;
+                });
+            return Next;
+          })
       | addExtraCase(
           Actions::SetAvailablePresetIdsActionCreator(),
           [](const FBridgeSliceState &State,
@@ -49,14 +49,16 @@ localValidateBridgeThunk(const FAgentAction &Action,
 
 /**
  * Builds the thunk that validates a bridge action through the API.
+ * Signal aborts the validation request.
  * User Story: As remote bridge validation, I need a thunk that checks API
  * prerequisites and stores the resulting validation outcome.
  */
 inline ThunkAction<FValidationResult, FStoreState>
 validateBridgeThunk(const FAgentAction &Action,
                     const FBridgeValidationContext &Context,
-                    const FString &NpcId = TEXT("")) {
-  return [Action, Context, NpcId](
+                    const FString &NpcId = TEXT(""),
+                    const func::AbortSignal &Signal = func::AbortSignal()) {
+  return [Action, Context, NpcId, Signal](
              std::function<AnyAction(const AnyAction &)> Dispatch,
              std::function<FStoreState()> GetState)
              -> func::AsyncResult<FValidationResult> {
@@ -67,8 +69,8 @@ validateBridgeThunk(const FAgentAction &Action,
         : (Dispatch(BridgeSlice::Actions::BridgeValidationPending()),
            func::AsyncChain::then<FValidationResult, FValidationResult>(
                APISlice::Endpoints::postBridgeValidate(
-                   NpcId, TypeFactory::BridgeValidateRequest(Action, Context))(
-                   Dispatch, GetState),
+                   NpcId, TypeFactory::BridgeValidateRequest(Action, Context),
+                   Signal)(Dispatch, GetState),
                [Dispatch](const FValidationResult &Result) {
                  Dispatch(
                      BridgeSlice::Actions::BridgeValidationSuccess(Result));
@@ -174,7 +176,9 @@ inline ThunkAction<TArray<FString>, FStoreState> listRulePresetsThunk() {
 }
 
 /**
- * Builds the thunk that registers or updates a bridge ruleset.
+ * Builds the thunk that registers or updates a bridge ruleset. The saved
+ * version is merged with a delta action rather than a rebuilt list, so
+ * registrations queued in one facade batch do not overwrite each other.
  * User Story: As bridge ruleset editing, I need a thunk that persists a ruleset
  * and refreshes local state with the saved server version.
  */
@@ -190,20 +194,9 @@ registerRulesetThunk(const FDirectiveRuleSet &Ruleset) {
         : func::AsyncChain::then<FDirectiveRuleSet, FDirectiveRuleSet>(
               APISlice::Endpoints::postRuleRegister(Ruleset)(Dispatch,
                                                              GetState),
-              [Dispatch, GetState](const FDirectiveRuleSet &Registered) {
-                const TArray<FDirectiveRuleSet> Updated = [&]() {
-                  TArray<FDirectiveRuleSet> R =
-                      GetState().Bridge.AvailableRulesets;
-                  const int32 Found = R.IndexOfByPredicate(
-                      [&Registered](const FDirectiveRuleSet &X) {
-                        return X.Id == Registered.Id;
-                      });
-                  Found != INDEX_NONE ? (void)(R[Found] = Registered)
-                                      : (void)R.Add(Registered);
-                  return R;
-                }();
+              [Dispatch](const FDirectiveRuleSet &Registered) {
                 Dispatch(
-                    BridgeSlice::Actions::SetAvailableRulesets(Updated));
+                    BridgeSlice::Actions::UpsertAvailableRuleset(Registered));
                 return detail::ResolveAsync(Registered);
               });
   };
@@ -225,17 +218,9 @@ deleteRulesetThunk(const FString &RulesetId) {
         ? detail::RejectAsync<rtk::FEmptyPayload>(ApiKeyError.value)
         : func::AsyncChain::then<rtk::FEmptyPayload, rtk::FEmptyPayload>(
               APISlice::Endpoints::deleteRule(RulesetId)(Dispatch, GetState),
-              [Dispatch, GetState,
-               RulesetId](const rtk::FEmptyPayload &Payload) {
-                TArray<FDirectiveRuleSet> Rulesets =
-                    GetState().Bridge.AvailableRulesets;
-                Rulesets.RemoveAll(
-                    [RulesetId](const FDirectiveRuleSet &Ruleset) {
-                      return Ruleset.Id == RulesetId ||
-                             Ruleset.RulesetId == RulesetId;
-                    });
+              [Dispatch, RulesetId](const rtk::FEmptyPayload &Payload) {
                 Dispatch(
-                    BridgeSlice::Actions::SetAvailableRulesets(Rulesets));
+                    BridgeSlice::Actions::RemoveAvailableRuleset(RulesetId));
                 return detail::ResolveAsync(Payload);
               });
   };
@@ -1,14 +1,19 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Core/TimerWheel.h"
 #include "Core/functional_core.hpp"
+#include "Cortex/ModelVariants.h"
 #include "NPC/NPCId.h"
 #include "NPC/NPCSlice.h"
+#include "NativeEngine.h"
 #include "RuntimeConfig.h"
 #include "RuntimeStore.h"
 #include "Thunks.h"
 #include "HttpManager.h"
 #include "HttpModule.h"
+#include <condition_variable>
+#include <mutex>
 #include <stdexcept>
 
 /**
@@ -25,46 +30,57 @@ namespace Ops {
  * Pumps the HTTP tick loop until the AsyncResult completes.
  * User Story: As synchronous CLI commands, I need async thunks awaited without
  * losing UE HTTP progress so terminal workflows can stay blocking and simple.
- * Allows async thunks to be used in synchronous CLI context.
+ * Allows async thunks to be used in synchronous CLI context. The deadline runs
+ * on the timer wheel and completion wakes the pump loop, so the call returns
+ * as soon as the result lands instead of on the next poll quantum.
  */
 template <typename T>
 T WaitForResult(func::AsyncResult<T> &&Async, double TimeoutSeconds = 15.0) {
-  bool bCompleted = false;
-  T Result{};
-  FString Error;
-
-  Async.then([&bCompleted, &Result](T Value) {
-    Result = Value;
-    bCompleted = true;
-  }).catch_([&bCompleted, &Error](std::string Message) {
-    Error = UTF8_TO_TCHAR(Message.c_str());
-    bCompleted = true;
-  });
-  Async.execute();
-
-  const double StartTime = FPlatformTime::Seconds();
-  struct PollLoop {
-    static void apply(bool &Completed, double Start, double Timeout) {
-      (!Completed && (FPlatformTime::Seconds() - Start) < Timeout)
-          ? (FTaskGraphInterface::Get().ProcessThreadUntilIdle(
-                 ENamedThreads::GameThread),
-             FHttpModule::Get().GetHttpManager().Tick(0.05f),
-             FPlatformProcess::Sleep(0.05f),
-             apply(Completed, Start, Timeout), void())
-          : void();
+  struct FWaitState {
+    std::mutex Mutex;
+    std::condition_variable Settled;
+    bool bCompleted = false;
+    T Result{};
+    std::string Error;
+  };
+  const std::shared_ptr<FWaitState> State = std::make_shared<FWaitState>();
+  const auto Finish = [State](T Value, std::string Message) {
+    {
+      std::lock_guard<std::mutex> Lock(State->Mutex);
+      State->Result = std::move(Value);
+      State->Error = std::move(Message);
+      State->bCompleted = true;
     }
+    State->Settled.notify_all();
   };
-  PollLoop::apply(bCompleted, StartTime, TimeoutSeconds);
 
-  !Error.IsEmpty()
-      ? throw std::runtime_error(TCHAR_TO_UTF8(*Error))
-      : (void)0;
+  Timers::timeout<T>(Async, static_cast<int64>(TimeoutSeconds * 1000.0))
+      .then([Finish](T Value) { Finish(std::move(Value), std::string()); })
+      .catch_([Finish](std::string Message) {
+        Finish(T{}, func::isTimeoutError(Message)
+                        ? std::string("Timed out waiting for async result")
+                        : Message);
+      })
+      .execute();
+
+  struct PollLoop {
+    static void apply(FWaitState &Wait) {
+      FTaskGraphInterface::Get().ProcessThreadUntilIdle(
+          ENamedThreads::GameThread);
+      FHttpModule::Get().GetHttpManager().Tick(0.05f);
+      std::unique_lock<std::mutex> Lock(Wait.Mutex);
+      const bool bDone = Wait.Settled.wait_for(
+          Lock, std::chrono::milliseconds(50),
+          [&Wait]() { return Wait.bCompleted; });
+      Lock.unlock();
+      bDone ? void() : apply(Wait);
+    }
+  };
+  PollLoop::apply(*State);
 
-  !bCompleted
-      ? throw std::runtime_error("Timed out waiting for async result")
-      : (void)0;
+  !State->Error.empty() ? throw std::runtime_error(State->Error) : (void)0;
 
-  return Result;
+  return State->Result;
 }
 
 struct FRuntimeConfig {
@@ -275,6 +291,25 @@ inline FCortexResponse CompleteCortex(rtk::EnhancedStore<FStoreState> &Store,
                        TimeoutSeconds);
 }
 
+/**
+ * Requantizes a local GGUF model to the named quant. Out defaults to the
+ * source path with the quant appended; an up-to-date output is reused.
+ * User Story: As offline model preparation, I need a CLI requantize step so
+ * SKU-specific variants can be built once and shipped with a build.
+ */
+inline func::Either<FString, FString>
+QuantizeModel(const FString &Source, const FString &Quant,
+              const FString &Out = TEXT("")) {
+  const FString OutPath =
+      Out.IsEmpty() ? FPaths::Combine(FPaths::GetPath(Source),
+                                      FPaths::GetBaseFilename(Source) +
+                                          TEXT("-") + Quant.ToUpper() +
+                                          TEXT(".gguf"))
+                    : Out;
+  return ModelVariants::EnsureVariant(Source, OutPath, Quant,
+                                      &Native::Llama::Quantize);
+}
+
 /**
  * Initializes a remote cortex session, optionally using an explicit auth key.
  * User Story: As remote-cortex CLI flows, I need one helper to bootstrap a
@@ -507,6 +542,18 @@ inline rtk::FEmptyPayload InitVector(rtk::EnhancedStore<FStoreState> &Store) {
   return WaitForResult(Store.dispatch(rtk::initNodeVectorThunk()));
 }
 
+/**
+ * Migrates the local memory database to another vector storage mode.
+ * User Story: As vector-runtime CLI flows, I need a migration command so
+ * operators can move existing databases to quantized storage from the shell.
+ */
+inline rtk::FEmptyPayload
+MigrateVectorStorage(rtk::EnhancedStore<FStoreState> &Store,
+                     const FString &VectorStorage) {
+  return WaitForResult(
+      Store.dispatch(rtk::migrateNodeMemoryStorageThunk(VectorStorage)));
+}
+
 /**
  * Generates an embedding vector for the supplied text.
  * User Story: As vector-runtime CLI flows, I need one helper to generate
@@ -0,0 +1,356 @@
+#pragma once
+/**
+ * Action payload storage — small-buffer, type-tagged, pooled
+ * User Story: As store dispatch under thunk-heavy load, I need small action
+ * payloads stored inline and larger ones drawn from a pool so dispatch does
+ * not pay a heap allocation and atomic ref count per action.
+ */
+
+#include "CoreMinimal.h"
+#include "HAL/UnrealMemory.h"
+#include <atomic>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace rtk {
+
+/**
+ * Identifies a payload type for checked access. The id hashes the compiler's
+ * spelling of the type, so every module agrees on it; an address of a
+ * per-type static would differ in each DLL that instantiates it. Types in
+ * anonymous namespaces spell alike across translation units, so payload types
+ * that cross them must be named.
+ * User Story: As actions dispatched from one module and reduced in another, I
+ * need one id per type so checked reads do not fail at the DLL boundary.
+ */
+using FPayloadTypeId = uint64;
+
+namespace PayloadTypeDetail {
+
+inline constexpr uint64 FnvOffset = 14695981039346656037ull;
+inline constexpr uint64 FnvPrime = 1099511628211ull;
+
+constexpr uint64 Mix(uint64 Hash, char Char) {
+  return (Hash ^ static_cast<uint8>(Char)) * FnvPrime;
+}
+
+/**
+ * FNV-1a over Length chars, eight per step so long template spellings stay
+ * inside the compiler's constexpr recursion limit.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+constexpr uint64 Hash(const char *Text, SIZE_T Length, uint64 Seed) {
+  return Length == 0 ? Seed
+         : Length < 8
+             ? Hash(Text + 1, Length - 1, Mix(Seed, Text[0]))
+             : Hash(Text + 8, Length - 8,
+                    Mix(Mix(Mix(Mix(Mix(Mix(Mix(Mix(Seed, Text[0]), Text[1]),
+                                            Text[2]),
+                                        Text[3]),
+                                    Text[4]),
+                                Text[5]),
+                            Text[6]),
+                        Text[7]));
+}
+
+/** Function signature naming T, as spelled by this compiler. */
+template <typename T> constexpr const char *Signature() {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+
+template <typename T>
+inline constexpr FPayloadTypeId Id =
+    Hash(Signature<T>(), std::char_traits<char>::length(Signature<T>()),
+         FnvOffset);
+
+} // namespace PayloadTypeDetail
+
+template <typename T> constexpr FPayloadTypeId PayloadTypeId() {
+  return PayloadTypeDetail::Id<T>;
+}
+
+namespace PayloadPool {
+
+/** Block size classes served from per-thread free lists. */
+inline constexpr int32 NumClasses = 4;
+inline constexpr SIZE_T ClassBytes[NumClasses] = {64, 128, 256, 512};
+
+/** Blocks each thread keeps per class before returning them to the OS heap. */
+inline constexpr int32 MaxCachedPerClass = 64;
+
+/** Alignment of every pooled block and of the inline buffer. */
+inline constexpr SIZE_T BlockAlign = 16;
+
+/**
+ * Returns the size class serving an allocation, or INDEX_NONE when it is
+ * larger than every class.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline int32 ClassFor(SIZE_T Bytes) {
+  return Bytes <= ClassBytes[0]   ? 0
+         : Bytes <= ClassBytes[1] ? 1
+         : Bytes <= ClassBytes[2] ? 2
+         : Bytes <= ClassBytes[3] ? 3
+                                  : INDEX_NONE;
+}
+
+/**
+ * Lifecycle of the calling thread's cache. Trivially destructible, so it can
+ * still be read while statics holding actions are torn down after the cache.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+enum class ECacheState : uint8 { Unused, Live, Destroyed };
+
+inline ECacheState &CacheState() {
+  thread_local ECacheState State = ECacheState::Unused;
+  return State;
+}
+
+/**
+ * Per-thread free lists. A block released on a thread other than the one
+ * that allocated it simply joins that thread's list; blocks are plain memory.
+ * User Story: As dispatch from worker threads, I need pooling without a lock
+ * so allocation stays cheaper than the heap it replaces.
+ */
+struct FThreadCache {
+  void *Free[NumClasses][MaxCachedPerClass];
+  int32 Count[NumClasses];
+
+  FThreadCache() : Count{} { CacheState() = ECacheState::Live; }
+
+  ~FThreadCache() {
+    Drain(0);
+    CacheState() = ECacheState::Destroyed;
+  }
+
+  FThreadCache(const FThreadCache &) = delete;
+  FThreadCache &operator=(const FThreadCache &) = delete;
+
+private:
+  void Drain(int32 Class) {
+    Class < NumClasses
+        ? (Count[Class] > 0
+               ? (FMemory::Free(Free[Class][--Count[Class]]), Drain(Class),
+                  void())
+               : Drain(Class + 1),
+           void())
+        : void();
+  }
+};
+
+/**
+ * Returns the calling thread's free lists.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FThreadCache &Cache() {
+  thread_local FThreadCache Instance;
+  return Instance;
+}
+
+/**
+ * Allocates a block of at least Bytes, from the thread's free list when one
+ * of the right class is cached.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void *Allocate(SIZE_T Bytes) {
+  const int32 Class = ClassFor(Bytes);
+  return (Class == INDEX_NONE || CacheState() == ECacheState::Destroyed)
+             ? FMemory::Malloc(Bytes, BlockAlign)
+             : [Class]() {
+                 FThreadCache &Local = Cache();
+                 return Local.Count[Class] > 0
+                            ? Local.Free[Class][--Local.Count[Class]]
+                            : FMemory::Malloc(ClassBytes[Class], BlockAlign);
+               }();
+}
+
+/**
+ * Returns a block allocated for Bytes to the thread's free list, or to the
+ * heap when the list is full or the block is oversized.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void Release(void *Block, SIZE_T Bytes) {
+  const int32 Class = ClassFor(Bytes);
+  (Class != INDEX_NONE && CacheState() != ECacheState::Destroyed &&
+   Cache().Count[Class] < MaxCachedPerClass)
+      ? (void)(Cache().Free[Class][Cache().Count[Class]++] = Block)
+      : FMemory::Free(Block);
+}
+
+} // namespace PayloadPool
+
+/**
+ * Header of a pooled payload block; the payload object follows it. Copies of
+ * an action share the block, as they shared the old shared_ptr.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FPayloadBlock {
+  std::atomic<int32> RefCount;
+  SIZE_T Bytes;
+
+  static constexpr SIZE_T HeaderBytes =
+      (sizeof(std::atomic<int32>) + sizeof(SIZE_T) + PayloadPool::BlockAlign -
+       1) &
+      ~(PayloadPool::BlockAlign - 1);
+
+  void *Object() { return reinterpret_cast<uint8 *>(this) + HeaderBytes; }
+};
+
+/**
+ * Per-type operations for a stored payload.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FPayloadOps {
+  FPayloadTypeId TypeId;
+  bool bInline;
+  void (*Destroy)(void *Object);
+};
+
+/**
+ * Type-erased action payload. Trivially copyable payloads up to InlineBytes
+ * (empty payloads, ids, counters, flags) live inside the action and copy as
+ * bytes. Anything else lives in a ref-counted pooled block. Access is checked
+ * against the stored type id.
+ * User Story: As rtk::AnyAction, I need a payload that is free to create and
+ * copy for lifecycle actions and still safe to read back by type.
+ */
+class FActionPayload {
+public:
+  static constexpr SIZE_T InlineBytes = 48;
+
+  /**
+   * Whether a payload type is stored inline.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  template <typename T>
+  static constexpr bool StoresInline =
+      sizeof(T) <= InlineBytes && alignof(T) <= PayloadPool::BlockAlign &&
+      std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+
+  FActionPayload() : Ops(nullptr) {}
+
+  /**
+   * Stores a copy of Value.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  template <typename T> static FActionPayload Make(const T &Value) {
+    static_assert(alignof(T) <= PayloadPool::BlockAlign,
+                  "Action payloads must not be over-aligned");
+    FActionPayload Out;
+    Out.Ops = &OpsFor<T>();
+    Emplace<T>(Out, Value, std::bool_constant<StoresInline<T>>());
+    return Out;
+  }
+
+  FActionPayload(const FActionPayload &Other) : Ops(Other.Ops) {
+    FMemory::Memcpy(&Storage, &Other.Storage, sizeof(Storage));
+    IsPooled() ? (void)Storage.Block->RefCount.fetch_add(
+                     1, std::memory_order_relaxed)
+               : void();
+  }
+
+  FActionPayload(FActionPayload &&Other) noexcept : Ops(Other.Ops) {
+    FMemory::Memcpy(&Storage, &Other.Storage, sizeof(Storage));
+    Other.Ops = nullptr;
+  }
+
+  FActionPayload &operator=(FActionPayload Other) noexcept {
+    Swap(Other);
+    return *this;
+  }
+
+  ~FActionPayload() { Reset(); }
+
+  bool HasValue() const { return Ops != nullptr; }
+
+  /** Stored type id, or 0 when empty. */
+  FPayloadTypeId TypeId() const { return Ops ? Ops->TypeId : 0; }
+
+  /** True when a value is held in the inline buffer. */
+  bool IsInline() const { return Ops && Ops->bInline; }
+
+  template <typename T> bool Holds() const {
+    return Ops && Ops->TypeId == PayloadTypeId<T>();
+  }
+
+  /**
+   * Returns the stored value when it has type T, otherwise nullptr.
+   * User Story: As reducers, I need a checked pointer into the payload so a
+   * mismatched creator reads nothing instead of reinterpreting memory.
+   */
+  template <typename T> const T *TryGet() const {
+    return Holds<T>() ? static_cast<const T *>(Data()) : nullptr;
+  }
+
+  /**
+   * Drops the stored value.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  void Reset() {
+    (IsPooled() && Storage.Block->RefCount.fetch_sub(
+                       1, std::memory_order_acq_rel) == 1)
+        ? (Ops->Destroy(Storage.Block->Object()),
+           PayloadPool::Release(Storage.Block, Storage.Block->Bytes), void())
+        : void();
+    Ops = nullptr;
+  }
+
+private:
+  union FStorage {
+    alignas(PayloadPool::BlockAlign) uint8 Buffer[InlineBytes];
+    FPayloadBlock *Block;
+  };
+
+  FStorage Storage;
+  const FPayloadOps *Ops;
+
+  bool IsPooled() const { return Ops && !Ops->bInline; }
+
+  const void *Data() const {
+    return Ops->bInline ? static_cast<const void *>(Storage.Buffer)
+                        : Storage.Block->Object();
+  }
+
+  void Swap(FActionPayload &Other) {
+    FStorage Temp;
+    FMemory::Memcpy(&Temp, &Storage, sizeof(Storage));
+    FMemory::Memcpy(&Storage, &Other.Storage, sizeof(Storage));
+    FMemory::Memcpy(&Other.Storage, &Temp, sizeof(Storage));
+    std::swap(Ops, Other.Ops);
+  }
+
+  template <typename T> static const FPayloadOps &OpsFor() {
+    static const FPayloadOps Ops{
+        PayloadTypeId<T>(), StoresInline<T>,
+        [](void *Object) { static_cast<T *>(Object)->~T(); }};
+    return Ops;
+  }
+
+  template <typename T>
+  static void Emplace(FActionPayload &Out, const T &Value, std::true_type) {
+    new (Out.Storage.Buffer) T(Value);
+  }
+
+  template <typename T>
+  static void Emplace(FActionPayload &Out, const T &Value, std::false_type) {
+    Out.Storage.Block = NewBlock<T>(Value);
+  }
+
+  template <typename T> static FPayloadBlock *NewBlock(const T &Value) {
+    const SIZE_T Bytes = FPayloadBlock::HeaderBytes + sizeof(T);
+    FPayloadBlock *Block =
+        static_cast<FPayloadBlock *>(PayloadPool::Allocate(Bytes));
+    new (&Block->RefCount) std::atomic<int32>(1);
+    Block->Bytes = Bytes;
+    new (Block->Object()) T(Value);
+    return Block;
+  }
+};
+
+} // namespace rtk
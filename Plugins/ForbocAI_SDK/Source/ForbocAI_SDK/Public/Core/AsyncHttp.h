@@ -183,6 +183,9 @@ template <typename T> struct JsonDeserializer<TArray<T>, void> {
 
 /**
  * Builds the generic HTTP request wrapper for an async call.
+ * Aborting Signal cancels the in-flight request; the result then resolves as
+ * a failure carrying the abort message, and a request whose signal already
+ * fired is never sent.
  * User Story: As endpoint helpers, I need one request builder so GET, POST,
  * and DELETE calls share the same network, auth, and decode path.
  */
@@ -190,27 +193,44 @@ template <typename T>
 func::AsyncResult<func::HttpResult<T>>
 CreateRequest(const FString &Verb, const FString &Url,
               const FString &ApiKey = TEXT(""),
-              const FString &Payload = TEXT("")) {
+              const FString &Payload = TEXT(""),
+              const func::AbortSignal &Signal = func::AbortSignal()) {
   return func::createAsyncResult<func::HttpResult<T>>(
-      [Verb, Url, ApiKey, Payload](std::function<void(func::HttpResult<T>)> Resolve,
-                                   std::function<void(std::string)> Reject) {
-        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request =
-            FHttpModule::Get().CreateRequest();
-        Request->SetURL(Url);
-        Request->SetVerb(Verb);
-        Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+      [Verb, Url, ApiKey, Payload,
+       Signal](std::function<void(func::HttpResult<T>)> Resolve,
+               std::function<void(std::string)> Reject) {
         (void)Reject;
-        (void)ApplyPayload(*Request, Verb, Payload);
-        (void)ApplyAuthorization(*Request, ApiKey);
-
-        Request->OnProcessRequestComplete().BindLambda(
-            [Resolve](FHttpRequestPtr Req, FHttpResponsePtr Res,
-                      bool bWasSuccessful) {
-              (void)Req;
-              ResolveRequestCompletion<T>(Resolve, Res, bWasSuccessful);
-            });
-
-        Request->ProcessRequest();
+        Signal.aborted()
+            ? Resolve(func::HttpResult<T>::Failure(
+                  func::abortMessage(Signal.reason()), 0))
+            : [&]() {
+                TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request =
+                    FHttpModule::Get().CreateRequest();
+                Request->SetURL(Url);
+                Request->SetVerb(Verb);
+                Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+                (void)ApplyPayload(*Request, Verb, Payload);
+                (void)ApplyAuthorization(*Request, ApiKey);
+
+                const std::shared_ptr<std::function<void()>> Unsubscribe =
+                    std::make_shared<std::function<void()>>([]() {});
+                Request->OnProcessRequestComplete().BindLambda(
+                    [Resolve, Signal, Unsubscribe](FHttpRequestPtr Req,
+                                                   FHttpResponsePtr Res,
+                                                   bool bWasSuccessful) {
+                      (void)Req;
+                      (*Unsubscribe)();
+                      Signal.aborted()
+                          ? Resolve(func::HttpResult<T>::Failure(
+                                func::abortMessage(Signal.reason()), 0))
+                          : ResolveRequestCompletion<T>(Resolve, Res,
+                                                        bWasSuccessful);
+                    });
+
+                *Unsubscribe = Signal.onAbort(
+                    [Request](std::string) { Request->CancelRequest(); });
+                Request->ProcessRequest();
+              }();
       });
 }
 
@@ -224,8 +244,9 @@ CreateRequest(const FString &Verb, const FString &Url,
 template <typename T>
 func::AsyncResult<func::HttpResult<T>>
 Post(const FString &Url, const FString &Payload,
-     const FString &ApiKey = TEXT("")) {
-  return detail::CreateRequest<T>(TEXT("POST"), Url, ApiKey, Payload);
+     const FString &ApiKey = TEXT(""),
+     const func::AbortSignal &Signal = func::AbortSignal()) {
+  return detail::CreateRequest<T>(TEXT("POST"), Url, ApiKey, Payload, Signal);
 }
 
 /**
@@ -234,9 +255,10 @@ Post(const FString &Url, const FString &Payload,
  * share the common request and decode path.
  */
 template <typename T>
-func::AsyncResult<func::HttpResult<T>> Get(const FString &Url,
-                                           const FString &ApiKey = TEXT("")) {
-  return detail::CreateRequest<T>(TEXT("GET"), Url, ApiKey);
+func::AsyncResult<func::HttpResult<T>>
+Get(const FString &Url, const FString &ApiKey = TEXT(""),
+    const func::AbortSignal &Signal = func::AbortSignal()) {
+  return detail::CreateRequest<T>(TEXT("GET"), Url, ApiKey, TEXT(""), Signal);
 }
 
 /**
@@ -246,8 +268,10 @@ func::AsyncResult<func::HttpResult<T>> Get(const FString &Url,
  */
 template <typename T>
 func::AsyncResult<func::HttpResult<T>>
-Delete(const FString &Url, const FString &ApiKey = TEXT("")) {
-  return detail::CreateRequest<T>(TEXT("DELETE"), Url, ApiKey);
+Delete(const FString &Url, const FString &ApiKey = TEXT(""),
+       const func::AbortSignal &Signal = func::AbortSignal()) {
+  return detail::CreateRequest<T>(TEXT("DELETE"), Url, ApiKey, TEXT(""),
+                                  Signal);
 }
 
 /**
@@ -0,0 +1,274 @@
+#pragma once
+/**
+ * Native handle manager — owned, lockable, hot-swappable native resources
+ * User Story: As thunks running on arbitrary worker threads, I need defined
+ * ownership of llama contexts and sqlite connections so concurrent calls,
+ * model reloads and database clears never touch a freed or busy handle.
+ */
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace NativeHandles {
+
+/**
+ * Shared leases may overlap each other; an exclusive lease runs alone.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+enum class ELeaseMode : uint8 { Shared, Exclusive };
+
+using FReleaseFn = std::function<void(void *)>;
+
+/**
+ * One native resource. Access serializes use of the handle; the handle is
+ * released when the last reference (slot or lease) goes away, or earlier by
+ * Shutdown once in-flight leases have finished.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FNativeResource {
+  void *Handle;
+  FReleaseFn Release;
+  FRWLock Access;
+  uint64 Generation;
+
+  FNativeResource(void *InHandle, FReleaseFn InRelease, uint64 InGeneration)
+      : Handle(InHandle), Release(MoveTemp(InRelease)),
+        Generation(InGeneration) {}
+
+  ~FNativeResource() {
+    (Handle && Release) ? (Release(Handle), void()) : void();
+  }
+
+  FNativeResource(const FNativeResource &) = delete;
+  FNativeResource &operator=(const FNativeResource &) = delete;
+};
+
+using FResourceRef = std::shared_ptr<FNativeResource>;
+
+/**
+ * Named slot holding the current resource of one kind (cortex, embedder,
+ * memory database). Swapping the slot never frees a handle in use.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FNativeSlot {
+  std::mutex Mutex;
+  FResourceRef Current;
+  std::atomic<uint64> Generation;
+
+  FNativeSlot() : Generation(0) {}
+};
+
+/**
+ * Scoped use of a resource. Holds a reference so the handle outlives any
+ * concurrent swap, and holds the resource lock in the requested mode.
+ * User Story: As native thunks, I need one scoped lease so locking and
+ * lifetime are released on every exit path of a worker lambda.
+ */
+struct FNativeLease {
+  FResourceRef Resource;
+  ELeaseMode Mode;
+
+  FNativeLease(FResourceRef InResource, ELeaseMode InMode)
+      : Resource(MoveTemp(InResource)), Mode(InMode) {
+    Resource ? (Mode == ELeaseMode::Exclusive ? Resource->Access.WriteLock()
+                                              : Resource->Access.ReadLock(),
+                void())
+             : void();
+  }
+
+  ~FNativeLease() {
+    Resource ? (Mode == ELeaseMode::Exclusive ? Resource->Access.WriteUnlock()
+                                              : Resource->Access.ReadUnlock(),
+                void())
+             : void();
+  }
+
+  FNativeLease(const FNativeLease &) = delete;
+  FNativeLease &operator=(const FNativeLease &) = delete;
+
+  /**
+   * Returns the leased handle, or nullptr when the slot was empty or the
+   * resource was shut down before the lease was granted.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  void *Get() const { return Resource ? Resource->Handle : nullptr; }
+
+  explicit operator bool() const { return Get() != nullptr; }
+};
+
+/**
+ * Returns the slot's current resource (possibly empty).
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FResourceRef Current(FNativeSlot &Slot) {
+  std::lock_guard<std::mutex> Lock(Slot.Mutex);
+  return Slot.Current;
+}
+
+/**
+ * Reports whether the slot currently holds a resource.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline bool IsLoaded(FNativeSlot &Slot) {
+  return static_cast<bool>(Current(Slot));
+}
+
+/**
+ * Installs a new handle and returns the previous resource. The previous
+ * handle stays valid for leases already granted and is released after the
+ * last of them ends. A null handle empties the slot.
+ * User Story: As model reloads, I need hot swap so a new model can be
+ * published while inferences on the old one run to completion.
+ */
+inline FResourceRef Install(FNativeSlot &Slot, void *Handle,
+                            FReleaseFn Release) {
+  const FResourceRef Next =
+      Handle ? std::make_shared<FNativeResource>(
+                   Handle, MoveTemp(Release), Slot.Generation.fetch_add(1) + 1)
+             : FResourceRef();
+  std::lock_guard<std::mutex> Lock(Slot.Mutex);
+  FResourceRef Previous = MoveTemp(Slot.Current);
+  Slot.Current = Next;
+  return Previous;
+}
+
+/**
+ * Empties the slot and returns what it held.
+ * User Story: As reload and clear flows, I need new callers turned away
+ * before the old resource is torn down.
+ */
+inline FResourceRef Retire(FNativeSlot &Slot) {
+  return Install(Slot, nullptr, FReleaseFn());
+}
+
+/**
+ * Waits for every lease on a retired resource, runs BeforeRelease on the
+ * handle, then releases it immediately. Leases granted afterwards see a null
+ * handle.
+ * User Story: As database clears, I need the connection closed only after
+ * in-flight queries finish so files are never deleted under a running query.
+ */
+inline void Shutdown(const FResourceRef &Resource,
+                     const std::function<void(void *)> &BeforeRelease =
+                         std::function<void(void *)>()) {
+  Resource
+      ? [&Resource, &BeforeRelease]() {
+          FWriteScopeLock Lock(Resource->Access);
+          void *Handle = Resource->Handle;
+          Resource->Handle = nullptr;
+          (Handle && BeforeRelease) ? (BeforeRelease(Handle), void()) : void();
+          (Handle && Resource->Release) ? (Resource->Release(Handle), void())
+                                        : void();
+        }()
+      : void();
+}
+
+/**
+ * Fixed set of interchangeable resources (read-only sqlite connections).
+ * Each checkout gets one resource to itself for the duration of an operation.
+ * User Story: As concurrent recall, I need a pool of connections so searches
+ * for many NPCs run side by side instead of queueing on one handle.
+ */
+struct FNativePool {
+  std::mutex Mutex;
+  std::condition_variable Returned;
+  TArray<FResourceRef> Idle;
+  int32 Size;
+  int32 InUse;
+
+  FNativePool() : Size(0), InUse(0) {}
+};
+
+/**
+ * Scoped checkout of one pooled resource. Waits while every resource is busy;
+ * empty when the pool has no resources or is drained while waiting, so
+ * callers can fall back to a slot.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FPoolLease {
+  FNativePool &Pool;
+  FResourceRef Resource;
+
+  explicit FPoolLease(FNativePool &InPool) : Pool(InPool) {
+    std::unique_lock<std::mutex> Lock(Pool.Mutex);
+    Pool.Returned.wait(
+        Lock, [this]() { return Pool.Idle.Num() > 0 || Pool.Size == 0; });
+    Pool.Idle.Num() > 0
+        ? (Resource = Pool.Idle.Pop(EAllowShrinking::No), ++Pool.InUse, void())
+        : void();
+  }
+
+  ~FPoolLease() {
+    Resource ? (GiveBack(), void()) : void();
+  }
+
+  FPoolLease(const FPoolLease &) = delete;
+  FPoolLease &operator=(const FPoolLease &) = delete;
+
+  void *Get() const { return Resource ? Resource->Handle : nullptr; }
+
+  explicit operator bool() const { return Get() != nullptr; }
+
+private:
+  void GiveBack() {
+    {
+      std::lock_guard<std::mutex> Lock(Pool.Mutex);
+      Pool.Idle.Add(MoveTemp(Resource));
+      --Pool.InUse;
+    }
+    Pool.Returned.notify_all();
+  }
+};
+
+/**
+ * Takes every resource out of the pool, waiting for checked-out ones to come
+ * back first. Dropping the returned array releases them. New checkouts made
+ * while draining come back empty.
+ * User Story: As database reload and clear flows, I need every reader closed
+ * before the writer is swapped or the file is deleted.
+ */
+inline TArray<FResourceRef> Drain(FNativePool &Pool) {
+  std::unique_lock<std::mutex> Lock(Pool.Mutex);
+  Pool.Size = 0;
+  Pool.Returned.notify_all();
+  Pool.Returned.wait(Lock, [&Pool]() { return Pool.InUse == 0; });
+  TArray<FResourceRef> Drained = MoveTemp(Pool.Idle);
+  Pool.Idle.Reset();
+  return Drained;
+}
+
+/**
+ * Replaces the pool's resources with the given handles, skipping nulls, and
+ * returns the new pool size. Previous resources are drained and released.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline int32 Fill(FNativePool &Pool, const TArray<void *> &Handles,
+                  const FReleaseFn &Release) {
+  Drain(Pool);
+  TArray<FResourceRef> Next;
+  struct Helper {
+    static void apply(const TArray<void *> &Handles, const FReleaseFn &Release,
+                      int32 Index, TArray<FResourceRef> &Out) {
+      Index < Handles.Num()
+          ? ((Handles[Index]
+                  ? (Out.Add(std::make_shared<FNativeResource>(
+                         Handles[Index], Release, static_cast<uint64>(Index))),
+                     void())
+                  : void()),
+             apply(Handles, Release, Index + 1, Out), void())
+          : void();
+    }
+  };
+  Helper::apply(Handles, Release, 0, Next);
+  std::lock_guard<std::mutex> Lock(Pool.Mutex);
+  Pool.Idle = MoveTemp(Next);
+  Pool.Size = Pool.Idle.Num();
+  return Pool.Size;
+}
+
+} // namespace NativeHandles
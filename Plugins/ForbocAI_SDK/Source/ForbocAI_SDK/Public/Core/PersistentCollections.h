@@ -0,0 +1,834 @@
+#pragma once
+/**
+ * Persistent collections — hash-array-mapped map and chunked vector
+ * Both are immutable values: an update copies only the path from the root to
+ * the changed slot (O(log n) nodes of at most 32 slots) and shares the rest
+ * with the previous version. Transients batch many edits and copy each node
+ * at most once.
+ * User Story: As entity slices holding thousands of memories or NPCs, I need
+ * a single-entity update to cost a few node copies instead of cloning the
+ * whole container.
+ */
+
+#include "CoreMinimal.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <utility>
+
+namespace rtk {
+namespace persistent {
+
+/**
+ * Identifies the transient allowed to edit a node in place. Zero means the
+ * node is shared and must be copied before any change.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+using FEditToken = uint64;
+
+/**
+ * Returns a token no node has seen before.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FEditToken NewEditToken() {
+  static std::atomic<uint64> Next{1};
+  return Next.fetch_add(1, std::memory_order_relaxed);
+}
+
+/** Slots per node: hash bits consumed per map level, items per vector leaf. */
+inline constexpr int32 BranchBits = 5;
+inline constexpr int32 Branch = 1 << BranchBits;
+
+/** Hash width; map levels past it hold colliding keys in a flat list. */
+inline constexpr int32 HashBits = 32;
+
+namespace detail {
+inline uint32 FragmentBit(uint32 Hash, int32 Shift) {
+  return Shift >= HashBits
+             ? 0u
+             : 1u << ((Hash >> Shift) & static_cast<uint32>(Branch - 1));
+}
+
+inline int32 SlotIndex(uint32 Map, uint32 Bit) {
+  return std::popcount(Map & (Bit - 1));
+}
+
+template <typename NodeT>
+std::shared_ptr<NodeT> Editable(const std::shared_ptr<NodeT> &Node,
+                                FEditToken Edit) {
+  return (Edit != 0 && Node->Edit == Edit) ? Node
+                                           : [&Node, Edit]() {
+                                               auto Copy =
+                                                   std::make_shared<NodeT>(
+                                                       *Node);
+                                               Copy->Edit = Edit;
+                                               return Copy;
+                                             }();
+}
+} // namespace detail
+
+/**
+ * One node of a hash-array-mapped trie, in the compressed (CHAMP) layout:
+ * DataMap marks slots holding an entry inline, NodeMap marks slots holding a
+ * child, and both arrays are packed in slot order. Nodes past the hash width
+ * hold colliding entries unordered.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename K, typename V> struct FHamtNode {
+  struct FEntry {
+    uint32 Hash;
+    K Key;
+    V Value;
+  };
+
+  uint32 DataMap = 0;
+  uint32 NodeMap = 0;
+  FEditToken Edit = 0;
+  TArray<FEntry> Entries;
+  TArray<std::shared_ptr<FHamtNode>> Children;
+
+  bool IsSingleton() const {
+    return Children.Num() == 0 && Entries.Num() == 1;
+  }
+};
+
+/**
+ * Trie operations shared by the persistent map and its transient. Each takes
+ * the edit token of the caller; nodes owned by that token change in place,
+ * every other node on the path is copied.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename K, typename V> struct FHamtOps {
+  using FNode = FHamtNode<K, V>;
+  using FEntry = typename FNode::FEntry;
+  using FNodePtr = std::shared_ptr<FNode>;
+
+  static const FEntry *FindCollision(const FNode &Node, const K &Key) {
+    const FEntry *End = Node.Entries.GetData() + Node.Entries.Num();
+    const FEntry *Found =
+        std::find_if(Node.Entries.GetData(), End,
+                     [&Key](const FEntry &Entry) { return Entry.Key == Key; });
+    return Found != End ? Found : nullptr;
+  }
+
+  static const V *Find(const FNode *Node, const K &Key, uint32 Hash,
+                       int32 Shift) {
+    const uint32 Bit = detail::FragmentBit(Hash, Shift);
+    return !Node ? nullptr
+           : Shift >= HashBits
+               ? [Found = FindCollision(*Node, Key)]() -> const V * {
+                   return Found ? &Found->Value : nullptr;
+                 }()
+           : (Node->DataMap & Bit)
+               ? [&]() -> const V * {
+                   const FEntry &Entry =
+                       Node->Entries[detail::SlotIndex(Node->DataMap, Bit)];
+                   return (Entry.Hash == Hash && Entry.Key == Key)
+                              ? &Entry.Value
+                              : nullptr;
+                 }()
+           : (Node->NodeMap & Bit)
+               ? Find(Node->Children[detail::SlotIndex(Node->NodeMap, Bit)]
+                          .get(),
+                      Key, Hash, Shift + BranchBits)
+               : nullptr;
+  }
+
+  /**
+   * Builds the smallest subtree holding two entries whose hashes agree on
+   * every level above Shift.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  static FNodePtr MergeTwo(FEntry First, FEntry Second, int32 Shift,
+                           FEditToken Edit) {
+    auto Node = std::make_shared<FNode>();
+    Node->Edit = Edit;
+    const uint32 FirstBit = detail::FragmentBit(First.Hash, Shift);
+    const uint32 SecondBit = detail::FragmentBit(Second.Hash, Shift);
+    Shift >= HashBits
+        ? (Node->Entries.Add(MoveTemp(First)),
+           Node->Entries.Add(MoveTemp(Second)), void())
+    : FirstBit == SecondBit
+        ? (Node->NodeMap = FirstBit,
+           Node->Children.Add(MergeTwo(MoveTemp(First), MoveTemp(Second),
+                                       Shift + BranchBits, Edit)),
+           void())
+        : (Node->DataMap = FirstBit | SecondBit,
+           FirstBit < SecondBit
+               ? (Node->Entries.Add(MoveTemp(First)),
+                  Node->Entries.Add(MoveTemp(Second)), void())
+               : (Node->Entries.Add(MoveTemp(Second)),
+                  Node->Entries.Add(MoveTemp(First)), void()));
+    return Node;
+  }
+
+  static FNodePtr Leaf(FEntry Entry, int32 Shift, FEditToken Edit) {
+    auto Node = std::make_shared<FNode>();
+    Node->Edit = Edit;
+    Node->DataMap =
+        Shift >= HashBits ? 0u : detail::FragmentBit(Entry.Hash, Shift);
+    Node->Entries.Add(MoveTemp(Entry));
+    return Node;
+  }
+
+  /**
+   * Returns the trie with Entry stored, setting bAdded when the key is new.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  static FNodePtr Assoc(const FNodePtr &Node, FEntry Entry, int32 Shift,
+                        FEditToken Edit, bool &bAdded) {
+    const uint32 Bit = detail::FragmentBit(Entry.Hash, Shift);
+    return !Node ? (bAdded = true, Leaf(MoveTemp(Entry), Shift, Edit))
+           : Shift >= HashBits
+               ? AssocCollision(Node, MoveTemp(Entry), Edit, bAdded)
+           : (Node->DataMap & Bit)
+               ? AssocOverEntry(Node, MoveTemp(Entry), Bit, Shift, Edit,
+                                bAdded)
+           : (Node->NodeMap & Bit)
+               ? AssocIntoChild(Node, MoveTemp(Entry), Bit, Shift, Edit,
+                                bAdded)
+               : [&]() {
+                   FNodePtr Next = detail::Editable(Node, Edit);
+                   Next->Entries.Insert(MoveTemp(Entry),
+                                        detail::SlotIndex(Next->DataMap, Bit));
+                   Next->DataMap |= Bit;
+                   bAdded = true;
+                   return Next;
+                 }();
+  }
+
+  static FNodePtr AssocCollision(const FNodePtr &Node, FEntry Entry,
+                                 FEditToken Edit, bool &bAdded) {
+    const FEntry *Found = FindCollision(*Node, Entry.Key);
+    const int32 Index =
+        Found ? static_cast<int32>(Found - Node->Entries.GetData())
+              : INDEX_NONE;
+    FNodePtr Next = detail::Editable(Node, Edit);
+    Index != INDEX_NONE
+        ? (Next->Entries[Index].Value = MoveTemp(Entry.Value), void())
+        : (Next->Entries.Add(MoveTemp(Entry)), bAdded = true, void());
+    return Next;
+  }
+
+  static FNodePtr AssocOverEntry(const FNodePtr &Node, FEntry Entry,
+                                 uint32 Bit, int32 Shift, FEditToken Edit,
+                                 bool &bAdded) {
+    const int32 Index = detail::SlotIndex(Node->DataMap, Bit);
+    const FEntry &Existing = Node->Entries[Index];
+    const bool bSameKey =
+        Existing.Hash == Entry.Hash && Existing.Key == Entry.Key;
+    FNodePtr Next = detail::Editable(Node, Edit);
+    bSameKey
+        ? (Next->Entries[Index].Value = MoveTemp(Entry.Value), void())
+        : [&]() {
+            FNodePtr Child = MergeTwo(Next->Entries[Index], MoveTemp(Entry),
+                                      Shift + BranchBits, Edit);
+            Next->Entries.RemoveAt(Index);
+            Next->DataMap ^= Bit;
+            Next->NodeMap |= Bit;
+            Next->Children.Insert(MoveTemp(Child),
+                                  detail::SlotIndex(Next->NodeMap, Bit));
+            bAdded = true;
+          }();
+    return Next;
+  }
+
+  static FNodePtr AssocIntoChild(const FNodePtr &Node, FEntry Entry,
+                                 uint32 Bit, int32 Shift, FEditToken Edit,
+                                 bool &bAdded) {
+    const int32 Index = detail::SlotIndex(Node->NodeMap, Bit);
+    const FNodePtr &Child = Node->Children[Index];
+    FNodePtr NewChild =
+        Assoc(Child, MoveTemp(Entry), Shift + BranchBits, Edit, bAdded);
+    return NewChild == Child ? Node : [&]() {
+      FNodePtr Next = detail::Editable(Node, Edit);
+      Next->Children[Index] = MoveTemp(NewChild);
+      return Next;
+    }();
+  }
+
+  /**
+   * Returns the trie without Key (nullptr once empty), setting bRemoved when
+   * the key was present. A child left holding one entry is pulled up into its
+   * parent so equal maps keep equal shapes.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  static FNodePtr Dissoc(const FNodePtr &Node, const K &Key, uint32 Hash,
+                         int32 Shift, FEditToken Edit, bool &bRemoved) {
+    const uint32 Bit = detail::FragmentBit(Hash, Shift);
+    return !Node ? Node
+           : Shift >= HashBits
+               ? DissocCollision(Node, Key, Edit, bRemoved)
+           : (Node->DataMap & Bit)
+               ? DissocEntry(Node, Key, Hash, Bit, Edit, bRemoved)
+           : (Node->NodeMap & Bit)
+               ? DissocFromChild(Node, Key, Hash, Bit, Shift, Edit, bRemoved)
+               : Node;
+  }
+
+  static FNodePtr DissocCollision(const FNodePtr &Node, const K &Key,
+                                  FEditToken Edit, bool &bRemoved) {
+    const FEntry *Found = FindCollision(*Node, Key);
+    return !Found ? Node
+           : Node->Entries.Num() == 1
+               ? (bRemoved = true, FNodePtr())
+               : [&]() {
+                   const int32 Index =
+                       static_cast<int32>(Found - Node->Entries.GetData());
+                   FNodePtr Next = detail::Editable(Node, Edit);
+                   Next->Entries.RemoveAt(Index);
+                   bRemoved = true;
+                   return Next;
+                 }();
+  }
+
+  static FNodePtr DissocEntry(const FNodePtr &Node, const K &Key, uint32 Hash,
+                              uint32 Bit, FEditToken Edit, bool &bRemoved) {
+    const int32 Index = detail::SlotIndex(Node->DataMap, Bit);
+    const FEntry &Existing = Node->Entries[Index];
+    return !(Existing.Hash == Hash && Existing.Key == Key) ? Node
+           : Node->IsSingleton() ? (bRemoved = true, FNodePtr())
+                                 : [&]() {
+                                     FNodePtr Next =
+                                         detail::Editable(Node, Edit);
+                                     Next->Entries.RemoveAt(Index);
+                                     Next->DataMap ^= Bit;
+                                     bRemoved = true;
+                                     return Next;
+                                   }();
+  }
+
+  static FNodePtr DissocFromChild(const FNodePtr &Node, const K &Key,
+                                  uint32 Hash, uint32 Bit, int32 Shift,
+                                  FEditToken Edit, bool &bRemoved) {
+    const int32 Index = detail::SlotIndex(Node->NodeMap, Bit);
+    const FNodePtr &Child = Node->Children[Index];
+    FNodePtr NewChild =
+        Dissoc(Child, Key, Hash, Shift + BranchBits, Edit, bRemoved);
+    return NewChild == Child ? Node : [&]() {
+      FNodePtr Next = detail::Editable(Node, Edit);
+      (!NewChild || NewChild->IsSingleton())
+          ? (Next->Children.RemoveAt(Index), Next->NodeMap ^= Bit, void())
+          : (Next->Children[Index] = NewChild, void());
+      NewChild && NewChild->IsSingleton()
+          ? (Next->Entries.Insert(NewChild->Entries[0],
+                                  detail::SlotIndex(Next->DataMap, Bit)),
+             Next->DataMap |= Bit, void())
+          : void();
+      return (Next->Entries.Num() == 0 && Next->Children.Num() == 0)
+                 ? FNodePtr()
+                 : Next;
+    }();
+  }
+
+  template <typename Fn>
+  static void ForEachEntry(const FNode &Node, Fn &Visit, int32 Index) {
+    Index < Node.Entries.Num()
+        ? (Visit(Node.Entries[Index].Key, Node.Entries[Index].Value),
+           ForEachEntry(Node, Visit, Index + 1), void())
+        : void();
+  }
+
+  template <typename Fn>
+  static void ForEachChild(const FNode &Node, Fn &Visit, int32 Index) {
+    Index < Node.Children.Num()
+        ? (ForEach(Node.Children[Index].get(), Visit),
+           ForEachChild(Node, Visit, Index + 1), void())
+        : void();
+  }
+
+  template <typename Fn> static void ForEach(const FNode *Node, Fn &Visit) {
+    Node ? (ForEachEntry(*Node, Visit, 0), ForEachChild(*Node, Visit, 0),
+            void())
+         : void();
+  }
+};
+
+/**
+ * Persistent hash map (hash-array-mapped trie). Keys need operator== and
+ * GetTypeHash, as for TMap. Every update returns a new map sharing unchanged
+ * nodes with this one; the original is never modified, so maps can be shared
+ * freely across threads and state snapshots.
+ * User Story: As entity-backed slices, I need id -> entity storage whose
+ * single-entity updates copy a handful of small nodes.
+ */
+template <typename K, typename V> class PersistentMap {
+public:
+  using Ops = FHamtOps<K, V>;
+  using FNodePtr = typename Ops::FNodePtr;
+
+  PersistentMap() : Count(0) {}
+
+  int32 size() const { return Count; }
+
+  bool isEmpty() const { return Count == 0; }
+
+  /**
+   * Returns the value stored for Key, or nullptr. The pointer stays valid as
+   * long as this map (or any version sharing the node) is alive.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  const V *find(const K &Key) const {
+    return Ops::Find(Root.get(), Key, GetTypeHash(Key), 0);
+  }
+
+  bool contains(const K &Key) const { return find(Key) != nullptr; }
+
+  /**
+   * Returns a map with Key set to Value.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  PersistentMap set(const K &Key, V Value) const {
+    bool bAdded = false;
+    FNodePtr Next = Ops::Assoc(
+        Root, typename Ops::FEntry{GetTypeHash(Key), Key, MoveTemp(Value)}, 0,
+        0, bAdded);
+    return PersistentMap(MoveTemp(Next), Count + (bAdded ? 1 : 0));
+  }
+
+  /**
+   * Returns a map without Key; returns this map when Key is absent.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  PersistentMap remove(const K &Key) const {
+    bool bRemoved = false;
+    FNodePtr Next = Ops::Dissoc(Root, Key, GetTypeHash(Key), 0, 0, bRemoved);
+    return PersistentMap(MoveTemp(Next), Count - (bRemoved ? 1 : 0));
+  }
+
+  /**
+   * Visits every entry as (key, value), in hash order.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  template <typename Fn> void forEach(Fn Visit) const {
+    Ops::ForEach(Root.get(), Visit);
+  }
+
+  /**
+   * True when both maps are the same version (shared root). Cheap identity
+   * check for memoization; structurally equal maps built separately differ.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  bool sameAs(const PersistentMap &Other) const { return Root == Other.Root; }
+
+  /**
+   * Batch editor. Nodes it creates carry its token and are changed in place
+   * by later edits of the same transient; shared nodes are still copied.
+   * User Story: As batch reducers (set all, upsert many), I need each node
+   * copied once per batch rather than once per entity.
+   */
+  class Transient {
+  public:
+    explicit Transient(const PersistentMap &From)
+        : Root(From.Root), Count(From.Count), Edit(NewEditToken()) {}
+
+    int32 size() const { return Count; }
+
+    const V *find(const K &Key) const {
+      return Ops::Find(Root.get(), Key, GetTypeHash(Key), 0);
+    }
+
+    Transient &set(const K &Key, V Value) {
+      bool bAdded = false;
+      Root = Ops::Assoc(
+          Root, typename Ops::FEntry{GetTypeHash(Key), Key, MoveTemp(Value)},
+          0, Edit, bAdded);
+      Count += bAdded ? 1 : 0;
+      return *this;
+    }
+
+    Transient &remove(const K &Key) {
+      bool bRemoved = false;
+      Root = Ops::Dissoc(Root, Key, GetTypeHash(Key), 0, Edit, bRemoved);
+      Count -= bRemoved ? 1 : 0;
+      return *this;
+    }
+
+    /**
+     * Returns the edited map. The transient switches to a fresh token, so
+     * further edits copy nodes instead of changing the returned map.
+     * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+     */
+    PersistentMap persistent() {
+      Edit = NewEditToken();
+      return PersistentMap(Root, Count);
+    }
+
+  private:
+    FNodePtr Root;
+    int32 Count;
+    FEditToken Edit;
+  };
+
+  Transient transient() const { return Transient(*this); }
+
+private:
+  PersistentMap(FNodePtr InRoot, int32 InCount)
+      : Root(MoveTemp(InRoot)), Count(InCount) {}
+
+  FNodePtr Root;
+  int32 Count;
+};
+
+/**
+ * One node of a chunked vector: a leaf holds up to Branch items, an internal
+ * node up to Branch children with the running item count after each child.
+ * Nodes may be underfull (removals never rebalance), so lookups descend by
+ * the size table rather than by index arithmetic, as in an RRB tree.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T> struct FChunkNode {
+  FEditToken Edit = 0;
+  bool bLeaf = true;
+  TArray<T> Items;
+  TArray<std::shared_ptr<FChunkNode>> Children;
+  TArray<int32> Sizes;
+
+  int32 Total() const {
+    return bLeaf ? Items.Num() : (Sizes.Num() > 0 ? Sizes.Last() : 0);
+  }
+
+  /**
+   * Recomputes the running counts after children changed.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  void RebuildSizes() {
+    Sizes.SetNum(Children.Num());
+    int32 Running = 0;
+    std::transform(Children.GetData(), Children.GetData() + Children.Num(),
+                   Sizes.GetData(),
+                   [&Running](const std::shared_ptr<FChunkNode> &Child) {
+                     return Running += Child->Total();
+                   });
+  }
+
+  /**
+   * Child holding item Index, and the item's index within that child.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  int32 ChildFor(int32 Index, int32 &Local) const {
+    const int32 *Found = std::upper_bound(
+        Sizes.GetData(), Sizes.GetData() + Sizes.Num(), Index);
+    const int32 Child = std::min(static_cast<int32>(Found - Sizes.GetData()),
+                                 Sizes.Num() - 1);
+    Local = Index - (Child > 0 ? Sizes[Child - 1] : 0);
+    return Child;
+  }
+};
+
+/**
+ * Tree operations shared by the persistent vector and its transient.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T> struct FChunkOps {
+  using FNode = FChunkNode<T>;
+  using FNodePtr = std::shared_ptr<FNode>;
+
+  static const T &Get(const FNode &Node, int32 Index) {
+    return Node.bLeaf ? Node.Items[Index] : [&Node, Index]() -> const T & {
+      int32 Local = 0;
+      const int32 Child = Node.ChildFor(Index, Local);
+      return Get(*Node.Children[Child], Local);
+    }();
+  }
+
+  static const T &Last(const FNode &Node) {
+    return Node.bLeaf ? Node.Items.Last() : Last(*Node.Children.Last());
+  }
+
+  static FNodePtr Set(const FNodePtr &Node, int32 Index, T Value,
+                      FEditToken Edit) {
+    FNodePtr Next = detail::Editable(Node, Edit);
+    int32 Local = 0;
+    Node->bLeaf
+        ? (Next->Items[Index] = MoveTemp(Value), void())
+        : [&]() {
+            const int32 Child = Node->ChildFor(Index, Local);
+            Next->Children[Child] =
+                Set(Node->Children[Child], Local, MoveTemp(Value), Edit);
+          }();
+    return Next;
+  }
+
+  /**
+   * Splits an overfull node in two. Appends keep the left half full so a
+   * vector built by pushBack stays densely packed.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  static FNodePtr SplitOff(const FNodePtr &Node, bool bAppend,
+                           FEditToken Edit) {
+    auto Right = std::make_shared<FNode>();
+    Right->Edit = Edit;
+    Right->bLeaf = Node->bLeaf;
+    const int32 Num = Node->bLeaf ? Node->Items.Num() : Node->Children.Num();
+    const int32 Keep = bAppend ? Branch : Num / 2;
+    Node->bLeaf
+        ? (Right->Items.Append(Node->Items.GetData() + Keep, Num - Keep),
+           Node->Items.SetNum(Keep), void())
+        : (Right->Children.Append(Node->Children.GetData() + Keep, Num - Keep),
+           Node->Children.SetNum(Keep), Node->RebuildSizes(),
+           Right->RebuildSizes(), void());
+    return Right;
+  }
+
+  /**
+   * Inserts Value before item Index. Returns the updated node and, when it
+   * overflowed, the new right sibling through Split.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  static FNodePtr Insert(const FNodePtr &Node, int32 Index, T Value,
+                         FEditToken Edit, FNodePtr &Split) {
+    FNodePtr Next = detail::Editable(Node, Edit);
+    const bool bAppend = Index == Node->Total();
+    Node->bLeaf
+        ? (Next->Items.Insert(MoveTemp(Value), Index), void())
+        : [&]() {
+            int32 Local = 0;
+            const int32 Child =
+                bAppend ? Node->Children.Num() - 1
+                        : Node->ChildFor(Index, Local);
+            Local = bAppend ? Node->Children[Child]->Total() : Local;
+            FNodePtr ChildSplit;
+            Next->Children[Child] = Insert(Node->Children[Child], Local,
+                                           MoveTemp(Value), Edit, ChildSplit);
+            ChildSplit ? (Next->Children.Insert(MoveTemp(ChildSplit),
+                                                Child + 1),
+                          void())
+                       : void();
+            Next->RebuildSizes();
+          }();
+    const int32 Width = Next->bLeaf ? Next->Items.Num() : Next->Children.Num();
+    Split = Width > Branch ? SplitOff(Next, bAppend, Edit) : FNodePtr();
+    return Next;
+  }
+
+  /**
+   * Removes item Index. Returns nullptr when the node is left empty so the
+   * parent drops it.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  static FNodePtr RemoveAt(const FNodePtr &Node, int32 Index,
+                           FEditToken Edit) {
+    FNodePtr Next = detail::Editable(Node, Edit);
+    Node->bLeaf ? (Next->Items.RemoveAt(Index), void()) : [&]() {
+      int32 Local = 0;
+      const int32 Child = Node->ChildFor(Index, Local);
+      FNodePtr NewChild = RemoveAt(Node->Children[Child], Local, Edit);
+      NewChild ? (Next->Children[Child] = MoveTemp(NewChild), void())
+               : (Next->Children.RemoveAt(Child), void());
+      Next->RebuildSizes();
+    }();
+    return Next->Total() == 0 ? FNodePtr() : Next;
+  }
+
+  /**
+   * Grows the tree by one level when the root split.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  static FNodePtr Grow(FNodePtr Root, FNodePtr Split, FEditToken Edit) {
+    return !Split ? Root : [&]() {
+      auto Parent = std::make_shared<FNode>();
+      Parent->Edit = Edit;
+      Parent->bLeaf = false;
+      Parent->Children.Add(MoveTemp(Root));
+      Parent->Children.Add(MoveTemp(Split));
+      Parent->RebuildSizes();
+      return Parent;
+    }();
+  }
+
+  /**
+   * Drops root levels left with a single child after removals.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  static FNodePtr Shrink(FNodePtr Root) {
+    return (Root && !Root->bLeaf && Root->Children.Num() == 1)
+               ? Shrink(Root->Children[0])
+               : Root;
+  }
+
+  static FNodePtr InsertAtRoot(const FNodePtr &Root, int32 Index, T Value,
+                               FEditToken Edit) {
+    FNodePtr Base = Root ? Root : [Edit]() {
+      auto Empty = std::make_shared<FNode>();
+      Empty->Edit = Edit;
+      return Empty;
+    }();
+    FNodePtr Split;
+    FNodePtr Next = Insert(Base, Index, MoveTemp(Value), Edit, Split);
+    return Grow(MoveTemp(Next), MoveTemp(Split), Edit);
+  }
+
+  /**
+   * First index whose item is not before the target, for vectors kept
+   * sorted by the same order. Descends by each child's last item.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  template <typename IsBefore>
+  static int32 LowerBound(const FNode &Node, const IsBefore &Before) {
+    return Node.bLeaf
+               ? static_cast<int32>(
+                     std::partition_point(Node.Items.GetData(),
+                                          Node.Items.GetData() +
+                                              Node.Items.Num(),
+                                          Before) -
+                     Node.Items.GetData())
+               : [&]() {
+                   const FNodePtr *Begin = Node.Children.GetData();
+                   const FNodePtr *Found = std::partition_point(
+                       Begin, Begin + Node.Children.Num(),
+                       [&Before](const FNodePtr &Child) {
+                         return Before(Last(*Child));
+                       });
+                   const int32 Child = static_cast<int32>(Found - Begin);
+                   return Child >= Node.Children.Num()
+                              ? Node.Total()
+                              : (Child > 0 ? Node.Sizes[Child - 1] : 0) +
+                                    LowerBound(*Node.Children[Child], Before);
+                 }();
+  }
+
+  template <typename Fn>
+  static void ForEachItem(const FNode &Node, Fn &Visit, int32 Index) {
+    Index < Node.Items.Num()
+        ? (Visit(Node.Items[Index]), ForEachItem(Node, Visit, Index + 1),
+           void())
+        : void();
+  }
+
+  template <typename Fn>
+  static void ForEachChild(const FNode &Node, Fn &Visit, int32 Index) {
+    Index < Node.Children.Num()
+        ? (ForEach(Node.Children[Index].get(), Visit),
+           ForEachChild(Node, Visit, Index + 1), void())
+        : void();
+  }
+
+  template <typename Fn> static void ForEach(const FNode *Node, Fn &Visit) {
+    Node ? (Node->bLeaf ? ForEachItem(*Node, Visit, 0)
+                        : ForEachChild(*Node, Visit, 0))
+         : void();
+  }
+};
+
+/**
+ * Persistent chunked vector: a B-tree of 32-item leaves indexed by position.
+ * get, set, pushBack, insertAt and removeAt copy one root-to-leaf path, so
+ * they are O(log n) however large the vector is.
+ * User Story: As entity-backed slices, I need insertion-ordered id lists
+ * whose removals do not shift and copy every later id.
+ */
+template <typename T> class PersistentVector {
+public:
+  using Ops = FChunkOps<T>;
+  using FNodePtr = typename Ops::FNodePtr;
+
+  PersistentVector() {}
+
+  int32 size() const { return Root ? Root->Total() : 0; }
+
+  bool isEmpty() const { return size() == 0; }
+
+  const T &operator[](int32 Index) const { return Ops::Get(*Root, Index); }
+
+  PersistentVector set(int32 Index, T Value) const {
+    return PersistentVector(Ops::Set(Root, Index, MoveTemp(Value), 0));
+  }
+
+  PersistentVector insertAt(int32 Index, T Value) const {
+    return PersistentVector(
+        Ops::InsertAtRoot(Root, Index, MoveTemp(Value), 0));
+  }
+
+  PersistentVector pushBack(T Value) const {
+    return insertAt(size(), MoveTemp(Value));
+  }
+
+  PersistentVector removeAt(int32 Index) const {
+    return PersistentVector(Ops::Shrink(Ops::RemoveAt(Root, Index, 0)));
+  }
+
+  /**
+   * First index whose item is not before the target; size() when none.
+   * Only meaningful when items are sorted by the order Before tests.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  template <typename IsBefore> int32 lowerBound(const IsBefore &Before) const {
+    return Root ? Ops::LowerBound(*Root, Before) : 0;
+  }
+
+  /**
+   * Visits every item in order.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  template <typename Fn> void forEach(Fn Visit) const {
+    Ops::ForEach(Root.get(), Visit);
+  }
+
+  TArray<T> toArray() const {
+    TArray<T> Out;
+    Out.Reserve(size());
+    forEach([&Out](const T &Item) { Out.Add(Item); });
+    return Out;
+  }
+
+  bool sameAs(const PersistentVector &Other) const {
+    return Root == Other.Root;
+  }
+
+  /**
+   * Batch editor; see PersistentMap::Transient.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  class Transient {
+  public:
+    explicit Transient(const PersistentVector &From)
+        : Root(From.Root), Edit(NewEditToken()) {}
+
+    int32 size() const { return Root ? Root->Total() : 0; }
+
+    const T &operator[](int32 Index) const { return Ops::Get(*Root, Index); }
+
+    Transient &set(int32 Index, T Value) {
+      Root = Ops::Set(Root, Index, MoveTemp(Value), Edit);
+      return *this;
+    }
+
+    Transient &insertAt(int32 Index, T Value) {
+      Root = Ops::InsertAtRoot(Root, Index, MoveTemp(Value), Edit);
+      return *this;
+    }
+
+    Transient &pushBack(T Value) { return insertAt(size(), MoveTemp(Value)); }
+
+    Transient &removeAt(int32 Index) {
+      Root = Ops::Shrink(Ops::RemoveAt(Root, Index, Edit));
+      return *this;
+    }
+
+    template <typename IsBefore>
+    int32 lowerBound(const IsBefore &Before) const {
+      return Root ? Ops::LowerBound(*Root, Before) : 0;
+    }
+
+    PersistentVector persistent() {
+      Edit = NewEditToken();
+      return PersistentVector(Root);
+    }
+
+  private:
+    FNodePtr Root;
+    FEditToken Edit;
+  };
+
+  Transient transient() const { return Transient(*this); }
+
+private:
+  explicit PersistentVector(FNodePtr InRoot) : Root(MoveTemp(InRoot)) {}
+
+  FNodePtr Root;
+};
+
+} // namespace persistent
+} // namespace rtk
@@ -10,43 +10,96 @@
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 #include "JsonObjectConverter.h"
+#include "Memory/EmbeddingStore.h"
 #include "Misc/Paths.h"
 #include "NativeEngine.h"
+#include "RuntimeConfig.h"
 #include "RuntimeStore.h"
 #include "Core/JsonInterop.h"
+#include "Core/NativeHandles.h"
+#include "Core/TimerWheel.h"
 #include "Serialization/JsonSerializer.h"
 
 namespace rtk {
 namespace detail {
 
 /**
- * Returns the singleton handle backing the local inference cortex.
+ * Returns the slot holding the local inference cortex. A llama context runs
+ * one decode at a time, so callers lease it exclusively.
  * User Story: As node-cortex thunks, I need a shared inference handle so model
  * initialization and inference reuse the same native runtime.
  */
-inline Native::Llama::Context &NodeCortexHandle() {
-  static Native::Llama::Context Handle = nullptr;
-  return Handle;
+inline NativeHandles::FNativeSlot &NodeCortexSlot() {
+  static NativeHandles::FNativeSlot Slot;
+  return Slot;
 }
 
 /**
- * Returns the singleton handle backing the local embedding model.
+ * Returns the slot holding the local embedding model.
  * User Story: As embedding thunks, I need a dedicated embedding handle so
  * vector generation does not conflict with the inference runtime.
  */
-inline Native::Llama::Context &NodeEmbeddingHandle() {
-  static Native::Llama::Context Handle = nullptr;
-  return Handle;
+inline NativeHandles::FNativeSlot &NodeEmbeddingSlot() {
+  static NativeHandles::FNativeSlot Slot;
+  return Slot;
 }
 
 /**
- * Returns the singleton handle backing the local sqlite memory database.
+ * Returns the slot holding the local sqlite memory writer connection. Writes
+ * lease it exclusively; searches only use it (shared) when no reader pool is
+ * open.
  * User Story: As node-memory thunks, I need a shared database handle so local
  * memory operations reuse one opened connection.
  */
-inline Native::Sqlite::DB &NodeMemoryHandle() {
-  static Native::Sqlite::DB Handle = nullptr;
-  return Handle;
+inline NativeHandles::FNativeSlot &NodeMemorySlot() {
+  static NativeHandles::FNativeSlot Slot;
+  return Slot;
+}
+
+/**
+ * Release functions installed with each native handle kind.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void ReleaseLlamaContext(void *Handle) {
+  Native::Llama::FreeModel(Handle);
+}
+
+inline void ReleaseSqliteDatabase(void *Handle) {
+  Native::Sqlite::Close(Handle);
+}
+
+/**
+ * Points a leased llama context at an abort signal for one scope, so the
+ * generation loop stops at the next token once the signal fires.
+ * User Story: As cancellable node-cortex thunks, I need the flag cleared on
+ * every exit path so the next lease never sees a stale signal.
+ */
+struct FNativeAbortScope {
+  Native::Llama::Context Handle;
+
+  FNativeAbortScope(Native::Llama::Context InHandle,
+                    const func::AbortSignal &Signal)
+      : Handle(InHandle) {
+    Native::Llama::SetAbortFlag(Handle, Signal.flag());
+  }
+
+  ~FNativeAbortScope() { Native::Llama::SetAbortFlag(Handle, nullptr); }
+
+  FNativeAbortScope(const FNativeAbortScope &) = delete;
+  FNativeAbortScope &operator=(const FNativeAbortScope &) = delete;
+};
+
+/**
+ * Embeds text under an exclusive lease on the embedding model. With no
+ * embedder loaded the native layer receives a null context, as before.
+ * User Story: As memory store and recall thunks, I need embedding calls
+ * serialized per model so concurrent thunks never share a decode.
+ */
+inline TArray<float> EmbedText(const FString &Text) {
+  const NativeHandles::FNativeLease Lease(
+      NativeHandles::Current(NodeEmbeddingSlot()),
+      NativeHandles::ELeaseMode::Exclusive);
+  return Native::Llama::Embed(Lease.Get(), Text);
 }
 
 /**
@@ -218,12 +271,115 @@ inline FString &NodeMemoryPathStorage() {
 }
 
 /**
- * Returns the current node-memory database handle.
- * User Story: As node-memory helpers, I need one place to read the active
- * database handle so storage and recall use the same connection.
+ * Returns the pool of read-only connections serving local memory recall.
+ * User Story: As concurrent NPC recall, I need searches spread over reader
+ * connections so they neither queue on one handle nor block memory writes.
+ */
+inline NativeHandles::FNativePool &NodeMemoryReaders() {
+  static NativeHandles::FNativePool Pool;
+  return Pool;
+}
+
+/**
+ * Opens the configured number of reader connections for a database path and
+ * installs them in the reader pool. Returns how many opened.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline int32 OpenNodeMemoryReaders(const FString &Path, int32 Count) {
+  TArray<void *> Handles;
+  Handles.Reserve(Count);
+  struct Helper {
+    static void apply(const FString &Path, int32 Remaining,
+                      TArray<void *> &Out) {
+      Remaining > 0
+          ? (Out.Add(Native::Sqlite::OpenReader(Path)),
+             apply(Path, Remaining - 1, Out), void())
+          : void();
+    }
+  };
+  Helper::apply(Path, Count, Handles);
+  return NativeHandles::Fill(NodeMemoryReaders(), Handles,
+                             &ReleaseSqliteDatabase);
+}
+
+/**
+ * Resolves recall scoring parameters for a mode name (empty means the
+ * configured mode), with recency measured from now.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline Native::Sqlite::FRecallScoring RecallScoringFor(const FString &Mode) {
+  Native::Sqlite::FRecallScoring Scoring;
+  Scoring.Mode = Native::Sqlite::ScoringFromName(
+      Mode.IsEmpty() ? SDKConfig::GetMemoryRecallScoring() : Mode);
+  Scoring.RecencyTauSeconds = SDKConfig::GetMemoryRecencyTauSeconds();
+  Scoring.MmrLambda = SDKConfig::GetMemoryMmrLambda();
+  Scoring.NowSeconds = FDateTime::UtcNow().ToUnixTimestamp();
+  return Scoring;
+}
+
+/**
+ * Runs a scored vector search on a pooled reader, or on the writer under a
+ * shared lease when no readers are open (in-memory databases, zero-sized
+ * pool).
+ * User Story: As memory recall thunks, I need one search entry point so the
+ * reader/writer routing stays out of thunk code.
+ */
+inline TArray<FMemoryItem>
+SearchNodeMemory(const TArray<float> &Vector, int32 Limit,
+                 const Native::Sqlite::FRecallScoring &Scoring =
+                     Native::Sqlite::FRecallScoring()) {
+  const NativeHandles::FPoolLease Reader(NodeMemoryReaders());
+  const NativeHandles::FNativeLease Writer(
+      Reader ? NativeHandles::FResourceRef()
+             : NativeHandles::Current(NodeMemorySlot()),
+      NativeHandles::ELeaseMode::Shared);
+  void *Db = Reader ? Reader.Get() : Writer.Get();
+  return Db ? Native::Sqlite::SearchScored(Db, Vector, Limit, Scoring)
+            : TArray<FMemoryItem>();
+}
+
+/**
+ * Returns a memory's embedding from the side store, or reads it from the
+ * memory database (pooled reader first) and keeps it there for next time.
+ * Empty when neither knows the id.
+ * User Story: As export and serialization, I need vectors fetched by id on
+ * demand so memory state never has to carry them.
+ */
+inline TArray<float> FetchNodeEmbedding(const FString &Id) {
+  const func::Maybe<TArray<float>> Held = EmbeddingStore::Find(Id);
+  return Held.hasValue ? Held.value : [&Id]() {
+    const NativeHandles::FPoolLease Reader(NodeMemoryReaders());
+    const NativeHandles::FNativeLease Writer(
+        Reader ? NativeHandles::FResourceRef()
+               : NativeHandles::Current(NodeMemorySlot()),
+        NativeHandles::ELeaseMode::Shared);
+    void *Db = Reader ? Reader.Get() : Writer.Get();
+    const TArray<float> Fetched =
+        Db ? Native::Sqlite::FetchEmbedding(Db, Id) : TArray<float>();
+    EmbeddingStore::Put(Id, CopyTemp(Fetched));
+    return Fetched;
+  }();
+}
+
+/**
+ * Fills in the embedding of every item that arrived without one.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
  */
-inline Native::Sqlite::DB EnsureNodeMemoryDatabase() {
-  return NodeMemoryHandle();
+inline TArray<FMemoryItem> HydrateEmbeddings(TArray<FMemoryItem> Items) {
+  struct Helper {
+    static void apply(TArray<FMemoryItem> &Items, int32 Index) {
+      Index < Items.Num()
+          ? (Items[Index].Embedding.Num() == 0
+                 ? (Items[Index].Embedding =
+                        FetchNodeEmbedding(Items[Index].Id),
+                    void())
+                 : void(),
+             apply(Items, Index + 1), void())
+          : void();
+    }
+  };
+  Helper::apply(Items, 0);
+  return Items;
 }
 
 /**
@@ -345,20 +501,18 @@ UploadSignedSoul(const FArweaveUploadInstruction &Instruction,
               [State, TryOnce](FHttpRequestPtr Req, FHttpResponsePtr Res,
                                bool bWasSuccessful) {
                 /**
-                 * Retry helper: schedules backoff then re-invokes TryOnce.
+                 * Retry helper: waits out the backoff on the timer wheel
+                 * (250 ms doubling) then re-invokes TryOnce on the game thread.
                  * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
                  */
                 const auto ScheduleRetry = [&State, &TryOnce]() {
-                  const float BackoffSec =
-                      0.250f *
-                      FMath::Pow(2.0f,
-                                 static_cast<float>(State->Attempt - 1));
-                  AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
-                            [State, TryOnce, BackoffSec]() {
-                              FPlatformProcess::Sleep(BackoffSec);
-                              AsyncTask(ENamedThreads::GameThread,
-                                        [TryOnce]() { (*TryOnce)(); });
-                            });
+                  Timers::delay(Timers::BackoffDelayMs(Timers::FBackoff(),
+                                                       State->Attempt))
+                      .then([TryOnce]() {
+                        AsyncTask(ENamedThreads::GameThread,
+                                  [TryOnce]() { (*TryOnce)(); });
+                      })
+                      .execute();
                 };
 
                 /**
@@ -0,0 +1,664 @@
+#pragma once
+/**
+ * Timer service — hierarchical timing wheel behind delay, interval, timeout
+ * and retryWithBackoff
+ * Timers sit in a 4-level wheel of 64 slots per level at 1 ms resolution.
+ * Scheduling and cancelling are O(1), and advancing only visits the slots
+ * that come due. A single timer thread sleeps until the next occupied slot
+ * and runs due tasks; no other thread blocks to wait out time.
+ * User Story: As retries, polls and timeouts, I need waiting to cost a wheel
+ * slot instead of a sleeping pool thread so time-based work adds no latency
+ * quanta and leaves workers free.
+ */
+
+#include "CoreMinimal.h"
+#include "Core/functional_core.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace Timers {
+
+using FTimerId = uint64;
+using FTimerTask = std::function<void()>;
+
+/** Slots per level is 2^WheelBits; one tick is one millisecond. */
+inline constexpr int32 WheelBits = 6;
+inline constexpr uint64 WheelSlots = 1ull << WheelBits;
+inline constexpr int32 WheelLevels = 4;
+
+/** Ticks the wheel covers (~4.6 hours); later deadlines re-cascade. */
+inline constexpr uint64 WheelSpan = 1ull << (WheelBits * WheelLevels);
+
+/** TicksUntilNext result when no timer is pending. */
+inline constexpr uint64 NoPendingTimer = std::numeric_limits<uint64>::max();
+
+struct FTimerEntry {
+  FTimerId Id;
+  uint64 Deadline;
+  FTimerTask Task;
+};
+
+/**
+ * Wheel state. Not thread-safe on its own; FTimerService guards it.
+ * Cancelled entries stay in their slot and are dropped when it is visited.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FTimerWheel {
+  uint64 Now = 0;
+  FTimerId NextId = 1;
+  size_t Stored = 0;
+  std::vector<FTimerEntry> Slots[WheelLevels][WheelSlots];
+  std::unordered_set<FTimerId> Live;
+};
+
+namespace detail {
+inline int32 LevelFor(uint64 Delta) {
+  return Delta < (1ull << WheelBits)       ? 0
+         : Delta < (1ull << 2 * WheelBits) ? 1
+         : Delta < (1ull << 3 * WheelBits) ? 2
+                                           : 3;
+}
+
+inline std::vector<FTimerEntry> &SlotAt(FTimerWheel &Wheel, int32 Level,
+                                        uint64 Tick) {
+  return Wheel.Slots[Level][(Tick >> (Level * WheelBits)) & (WheelSlots - 1)];
+}
+
+/**
+ * Files an entry by distance to its deadline. Entries past the wheel's span
+ * park in the top level and are re-filed when that slot cascades.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void Place(FTimerWheel &Wheel, FTimerEntry Entry) {
+  const uint64 Delta = Entry.Deadline - Wheel.Now;
+  const uint64 Target =
+      Delta < WheelSpan ? Entry.Deadline : Wheel.Now + WheelSpan - 1;
+  ++Wheel.Stored;
+  SlotAt(Wheel, LevelFor(Target - Wheel.Now), Target)
+      .push_back(std::move(Entry));
+}
+
+inline std::vector<FTimerEntry> TakeSlot(FTimerWheel &Wheel, int32 Level) {
+  std::vector<FTimerEntry> Entries;
+  Entries.swap(SlotAt(Wheel, Level, Wheel.Now));
+  Wheel.Stored -= Entries.size();
+  return Entries;
+}
+
+inline void PlaceAll(FTimerWheel &Wheel, std::vector<FTimerEntry> &Entries,
+                     size_t Index) {
+  Index < Entries.size()
+      ? (Place(Wheel, std::move(Entries[Index])),
+         PlaceAll(Wheel, Entries, Index + 1))
+      : void();
+}
+
+inline void CollectLive(FTimerWheel &Wheel, std::vector<FTimerEntry> &Entries,
+                        size_t Index, std::vector<FTimerTask> &Due) {
+  Index < Entries.size()
+      ? ((Wheel.Live.erase(Entries[Index].Id) > 0
+              ? (Due.push_back(std::move(Entries[Index].Task)), void())
+              : void()),
+         CollectLive(Wheel, Entries, Index + 1, Due))
+      : void();
+}
+
+inline void ClearSlots(FTimerWheel &Wheel, int32 Index) {
+  Index < WheelLevels * WheelSlots
+      ? (Wheel.Slots[Index / WheelSlots][Index % WheelSlots].clear(),
+         ClearSlots(Wheel, Index + 1))
+      : void();
+}
+
+/**
+ * Re-files the current slot of every level whose lower levels just wrapped,
+ * top level first so entries moving down are cascaded again this tick.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void CascadeFrom(FTimerWheel &Wheel, int32 Level) {
+  Level < 1 ? void() : [&Wheel, Level]() {
+    (Wheel.Now & ((1ull << (Level * WheelBits)) - 1)) == 0
+        ? [&Wheel, Level]() {
+            std::vector<FTimerEntry> Entries = TakeSlot(Wheel, Level);
+            PlaceAll(Wheel, Entries, 0);
+          }()
+        : void();
+    CascadeFrom(Wheel, Level - 1);
+  }();
+}
+
+inline void Step(FTimerWheel &Wheel, std::vector<FTimerTask> &Due) {
+  ++Wheel.Now;
+  CascadeFrom(Wheel, WheelLevels - 1);
+  std::vector<FTimerEntry> Entries = TakeSlot(Wheel, 0);
+  CollectLive(Wheel, Entries, 0, Due);
+}
+
+/**
+ * Advances an idle wheel in one jump, dropping cancelled leftovers.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void JumpIdle(FTimerWheel &Wheel, uint64 Ticks) {
+  Wheel.Stored > 0
+      ? (ClearSlots(Wheel, 0), Wheel.Stored = 0, void())
+      : void();
+  Wheel.Now += Ticks;
+}
+
+/**
+ * Runs Ticks steps, halving the range so the recursion stays logarithmic.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void StepMany(FTimerWheel &Wheel, uint64 Ticks,
+                     std::vector<FTimerTask> &Due) {
+  Ticks == 0 ? void()
+  : Wheel.Live.empty() ? JumpIdle(Wheel, Ticks)
+  : Ticks == 1         ? Step(Wheel, Due)
+                       : (StepMany(Wheel, Ticks / 2, Due),
+                          StepMany(Wheel, Ticks - Ticks / 2, Due));
+}
+
+inline uint64 FirstOccupied(const FTimerWheel &Wheel, uint64 Offset,
+                            uint64 Limit) {
+  return Offset >= Limit ||
+                 !Wheel.Slots[0][(Wheel.Now + Offset) & (WheelSlots - 1)]
+                      .empty()
+             ? Offset
+             : FirstOccupied(Wheel, Offset + 1, Limit);
+}
+} // namespace detail
+
+/**
+ * Adds a task that comes due DelayTicks from now (at least one tick).
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FTimerId Schedule(FTimerWheel &Wheel, uint64 DelayTicks,
+                         FTimerTask Task) {
+  const FTimerId Id = Wheel.NextId++;
+  Wheel.Live.insert(Id);
+  detail::Place(Wheel, FTimerEntry{Id,
+                                   Wheel.Now + std::max<uint64>(DelayTicks, 1),
+                                   std::move(Task)});
+  return Id;
+}
+
+/**
+ * Cancels a pending task. Returns false when it already ran or was unknown.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline bool Cancel(FTimerWheel &Wheel, FTimerId Id) {
+  return Wheel.Live.erase(Id) > 0;
+}
+
+/**
+ * Moves the wheel forward and appends the tasks that came due, in deadline
+ * order, to Due. The caller runs them, outside any lock.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void Advance(FTimerWheel &Wheel, uint64 Ticks,
+                    std::vector<FTimerTask> &Due) {
+  detail::StepMany(Wheel, Ticks, Due);
+}
+
+/**
+ * Returns how many ticks may pass before Advance has work: the next occupied
+ * bottom slot, or the next bottom-level wrap where upper levels cascade.
+ * User Story: As the timer thread, I need a safe sleep length so it wakes
+ * for the next deadline without polling every tick.
+ */
+inline uint64 TicksUntilNext(const FTimerWheel &Wheel) {
+  return Wheel.Live.empty()
+             ? NoPendingTimer
+             : detail::FirstOccupied(
+                   Wheel, 1, WheelSlots - (Wheel.Now & (WheelSlots - 1)));
+}
+
+/**
+ * Milliseconds on a monotonic clock.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline uint64 SteadyClockMs() {
+  return static_cast<uint64>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+/**
+ * Thread-safe wheel bound to a clock. With bUseThread the service starts its
+ * timer thread on first use and due tasks run there; without it, whoever
+ * calls Pump (a game tick, a test) or Run (an owned thread) runs them. Tasks must be short: resolve,
+ * enqueue or re-arm, never block.
+ * User Story: As async helpers, I need one place that owns time so every
+ * delay, poll and retry shares a thread instead of parking its own.
+ */
+struct FTimerService {
+  std::mutex Mutex;
+  std::condition_variable Wake;
+  FTimerWheel Wheel;
+  std::function<uint64()> Clock;
+  uint64 Origin;
+  bool bUseThread;
+  bool bStopping;
+  std::thread Thread;
+
+  explicit FTimerService(std::function<uint64()> InClock = &SteadyClockMs,
+                         bool bInUseThread = true)
+      : Clock(std::move(InClock)), Origin(Clock()), bUseThread(bInUseThread),
+        bStopping(false) {}
+
+  ~FTimerService();
+
+  FTimerService(const FTimerService &) = delete;
+  FTimerService &operator=(const FTimerService &) = delete;
+};
+
+namespace detail {
+inline uint64 ElapsedMs(const FTimerService &Service) {
+  return Service.Clock() - Service.Origin;
+}
+
+/**
+ * Brings the wheel up to the clock and collects due tasks. Caller holds the
+ * service mutex.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline std::vector<FTimerTask> CollectDue(FTimerService &Service) {
+  std::vector<FTimerTask> Due;
+  const uint64 Elapsed = ElapsedMs(Service);
+  Elapsed > Service.Wheel.Now
+      ? Advance(Service.Wheel, Elapsed - Service.Wheel.Now, Due)
+      : void();
+  return Due;
+}
+
+inline void RunTasks(const std::vector<FTimerTask> &Tasks, size_t Index = 0) {
+  Index < Tasks.size() ? (Tasks[Index](), RunTasks(Tasks, Index + 1)) : void();
+}
+
+/**
+ * Timer thread body: run what is due, then sleep until the next occupied
+ * slot or until a new timer is scheduled.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void RunTimerThread(FTimerService &Service) {
+  std::unique_lock<std::mutex> Lock(Service.Mutex);
+  while (!Service.bStopping) {
+    const std::vector<FTimerTask> Due = CollectDue(Service);
+    const uint64 Ticks = TicksUntilNext(Service.Wheel);
+    !Due.empty()
+        ? (Lock.unlock(), RunTasks(Due), Lock.lock())
+    : Ticks == NoPendingTimer
+        ? Service.Wake.wait(Lock)
+        : static_cast<void>(Service.Wake.wait_for(
+              Lock, std::chrono::milliseconds(
+                        Service.Wheel.Now + Ticks -
+                        std::min(ElapsedMs(Service),
+                                 Service.Wheel.Now + Ticks))));
+  }
+}
+} // namespace detail
+
+/**
+ * Schedules Task to run DelayMs from now. Safe from any thread, including
+ * from inside a running timer task.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FTimerId Schedule(FTimerService &Service, int64 DelayMs,
+                         FTimerTask Task) {
+  std::unique_lock<std::mutex> Lock(Service.Mutex);
+  const uint64 Lag = detail::ElapsedMs(Service) - Service.Wheel.Now;
+  const FTimerId Id =
+      Schedule(Service.Wheel, static_cast<uint64>(std::max<int64>(DelayMs, 0)) + Lag,
+               std::move(Task));
+  Service.bUseThread && !Service.bStopping && !Service.Thread.joinable()
+      ? (Service.Thread =
+             std::thread([&Service]() { detail::RunTimerThread(Service); }),
+         void())
+      : void();
+  Lock.unlock();
+  Service.Wake.notify_one();
+  return Id;
+}
+
+/**
+ * Cancels a scheduled task. Returns false when it already ran.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline bool Cancel(FTimerService &Service, FTimerId Id) {
+  std::lock_guard<std::mutex> Lock(Service.Mutex);
+  return Cancel(Service.Wheel, Id);
+}
+
+/**
+ * Runs every task that is due on the calling thread. Drives services without
+ * a timer thread; harmless on ones that have it.
+ * User Story: As game-tick and test drivers, I need to advance timers from
+ * my own loop so they fire on a thread I control.
+ */
+inline void Pump(FTimerService &Service) {
+  std::unique_lock<std::mutex> Lock(Service.Mutex);
+  const std::vector<FTimerTask> Due = detail::CollectDue(Service);
+  Lock.unlock();
+  detail::RunTasks(Due);
+}
+
+/**
+ * Stops the timer thread and drops pending tasks.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void Stop(FTimerService &Service) {
+  {
+    std::lock_guard<std::mutex> Lock(Service.Mutex);
+    Service.bStopping = true;
+    Service.Wheel.Live.clear();
+  }
+  Service.Wake.notify_all();
+  Service.Thread.joinable() &&
+          Service.Thread.get_id() != std::this_thread::get_id()
+      ? Service.Thread.join()
+      : void();
+}
+
+inline FTimerService::~FTimerService() { Stop(*this); }
+
+/**
+ * Runs the timer loop on the calling thread until Stop. Lets an owner that
+ * manages its own thread drive a service created without one.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void Run(FTimerService &Service) { detail::RunTimerThread(Service); }
+
+/**
+ * Lets a stopped service run again, for owners started a second time in one
+ * process (a module reloaded in the editor).
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void Restart(FTimerService &Service) {
+  std::lock_guard<std::mutex> Lock(Service.Mutex);
+  Service.bStopping = false;
+}
+
+/**
+ * Process-wide timer service. It starts no thread of its own: the module
+ * runs it on an FRunnableThread from StartupModule and stops it in
+ * ShutdownModule, so no thread is left to join from a static destructor
+ * while the DLL unloads.
+ * User Story: As module unload, I need the timer thread stopped while the
+ * engine is still up so shutdown never waits on the loader lock.
+ */
+inline FTimerService &Get() {
+  static FTimerService Service(&SteadyClockMs, false);
+  return Service;
+}
+
+namespace detail {
+/**
+ * One armed timer that settles once: by firing, or by its signal aborting.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FArmedTimer {
+  std::mutex Mutex;
+  bool bSettled = false;
+  FTimerId Id = 0;
+  std::function<void()> Unsubscribe;
+
+  /** Marks the timer settled; returns false when it already was. */
+  bool Settle(std::function<void()> &OutUnsubscribe) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    const bool bFirst = !bSettled;
+    bSettled = true;
+    bFirst ? OutUnsubscribe.swap(Unsubscribe) : void();
+    return bFirst;
+  }
+};
+} // namespace detail
+
+/**
+ * Resolves after DelayMs. Aborting Signal cancels the timer and rejects with
+ * an abort message.
+ * User Story: As retry and polling code, I need a non-blocking wait so a
+ * pause costs a timer entry rather than a thread.
+ */
+inline func::AsyncResult<void>
+delay(int64 DelayMs, const func::AbortSignal &Signal = func::AbortSignal(),
+      FTimerService &Service = Get()) {
+  return func::AsyncResult<void>::create(
+      [DelayMs, Signal, &Service](std::function<void()> Resolve,
+                                  std::function<void(std::string)> Reject) {
+        Signal.aborted()
+            ? Reject(func::abortMessage(Signal.reason()))
+            : [&]() {
+                const std::shared_ptr<detail::FArmedTimer> Armed =
+                    std::make_shared<detail::FArmedTimer>();
+                {
+                  std::lock_guard<std::mutex> Lock(Armed->Mutex);
+                  Armed->Id = Schedule(Service, DelayMs, [Armed, Resolve]() {
+                    std::function<void()> Unsubscribe;
+                    Armed->Settle(Unsubscribe)
+                        ? ((Unsubscribe ? Unsubscribe() : void()), Resolve())
+                        : void();
+                  });
+                }
+                std::function<void()> Unsubscribe = Signal.onAbort(
+                    [Armed, Reject, &Service](std::string Reason) {
+                      std::function<void()> Ignored;
+                      Armed->Settle(Ignored)
+                          ? (Cancel(Service, Armed->Id),
+                             Reject(func::abortMessage(Reason)))
+                          : void();
+                    });
+                std::unique_lock<std::mutex> Lock(Armed->Mutex);
+                const bool bSettled = Armed->bSettled;
+                bSettled ? void() : Armed->Unsubscribe.swap(Unsubscribe);
+                Lock.unlock();
+                bSettled && Unsubscribe ? Unsubscribe() : void();
+              }();
+      });
+}
+
+namespace detail {
+inline void IntervalTick(FTimerService &Service, int64 PeriodMs,
+                         const std::function<bool(int64)> &Step,
+                         const func::AbortSignal &Signal, int64 Tick,
+                         const std::function<void(int64)> &Resolve,
+                         const std::function<void(std::string)> &Reject) {
+  const func::AsyncResult<void> Wait = delay(PeriodMs, Signal, Service);
+  func::thenAsync(Wait, [&Service, PeriodMs, Step, Signal, Tick, Resolve,
+                         Reject]() {
+    Step(Tick) ? IntervalTick(Service, PeriodMs, Step, Signal, Tick + 1,
+                              Resolve, Reject)
+               : Resolve(Tick + 1);
+  });
+  func::catchAsync(Wait, Reject);
+  func::executeAsync(Wait);
+}
+} // namespace detail
+
+/**
+ * Calls Step every PeriodMs with a zero-based tick count, starting one period
+ * from now, until it returns false; then resolves with the number of calls.
+ * Step runs on the timer thread. Aborting Signal stops it and rejects.
+ * User Story: As process and status polling, I need a repeating check that
+ * does not hold a thread between checks.
+ */
+inline func::AsyncResult<int64>
+interval(int64 PeriodMs, std::function<bool(int64)> Step,
+         const func::AbortSignal &Signal = func::AbortSignal(),
+         FTimerService &Service = Get()) {
+  return func::AsyncResult<int64>::create(
+      [PeriodMs, Step, Signal, &Service](
+          std::function<void(int64)> Resolve,
+          std::function<void(std::string)> Reject) {
+        detail::IntervalTick(Service, PeriodMs, Step, Signal, 0, Resolve,
+                             Reject);
+      });
+}
+
+/**
+ * Settles like Work unless TimeoutMs passes first; then rejects with
+ * func::TimedOutError and aborts Work with the same reason.
+ * User Story: As network and inference callers, I need a bounded wait so a
+ * stalled request cannot hold a turn forever.
+ */
+template <typename T>
+func::AsyncResult<T> timeout(const func::AbortableWork<T> &Work,
+                             int64 TimeoutMs,
+                             const func::AbortSignal &Parent =
+                                 func::AbortSignal(),
+                             FTimerService &Service = Get()) {
+  return func::timeout<T>(
+      Work,
+      [TimeoutMs, &Service](const func::AbortSignal &Signal) {
+        return delay(TimeoutMs, Signal, Service);
+      },
+      Parent);
+}
+
+/**
+ * Timeout for work that cannot be aborted: it keeps running after the
+ * deadline, but its late outcome is dropped.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+func::AsyncResult<T> timeout(const func::AsyncResult<T> &Work,
+                             int64 TimeoutMs, FTimerService &Service = Get()) {
+  return timeout<T>(
+      func::AbortableWork<T>(
+          [Work](const func::AbortSignal &) { return Work; }),
+      TimeoutMs, func::AbortSignal(), Service);
+}
+
+/**
+ * Backoff schedule: the wait after attempt N is
+ * min(MaxDelayMs, InitialDelayMs * Multiplier^(N-1)).
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FBackoff {
+  int32 MaxAttempts = 3;
+  int64 InitialDelayMs = 250;
+  double Multiplier = 2.0;
+  int64 MaxDelayMs = 30000;
+};
+
+/**
+ * Returns the wait after the given 1-based attempt.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline int64 BackoffDelayMs(const FBackoff &Backoff, int32 Attempt) {
+  return std::min<int64>(
+      Backoff.MaxDelayMs,
+      static_cast<int64>(static_cast<double>(Backoff.InitialDelayMs) *
+                         std::pow(Backoff.Multiplier,
+                                  static_cast<double>(
+                                      std::max<int32>(Attempt, 1) - 1))));
+}
+
+/**
+ * Default retry filter: everything except aborts.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline bool RetryUnlessAborted(const std::string &Error) {
+  return !func::isAbortError(Error);
+}
+
+namespace detail {
+template <typename T>
+void RetryFrom(const func::AbortableWork<T> &Attempt, const FBackoff &Backoff,
+               const std::function<bool(const std::string &)> &ShouldRetry,
+               const func::AbortSignal &Signal, FTimerService &Service,
+               int32 AttemptNo, const std::function<void(T)> &Resolve,
+               const std::function<void(std::string)> &Reject) {
+  const func::AsyncResult<T> Work = Attempt(Signal);
+  func::thenAsync(Work, Resolve);
+  func::catchAsync(Work, [Attempt, Backoff, ShouldRetry, Signal, &Service,
+                          AttemptNo, Resolve, Reject](std::string Error) {
+    AttemptNo < Backoff.MaxAttempts && !Signal.aborted() && ShouldRetry(Error)
+        ? [&]() {
+            const func::AsyncResult<void> Wait = delay(
+                BackoffDelayMs(Backoff, AttemptNo), Signal, Service);
+            func::thenAsync(Wait, [Attempt, Backoff, ShouldRetry, Signal,
+                                   &Service, AttemptNo, Resolve, Reject]() {
+              RetryFrom<T>(Attempt, Backoff, ShouldRetry, Signal, Service,
+                           AttemptNo + 1, Resolve, Reject);
+            });
+            func::catchAsync(Wait, Reject);
+            func::executeAsync(Wait);
+          }()
+        : Reject(Error);
+  });
+  func::executeAsync(Work);
+}
+} // namespace detail
+
+/**
+ * Runs Attempt until it succeeds, ShouldRetry rejects an error, or
+ * Backoff.MaxAttempts is used up, waiting on the wheel between attempts.
+ * Rejects with the last error. Aborting Signal stops between or during
+ * attempts.
+ * User Story: As upload and API callers, I need retries that wait on the
+ * timer wheel so backoff never parks a worker thread.
+ */
+template <typename T>
+func::AsyncResult<T>
+retryWithBackoff(const func::AbortableWork<T> &Attempt,
+                 const FBackoff &Backoff = FBackoff(),
+                 std::function<bool(const std::string &)> ShouldRetry =
+                     &RetryUnlessAborted,
+                 const func::AbortSignal &Signal = func::AbortSignal(),
+                 FTimerService &Service = Get()) {
+  return func::AsyncResult<T>::create(
+      [Attempt, Backoff, ShouldRetry, Signal, &Service](
+          std::function<void(T)> Resolve,
+          std::function<void(std::string)> Reject) {
+        detail::RetryFrom<T>(Attempt, Backoff, ShouldRetry, Signal, Service, 1,
+                             Resolve, Reject);
+      });
+}
+
+/**
+ * Blocks the calling thread until Work settles; left holds the error. For
+ * synchronous callers (CLI, setup commands) whose work completes on other
+ * threads. Never call it from a timer task: it would wait on itself.
+ * User Story: As synchronous command handlers, I need to wait on async work
+ * without sleep-polling so they return the moment it finishes.
+ */
+template <typename T>
+func::Either<std::string, T> awaitResult(const func::AsyncResult<T> &Work) {
+  struct FWait {
+    std::mutex Mutex;
+    std::condition_variable Settled;
+    bool bDone = false;
+    func::Either<std::string, T> Result;
+  };
+  const std::shared_ptr<FWait> Wait = std::make_shared<FWait>();
+  const auto Finish = [Wait](func::Either<std::string, T> Result) {
+    {
+      std::lock_guard<std::mutex> Lock(Wait->Mutex);
+      Wait->Result = std::move(Result);
+      Wait->bDone = true;
+    }
+    Wait->Settled.notify_all();
+  };
+  func::thenAsync(Work, [Finish](T Value) {
+    Finish(func::make_right<std::string, T>(Value));
+  });
+  func::catchAsync(Work, [Finish](std::string Error) {
+    Finish(func::make_left<std::string, T>(Error));
+  });
+  func::executeAsync(Work);
+  std::unique_lock<std::mutex> Lock(Wait->Mutex);
+  Wait->Settled.wait(Lock, [&Wait]() { return Wait->bDone; });
+  return Wait->Result;
+}
+
+} // namespace Timers
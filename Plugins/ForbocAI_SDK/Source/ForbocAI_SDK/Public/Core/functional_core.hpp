@@ -30,6 +30,7 @@
  *  11. mbind / ebind        — Monadic bind for Maybe / Either
  *  12. or_else / match      — Extraction / pattern matching
  *  13. ValidationPipeline   — Functional validation chain
+ *      StaticValidation     — Statically composed, const-ref validation
  *  14. ConfigBuilder        — Functional configuration builder
  *  15. TestResult           — Functional testing result
  *  16. AsyncResult          — Functional async result handling
@@ -38,6 +39,9 @@
  *  19. Dispatcher            — Dictionary-based typed dispatch
  *  20. multi_match           — Multi-case value-based pattern matching
  *  21. from_nullable         — Lift nullable values into Maybe
+ *  22. AbortSignal           — Cooperative cancellation for async work
+ *  23. whenAll / race / ...  — Concurrency combinators for AsyncResult
+ *  24. SharedLazy / ConcurrentMemo — Thread-safe lazies and memo caches
  * REQUIREMENTS:
  *   Several helpers default-construct inactive payloads or
  *   error branches as a deliberate C++11 trade-off:
@@ -49,10 +53,14 @@
  * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -258,7 +266,8 @@ template <size_t Arity, typename Func> Curried<Arity, Func> curry(Func f) {
  * Construction: use the lazy() factory function.
  * Access:       use the eval() free function.
  * Note: Not thread-safe. Intended for single-thread
- * use (e.g. game thread).
+ * use (e.g. game thread); use SharedLazy (§24) for
+ * values forced from worker threads.
  * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
  */
 
@@ -303,6 +312,8 @@ template <typename T> const T &eval(const Lazy<T> &lz) {
  * Note: the default comparator uses tuple equality, so
  * callers with non-comparable or overly-large inputs
  * should supply a custom comparator over a smaller key.
+ * Not thread-safe; SharedMemoizedLast (§24) is the
+ * variant for callers on several threads.
  * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
  */
 
@@ -670,10 +681,10 @@ template <typename T, typename E>
 Either<E, T>
 runValidationStep(const std::vector<std::function<Either<E, T>(T)>> &Steps,
                   size_t Index, T Current) {
-  Either<E, T> Result = Steps[Index](Current);
-  return Result.isLeft ? Result
+  Either<E, T> Result = Steps[Index](std::move(Current));
+  return Result.isLeft ? std::move(Result)
                        : runValidationRecursive<T, E>(Steps, Index + 1,
-                                                      Result.right);
+                                                      std::move(Result.right));
 }
 
 template <typename T, typename E>
@@ -681,8 +692,8 @@ Either<E, T>
 runValidationRecursive(const std::vector<std::function<Either<E, T>(T)>> &Steps,
                        size_t Index, T Current) {
   return Index == Steps.size()
-             ? make_right(E{}, Current)
-             : runValidationStep<T, E>(Steps, Index, Current);
+             ? make_right(E{}, std::move(Current))
+             : runValidationStep<T, E>(Steps, Index, std::move(Current));
 }
 } // namespace detail
 
@@ -697,6 +708,193 @@ Either<E, T> runValidation(const ValidationPipeline<T, E> &Pipeline, T Value) {
                                               std::move(Value));
 }
 
+/**
+ * 13.1 StaticValidation (Statically Composed Validation)
+ * Steps are stored by their concrete type, so running the pipeline calls
+ * each one directly instead of through std::function. Check steps read the
+ * input by const reference and return nothing() to pass or just(error) to
+ * fail; transform steps adjust the input in place. Pipelines without
+ * transforms validate a const reference and never copy it.
+ * Usage:
+ *   auto checks = staticValidation<FAction, FString>()
+ *       | check(RequireType())
+ *       | transform(TrimTarget())
+ *       | check(RequireTarget());
+ *   std::vector<FString> errors =
+ *       validateInPlace(checks, action, ValidationMode::Aggregate);
+ * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
+ */
+
+/**
+ * Whether a run stops at the first error or collects every error.
+ * User Story: As validation callers, I need both modes so gameplay paths can
+ * bail out cheaply while tooling can report every problem at once.
+ */
+enum class ValidationMode { EarlyExit, Aggregate };
+
+/**
+ * Read-only step: Fn(const T&) -> Maybe<E>.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Fn> struct CheckStep {
+  Fn Run;
+};
+
+/**
+ * In-place step: Fn(T&) -> void.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Fn> struct TransformStep {
+  Fn Run;
+};
+
+/**
+ * Wraps a check function as a pipeline step.
+ * User Story: As validation authors, I need a step wrapper so checks keep
+ * their concrete type inside the composed pipeline.
+ */
+template <typename Fn> CheckStep<Fn> check(Fn Run) {
+  return CheckStep<Fn>{std::move(Run)};
+}
+
+/**
+ * Wraps an in-place transform as a pipeline step.
+ * User Story: As validation authors, I need normalization steps so later
+ * checks see cleaned input without the pipeline copying it.
+ */
+template <typename Fn> TransformStep<Fn> transform(Fn Run) {
+  return TransformStep<Fn>{std::move(Run)};
+}
+
+/**
+ * Pipeline whose step list is part of its type.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T, typename E, typename... Steps> struct StaticValidation {
+  std::tuple<Steps...> StepList;
+};
+
+/**
+ * Creates an empty statically composed pipeline.
+ * User Story: As validation authors, I need an entry point so static
+ * pipelines read the same way as ValidationPipeline declarations.
+ */
+template <typename T, typename E = std::string>
+StaticValidation<T, E> staticValidation() {
+  return StaticValidation<T, E>{std::tuple<>()};
+}
+
+/**
+ * Appends a check or transform step, producing a longer pipeline type.
+ * User Story: As validation authors, I need pipe-style composition so
+ * static pipelines are assembled like the existing validation chains.
+ */
+template <typename T, typename E, typename... Steps, typename Fn>
+StaticValidation<T, E, Steps..., CheckStep<Fn>>
+operator|(StaticValidation<T, E, Steps...> Pipeline, CheckStep<Fn> Step) {
+  return StaticValidation<T, E, Steps..., CheckStep<Fn>>{std::tuple_cat(
+      std::move(Pipeline.StepList), std::make_tuple(std::move(Step)))};
+}
+
+template <typename T, typename E, typename... Steps, typename Fn>
+StaticValidation<T, E, Steps..., TransformStep<Fn>>
+operator|(StaticValidation<T, E, Steps...> Pipeline, TransformStep<Fn> Step) {
+  return StaticValidation<T, E, Steps..., TransformStep<Fn>>{std::tuple_cat(
+      std::move(Pipeline.StepList), std::make_tuple(std::move(Step)))};
+}
+
+namespace detail {
+template <typename... Steps> struct HasTransformStep;
+
+template <> struct HasTransformStep<> : std::false_type {};
+
+template <typename Fn, typename... Rest>
+struct HasTransformStep<TransformStep<Fn>, Rest...> : std::true_type {};
+
+template <typename Fn, typename... Rest>
+struct HasTransformStep<CheckStep<Fn>, Rest...> : HasTransformStep<Rest...> {};
+
+template <typename V, typename E, typename Fn>
+void applyValidationStep(const CheckStep<Fn> &Step, V &Value,
+                         std::vector<E> &Errors) {
+  Maybe<E> Error = Step.Run(static_cast<const V &>(Value));
+  Error.hasValue ? (Errors.push_back(std::move(Error.value)), void())
+                 : void();
+}
+
+template <typename V, typename E, typename Fn>
+void applyValidationStep(const TransformStep<Fn> &Step, V &Value,
+                         std::vector<E> &Errors) {
+  static_cast<void>(Errors);
+  Step.Run(Value);
+}
+
+template <size_t I, size_t N> struct StaticValidationRunner {
+  template <typename Tuple, typename V, typename E>
+  static void run(const Tuple &StepList, V &Value, std::vector<E> &Errors,
+                  ValidationMode Mode) {
+    (Mode == ValidationMode::EarlyExit && !Errors.empty())
+        ? void()
+        : (applyValidationStep(std::get<I>(StepList), Value, Errors),
+           StaticValidationRunner<I + 1, N>::run(StepList, Value, Errors,
+                                                 Mode));
+  }
+};
+
+template <size_t N> struct StaticValidationRunner<N, N> {
+  template <typename Tuple, typename V, typename E>
+  static void run(const Tuple &, V &, std::vector<E> &, ValidationMode) {}
+};
+} // namespace detail
+
+/**
+ * Runs a check-only pipeline against a const reference; the input is never
+ * copied. An empty result means the input passed.
+ * User Story: As per-action validation, I need zero-copy checks so rule count
+ * does not multiply payload copies on the hot path.
+ */
+template <typename T, typename E, typename... Steps>
+std::vector<E> validateRef(const StaticValidation<T, E, Steps...> &Pipeline,
+                           const T &Value,
+                           ValidationMode Mode = ValidationMode::EarlyExit) {
+  static_assert(!detail::HasTransformStep<Steps...>::value,
+                "validateRef cannot run transform steps; use validateInPlace");
+  std::vector<E> Errors;
+  detail::StaticValidationRunner<0, sizeof...(Steps)>::run(
+      Pipeline.StepList, Value, Errors, Mode);
+  return Errors;
+}
+
+/**
+ * Runs a pipeline, applying transform steps to Value in place. An empty
+ * result means the (possibly normalized) input passed.
+ * User Story: As validation that normalizes input, I need transforms applied
+ * to the caller's value so normalization costs no extra copy.
+ */
+template <typename T, typename E, typename... Steps>
+std::vector<E>
+validateInPlace(const StaticValidation<T, E, Steps...> &Pipeline, T &Value,
+                ValidationMode Mode = ValidationMode::EarlyExit) {
+  std::vector<E> Errors;
+  detail::StaticValidationRunner<0, sizeof...(Steps)>::run(
+      Pipeline.StepList, Value, Errors, Mode);
+  return Errors;
+}
+
+/**
+ * Adapts a static pipeline to the Either shape of runValidation, moving the
+ * value through and stopping at the first error.
+ * User Story: As existing Either-based call sites, I need the same result
+ * shape so switching to a static pipeline does not change their handling.
+ */
+template <typename T, typename E, typename... Steps>
+Either<E, T> runValidation(const StaticValidation<T, E, Steps...> &Pipeline,
+                           T Value) {
+  std::vector<E> Errors = validateInPlace(Pipeline, Value);
+  return Errors.empty() ? make_right(E{}, std::move(Value))
+                        : make_left(std::move(Errors.front()), T{});
+}
+
 /**
  * 14. ConfigBuilder (Functional Configuration Builder)
  * A data-first builder for creating immutable
@@ -1462,6 +1660,1093 @@ T require_just(const Maybe<T> &m, const std::string &errorMsg) {
   return m.hasValue ? m.value : detail::failWithMessage<T>(errorMsg);
 }
 
+/**
+ * 22. AbortSignal (Cooperative Cancellation)
+ * An AbortController owns the right to abort; the AbortSignal it hands out
+ * is observed by the work. Aborting is one-shot: listeners run once, on the
+ * aborting thread, and listeners added afterwards run immediately. A
+ * default-constructed signal has no state and never aborts, so APIs can take
+ * one by default at no cost.
+ * Usage:
+ *   func::AbortController Controller = func::createAbortController();
+ *   func::abortable(Work, Controller.signal).catch_(...).execute();
+ *   Controller.abort("npc left");  // Work's chain rejects with "Aborted: npc left"
+ * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
+ */
+
+/**
+ * Rejection message prefix used for aborted work.
+ * User Story: As rejection handlers, I need one marker for aborts so they can
+ * tell abandoned work apart from failures.
+ */
+static const char *const AbortedError = "Aborted";
+
+/**
+ * Builds the rejection message for an abort reason.
+ * User Story: As aborted work, I need the reason kept in the rejection so logs
+ * show why a request was dropped.
+ */
+inline std::string abortMessage(const std::string &reason) {
+  return reason.empty() || reason == AbortedError
+             ? std::string(AbortedError)
+             : std::string(AbortedError) + ": " + reason;
+}
+
+/**
+ * Returns whether a rejection message came from an abort.
+ * User Story: As rejection handlers, I need to recognize aborts so abandoned
+ * work is not reported as an error.
+ */
+inline bool isAbortError(const std::string &error) {
+  const std::string Prefix(AbortedError);
+  return error.compare(0, Prefix.size(), Prefix) == 0 &&
+         (error.size() == Prefix.size() || error[Prefix.size()] == ':');
+}
+
+struct AbortSignal {
+  typedef std::pair<uint64_t, std::function<void(std::string)>> Listener;
+  struct State {
+    std::atomic<bool> aborted{false};
+    std::mutex mutex;
+    std::string reason;
+    uint64_t nextListener = 1;
+    std::vector<Listener> listeners;
+  };
+  std::shared_ptr<State> state;
+
+  /**
+   * Returns whether abort has been requested. Safe to poll from any thread.
+   * User Story: As long-running loops, I need a cheap check so they can stop
+   * between steps once their requester is gone.
+   */
+  bool aborted() const {
+    return state && state->aborted.load(std::memory_order_acquire);
+  }
+
+  /**
+   * Returns the abort reason, or an empty string while not aborted.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  std::string reason() const {
+    return !state ? std::string() : [this]() {
+      std::lock_guard<std::mutex> Lock(state->mutex);
+      return state->reason;
+    }();
+  }
+
+  /**
+   * Returns the abort flag for native code that polls a raw atomic. The
+   * pointer stays valid while any copy of this signal is alive.
+   * User Story: As native inference loops, I need a plain flag so C callbacks
+   * can observe aborts without std::function plumbing.
+   */
+  const std::atomic<bool> *flag() const {
+    return state ? &state->aborted : nullptr;
+  }
+
+  /**
+   * Registers a listener and returns a function that removes it. Runs the
+   * listener immediately when the signal is already aborted.
+   * User Story: As request wrappers, I need abort callbacks so in-flight
+   * requests are cancelled as soon as their owner goes away.
+   */
+  std::function<void()>
+  onAbort(std::function<void(std::string)> listener) const {
+    return !state ? std::function<void()>([]() {})
+                  : [this, &listener]() -> std::function<void()> {
+      std::unique_lock<std::mutex> Lock(state->mutex);
+      const bool bAborted = state->aborted.load(std::memory_order_acquire);
+      const uint64_t Id = bAborted ? 0 : state->nextListener++;
+      bAborted ? void()
+               : (state->listeners.emplace_back(Id, std::move(listener)), void());
+      const std::string Reason = state->reason;
+      Lock.unlock();
+      bAborted ? listener(Reason) : void();
+      const std::weak_ptr<State> Weak = state;
+      return [Weak, Id]() {
+        const std::shared_ptr<State> Shared = Weak.lock();
+        Shared ? [&Shared, Id]() {
+          std::lock_guard<std::mutex> Guard(Shared->mutex);
+          auto &Listeners = Shared->listeners;
+          Listeners.erase(
+              std::remove_if(Listeners.begin(), Listeners.end(),
+                             [Id](const Listener &Entry) {
+                               return Entry.first == Id;
+                             }),
+              Listeners.end());
+        }()
+               : void();
+      };
+    }();
+  }
+};
+
+struct AbortController {
+  AbortSignal signal;
+
+  /**
+   * Aborts the signal once and runs its listeners with the reason.
+   * User Story: As NPC and UI owners, I need one call that cancels everything
+   * tied to a conversation when the player walks away.
+   */
+  void abort(const std::string &reason = AbortedError) const {
+    !signal.state ? void() : [this, &reason]() {
+      std::vector<AbortSignal::Listener> Listeners;
+      {
+        std::lock_guard<std::mutex> Lock(signal.state->mutex);
+        const bool bFirst =
+            !signal.state->aborted.load(std::memory_order_acquire);
+        bFirst ? (signal.state->reason = reason,
+                  signal.state->aborted.store(true, std::memory_order_release),
+                  Listeners.swap(signal.state->listeners), void())
+               : void();
+      }
+      notifyListeners(Listeners, 0, reason);
+    }();
+  }
+
+private:
+  static void notifyListeners(const std::vector<AbortSignal::Listener> &Listeners,
+                              size_t Index, const std::string &reason) {
+    Index >= Listeners.size()
+        ? void()
+        : (Listeners[Index].second(reason),
+           notifyListeners(Listeners, Index + 1, reason));
+  }
+};
+
+/**
+ * Creates a controller with a fresh, not yet aborted signal.
+ * User Story: As cancellable call sites, I need a factory so every controller
+ * starts with its own shared state.
+ */
+inline AbortController createAbortController() {
+  AbortController Controller;
+  Controller.signal.state = std::make_shared<AbortSignal::State>();
+  return Controller;
+}
+
+/**
+ * Wraps work so it rejects with an abort message once the signal fires. The
+ * first of completion, failure and abort wins; later outcomes are dropped.
+ * Work that has not started by the time of the abort is never executed.
+ * User Story: As thunk plumbing, I need abandoned chains to settle right away
+ * so fulfilled actions are not dispatched for requesters that are gone.
+ */
+template <typename T>
+AsyncResult<T> abortable(const AsyncResult<T> &work, const AbortSignal &signal) {
+  return !signal.state
+             ? work
+             : createAsyncResult<T>([work, signal](
+                                        std::function<void(T)> resolve,
+                                        std::function<void(std::string)>
+                                            reject) {
+                 const std::shared_ptr<std::atomic<bool>> Settled =
+                     std::make_shared<std::atomic<bool>>(false);
+                 const std::shared_ptr<std::function<void()>> Unsubscribe =
+                     std::make_shared<std::function<void()>>(
+                         signal.onAbort([Settled, reject](std::string Reason) {
+                           !Settled->exchange(true)
+                               ? reject(abortMessage(Reason))
+                               : void();
+                         }));
+                 signal.aborted()
+                     ? void()
+                     : (thenAsync(work,
+                                  [Settled, Unsubscribe, resolve](T Value) {
+                                    !Settled->exchange(true)
+                                        ? ((*Unsubscribe)(), resolve(Value))
+                                        : void();
+                                  }),
+                        catchAsync(work,
+                                   [Settled, Unsubscribe,
+                                    reject](std::string Error) {
+                                     !Settled->exchange(true)
+                                         ? ((*Unsubscribe)(), reject(Error))
+                                         : void();
+                                   }),
+                        executeAsync(work));
+               });
+}
+
+/**
+ * 23. Concurrency combinators (whenAll / whenAny / race / mapConcurrent /
+ *     timeout)
+ * Fan AsyncResults out and join them. Inputs start together when the
+ * combined result executes, and completions may arrive on any thread; each
+ * join is guarded by a mutex and settles exactly once. Combinators that can
+ * finish before every input does take AbortableWork factories: the signal
+ * they receive fires when the join settles early, so losers and siblings of
+ * a failure stop instead of running to completion. An optional parent
+ * signal aborts the whole join. Value type T must not be void.
+ * User Story: As thunk composition, I need fan-out and join helpers so
+ * independent async work runs in parallel instead of one chain at a time.
+ */
+
+static const char *const TimedOutError = "Timed out";
+
+/**
+ * Returns whether a rejection message came from timeout().
+ * User Story: As rejection handlers, I need timeouts recognized so slow work
+ * can be retried or reported differently from hard failures.
+ */
+inline bool isTimeoutError(const std::string &error) {
+  return error == TimedOutError;
+}
+
+template <typename T>
+using AbortableWork = std::function<AsyncResult<T>(const AbortSignal &)>;
+
+namespace detail {
+template <typename T> struct AsyncValue;
+template <typename T> struct AsyncValue<AsyncResult<T>> { typedef T type; };
+
+template <typename T> struct FanState {
+  explicit FanState(size_t Count)
+      : values(Count), errors(Count), remaining(Count), next(0),
+        settled(false), siblings(createAbortController()) {}
+  std::mutex mutex;
+  std::vector<T> values;
+  std::vector<std::string> errors;
+  size_t remaining;
+  size_t next;
+  bool settled;
+  AbortController siblings;
+  std::function<void()> unlinkParent;
+};
+
+inline void forEachIndex(size_t Index, size_t End,
+                         const std::function<void(size_t)> &Fn) {
+  Index >= End ? void() : (Fn(Index), forEachIndex(Index + 1, End, Fn));
+}
+
+/**
+ * Claims the right to settle a join. Only the first caller gets true; it
+ * also detaches the parent signal.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T> bool claimFan(FanState<T> &Fan) {
+  std::unique_lock<std::mutex> Lock(Fan.mutex);
+  const bool bFirst = !Fan.settled;
+  Fan.settled = true;
+  std::function<void()> Unlink;
+  bFirst ? Unlink.swap(Fan.unlinkParent) : void();
+  Lock.unlock();
+  Unlink ? Unlink() : void();
+  return bFirst;
+}
+
+template <typename T> bool isSettled(FanState<T> &Fan) {
+  std::lock_guard<std::mutex> Lock(Fan.mutex);
+  return Fan.settled;
+}
+
+/**
+ * Stores one input's value; returns true when it was the last outstanding.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+bool fillSlot(FanState<T> &Fan, size_t Index, const T &Value) {
+  std::lock_guard<std::mutex> Lock(Fan.mutex);
+  return !Fan.settled &&
+         (Fan.values[Index] = Value, --Fan.remaining == 0);
+}
+
+/**
+ * Records one input's failure; returns true when it was the last outstanding.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+bool failSlot(FanState<T> &Fan, size_t Index, const std::string &Error) {
+  std::lock_guard<std::mutex> Lock(Fan.mutex);
+  return !Fan.settled &&
+         (Fan.errors[Index] = Error, --Fan.remaining == 0);
+}
+
+template <typename T> std::vector<T> takeValues(FanState<T> &Fan) {
+  std::lock_guard<std::mutex> Lock(Fan.mutex);
+  return std::move(Fan.values);
+}
+
+/**
+ * Joins every input error into one message, keeping input positions.
+ * User Story: As whenAny callers, I need every failure reported when nothing
+ * succeeds so the root cause is not hidden behind the last error.
+ */
+inline std::string aggregateErrors(const std::vector<std::string> &Errors) {
+  std::string Message = "All " + std::to_string(Errors.size()) +
+                        " tasks failed";
+  forEachIndex(0, Errors.size(), [&Message, &Errors](size_t Index) {
+    Message += (Index == 0 ? ": [" : "; [") + std::to_string(Index) + "] " +
+               Errors[Index];
+  });
+  return Message;
+}
+
+/**
+ * Settles the join as failed and aborts every input still running.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+void rejectFan(FanState<T> &Fan, const std::string &Error,
+               const std::function<void(std::string)> &Reject) {
+  claimFan(Fan) ? (Fan.siblings.abort(Error), Reject(Error)) : void();
+}
+
+/**
+ * Rejects the join when Parent aborts. Returns false, without linking, when
+ * Parent has already fired and the join must not start.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+bool linkParent(const std::shared_ptr<FanState<T>> &Fan,
+                const AbortSignal &Parent,
+                const std::function<void(std::string)> &Reject) {
+  return Parent.aborted()
+             ? (Reject(abortMessage(Parent.reason())), false)
+             : [&Fan, &Parent, &Reject]() {
+                 std::function<void()> Unlink =
+                     Parent.onAbort([Fan, Reject](std::string Reason) {
+                       rejectFan(*Fan, abortMessage(Reason), Reject);
+                     });
+                 std::unique_lock<std::mutex> Lock(Fan->mutex);
+                 const bool bSettled = Fan->settled;
+                 bSettled ? void() : Fan->unlinkParent.swap(Unlink);
+                 Lock.unlock();
+                 Unlink ? Unlink() : void();
+                 return !bSettled;
+               }();
+}
+
+/**
+ * Starts every input and resolves with all values in input order, or
+ * rejects with the first error.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+void joinAll(const std::vector<AsyncResult<T>> &Works,
+             const std::shared_ptr<FanState<T>> &Fan,
+             const std::function<void(std::vector<T>)> &Resolve,
+             const std::function<void(std::string)> &Reject) {
+  Works.empty() ? (claimFan(*Fan), Resolve(std::vector<T>()))
+                : forEachIndex(0, Works.size(), [&Works, &Fan, &Resolve,
+                                                 &Reject](size_t Index) {
+                    const AsyncResult<T> Work = Works[Index];
+                    isSettled(*Fan)
+                        ? void()
+                        : (thenAsync(Work,
+                                     [Fan, Index, Resolve](T Value) {
+                                       fillSlot(*Fan, Index, Value) &&
+                                               claimFan(*Fan)
+                                           ? Resolve(takeValues(*Fan))
+                                           : void();
+                                     }),
+                           catchAsync(Work,
+                                      [Fan, Reject](std::string Error) {
+                                        rejectFan(*Fan, Error, Reject);
+                                      }),
+                           executeAsync(Work));
+                  });
+}
+
+/**
+ * Starts every factory and settles on the first qualifying outcome. With
+ * bAnySettles a failure wins too (race); otherwise failures are collected
+ * and the join rejects only when every input failed (whenAny).
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+void joinFirst(const std::vector<AbortableWork<T>> &Works,
+               const std::shared_ptr<FanState<T>> &Fan, bool bAnySettles,
+               const std::function<void(T)> &Resolve,
+               const std::function<void(std::string)> &Reject) {
+  Works.empty()
+      ? (claimFan(*Fan), Reject("No tasks to wait for"))
+      : forEachIndex(0, Works.size(), [&Works, &Fan, bAnySettles, &Resolve,
+                                       &Reject](size_t Index) {
+          isSettled(*Fan) ? void() : [&]() {
+            const AsyncResult<T> Work = Works[Index](Fan->siblings.signal);
+            thenAsync(Work, [Fan, Resolve](T Value) {
+              claimFan(*Fan) ? (Fan->siblings.abort("Superseded"),
+                                Resolve(Value))
+                             : void();
+            });
+            catchAsync(Work, [Fan, Index, bAnySettles,
+                              Reject](std::string Error) {
+              bAnySettles ? rejectFan(*Fan, Error, Reject)
+              : failSlot(*Fan, Index, Error) && claimFan(*Fan)
+                  ? Reject(aggregateErrors(Fan->errors))
+                  : void();
+            });
+            executeAsync(Work);
+          }();
+        });
+}
+
+/**
+ * Launches the next item of a bounded map, if any remain and the join is
+ * still open.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename B, typename A, typename Fn>
+void launchNext(const std::shared_ptr<const std::vector<A>> &Items,
+                const Fn &Map,
+                const std::shared_ptr<FanState<B>> &Fan,
+                const std::function<void(std::vector<B>)> &Resolve,
+                const std::function<void(std::string)> &Reject) {
+  std::unique_lock<std::mutex> Lock(Fan->mutex);
+  const bool bLaunch = !Fan->settled && Fan->next < Items->size();
+  const size_t Index = bLaunch ? Fan->next++ : 0;
+  Lock.unlock();
+  bLaunch ? [&]() {
+    const AsyncResult<B> Work = Map((*Items)[Index], Fan->siblings.signal);
+    thenAsync(Work, [Items, Map, Fan, Index, Resolve, Reject](B Value) {
+      fillSlot(*Fan, Index, Value)
+          ? (claimFan(*Fan) ? Resolve(takeValues(*Fan)) : void())
+          : launchNext<B>(Items, Map, Fan, Resolve, Reject);
+    });
+    catchAsync(Work, [Fan, Reject](std::string Error) {
+      rejectFan(*Fan, Error, Reject);
+    });
+    executeAsync(Work);
+  }()
+          : void();
+}
+} // namespace detail
+
+/**
+ * Runs all inputs concurrently and resolves with their values in input
+ * order. Rejects with the first error; other inputs keep running because a
+ * plain AsyncResult cannot be stopped (use the factory overload for that).
+ * User Story: As thunk composition, I need to wait on several independent
+ * results at once so fan-out work finishes in the time of the slowest part.
+ */
+template <typename T>
+AsyncResult<std::vector<T>> whenAll(const std::vector<AsyncResult<T>> &works) {
+  return createAsyncResult<std::vector<T>>(
+      [works](std::function<void(std::vector<T>)> resolve,
+              std::function<void(std::string)> reject) {
+        detail::joinAll<T>(
+            works, std::make_shared<detail::FanState<T>>(works.size()),
+            resolve, reject);
+      });
+}
+
+/**
+ * Runs all factories concurrently and resolves with their values in input
+ * order. The first error rejects the join and aborts the remaining inputs.
+ * User Story: As thunk composition, I need a failed fan-out to stop its
+ * siblings so network and inference are not spent on a doomed batch.
+ */
+template <typename T>
+AsyncResult<std::vector<T>>
+whenAll(const std::vector<AbortableWork<T>> &works,
+        const AbortSignal &parent = AbortSignal()) {
+  return createAsyncResult<std::vector<T>>(
+      [works, parent](std::function<void(std::vector<T>)> resolve,
+                      std::function<void(std::string)> reject) {
+        const std::shared_ptr<detail::FanState<T>> Fan =
+            std::make_shared<detail::FanState<T>>(works.size());
+        std::vector<AsyncResult<T>> Started;
+        detail::linkParent(Fan, parent, reject)
+            ? (std::transform(works.begin(), works.end(),
+                              std::back_inserter(Started),
+                              [&Fan](const AbortableWork<T> &Work) {
+                                return Work(Fan->siblings.signal);
+                              }),
+               detail::joinAll<T>(Started, Fan, resolve, reject))
+            : void();
+      });
+}
+
+/**
+ * Runs all inputs concurrently and resolves, never rejects, with one Either
+ * per input in input order: left holds the error, right the value.
+ * User Story: As batch callers, I need every outcome when partial success is
+ * acceptable so one bad item does not hide the rest.
+ */
+template <typename T>
+AsyncResult<std::vector<Either<std::string, T>>>
+whenAllSettled(const std::vector<AsyncResult<T>> &works) {
+  typedef Either<std::string, T> Outcome;
+  return createAsyncResult<std::vector<Outcome>>(
+      [works](std::function<void(std::vector<Outcome>)> resolve,
+              std::function<void(std::string)> reject) {
+        static_cast<void>(reject);
+        const std::shared_ptr<detail::FanState<Outcome>> Fan =
+            std::make_shared<detail::FanState<Outcome>>(works.size());
+        works.empty()
+            ? resolve(std::vector<Outcome>())
+            : detail::forEachIndex(0, works.size(), [&works, &Fan,
+                                                     &resolve](size_t Index) {
+                const AsyncResult<T> Work = works[Index];
+                thenAsync(Work, [Fan, Index, resolve](T Value) {
+                  detail::fillSlot(*Fan, Index,
+                                   make_right<std::string, T>(Value)) &&
+                          detail::claimFan(*Fan)
+                      ? resolve(detail::takeValues(*Fan))
+                      : void();
+                });
+                catchAsync(Work, [Fan, Index, resolve](std::string Error) {
+                  detail::fillSlot(*Fan, Index,
+                                   make_left<std::string, T>(Error)) &&
+                          detail::claimFan(*Fan)
+                      ? resolve(detail::takeValues(*Fan))
+                      : void();
+                });
+                executeAsync(Work);
+              });
+      });
+}
+
+/**
+ * Resolves with the first input to succeed and aborts the others. Rejects
+ * only when every input failed, with all errors joined in input order.
+ * User Story: As fallback flows, I need the first good answer from several
+ * sources so one slow or failing source does not block the rest.
+ */
+template <typename T>
+AsyncResult<T> whenAny(const std::vector<AbortableWork<T>> &works,
+                       const AbortSignal &parent = AbortSignal()) {
+  return createAsyncResult<T>([works, parent](
+                                  std::function<void(T)> resolve,
+                                  std::function<void(std::string)> reject) {
+    const std::shared_ptr<detail::FanState<T>> Fan =
+        std::make_shared<detail::FanState<T>>(works.size());
+    detail::linkParent(Fan, parent, reject)
+        ? detail::joinFirst<T>(works, Fan, false, resolve, reject)
+        : void();
+  });
+}
+
+/**
+ * Settles with the first input to settle, success or failure, and aborts
+ * the others.
+ * User Story: As latency-sensitive flows, I need the first outcome of
+ * competing work so the slower attempts are dropped as soon as one returns.
+ */
+template <typename T>
+AsyncResult<T> race(const std::vector<AbortableWork<T>> &works,
+                    const AbortSignal &parent = AbortSignal()) {
+  return createAsyncResult<T>([works, parent](
+                                  std::function<void(T)> resolve,
+                                  std::function<void(std::string)> reject) {
+    const std::shared_ptr<detail::FanState<T>> Fan =
+        std::make_shared<detail::FanState<T>>(works.size());
+    detail::linkParent(Fan, parent, reject)
+        ? detail::joinFirst<T>(works, Fan, true, resolve, reject)
+        : void();
+  });
+}
+
+/**
+ * Maps items through fn with at most limit calls in flight and resolves
+ * with the results in item order. The first error rejects, aborts the calls
+ * in flight and launches no more. A limit of 0 is treated as 1.
+ * User Story: As batch thunks, I need bounded parallel maps so fan-out uses
+ * spare cores without flooding the network or the native worker pool.
+ */
+template <typename A, typename Fn>
+AsyncResult<std::vector<typename detail::AsyncValue<decltype(
+    std::declval<Fn &>()(std::declval<const A &>(),
+                         std::declval<const AbortSignal &>()))>::type>>
+mapConcurrent(const std::vector<A> &items, size_t limit, Fn fn,
+              const AbortSignal &parent = AbortSignal()) {
+  typedef typename detail::AsyncValue<decltype(std::declval<Fn &>()(
+      std::declval<const A &>(), std::declval<const AbortSignal &>()))>::type
+      B;
+  return createAsyncResult<std::vector<B>>(
+      [items, limit, fn, parent](std::function<void(std::vector<B>)> resolve,
+                                 std::function<void(std::string)> reject) {
+        const std::shared_ptr<detail::FanState<B>> Fan =
+            std::make_shared<detail::FanState<B>>(items.size());
+        const std::shared_ptr<const std::vector<A>> Items =
+            std::make_shared<const std::vector<A>>(items);
+        items.empty()
+            ? resolve(std::vector<B>())
+        : detail::linkParent(Fan, parent, reject)
+            ? detail::forEachIndex(
+                  0, std::min(std::max<size_t>(limit, 1), items.size()),
+                  [&Items, &fn, &Fan, &resolve, &reject](size_t) {
+                    detail::launchNext<B>(Items, fn, Fan, resolve, reject);
+                  })
+            : void();
+      });
+}
+
+/**
+ * Rejects with TimedOutError when deadline resolves before work settles,
+ * aborting work with the same reason; otherwise settles like work and
+ * aborts the deadline. Deadlines come from the caller's timer source.
+ * User Story: As network and inference callers, I need an upper bound on
+ * waiting so a stalled request cannot hold an NPC turn forever.
+ */
+template <typename T>
+AsyncResult<T> timeout(const AbortableWork<T> &work,
+                       const AbortableWork<void> &deadline,
+                       const AbortSignal &parent = AbortSignal()) {
+  std::vector<AbortableWork<T>> Arms;
+  Arms.push_back(work);
+  Arms.push_back([deadline](const AbortSignal &Signal) {
+    const AsyncResult<void> Timer = deadline(Signal);
+    return createAsyncResult<T>(
+        [Timer](std::function<void(T)> resolve,
+                std::function<void(std::string)> reject) {
+          static_cast<void>(resolve);
+          thenAsync(Timer, [reject]() { reject(TimedOutError); });
+          catchAsync(Timer, reject);
+          executeAsync(Timer);
+        });
+  });
+  return race<T>(Arms, parent);
+}
+
+/**
+ * 24. Concurrent memoization (SharedLazy / ConcurrentMemo /
+ *     SharedMemoizedLast)
+ * Thread-safe counterparts of Lazy (§6) and MemoizedLast (§7) for derived
+ * values shared with worker threads:
+ *   - SharedLazy<T> evaluates once under std::call_once. Copies share one
+ *     cell, so every copy observes the same single evaluation.
+ *   - ConcurrentMemo<K, V> is a bounded keyed cache split into independently
+ *     locked shards with least-recently-used eviction per shard; each shard
+ *     threads its entries on an intrusive recency list, so hits and
+ *     evictions are O(1). Compute runs
+ *     outside the shard lock, so two threads missing the same key may both
+ *     compute it; the first stored value wins and both return it.
+ *   - SharedMemoizedLast<R(Args...)> keeps its last (args, result) pair as
+ *     one immutable snapshot that is swapped in whole. Readers never see a
+ *     result paired with another call's arguments.
+ * §6 and §7 stay the cheaper choice for values used on one thread.
+ * Usage:
+ *   func::SharedLazy<FConfig> Config = func::sharedLazy(&LoadConfig);
+ *   const FConfig &Value = func::eval(Config);  // any thread, loads once
+ *   auto Embeddings = func::createConcurrentMemo<std::string, FVec>(1024);
+ *   func::memoGetOrCompute(Embeddings, Text, &Embed);
+ * User Story: As thunks running on worker threads, I need caches that are
+ * safe to share so derived data is computed once instead of recomputed or
+ * serialized behind the game thread.
+ */
+
+namespace detail {
+template <typename T> struct SharedLazyCell {
+  std::once_flag once;
+  std::function<T()> thunk;
+  std::unique_ptr<T> value;
+};
+
+template <typename T> void fillSharedLazy(SharedLazyCell<T> *cell) {
+  cell->value.reset(new T(cell->thunk()));
+  cell->thunk = std::function<T()>();
+}
+} // namespace detail
+
+template <typename T> struct SharedLazy {
+  std::shared_ptr<detail::SharedLazyCell<T>> cell;
+};
+
+/**
+ * Wraps a thunk so it is evaluated at most once across all threads. A thunk
+ * that throws leaves the value unset and the next eval() retries. The cell
+ * owns the value, so a thunk returning a reference stores a copy of what it
+ * refers to: the lazy type is the decayed result type.
+ * User Story: As shared setup code, I need a lazy value worker threads can
+ * force concurrently without computing it twice.
+ */
+template <typename F>
+auto sharedLazy(F &&f)
+    -> SharedLazy<typename std::decay<decltype(f())>::type> {
+  typedef typename std::decay<decltype(f())>::type T;
+  SharedLazy<T> lz;
+  lz.cell = std::make_shared<detail::SharedLazyCell<T>>();
+  lz.cell->thunk = std::forward<F>(f);
+  return lz;
+}
+
+/**
+ * Forces a shared lazy value; concurrent callers block until the single
+ * evaluation finishes, later callers take the once-flag fast path.
+ * User Story: As shared setup code, I need the same eval() entry point for
+ * shared lazies so switching from Lazy is a one-line change.
+ */
+template <typename T> const T &eval(const SharedLazy<T> &lz) {
+  std::call_once(lz.cell->once, &detail::fillSharedLazy<T>, lz.cell.get());
+  return *lz.cell->value;
+}
+
+/**
+ * Cache counters for ConcurrentMemo, summed over all shards. Each shard
+ * counts under its own lock so lookups share no global atomic.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct MemoCacheStats {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+  size_t size;
+  size_t capacity;
+};
+
+/** Shards a ConcurrentMemo uses unless the caller asks for another count. */
+static const size_t DefaultMemoShards = 16;
+
+namespace detail {
+/**
+ * One shard. Entries are linked newest to oldest through pointers stored in
+ * the entries themselves; unordered_map nodes never move, so the links stay
+ * valid across rehashes.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Key, typename Value, typename Hash> struct MemoShard {
+  struct Entry {
+    std::shared_ptr<const Value> value;
+    const Key *key;
+    Entry *newer;
+    Entry *older;
+  };
+
+  std::mutex mutex;
+  std::unordered_map<Key, Entry, Hash> entries;
+  Entry *newest = nullptr;
+  Entry *oldest = nullptr;
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+};
+
+template <typename Key, typename Value, typename Hash> struct MemoShards {
+  typedef MemoShard<Key, Value, Hash> Shard;
+
+  std::vector<Shard> shards;
+  size_t shardCapacity;
+  Hash hash;
+
+  MemoShards(size_t shardCount, size_t capacity)
+      : shards(std::max<size_t>(shardCount, 1)),
+        shardCapacity(std::max<size_t>(
+            (capacity + shards.size() - 1) / shards.size(), 1)) {}
+
+  Shard &shardFor(const Key &key) {
+    const size_t h = hash(key);
+    return shards[(h ^ (h >> 16)) % shards.size()];
+  }
+};
+
+/** Unlinks an entry from the shard's recency list. Caller holds the lock. */
+template <typename Key, typename Value, typename Hash>
+void unlinkMemoEntry(MemoShard<Key, Value, Hash> &shard,
+                     typename MemoShard<Key, Value, Hash>::Entry *entry) {
+  (entry->newer ? entry->newer->older : shard.newest) = entry->older;
+  (entry->older ? entry->older->newer : shard.oldest) = entry->newer;
+}
+
+/** Links an unlinked entry in as the newest. Caller holds the lock. */
+template <typename Key, typename Value, typename Hash>
+void linkNewestMemoEntry(MemoShard<Key, Value, Hash> &shard,
+                         typename MemoShard<Key, Value, Hash>::Entry *entry) {
+  entry->newer = nullptr;
+  entry->older = shard.newest;
+  (shard.newest ? shard.newest->newer : shard.oldest) = entry;
+  shard.newest = entry;
+}
+
+/** Marks an entry most recently used. Caller holds the lock. */
+template <typename Key, typename Value, typename Hash>
+void touchMemoEntry(MemoShard<Key, Value, Hash> &shard,
+                    typename MemoShard<Key, Value, Hash>::Entry *entry) {
+  entry != shard.newest
+      ? (unlinkMemoEntry(shard, entry), linkNewestMemoEntry(shard, entry))
+      : void();
+}
+
+template <typename Key, typename Value, typename Hash>
+std::shared_ptr<const Value> lookupMemoShard(MemoShard<Key, Value, Hash> &shard,
+                                             const Key &key) {
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  typename std::unordered_map<Key,
+                              typename MemoShard<Key, Value, Hash>::Entry,
+                              Hash>::iterator it = shard.entries.find(key);
+  return it == shard.entries.end()
+             ? (++shard.misses, std::shared_ptr<const Value>())
+             : (++shard.hits, touchMemoEntry(shard, &it->second),
+                it->second.value);
+}
+
+/**
+ * Drops the shard's least recently used entry, the tail of its recency list.
+ * Caller holds the shard lock and the shard is not empty.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Key, typename Value, typename Hash>
+void evictMemoShard(MemoShard<Key, Value, Hash> &shard) {
+  typename MemoShard<Key, Value, Hash>::Entry *victim = shard.oldest;
+  unlinkMemoEntry(shard, victim);
+  shard.entries.erase(shard.entries.find(*victim->key));
+  ++shard.evictions;
+}
+
+/**
+ * Stores a computed value unless another thread stored the key first, in
+ * which case the stored value is kept and returned.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Key, typename Value, typename Hash>
+std::shared_ptr<const Value>
+storeMemoShard(MemoShards<Key, Value, Hash> &memo,
+               MemoShard<Key, Value, Hash> &shard, const Key &key,
+               std::shared_ptr<const Value> value) {
+  typedef typename MemoShard<Key, Value, Hash>::Entry Entry;
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const bool present = shard.entries.count(key) > 0;
+  !present && shard.entries.size() >= memo.shardCapacity
+      ? evictMemoShard(shard)
+      : void();
+  const std::pair<typename std::unordered_map<Key, Entry, Hash>::iterator,
+                  bool>
+      inserted = shard.entries.insert(std::make_pair(
+          key, Entry{std::move(value), nullptr, nullptr, nullptr}));
+  Entry &stored = inserted.first->second;
+  inserted.second ? (stored.key = &inserted.first->first,
+                     linkNewestMemoEntry(shard, &stored))
+                  : touchMemoEntry(shard, &stored);
+  return stored.value;
+}
+} // namespace detail
+
+/**
+ * Bounded, sharded, thread-safe memo cache. Copies share one cache. Values
+ * are handed out as shared pointers, so an evicted value stays valid for
+ * callers still holding it.
+ * User Story: As worker-thread lookups, I need a keyed cache that scales
+ * with threads so hot keys are not serialized behind one lock.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+struct ConcurrentMemo {
+  std::shared_ptr<detail::MemoShards<Key, Value, Hash>> state;
+};
+
+/**
+ * Creates a memo cache holding roughly capacity entries spread over
+ * shardCount shards (each shard holds at least one).
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+ConcurrentMemo<Key, Value, Hash>
+createConcurrentMemo(size_t capacity, size_t shardCount = DefaultMemoShards) {
+  ConcurrentMemo<Key, Value, Hash> memo;
+  memo.state = std::make_shared<detail::MemoShards<Key, Value, Hash>>(
+      shardCount, capacity);
+  return memo;
+}
+
+/**
+ * Looks a key up without computing; null on a miss.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Key, typename Value, typename Hash>
+std::shared_ptr<const Value> memoFind(const ConcurrentMemo<Key, Value, Hash> &memo,
+                                      const Key &key) {
+  return detail::lookupMemoShard(memo.state->shardFor(key), key);
+}
+
+/**
+ * Returns the cached value for key, computing and storing compute(key) on a
+ * miss. compute runs without any lock held and may be called from several
+ * threads at once.
+ * User Story: As worker-thread lookups, I need get-or-compute in one call so
+ * each caller does not reimplement the miss path.
+ */
+template <typename Key, typename Value, typename Hash, typename F>
+std::shared_ptr<const Value>
+memoGetOrCompute(const ConcurrentMemo<Key, Value, Hash> &memo, const Key &key,
+                 F compute) {
+  detail::MemoShard<Key, Value, Hash> &shard = memo.state->shardFor(key);
+  std::shared_ptr<const Value> found = detail::lookupMemoShard(shard, key);
+  return found ? found
+               : detail::storeMemoShard(*memo.state, shard, key,
+                                        std::shared_ptr<const Value>(
+                                            std::make_shared<Value>(
+                                                compute(key))));
+}
+
+/**
+ * Snapshot of the cache counters.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Key, typename Value, typename Hash>
+MemoCacheStats memoStats(const ConcurrentMemo<Key, Value, Hash> &memo) {
+  typedef detail::MemoShard<Key, Value, Hash> Shard;
+  MemoCacheStats stats = {0, 0, 0, 0,
+                          memo.state->shardCapacity *
+                              memo.state->shards.size()};
+  detail::forEachIndex(0, memo.state->shards.size(),
+                       [&memo, &stats](size_t index) {
+                         Shard &shard = memo.state->shards[index];
+                         std::lock_guard<std::mutex> lock(shard.mutex);
+                         stats.hits += shard.hits;
+                         stats.misses += shard.misses;
+                         stats.evictions += shard.evictions;
+                         stats.size += shard.entries.size();
+                       });
+  return stats;
+}
+
+/**
+ * Drops every cached entry; counters are kept.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Key, typename Value, typename Hash>
+void memoClear(const ConcurrentMemo<Key, Value, Hash> &memo) {
+  typedef detail::MemoShard<Key, Value, Hash> Shard;
+  detail::forEachIndex(0, memo.state->shards.size(), [&memo](size_t index) {
+    Shard &shard = memo.state->shards[index];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.entries.clear();
+    shard.newest = nullptr;
+    shard.oldest = nullptr;
+  });
+}
+
+template <typename Signature> struct SharedMemoizedLast;
+
+namespace detail {
+/**
+ * Holder for an immutable snapshot. The lock covers only the pointer copy
+ * or swap, the same guarantee std::atomic_load gives shared_ptr, without the
+ * free functions C++20 deprecates.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Snapshot> struct SnapshotCell {
+  std::mutex mutex;
+  std::shared_ptr<const Snapshot> current;
+};
+
+template <typename Snapshot>
+std::shared_ptr<const Snapshot> loadSnapshot(SnapshotCell<Snapshot> &cell) {
+  std::lock_guard<std::mutex> lock(cell.mutex);
+  return cell.current;
+}
+
+template <typename Snapshot>
+void publishSnapshot(SnapshotCell<Snapshot> &cell,
+                     std::shared_ptr<const Snapshot> next) {
+  std::unique_lock<std::mutex> lock(cell.mutex);
+  cell.current.swap(next);
+  lock.unlock();
+}
+
+template <typename Signature> struct SharedMemoizedLastFactory;
+
+template <typename Result, typename... Args>
+Result callSharedMemoizedLast(
+    const SharedMemoizedLast<Result(Args...)> &memoized, Args... args);
+} // namespace detail
+
+/**
+ * Last-input memoization that is safe to call from several threads. Each
+ * call compares against one consistent snapshot and, on a miss, computes
+ * outside any lock and publishes a new snapshot. Results are returned by
+ * value because another thread may replace the snapshot at any time.
+ * Copies share one snapshot.
+ * User Story: As selectors read from worker threads, I need memoization
+ * without torn state so concurrent readers share one cached result.
+ */
+template <typename Result, typename... Args>
+struct SharedMemoizedLast<Result(Args...)> {
+  typedef std::tuple<typename std::decay<Args>::type...> ArgsTuple;
+  typedef std::function<bool(const ArgsTuple &, const ArgsTuple &)> Comparator;
+
+  struct Snapshot {
+    ArgsTuple args;
+    Result result;
+  };
+
+  std::function<Result(Args...)> func;
+  Comparator equals;
+  std::shared_ptr<detail::SnapshotCell<Snapshot>> cell;
+
+  Result operator()(Args... args) const {
+    return detail::callSharedMemoizedLast(*this, std::forward<Args>(args)...);
+  }
+};
+
+namespace detail {
+template <typename Result, typename... Args>
+struct SharedMemoizedLastFactory<Result(Args...)> {
+  typedef SharedMemoizedLast<Result(Args...)> MemoizedType;
+
+  static MemoizedType
+  create(std::function<Result(Args...)> function,
+         typename MemoizedType::Comparator comparator =
+             MemoizedLastFactory<Result(Args...)>::defaultComparator()) {
+    MemoizedType memoized;
+    memoized.func = std::move(function);
+    memoized.equals = std::move(comparator);
+    memoized.cell = std::make_shared<
+        SnapshotCell<typename MemoizedType::Snapshot>>();
+    return memoized;
+  }
+};
+
+template <typename Result, typename... Args>
+Result recomputeSharedMemoizedLast(
+    const SharedMemoizedLast<Result(Args...)> &memoized,
+    typename SharedMemoizedLast<Result(Args...)>::ArgsTuple current) {
+  typedef typename SharedMemoizedLast<Result(Args...)>::Snapshot Snapshot;
+  Result computed = func::apply(memoized.func, current);
+  publishSnapshot(*memoized.cell,
+                  std::shared_ptr<const Snapshot>(std::make_shared<Snapshot>(
+                      Snapshot{std::move(current), computed})));
+  return computed;
+}
+
+template <typename Result, typename... Args>
+Result callSharedMemoizedLast(
+    const SharedMemoizedLast<Result(Args...)> &memoized, Args... args) {
+  typedef typename SharedMemoizedLast<Result(Args...)>::Snapshot Snapshot;
+  typename SharedMemoizedLast<Result(Args...)>::ArgsTuple current(
+      std::forward<Args>(args)...);
+  const std::shared_ptr<const Snapshot> seen = loadSnapshot(*memoized.cell);
+  return seen && memoized.equals(seen->args, current)
+             ? seen->result
+             : recomputeSharedMemoizedLast(memoized, std::move(current));
+}
+} // namespace detail
+
+/**
+ * Thread-safe memoizeLast over a std::function with default comparison.
+ * User Story: As derived-data helpers, I need a shared memoizer with the
+ * memoizeLast shape so worker-thread callers can switch without rewrites.
+ */
+template <typename Signature>
+SharedMemoizedLast<Signature>
+memoizeLastShared(std::function<Signature> function) {
+  return detail::SharedMemoizedLastFactory<Signature>::create(
+      std::move(function));
+}
+
+/**
+ * Thread-safe memoizeLast over a generic callable with default comparison.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Signature, typename F>
+SharedMemoizedLast<Signature> memoizeLastShared(F f) {
+  return detail::SharedMemoizedLastFactory<Signature>::create(
+      std::function<Signature>(f));
+}
+
+/**
+ * Thread-safe memoizeLast using a custom argument comparator.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Signature, typename F>
+SharedMemoizedLast<Signature>
+memoizeLastShared(F f,
+                  typename SharedMemoizedLast<Signature>::Comparator comparator) {
+  return detail::SharedMemoizedLastFactory<Signature>::create(
+      std::function<Signature>(f), std::move(comparator));
+}
+
 } // namespace func
 
 #endif // FUNCTIONAL_CORE_HPP
@@ -2,10 +2,15 @@
 #ifndef RTK_HPP
 #define RTK_HPP
 
+#include "ActionPayload.h"
 #include "CoreMinimal.h"
+#include "PersistentCollections.h"
 #include "functional_core.hpp"
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -42,12 +47,14 @@ inline Action<FEmptyPayload> makeAction(const FString &Type) {
 }
 
 /**
- * Type-erased envelope for heterogeneous root dispatch
+ * Type-erased envelope for heterogeneous root dispatch. Small trivially
+ * copyable payloads are stored inline; others share a pooled block (see
+ * ActionPayload.h).
  * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
  */
 struct AnyAction {
   FString Type;
-  std::shared_ptr<void> PayloadWrapper;
+  FActionPayload PayloadStorage;
 
   /**
    * Constructs an empty type-erased action envelope.
@@ -57,25 +64,43 @@ struct AnyAction {
   AnyAction() {}
 
   /**
-   * Constructs a type-erased action envelope from a type tag and payload wrapper.
+   * Constructs a type-erased action envelope from a type tag and payload.
    * User Story: As root dispatch infrastructure, I need a type-erased action
    * constructor so heterogeneous payloads can move through one dispatch channel.
    */
-  AnyAction(const FString &InType, std::shared_ptr<void> InPayloadWrapper)
+  AnyAction(const FString &InType, FActionPayload InPayload)
+      : Type(InType), PayloadStorage(std::move(InPayload)) {}
+
+  /**
+   * Constructs an envelope from a shared payload object, copying the value
+   * into payload storage. A null pointer leaves the payload empty.
+   * User Story: As callers written against the shared_ptr envelope, I need
+   * this constructor so they keep compiling after the storage change.
+   */
+  template <typename Payload>
+  AnyAction(const FString &InType, const std::shared_ptr<Payload> &InPayload)
       : Type(InType),
-        PayloadWrapper(std::move(InPayloadWrapper)) {}
+        PayloadStorage(InPayload ? FActionPayload::Make<Payload>(*InPayload)
+                                 : FActionPayload()) {}
 
   /**
    * Extracts a typed payload from the type-erased storage.
    * User Story: As root dispatch consumers, I need a direct payload accessor so
    * infrastructure code can recover stored action data when type ownership is known.
-   * Warning: This performs an unchecked static_cast. Callers must ensure the requested
-   * payload type matches the stored value. Prefer ActionCreator::extract() when possible.
+   * The stored type id is checked; a mismatched type yields nothing.
    */
   template <typename Payload> func::Maybe<Payload> getPayload() const {
-    return PayloadWrapper
-               ? func::just(*static_cast<Payload *>(PayloadWrapper.get()))
-               : func::nothing<Payload>();
+    const Payload *Value = PayloadStorage.TryGet<Payload>();
+    return Value ? func::just(*Value) : func::nothing<Payload>();
+  }
+
+  /**
+   * Returns a pointer to the stored payload when it has the given type.
+   * User Story: As reducers reading large payloads, I need to look at the
+   * value in place so a read does not copy it.
+   */
+  template <typename Payload> const Payload *peekPayload() const {
+    return PayloadStorage.TryGet<Payload>();
   }
 };
 
@@ -308,7 +333,7 @@ template <typename Payload> struct ActionCreator {
   FString Type;
 
   AnyAction operator()(const Payload &payload) const {
-    return AnyAction(Type, std::make_shared<Payload>(payload));
+    return AnyAction(Type, FActionPayload::Make<Payload>(payload));
   }
 
   /**
@@ -343,7 +368,8 @@ struct EmptyActionCreator {
   FString Type;
 
   AnyAction operator()() const {
-    return AnyAction(Type, std::make_shared<FEmptyPayload>());
+    return AnyAction(Type,
+                     FActionPayload::Make<FEmptyPayload>(FEmptyPayload{}));
   }
 
   /**
@@ -370,6 +396,12 @@ inline EmptyActionCreator createAction(const FString &Type) {
 template <typename State> struct Slice {
   FString Name;
   CaseReducer<State> Reducer;
+  /**
+   * Action types this slice has a case for; root stores route on these.
+   * User Story: As root store routing, I need each slice's handled types so
+   * actions skip slices that would only return their previous state.
+   */
+  TArray<FString> ActionTypes;
 };
 
 /**
@@ -413,12 +445,12 @@ createCase(SliceBuilder<State> &Builder, const FString &ShortName,
   Builder.Reducers.Add(
       FullType, [Creator, WrappedReducer](const State &PrevState,
                                           const AnyAction &AnyActionValue) {
-        auto PayloadOpt = Creator.extract(AnyActionValue);
-        return PayloadOpt.hasValue
-                   ? WrappedReducer(
-                         PrevState,
-                         makeAction(AnyActionValue.Type, PayloadOpt.value))
-                   : PrevState;
+        const Payload *Value = Creator.match(AnyActionValue)
+                                   ? AnyActionValue.peekPayload<Payload>()
+                                   : nullptr;
+        return Value ? WrappedReducer(PrevState,
+                                      makeAction(AnyActionValue.Type, *Value))
+                     : PrevState;
       });
 
   return Creator;
@@ -480,12 +512,12 @@ addExtraCase(SliceBuilder<State> Builder, const ActionCreator<Payload> &Creator,
       Creator.Type,
       [Creator, WrappedReducer](const State &PrevState,
                                 const AnyAction &AnyActionValue) -> State {
-        auto PayloadOpt = Creator.extract(AnyActionValue);
-        return PayloadOpt.hasValue
-                   ? WrappedReducer(
-                         PrevState,
-                         makeAction(AnyActionValue.Type, PayloadOpt.value))
-                   : PrevState;
+        const Payload *Value = Creator.match(AnyActionValue)
+                                   ? AnyActionValue.peekPayload<Payload>()
+                                   : nullptr;
+        return Value ? WrappedReducer(PrevState,
+                                      makeAction(AnyActionValue.Type, *Value))
+                     : PrevState;
       });
   return Builder;
 }
@@ -533,6 +565,7 @@ template <typename State> Slice<State> buildSlice(const SliceBuilder<State> &Bui
   Slice<State> Result;
   Result.Name = Builder.Name;
   auto ReducerMap = Builder.Reducers;
+  ReducerMap.GenerateKeyArray(Result.ActionTypes);
 
   Result.Reducer =
       [ReducerMap](const State &PrevState, const AnyAction &Action) -> State {
@@ -547,46 +580,165 @@ template <typename State> Slice<State> buildSlice(const SliceBuilder<State> &Bui
  * User Story: As a maintainer, I need this implementation note so I can understand which milestone behavior the surrounding code is preserving.
  */
 
+/**
+ * Secondary index buckets: index name -> key -> ids in insertion order.
+ * User Story: As entity-backed slices, I need per-key id lists kept beside
+ * the entities so lookups like "all runs for NPC X" skip a full scan.
+ */
+using EntityIndexBuckets = TMap<FString, TMap<FString, TArray<FString>>>;
+
 template <typename T> struct EntityState {
   TArray<FString> ids;
   TMap<FString, T> entities;
+  EntityIndexBuckets indexes;
+};
+
+/**
+ * Declares one secondary index: a name and the key it groups entities by.
+ * User Story: As slice authors, I need indexes declared on the adapter so
+ * every add, update and remove keeps them current without extra reducer code.
+ */
+template <typename T> struct EntityIndex {
+  FString name;
+  std::function<FString(const T &)> selectKey;
 };
 
-template <typename T> struct EntitySelectors {
-  std::function<TArray<T>(const EntityState<T> &)> selectAll;
-  std::function<func::Maybe<T>(const EntityState<T> &, const FString &)>
-      selectById;
-  std::function<TArray<FString>(const EntityState<T> &)> selectIds;
-  std::function<int32_t(const EntityState<T> &)> selectTotal;
+/**
+ * Selector helpers over an entity state. StateT is the backend's state type:
+ * EntityState for the map adapter, PersistentEntityState for the persistent
+ * one.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T, typename StateT = EntityState<T>> struct EntitySelectors {
+  std::function<TArray<T>(const StateT &)> selectAll;
+  std::function<func::Maybe<T>(const StateT &, const FString &)> selectById;
+  std::function<TArray<FString>(const StateT &)> selectIds;
+  std::function<int32_t(const StateT &)> selectTotal;
+  std::function<TArray<FString>(const StateT &, const FString &,
+                                const FString &)>
+      selectIdsByIndex;
+  std::function<TArray<T>(const StateT &, const FString &, const FString &)>
+      selectByIndex;
 };
 
 template <typename T> struct EntityAdapterOps;
 
 namespace detail {
+/**
+ * Returns the id bucket for one index key, or nullptr when empty.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline const TArray<FString> *findIndexBucket(const EntityIndexBuckets &Indexes,
+                                              const FString &IndexName,
+                                              const FString &Key) {
+  const TMap<FString, TArray<FString>> *Buckets = Indexes.Find(IndexName);
+  return Buckets ? Buckets->Find(Key) : nullptr;
+}
+
+/**
+ * Removes an id from one bucket, dropping the bucket once it is empty.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void eraseFromBucket(EntityIndexBuckets &Indexes,
+                            const FString &IndexName, const FString &Key,
+                            const FString &Id) {
+  TMap<FString, TArray<FString>> *Buckets = Indexes.Find(IndexName);
+  TArray<FString> *Bucket = Buckets ? Buckets->Find(Key) : nullptr;
+  Bucket && (Bucket->Remove(Id), Bucket->Num() == 0) &&
+      (Buckets->Remove(Key), true);
+}
+
+/**
+ * Moves an entity between buckets of every index whose key changed. A null
+ * Before means insertion, a null After means removal.
+ * User Story: As entity-backed slices, I need index upkeep in one place so
+ * all adapter mutations update buckets the same way.
+ */
+template <typename T>
+void reindexEntity(EntityState<T> &Next, const TArray<EntityIndex<T>> &Defs,
+                   const FString &Id, std::type_identity_t<const T *> Before,
+                   std::type_identity_t<const T *> After) {
+  struct Reindex {
+    static void apply(EntityState<T> &N, const TArray<EntityIndex<T>> &D,
+                      const FString &Id, const T *B, const T *A, int32 I) {
+      I >= D.Num()
+          ? void()
+          : ([&]() {
+               const FString OldKey = B ? D[I].selectKey(*B) : FString();
+               const FString NewKey = A ? D[I].selectKey(*A) : FString();
+               const bool bSame = B && A && OldKey == NewKey;
+               (B && !bSame) &&
+                   (eraseFromBucket(N.indexes, D[I].name, OldKey, Id), true);
+               (A && !bSame) && (N.indexes.FindOrAdd(D[I].name)
+                                     .FindOrAdd(NewKey)
+                                     .Add(Id),
+                                 true);
+             }(),
+             apply(N, D, Id, B, A, I + 1), void());
+    }
+  };
+  Reindex::apply(Next, Defs, Id, Before, After, 0);
+}
+
 template <typename T>
-void addEntityIfMissing(EntityState<T> &Next, const FString &Id,
+void addEntityIfMissing(EntityState<T> &Next,
+                        const TArray<EntityIndex<T>> &Defs, const FString &Id,
                         const T &Entity) {
   const bool bMissing = !Next.entities.Find(Id);
   bMissing && (Next.ids.Add(Id), true);
   bMissing && (Next.entities.Add(Id, Entity), true);
+  bMissing && (reindexEntity(Next, Defs, Id, nullptr, &Entity), true);
 }
 
 template <typename T>
-void setEntity(EntityState<T> &Next, const FString &Id, const T &Entity) {
-  (!Next.entities.Find(Id)) && (Next.ids.Add(Id), true);
+void setEntity(EntityState<T> &Next, const TArray<EntityIndex<T>> &Defs,
+               const FString &Id, const T &Entity) {
+  const T *Existing = Next.entities.Find(Id);
+  const func::Maybe<T> Before =
+      Existing ? func::just(*Existing) : func::nothing<T>();
+  (!Existing) && (Next.ids.Add(Id), true);
   Next.entities.Add(Id, Entity);
+  reindexEntity(Next, Defs, Id, Before.hasValue ? &Before.value : nullptr,
+                &Entity);
+}
+
+template <typename T>
+void removeEntityIfPresent(EntityState<T> &Next,
+                           const TArray<EntityIndex<T>> &Defs,
+                           const FString &Id) {
+  T Removed;
+  (Next.entities.RemoveAndCopyValue(Id, Removed)) &&
+      (Next.ids.Remove(Id), reindexEntity(Next, Defs, Id, &Removed, nullptr),
+       true);
 }
 
+/**
+ * Drops an entity from the map and its index buckets, recording its id in
+ * Removed; the caller filters ids once for the whole batch.
+ * User Story: As batch removal, I need ids filtered in one pass so clearing k
+ * records costs O(N) instead of O(k*N).
+ */
 template <typename T>
-void removeEntityIfPresent(EntityState<T> &Next, const FString &Id) {
-  (Next.entities.Remove(Id) > 0) && (Next.ids.Remove(Id), true);
+void detachEntityIfPresent(EntityState<T> &Next,
+                           const TArray<EntityIndex<T>> &Defs,
+                           const FString &Id, TSet<FString> &Removed) {
+  T Entity;
+  (Next.entities.RemoveAndCopyValue(Id, Entity)) &&
+      (Removed.Add(Id), reindexEntity(Next, Defs, Id, &Entity, nullptr),
+       true);
 }
 
 template <typename T, typename PatchFn>
-void updateEntityIfPresent(EntityState<T> &Next, const FString &Id,
-                           PatchFn Patch) {
+void updateEntityIfPresent(EntityState<T> &Next,
+                           const TArray<EntityIndex<T>> &Defs,
+                           const FString &Id, PatchFn Patch) {
   const T *Existing = Next.entities.Find(Id);
-  Existing && (Next.entities.Add(Id, Patch(*Existing)), true);
+  Existing && ([&]() {
+    const T Before = *Existing;
+    const T After = Patch(Before);
+    Next.entities.Add(Id, After);
+    reindexEntity(Next, Defs, Id, &Before, &After);
+  }(), true);
 }
 
 template <typename T>
@@ -618,8 +770,15 @@ EntityState<T> upsertManyEntitiesRecursive(const EntityAdapterOps<T> &Ops,
                                            int32 Index, EntityState<T> Next);
 
 template <typename T>
-EntityState<T> removeManyEntitiesRecursive(const TArray<FString> &RemoveIds,
-                                           int32 Index, EntityState<T> Next);
+EntityState<T> removeManyEntitiesRecursive(const EntityAdapterOps<T> &Ops,
+                                           const TArray<FString> &RemoveIds,
+                                           int32 Index, EntityState<T> Next,
+                                           TSet<FString> &Removed);
+
+template <typename T>
+TArray<T> selectEntitiesByIdsRecursive(const EntityState<T> &State,
+                                       const TArray<FString> &Ids, int32 Index,
+                                       TArray<T> Result);
 
 template <typename T>
 TArray<T> selectAllEntitiesRecursive(const EntityState<T> &State, int32 Index,
@@ -628,13 +787,16 @@ TArray<T> selectAllEntitiesRecursive(const EntityState<T> &State, int32 Index,
 
 template <typename T> struct EntityAdapterOps {
   std::function<FString(const T &)> selectId;
+  TArray<EntityIndex<T>> indexes;
 
   /**
    * Returns an empty entity-state container.
    * User Story: As entity-backed slices, I need a canonical empty entity state
    * so adapters can initialize predictable reducer storage.
    */
-  EntityState<T> getInitialState() const { return EntityState<T>{{}, {}}; }
+  EntityState<T> getInitialState() const {
+    return EntityState<T>{{}, {}, {}};
+  }
 
   /**
    * Adds a single entity when its id is not already present.
@@ -644,7 +806,7 @@ template <typename T> struct EntityAdapterOps {
   EntityState<T> addOne(const EntityState<T> &state, const T &entity) const {
     EntityState<T> next = state;
     FString id = selectId(entity);
-    detail::addEntityIfMissing(next, id, entity);
+    detail::addEntityIfMissing(next, indexes, id, entity);
     return next;
   }
 
@@ -666,7 +828,7 @@ template <typename T> struct EntityAdapterOps {
   EntityState<T> setOne(const EntityState<T> &state, const T &entity) const {
     EntityState<T> next = state;
     FString id = selectId(entity);
-    detail::setEntity(next, id, entity);
+    detail::setEntity(next, indexes, id, entity);
     return next;
   }
 
@@ -709,7 +871,7 @@ template <typename T> struct EntityAdapterOps {
   EntityState<T> removeOne(const EntityState<T> &state,
                            const FString &id) const {
     EntityState<T> next = state;
-    detail::removeEntityIfPresent(next, id);
+    detail::removeEntityIfPresent(next, indexes, id);
     return next;
   }
 
@@ -720,7 +882,15 @@ template <typename T> struct EntityAdapterOps {
    */
   EntityState<T> removeMany(const EntityState<T> &state,
                             const TArray<FString> &removeIds) const {
-    return detail::removeManyEntitiesRecursive(removeIds, 0, state);
+    TSet<FString> Removed;
+    EntityState<T> next =
+        detail::removeManyEntitiesRecursive(*this, removeIds, 0, state, Removed);
+    Removed.Num() > 0 &&
+        (next.ids.RemoveAll([&Removed](const FString &Id) {
+          return Removed.Contains(Id);
+        }),
+         true);
+    return next;
   }
 
   /**
@@ -740,7 +910,7 @@ template <typename T> struct EntityAdapterOps {
   EntityState<T> updateOne(const EntityState<T> &state, const FString &id,
                            std::function<T(const T &)> patch) const {
     EntityState<T> next = state;
-    detail::updateEntityIfPresent(next, id, patch);
+    detail::updateEntityIfPresent(next, indexes, id, patch);
     return next;
   }
 
@@ -767,8 +937,26 @@ template <typename T> struct EntityAdapterOps {
       return state.ids.Num();
     };
 
-    return EntitySelectors<T>{
-        SelectAll, SelectById, SelectIds, SelectTotal};
+    const auto SelectIdsByIndex =
+        [](const EntityState<T> &state, const FString &index,
+           const FString &key) -> TArray<FString> {
+      const TArray<FString> *Bucket =
+          detail::findIndexBucket(state.indexes, index, key);
+      return Bucket ? *Bucket : TArray<FString>();
+    };
+
+    const auto SelectByIndex = [](const EntityState<T> &state,
+                                  const FString &index,
+                                  const FString &key) -> TArray<T> {
+      const TArray<FString> *Bucket =
+          detail::findIndexBucket(state.indexes, index, key);
+      return Bucket ? detail::selectEntitiesByIdsRecursive(state, *Bucket, 0,
+                                                           TArray<T>())
+                    : TArray<T>();
+    };
+
+    return EntitySelectors<T>{SelectAll,   SelectById,       SelectIds,
+                              SelectTotal, SelectIdsByIndex, SelectByIndex};
   }
 };
 
@@ -779,7 +967,8 @@ EntityState<T> addManyEntitiesRecursive(const EntityAdapterOps<T> &Ops,
                                         int32 Index, EntityState<T> Next) {
   return Index >= NewEntities.Num()
              ? Next
-             : (addEntityIfMissing(Next, Ops.selectId(NewEntities[Index]),
+             : (addEntityIfMissing(Next, Ops.indexes,
+                                   Ops.selectId(NewEntities[Index]),
                                    NewEntities[Index]),
                 addManyEntitiesRecursive(Ops, NewEntities, Index + 1,
                                          std::move(Next)));
@@ -791,9 +980,8 @@ EntityState<T> setAllEntitiesRecursive(const EntityAdapterOps<T> &Ops,
                                        int32 Index, EntityState<T> Next) {
   return Index >= NewEntities.Num()
              ? Next
-             : (Next.ids.Add(Ops.selectId(NewEntities[Index])),
-                Next.entities.Add(Ops.selectId(NewEntities[Index]),
-                                  NewEntities[Index]),
+             : (setEntity(Next, Ops.indexes, Ops.selectId(NewEntities[Index]),
+                          NewEntities[Index]),
                 setAllEntitiesRecursive(Ops, NewEntities, Index + 1,
                                         std::move(Next)));
 }
@@ -810,13 +998,27 @@ EntityState<T> upsertManyEntitiesRecursive(const EntityAdapterOps<T> &Ops,
 }
 
 template <typename T>
-EntityState<T> removeManyEntitiesRecursive(const TArray<FString> &RemoveIds,
-                                           int32 Index, EntityState<T> Next) {
+EntityState<T> removeManyEntitiesRecursive(const EntityAdapterOps<T> &Ops,
+                                           const TArray<FString> &RemoveIds,
+                                           int32 Index, EntityState<T> Next,
+                                           TSet<FString> &Removed) {
   return Index >= RemoveIds.Num()
              ? Next
-             : (removeEntityIfPresent(Next, RemoveIds[Index]),
-                removeManyEntitiesRecursive(RemoveIds, Index + 1,
-                                            std::move(Next)));
+             : (detachEntityIfPresent(Next, Ops.indexes, RemoveIds[Index],
+                                      Removed),
+                removeManyEntitiesRecursive(Ops, RemoveIds, Index + 1,
+                                            std::move(Next), Removed));
+}
+
+template <typename T>
+TArray<T> selectEntitiesByIdsRecursive(const EntityState<T> &State,
+                                       const TArray<FString> &Ids, int32 Index,
+                                       TArray<T> Result) {
+  return Index >= Ids.Num()
+             ? Result
+             : (appendEntityIfPresent(Result, State, Ids[Index]),
+                selectEntitiesByIdsRecursive(State, Ids, Index + 1,
+                                             std::move(Result)));
 }
 
 template <typename T>
@@ -838,7 +1040,437 @@ TArray<T> selectAllEntitiesRecursive(const EntityState<T> &State, int32 Index,
 template <typename T>
 EntityAdapterOps<T>
 createEntityAdapter(std::function<FString(const T &)> selectId) {
-  return EntityAdapterOps<T>{std::move(selectId)};
+  return EntityAdapterOps<T>{std::move(selectId), {}};
+}
+
+/**
+ * Returns a copy of the adapter with one more secondary index. Declare
+ * indexes before the adapter's first write; state built by an adapter
+ * without the index has empty buckets for it.
+ * User Story: As slice authors, I need declarative index registration so
+ * per-owner lookups come from the adapter instead of hand-rolled scans.
+ */
+template <typename T>
+EntityAdapterOps<T>
+withIndex(EntityAdapterOps<T> Ops, const FString &Name,
+          std::type_identity_t<std::function<FString(const T &)>> selectKey) {
+  Ops.indexes.Add(EntityIndex<T>{Name, std::move(selectKey)});
+  return Ops;
+}
+
+/**
+ * Position of an entity in insertion order. Sequence numbers only grow, so
+ * an order list stays sorted by Seq and can be binary-searched by it.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct EntityOrderRef {
+  uint64 Seq;
+  FString Id;
+};
+
+using EntityOrder = persistent::PersistentVector<EntityOrderRef>;
+
+/**
+ * Persistent index buckets: index name -> key -> refs in insertion order.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+using PersistentIndexBuckets =
+    persistent::PersistentMap<FString,
+                              persistent::PersistentMap<FString, EntityOrder>>;
+
+template <typename T> struct PersistentEntitySlot {
+  uint64 Seq;
+  T Value;
+};
+
+/**
+ * Entity state on persistent collections. Reducer copies share structure, so
+ * adding, replacing or removing one entity copies O(log n) small nodes
+ * instead of the whole id list and entity map.
+ * User Story: As slices holding thousands of entities, I need per-action
+ * reducer cost independent of collection size.
+ */
+template <typename T> struct PersistentEntityState {
+  persistent::PersistentMap<FString, PersistentEntitySlot<T>> entities;
+  EntityOrder order;
+  PersistentIndexBuckets indexes;
+  uint64 nextSeq = 1;
+};
+
+namespace detail {
+/**
+ * Index of the ref with sequence Seq in a sorted order list, or of the slot
+ * it would occupy.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename OrderT>
+int32 findOrderSlot(const OrderT &Order, uint64 Seq) {
+  return Order.lowerBound(
+      [Seq](const EntityOrderRef &Ref) { return Ref.Seq < Seq; });
+}
+
+inline PersistentIndexBuckets insertIntoBucket(
+    const PersistentIndexBuckets &Indexes, const FString &IndexName,
+    const FString &Key, const EntityOrderRef &Ref) {
+  const persistent::PersistentMap<FString, EntityOrder> *Found =
+      Indexes.find(IndexName);
+  const persistent::PersistentMap<FString, EntityOrder> Buckets =
+      Found ? *Found : persistent::PersistentMap<FString, EntityOrder>();
+  const EntityOrder *Bucket = Buckets.find(Key);
+  const EntityOrder Base = Bucket ? *Bucket : EntityOrder();
+  return Indexes.set(
+      IndexName,
+      Buckets.set(Key, Base.insertAt(findOrderSlot(Base, Ref.Seq), Ref)));
+}
+
+/**
+ * Removes a ref from one bucket, dropping the bucket once it is empty.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline PersistentIndexBuckets eraseFromBucket(
+    const PersistentIndexBuckets &Indexes, const FString &IndexName,
+    const FString &Key, uint64 Seq) {
+  const persistent::PersistentMap<FString, EntityOrder> *Buckets =
+      Indexes.find(IndexName);
+  const EntityOrder *Bucket = Buckets ? Buckets->find(Key) : nullptr;
+  const int32 Slot = Bucket ? findOrderSlot(*Bucket, Seq) : INDEX_NONE;
+  return (Slot == INDEX_NONE || Slot >= Bucket->size() ||
+          (*Bucket)[Slot].Seq != Seq)
+             ? Indexes
+             : [&]() {
+                 const EntityOrder Next = Bucket->removeAt(Slot);
+                 return Indexes.set(IndexName, Next.isEmpty()
+                                                   ? Buckets->remove(Key)
+                                                   : Buckets->set(Key, Next));
+               }();
+}
+
+/**
+ * Batch edit of a persistent entity state. Entities and order are edited
+ * through transients; buckets are small and updated persistently.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T> struct PersistentEntityEdit {
+  typename persistent::PersistentMap<FString,
+                                     PersistentEntitySlot<T>>::Transient
+      Entities;
+  typename EntityOrder::Transient Order;
+  PersistentIndexBuckets Indexes;
+  uint64 NextSeq;
+
+  explicit PersistentEntityEdit(const PersistentEntityState<T> &From)
+      : Entities(From.entities.transient()), Order(From.order.transient()),
+        Indexes(From.indexes), NextSeq(From.nextSeq) {}
+
+  PersistentEntityState<T> finish() {
+    return PersistentEntityState<T>{Entities.persistent(), Order.persistent(),
+                                    Indexes, NextSeq};
+  }
+};
+
+/**
+ * Persistent counterpart of reindexEntity.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+void reindexEntity(PersistentEntityEdit<T> &Edit,
+                   const TArray<EntityIndex<T>> &Defs, const FString &Id,
+                   uint64 Seq, std::type_identity_t<const T *> Before,
+                   std::type_identity_t<const T *> After) {
+  struct Reindex {
+    static void apply(PersistentEntityEdit<T> &E,
+                      const TArray<EntityIndex<T>> &D, const FString &Id,
+                      uint64 Seq, const T *B, const T *A, int32 I) {
+      I >= D.Num()
+          ? void()
+          : ([&]() {
+               const FString OldKey = B ? D[I].selectKey(*B) : FString();
+               const FString NewKey = A ? D[I].selectKey(*A) : FString();
+               const bool bSame = B && A && OldKey == NewKey;
+               (B && !bSame) &&
+                   (E.Indexes = eraseFromBucket(E.Indexes, D[I].name, OldKey,
+                                                Seq),
+                    true);
+               (A && !bSame) &&
+                   (E.Indexes = insertIntoBucket(E.Indexes, D[I].name, NewKey,
+                                                 EntityOrderRef{Seq, Id}),
+                    true);
+             }(),
+             apply(E, D, Id, Seq, B, A, I + 1), void());
+    }
+  };
+  Reindex::apply(Edit, Defs, Id, Seq, Before, After, 0);
+}
+
+/**
+ * Inserts an entity at the end of the order, or replaces it in place when
+ * bReplace is set and the id exists.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+void putEntity(PersistentEntityEdit<T> &Edit,
+               const TArray<EntityIndex<T>> &Defs, const FString &Id,
+               const T &Entity, bool bReplace) {
+  const PersistentEntitySlot<T> *Existing = Edit.Entities.find(Id);
+  !Existing ? [&]() {
+    const uint64 Seq = Edit.NextSeq++;
+    Edit.Entities.set(Id, PersistentEntitySlot<T>{Seq, Entity});
+    Edit.Order.pushBack(EntityOrderRef{Seq, Id});
+    reindexEntity(Edit, Defs, Id, Seq, nullptr, &Entity);
+  }()
+  : bReplace ? [&]() {
+    const PersistentEntitySlot<T> Before = *Existing;
+    Edit.Entities.set(Id, PersistentEntitySlot<T>{Before.Seq, Entity});
+    reindexEntity(Edit, Defs, Id, Before.Seq, &Before.Value, &Entity);
+  }()
+             : void();
+}
+
+template <typename T>
+void eraseEntity(PersistentEntityEdit<T> &Edit,
+                 const TArray<EntityIndex<T>> &Defs, const FString &Id) {
+  const PersistentEntitySlot<T> *Existing = Edit.Entities.find(Id);
+  Existing ? [&]() {
+    const PersistentEntitySlot<T> Before = *Existing;
+    Edit.Entities.remove(Id);
+    Edit.Order.removeAt(findOrderSlot(Edit.Order, Before.Seq));
+    reindexEntity(Edit, Defs, Id, Before.Seq, &Before.Value, nullptr);
+  }()
+           : void();
+}
+
+template <typename T>
+void putEntitiesRecursive(PersistentEntityEdit<T> &Edit,
+                          const TArray<EntityIndex<T>> &Defs,
+                          const std::function<FString(const T &)> &SelectId,
+                          const TArray<T> &Items, int32 Index, bool bReplace) {
+  Index >= Items.Num()
+      ? void()
+      : (putEntity(Edit, Defs, SelectId(Items[Index]), Items[Index], bReplace),
+         putEntitiesRecursive(Edit, Defs, SelectId, Items, Index + 1,
+                              bReplace));
+}
+
+template <typename T>
+void eraseEntitiesRecursive(PersistentEntityEdit<T> &Edit,
+                            const TArray<EntityIndex<T>> &Defs,
+                            const TArray<FString> &Ids, int32 Index) {
+  Index >= Ids.Num()
+      ? void()
+      : (eraseEntity(Edit, Defs, Ids[Index]),
+         eraseEntitiesRecursive(Edit, Defs, Ids, Index + 1));
+}
+
+template <typename T, typename PatchFn>
+void patchEntity(PersistentEntityEdit<T> &Edit,
+                 const TArray<EntityIndex<T>> &Defs, const FString &Id,
+                 PatchFn Patch) {
+  const PersistentEntitySlot<T> *Existing = Edit.Entities.find(Id);
+  Existing ? [&]() {
+    const PersistentEntitySlot<T> Before = *Existing;
+    const T After = Patch(Before.Value);
+    Edit.Entities.set(Id, PersistentEntitySlot<T>{Before.Seq, After});
+    reindexEntity(Edit, Defs, Id, Before.Seq, &Before.Value, &After);
+  }()
+           : void();
+}
+
+/**
+ * Entities for a list of refs, skipping refs whose entity is gone.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+TArray<T> selectEntitiesByRefs(const PersistentEntityState<T> &State,
+                               const EntityOrder &Refs) {
+  TArray<T> Result;
+  Result.Reserve(Refs.size());
+  Refs.forEach([&](const EntityOrderRef &Ref) {
+    const PersistentEntitySlot<T> *Slot = State.entities.find(Ref.Id);
+    Slot && (Result.Add(Slot->Value), true);
+  });
+  return Result;
+}
+
+inline TArray<FString> idsOf(const EntityOrder &Refs) {
+  TArray<FString> Ids;
+  Ids.Reserve(Refs.size());
+  Refs.forEach([&Ids](const EntityOrderRef &Ref) { Ids.Add(Ref.Id); });
+  return Ids;
+}
+
+inline const EntityOrder *findIndexBucket(const PersistentIndexBuckets &Indexes,
+                                          const FString &IndexName,
+                                          const FString &Key) {
+  const persistent::PersistentMap<FString, EntityOrder> *Buckets =
+      Indexes.find(IndexName);
+  return Buckets ? Buckets->find(Key) : nullptr;
+}
+} // namespace detail
+
+/**
+ * Entity adapter on persistent collections. Same operations, ordering and
+ * index semantics as EntityAdapterOps, except that an entity whose index key
+ * changes keeps its insertion position in the new bucket. Batch operations
+ * edit one transient, so each node is copied at most once per call.
+ * User Story: As slices with large collections, I need to swap the adapter
+ * backend without touching reducers or selectors.
+ */
+template <typename T> struct PersistentEntityAdapterOps {
+  std::function<FString(const T &)> selectId;
+  TArray<EntityIndex<T>> indexes;
+
+  /**
+   * Returns an empty entity-state container.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  PersistentEntityState<T> getInitialState() const {
+    return PersistentEntityState<T>();
+  }
+
+  /**
+   * Adds a single entity when its id is not already present.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  PersistentEntityState<T> addOne(const PersistentEntityState<T> &state,
+                                  const T &entity) const {
+    detail::PersistentEntityEdit<T> Edit(state);
+    detail::putEntity(Edit, indexes, selectId(entity), entity, false);
+    return Edit.finish();
+  }
+
+  PersistentEntityState<T> addMany(const PersistentEntityState<T> &state,
+                                   const TArray<T> &newEntities) const {
+    return putMany(state, newEntities, false);
+  }
+
+  /**
+   * Inserts or replaces a single entity by id; a replaced entity keeps its
+   * position.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  PersistentEntityState<T> setOne(const PersistentEntityState<T> &state,
+                                  const T &entity) const {
+    detail::PersistentEntityEdit<T> Edit(state);
+    detail::putEntity(Edit, indexes, selectId(entity), entity, true);
+    return Edit.finish();
+  }
+
+  PersistentEntityState<T> setAll(const PersistentEntityState<T> &,
+                                  const TArray<T> &newEntities) const {
+    return putMany(getInitialState(), newEntities, true);
+  }
+
+  PersistentEntityState<T> upsertOne(const PersistentEntityState<T> &state,
+                                     const T &entity) const {
+    return setOne(state, entity);
+  }
+
+  PersistentEntityState<T> upsertMany(const PersistentEntityState<T> &state,
+                                      const TArray<T> &entitiesToUpsert) const {
+    return putMany(state, entitiesToUpsert, true);
+  }
+
+  PersistentEntityState<T> removeOne(const PersistentEntityState<T> &state,
+                                     const FString &id) const {
+    detail::PersistentEntityEdit<T> Edit(state);
+    detail::eraseEntity(Edit, indexes, id);
+    return Edit.finish();
+  }
+
+  PersistentEntityState<T> removeMany(const PersistentEntityState<T> &state,
+                                      const TArray<FString> &removeIds) const {
+    detail::PersistentEntityEdit<T> Edit(state);
+    detail::eraseEntitiesRecursive(Edit, indexes, removeIds, 0);
+    return Edit.finish();
+  }
+
+  PersistentEntityState<T> removeAll(const PersistentEntityState<T> &) const {
+    return getInitialState();
+  }
+
+  PersistentEntityState<T> updateOne(const PersistentEntityState<T> &state,
+                                     const FString &id,
+                                     std::function<T(const T &)> patch) const {
+    detail::PersistentEntityEdit<T> Edit(state);
+    detail::patchEntity(Edit, indexes, id, patch);
+    return Edit.finish();
+  }
+
+  /**
+   * Builds selector helpers for the persistent state shape.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  EntitySelectors<T, PersistentEntityState<T>> getSelectors() const {
+    using StateT = PersistentEntityState<T>;
+    const auto SelectAll = [](const StateT &state) -> TArray<T> {
+      return detail::selectEntitiesByRefs(state, state.order);
+    };
+
+    const auto SelectById = [](const StateT &state,
+                               const FString &id) -> func::Maybe<T> {
+      const PersistentEntitySlot<T> *Slot = state.entities.find(id);
+      return Slot ? func::just(Slot->Value) : func::nothing<T>();
+    };
+
+    const auto SelectIds = [](const StateT &state) -> TArray<FString> {
+      return detail::idsOf(state.order);
+    };
+
+    const auto SelectTotal = [](const StateT &state) -> int32_t {
+      return state.entities.size();
+    };
+
+    const auto SelectIdsByIndex = [](const StateT &state, const FString &index,
+                                     const FString &key) -> TArray<FString> {
+      const EntityOrder *Bucket =
+          detail::findIndexBucket(state.indexes, index, key);
+      return Bucket ? detail::idsOf(*Bucket) : TArray<FString>();
+    };
+
+    const auto SelectByIndex = [](const StateT &state, const FString &index,
+                                  const FString &key) -> TArray<T> {
+      const EntityOrder *Bucket =
+          detail::findIndexBucket(state.indexes, index, key);
+      return Bucket ? detail::selectEntitiesByRefs(state, *Bucket)
+                    : TArray<T>();
+    };
+
+    return EntitySelectors<T, StateT>{SelectAll,   SelectById,
+                                      SelectIds,   SelectTotal,
+                                      SelectIdsByIndex, SelectByIndex};
+  }
+
+private:
+  PersistentEntityState<T> putMany(const PersistentEntityState<T> &state,
+                                   const TArray<T> &items,
+                                   bool bReplace) const {
+    detail::PersistentEntityEdit<T> Edit(state);
+    detail::putEntitiesRecursive(Edit, indexes, selectId, items, 0, bReplace);
+    return Edit.finish();
+  }
+};
+
+/**
+ * Creates a persistent-backend entity adapter from an id selector.
+ * User Story: As slice authors, I need the persistent backend available from
+ * the same one-line factory as the map backend.
+ */
+template <typename T>
+PersistentEntityAdapterOps<T>
+createPersistentEntityAdapter(std::function<FString(const T &)> selectId) {
+  return PersistentEntityAdapterOps<T>{std::move(selectId), {}};
+}
+
+/**
+ * withIndex for the persistent backend.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+PersistentEntityAdapterOps<T>
+withIndex(PersistentEntityAdapterOps<T> Ops, const FString &Name,
+          std::type_identity_t<std::function<FString(const T &)>> selectKey) {
+  Ops.indexes.Add(EntityIndex<T>{Name, std::move(selectKey)});
+  return Ops;
 }
 
 /**
@@ -849,6 +1481,13 @@ createEntityAdapter(std::function<FString(const T &)> selectId) {
 template <typename State> struct ThunkApi {
   std::function<AnyAction(const AnyAction &)> dispatch;
   std::function<State()> getState;
+  /**
+   * Abort signal for this run. Payload creators forward it to HTTP requests
+   * and native work; it never fires unless the caller supplied one.
+   * User Story: As payload creators, I need the caller's signal so abandoned
+   * runs stop consuming network and inference.
+   */
+  func::AbortSignal signal;
 };
 
 template <typename Result, typename State>
@@ -862,10 +1501,34 @@ struct AsyncThunkConfig {
   ActionCreator<Result> fulfilled;
   ActionCreator<FString> rejected;
 
-  std::function<ThunkAction<Result, State>(const Arg &)> thunkActionCreator;
+  std::function<ThunkAction<Result, State>(const Arg &,
+                                           const func::AbortSignal &)>
+      thunkActionCreator;
 
   ThunkAction<Result, State> operator()(const Arg &arg) const {
-    return thunkActionCreator(arg);
+    return thunkActionCreator(arg, func::AbortSignal());
+  }
+
+  /**
+   * Builds a thunk that aborts when signal fires: the run settles at once,
+   * rejected is dispatched with an abort message and fulfilled never is.
+   * User Story: As NPC and UI owners, I need in-flight thunks cancellable so
+   * work stops when the requester goes away.
+   */
+  ThunkAction<Result, State> operator()(const Arg &arg,
+                                        const func::AbortSignal &signal) const {
+    return thunkActionCreator(arg, signal);
+  }
+
+  /**
+   * Returns whether action is this thunk's rejection caused by an abort.
+   * User Story: As reducers and listeners, I need aborted runs told apart from
+   * failures so cancellations are not surfaced as errors.
+   */
+  bool isAborted(const AnyAction &action) const {
+    const func::Maybe<FString> Error = rejected.extract(action);
+    return rejected.match(action) && Error.hasValue &&
+           func::isAbortError(TCHAR_TO_UTF8(*Error.value));
   }
 };
 
@@ -885,9 +1548,10 @@ AsyncThunkConfig<Result, Arg, State> createAsyncThunk(
   auto rejected = createAction<FString>(TypePrefix + TEXT("/rejected"));
 
   auto thunkActionCreator = [pending, fulfilled, rejected, PayloadCreator](
-                                const Arg &arg) -> ThunkAction<Result, State> {
-    return [pending, fulfilled, rejected, PayloadCreator,
-            arg](std::function<AnyAction(const AnyAction &)> dispatch,
+                                const Arg &arg, const func::AbortSignal &signal)
+      -> ThunkAction<Result, State> {
+    return [pending, fulfilled, rejected, PayloadCreator, arg,
+            signal](std::function<AnyAction(const AnyAction &)> dispatch,
                  std::function<State()> getState) -> func::AsyncResult<Result> {
       /**
        * 1. Dispatch pending synchronously
@@ -899,13 +1563,22 @@ AsyncThunkConfig<Result, Arg, State> createAsyncThunk(
        * 2. Build the ThunkApi surface
        * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
        */
-      ThunkApi<State> api{dispatch, getState};
+      ThunkApi<State> api{dispatch, getState, signal};
 
       /**
-       * 3. Execute payload creator
+       * 3. Execute payload creator, unless the run was aborted before it
+       *    started. The result settles as soon as the signal fires.
        * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
        */
-      auto result = PayloadCreator(arg, api);
+      auto result = func::abortable(
+          signal.aborted()
+              ? func::createAsyncResult<Result>(
+                    [signal](std::function<void(Result)>,
+                             std::function<void(std::string)> reject) {
+                      reject(func::abortMessage(signal.reason()));
+                    })
+              : PayloadCreator(arg, api),
+          signal);
 
       /**
        * 4. Chain lifecycle actions using FP core AsyncChain.
@@ -950,21 +1623,180 @@ template <typename State> struct MiddlewareApi {
  */
 using Dispatcher = std::function<AnyAction(const AnyAction &)>;
 
+/**
+ * RTK-style curried middleware: api -> next -> action.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
 template <typename State>
-using Middleware =
+using CurriedMiddleware =
     std::function<std::function<Dispatcher(Dispatcher)>(
         const MiddlewareApi<State> &)>;
 
+template <typename State> struct MiddlewarePipeline;
+
+/**
+ * Continuation handed to a flat middleware handler: runs the rest of the
+ * pipeline from a fixed stage index. Two words, no allocation, no type
+ * erasure.
+ * User Story: As dispatch under bursts of streaming actions, I need `next`
+ * to be an index into the compiled chain rather than another closure.
+ */
+template <typename State> struct NextDispatch {
+  const MiddlewarePipeline<State> *Pipeline;
+  size_t Index;
+
+  AnyAction operator()(const AnyAction &Action) const {
+    return Pipeline->run(Index, Action);
+  }
+};
+
+/**
+ * Flat middleware handler: receives the action, the store api and the
+ * continuation on every call instead of capturing them per layer.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename State>
+using MiddlewareHandler = std::function<AnyAction(
+    const AnyAction &, const MiddlewareApi<State> &,
+    const NextDispatch<State> &)>;
+
+/**
+ * One middleware entry. Holds either a curried middleware (composed once when
+ * the pipeline is built) or a flat handler, plus an optional action-type
+ * filter. A filtered entry is skipped without being called for any action
+ * whose type it does not list.
+ * User Story: As store configuration, I need both middleware forms in one
+ * list so existing curried middleware keeps working next to flat handlers.
+ */
+template <typename State> struct Middleware {
+  CurriedMiddleware<State> Curried;
+  MiddlewareHandler<State> Handler;
+  bool bFilterTypes = false;
+  TSet<FString> ActionTypes;
+
+  Middleware() = default;
+
+  /**
+   * Wraps a curried middleware, so lambdas of the form api -> next -> action
+   * convert implicitly as they did when Middleware was a std::function.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  template <typename Fn,
+            typename = std::enable_if_t<
+                !std::is_same_v<std::decay_t<Fn>, Middleware> &&
+                std::is_constructible_v<CurriedMiddleware<State>, Fn>>>
+  Middleware(Fn &&Curry) : Curried(std::forward<Fn>(Curry)) {}
+
+  /**
+   * Builds a flat middleware that sees every action.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  static Middleware flat(MiddlewareHandler<State> InHandler) {
+    Middleware Out;
+    Out.Handler = std::move(InHandler);
+    return Out;
+  }
+
+  /**
+   * Builds a flat middleware that only sees the listed action types.
+   * User Story: As listeners keyed by action type, I need other actions to
+   * pass straight through so a burst of unrelated dispatches costs nothing.
+   */
+  static Middleware filtered(const TArray<FString> &Types,
+                             MiddlewareHandler<State> InHandler) {
+    return flat(std::move(InHandler)).onlyFor(Types);
+  }
+
+  /**
+   * Returns a copy restricted to the listed action types.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  Middleware onlyFor(const TArray<FString> &Types) const {
+    Middleware Out = *this;
+    Out.bFilterTypes = true;
+    Out.ActionTypes = TSet<FString>(Types);
+    return Out;
+  }
+};
+
+/**
+ * Middleware chain compiled into a flat array. Dispatch walks the array by
+ * index; curried middleware is composed once at build time against an index
+ * continuation, so neither form allocates or copies captures per dispatch.
+ * User Story: As store dispatch, I need a constant, small per-action cost so
+ * protocol and streaming bursts are not dominated by middleware plumbing.
+ */
+template <typename State> struct MiddlewarePipeline {
+  struct Stage {
+    MiddlewareHandler<State> Handle;
+    bool bFilterTypes;
+    TSet<FString> ActionTypes;
+  };
+
+  std::vector<Stage> Stages;
+  Dispatcher Base;
+  MiddlewareApi<State> Api;
+
+  /**
+   * Runs the chain from stage Index, skipping stages filtered out for the
+   * action's type, and ends in the base dispatcher.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  AnyAction run(size_t Index, const AnyAction &Action) const {
+    const size_t At = firstAccepting(Index, Action.Type);
+    return At < Stages.size()
+               ? Stages[At].Handle(Action, Api,
+                                   NextDispatch<State>{this, At + 1})
+               : Base(Action);
+  }
+
+private:
+  size_t firstAccepting(size_t Index, const FString &Type) const {
+    return (Index < Stages.size() && Stages[Index].bFilterTypes &&
+            !Stages[Index].ActionTypes.Contains(Type))
+               ? firstAccepting(Index + 1, Type)
+               : Index;
+  }
+};
+
 namespace detail {
+/**
+ * Compiles one middleware entry into a pipeline stage. Curried middleware is
+ * applied to the api and to a `next` bound to the following stage index.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
 template <typename State>
-Dispatcher applyMiddlewareRecursive(
-    typename std::vector<Middleware<State>>::const_reverse_iterator It,
-    typename std::vector<Middleware<State>>::const_reverse_iterator End,
-    const MiddlewareApi<State> &Api, Dispatcher CurrentDispatch) {
-  return It == End
-             ? CurrentDispatch
-             : applyMiddlewareRecursive<State>(It + 1, End, Api,
-                                               (*It)(Api)(CurrentDispatch));
+typename MiddlewarePipeline<State>::Stage
+compileStage(const MiddlewarePipeline<State> &Pipeline,
+             const Middleware<State> &Entry, size_t Index) {
+  const MiddlewareHandler<State> Handle =
+      Entry.Handler ? Entry.Handler
+      : Entry.Curried
+          ? MiddlewareHandler<State>(
+                [Composed = Entry.Curried(Pipeline.Api)(
+                     Dispatcher(NextDispatch<State>{&Pipeline, Index + 1}))](
+                    const AnyAction &Action, const MiddlewareApi<State> &,
+                    const NextDispatch<State> &) -> AnyAction {
+                  return Composed(Action);
+                })
+          : MiddlewareHandler<State>(
+                [](const AnyAction &Action, const MiddlewareApi<State> &,
+                   const NextDispatch<State> &Next) -> AnyAction {
+                  return Next(Action);
+                });
+  return typename MiddlewarePipeline<State>::Stage{Handle, Entry.bFilterTypes,
+                                                   Entry.ActionTypes};
+}
+
+template <typename State>
+void compileStages(MiddlewarePipeline<State> &Pipeline,
+                   const std::vector<Middleware<State>> &Middlewares,
+                   size_t Index) {
+  Index < Middlewares.size()
+      ? (Pipeline.Stages.push_back(
+             compileStage<State>(Pipeline, Middlewares[Index], Index)),
+         compileStages<State>(Pipeline, Middlewares, Index + 1), void())
+      : void();
 }
 } // namespace detail
 
@@ -979,64 +1811,395 @@ applyMiddleware(Dispatcher baseDispatch,
                 std::function<State()> getState,
                 const std::vector<Middleware<State>> &middlewares) {
   /**
-   * Use shared_ptr so middleware closures can reference the final enhanced
-   * dispatch through indirection, matching RTK's actual behavior.
+   * api.dispatch re-enters the whole pipeline. It holds the pipeline weakly so
+   * the pipeline, its stages and the api they capture do not keep each other
+   * alive; once the store is gone, re-dispatch returns the action unchanged.
    * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
    */
-  auto enhancedDispatch = std::make_shared<Dispatcher>(baseDispatch);
-
-  auto api = MiddlewareApi<State>{
-      /**
-       * Trampoline: always calls through the fully composed chain
-       * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
-       */
-      [enhancedDispatch](const AnyAction &action) -> AnyAction {
-        return (*enhancedDispatch)(action);
+  auto pipeline = std::make_shared<MiddlewarePipeline<State>>();
+  std::weak_ptr<const MiddlewarePipeline<State>> weakPipeline = pipeline;
+  pipeline->Base = baseDispatch;
+  pipeline->Api = MiddlewareApi<State>{
+      [weakPipeline](const AnyAction &action) -> AnyAction {
+        const auto Live = weakPipeline.lock();
+        return Live ? Live->run(0, action) : action;
       },
       getState};
-  Dispatcher currentDispatch =
-      detail::applyMiddlewareRecursive<State>(middlewares.rbegin(),
-                                             middlewares.rend(), api,
-                                             baseDispatch);
+  pipeline->Stages.reserve(middlewares.size());
+  detail::compileStages<State>(*pipeline, middlewares, 0);
+
+  return middlewares.empty()
+             ? baseDispatch
+             : Dispatcher([pipeline](const AnyAction &action) -> AnyAction {
+                 return pipeline->run(0, action);
+               });
+}
+
+/**
+ * Where a listener effect runs.
+ * Sync: inline, right after the reducers, inside dispatch.
+ * Deferred: queued and run when the outermost dispatch (or effect batch) on
+ * the dispatching thread unwinds, so effect dispatches run one after another
+ * instead of nesting.
+ * Worker: handed to the effect executor, off the dispatching thread. The
+ * store is not thread-safe, so a worker effect never touches it directly:
+ * api.getState returns a snapshot taken on the dispatching thread when the run
+ * was handed off, and api.dispatch posts the action through the effect
+ * dispatch executor (the game thread in the runtime) and returns it
+ * unreduced. With no dispatch executor set, dispatch runs inline.
+ * User Story: As listener authors offloading slow effects, I need the store
+ * reached only from its own thread so worker effects cannot race reducers.
+ */
+enum class EffectMode : uint8 { Sync, Deferred, Worker };
+
+/**
+ * How a listener treats a new trigger while earlier runs are pending.
+ * Every: each trigger runs. TakeLatest: a new trigger cancels earlier runs.
+ * Debounce: runs once the trigger has been quiet for DebounceSeconds.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+enum class EffectPolicy : uint8 { Every, TakeLatest, Debounce };
+
+using EffectTask = std::function<void()>;
+using EffectExecutor = std::function<void(EffectTask)>;
+using EffectDelay = std::function<void(double Seconds, EffectTask)>;
+
+/**
+ * Per-listener execution options. Unset Executor / Delay / DispatchExecutor
+ * fall back to the process defaults (see setEffectExecutor, setEffectDelay
+ * and setEffectDispatchExecutor).
+ * User Story: As listener authors, I need to choose per listener whether an
+ * effect may block dispatch so slow side effects stay out of dispatch latency.
+ */
+struct ListenerOptions {
+  EffectMode Mode = EffectMode::Sync;
+  EffectPolicy Policy = EffectPolicy::Every;
+  double DebounceSeconds = 0.0;
+  EffectExecutor Executor;
+  EffectDelay Delay;
+  EffectExecutor DispatchExecutor;
+};
+
+/**
+ * Mutable run state shared by every run of one listener. Bumping the epoch
+ * cancels every run started before it.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct ListenerControl {
+  std::atomic<uint64> Epoch{0};
+};
+
+/**
+ * Handle for one scheduled effect run. A cancelled run that has not started
+ * is dropped; a running effect can poll isCancelled() to stop early.
+ * User Story: As take-latest and debounce listeners, I need superseded runs
+ * cancelled so only the newest trigger's work completes.
+ */
+class EffectHandle {
+public:
+  EffectHandle() = default;
 
   /**
-  * Point the shared dispatch at the fully composed chain
-  * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
-  */
-  *enhancedDispatch = currentDispatch;
+   * Starts a run of a listener. Superseding runs bump the listener epoch
+   * first, cancelling every earlier run.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  static EffectHandle start(const std::shared_ptr<ListenerControl> &Control,
+                            bool bSupersede) {
+    EffectHandle Out;
+    Out.Run = std::make_shared<FRun>();
+    Out.Run->Control = Control;
+    Out.Run->Epoch = bSupersede ? Control->Epoch.fetch_add(1) + 1
+                                : Control->Epoch.load();
+    return Out;
+  }
+
+  void cancel() const {
+    Run ? Run->bCancelled.store(true, std::memory_order_release) : void();
+  }
+
+  bool isCancelled() const {
+    return !Run || Run->bCancelled.load(std::memory_order_acquire) ||
+           Run->Control->Epoch.load(std::memory_order_acquire) != Run->Epoch;
+  }
+
+  bool isFinished() const {
+    return Run && Run->bFinished.load(std::memory_order_acquire);
+  }
+
+  void finish() const {
+    Run ? Run->bFinished.store(true, std::memory_order_release) : void();
+  }
+
+private:
+  struct FRun {
+    std::shared_ptr<ListenerControl> Control;
+    uint64 Epoch = 0;
+    std::atomic<bool> bCancelled{false};
+    std::atomic<bool> bFinished{false};
+  };
+  std::shared_ptr<FRun> Run;
+};
+
+namespace detail {
+/**
+ * Effects deferred on this thread, and how many dispatches or batches are
+ * open on it. The queue drains when the outermost one closes.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct DeferredEffects {
+  int32 Depth = 0;
+  bool bDraining = false;
+  TArray<EffectTask> Queue;
+};
+
+inline DeferredEffects &deferredEffects() {
+  thread_local DeferredEffects Instance;
+  return Instance;
+}
+
+/**
+ * Runs queued effects until none are left. Effects queued while draining
+ * (by dispatches made from effects) join the next pass.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void runEffectTasksRecursive(const TArray<EffectTask> &Tasks,
+                                    int32 Index) {
+  Index >= Tasks.Num()
+      ? void()
+      : (Tasks[Index](), runEffectTasksRecursive(Tasks, Index + 1));
+}
+
+inline void drainDeferredEffects(DeferredEffects &Deferred) {
+  TArray<EffectTask> Pass = MoveTemp(Deferred.Queue);
+  Deferred.Queue.Reset();
+  runEffectTasksRecursive(Pass, 0);
+  Deferred.Queue.Num() > 0 ? drainDeferredEffects(Deferred) : void();
+}
+
+inline EffectExecutor &defaultEffectExecutor() {
+  static EffectExecutor Executor;
+  return Executor;
+}
+
+inline EffectDelay &defaultEffectDelay() {
+  static EffectDelay Delay;
+  return Delay;
+}
+
+inline EffectExecutor &defaultEffectDispatchExecutor() {
+  static EffectExecutor Executor;
+  return Executor;
+}
+} // namespace detail
+
+/**
+ * Sets the executor worker-mode effects use when a listener has none. Without
+ * one, worker effects run inline. Call during startup.
+ * User Story: As runtime bootstrap, I need to plug the engine's thread pool
+ * in once so rtk stays free of engine task APIs.
+ */
+inline void setEffectExecutor(EffectExecutor Executor) {
+  detail::defaultEffectExecutor() = std::move(Executor);
+}
+
+/**
+ * Sets the timer debounced effects use when a listener has none. Without one,
+ * debounced effects run at once (take-latest). Call during startup.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void setEffectDelay(EffectDelay Delay) {
+  detail::defaultEffectDelay() = std::move(Delay);
+}
 
-  return currentDispatch;
+/**
+ * Sets where worker-mode effects' dispatches run when a listener has none.
+ * Without one, they dispatch inline on the worker. Call during startup.
+ * User Story: As runtime bootstrap, I need worker dispatches posted to the
+ * store's thread so reducers never run on two threads at once.
+ */
+inline void setEffectDispatchExecutor(EffectExecutor Executor) {
+  detail::defaultEffectDispatchExecutor() = std::move(Executor);
 }
 
+/**
+ * Opens an effect batch on the calling thread. Deferred effects queued while
+ * any batch or dispatch is open run when the outermost one closes.
+ * User Story: As batched dispatch (facade flush), I need a whole batch's
+ * deferred effects to run after the batch rather than between its actions.
+ */
+struct ScopedEffectBatch {
+  ScopedEffectBatch() { ++detail::deferredEffects().Depth; }
+
+  ~ScopedEffectBatch() {
+    detail::DeferredEffects &Deferred = detail::deferredEffects();
+    (--Deferred.Depth == 0 && !Deferred.bDraining)
+        ? (Deferred.bDraining = true, detail::drainDeferredEffects(Deferred),
+           Deferred.bDraining = false, void())
+        : void();
+  }
+
+  ScopedEffectBatch(const ScopedEffectBatch &) = delete;
+  ScopedEffectBatch &operator=(const ScopedEffectBatch &) = delete;
+};
+
+/**
+ * Queues a task for the end of the open effect batch, or runs it now when no
+ * batch is open on this thread.
+ * User Story: As middleware that re-dispatches, I need follow-up dispatches
+ * queued behind the current one so they do not nest inside it.
+ */
+inline void deferEffect(EffectTask Task) {
+  detail::DeferredEffects &Deferred = detail::deferredEffects();
+  (Deferred.Depth > 0 || Deferred.bDraining)
+      ? (Deferred.Queue.Add(std::move(Task)), void())
+      : Task();
+}
+
+/**
+ * Listener registry. The map is immutable and shared: addListener builds a
+ * new map, and the built middleware holds the same one instead of a copy.
+ * Each entry carries its options and the run state its handles share.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
 template <typename State> struct ListenerMiddleware {
   using EffectCallback = std::function<void(const AnyAction &action,
                                             const MiddlewareApi<State> &api)>;
+  using CancellableEffect =
+      std::function<void(const AnyAction &action,
+                         const MiddlewareApi<State> &api,
+                         const EffectHandle &handle)>;
+
+  struct Entry {
+    CancellableEffect Effect;
+    ListenerOptions Options;
+    std::shared_ptr<ListenerControl> Control;
+  };
+
+  using ListenerMap = TMap<FString, TArray<Entry>>;
 
-  TMap<FString, TArray<EffectCallback>> listeners;
+  std::shared_ptr<const ListenerMap> listeners =
+      std::make_shared<const ListenerMap>();
 };
 
 namespace detail {
+inline const EffectExecutor &effectExecutorFor(const ListenerOptions &Options) {
+  return Options.Executor ? Options.Executor : defaultEffectExecutor();
+}
+
+/**
+ * Hands a ready effect run to its execution mode.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void runEffectInMode(const ListenerOptions &Options, EffectTask Task) {
+  const EffectExecutor &Executor = effectExecutorFor(Options);
+  Options.Mode == EffectMode::Worker && Executor
+      ? Executor(std::move(Task))
+  : Options.Mode == EffectMode::Deferred ? deferEffect(std::move(Task))
+                                         : Task();
+}
+
+/**
+ * The api a worker effect sees: a state snapshot taken now, on the
+ * dispatching thread, and a dispatch posted through the dispatch executor.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename State>
+MiddlewareApi<State> workerEffectApi(const MiddlewareApi<State> &Api,
+                                     const ListenerOptions &Options) {
+  const std::shared_ptr<const State> Snapshot =
+      std::make_shared<const State>(Api.getState());
+  const EffectExecutor Post = Options.DispatchExecutor
+                                  ? Options.DispatchExecutor
+                                  : defaultEffectDispatchExecutor();
+  const Dispatcher Dispatch = Api.dispatch;
+  return MiddlewareApi<State>{
+      Post ? Dispatcher([Dispatch, Post](const AnyAction &Action) {
+        Post([Dispatch, Action]() { Dispatch(Action); });
+        return Action;
+      })
+           : Dispatch,
+      [Snapshot]() { return *Snapshot; }};
+}
+
+/**
+ * Builds one run of a listener. Worker runs get their api here, on the
+ * dispatching thread, just before the hand-off.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename State>
+EffectTask makeEffectRun(
+    const typename ListenerMiddleware<State>::Entry &Listener,
+    const AnyAction &Action, const MiddlewareApi<State> &Api,
+    const EffectHandle &Handle) {
+  const MiddlewareApi<State> RunApi =
+      Listener.Options.Mode == EffectMode::Worker &&
+              effectExecutorFor(Listener.Options)
+          ? workerEffectApi(Api, Listener.Options)
+          : Api;
+  return [Effect = Listener.Effect, Action, RunApi, Handle]() {
+    Handle.isCancelled() ? void()
+                         : (Effect(Action, RunApi, Handle), Handle.finish());
+  };
+}
+
+/**
+ * Schedules one listener run for an action: starts its handle, then runs it
+ * through its mode now or, when debounced, once the delay elapses.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
 template <typename State>
-void invokeListenerEffectsRecursive(
-    const TArray<typename ListenerMiddleware<State>::EffectCallback> &Effects,
+void scheduleListenerEffect(
+    const typename ListenerMiddleware<State>::Entry &Listener,
+    const AnyAction &Action, const MiddlewareApi<State> &Api) {
+  const ListenerOptions &Options = Listener.Options;
+  const EffectHandle Handle = EffectHandle::start(
+      Listener.Control, Options.Policy != EffectPolicy::Every);
+  const EffectDelay &Delay =
+      Options.Delay ? Options.Delay : defaultEffectDelay();
+  Options.Policy == EffectPolicy::Debounce && Delay
+      ? Delay(Options.DebounceSeconds,
+              [Listener, Action, Api, Handle]() {
+                Handle.isCancelled()
+                    ? void()
+                    : runEffectInMode(Listener.Options,
+                                      makeEffectRun<State>(Listener, Action,
+                                                           Api, Handle));
+              })
+      : runEffectInMode(Options,
+                        makeEffectRun<State>(Listener, Action, Api, Handle));
+}
+
+template <typename State>
+void scheduleListenerEffectsRecursive(
+    const TArray<typename ListenerMiddleware<State>::Entry> &Listeners,
     int32 Index, const AnyAction &Action, const MiddlewareApi<State> &Api) {
-  Index >= Effects.Num()
+  Index >= Listeners.Num()
       ? void()
-      : (Effects[Index](Action, Api),
-         invokeListenerEffectsRecursive<State>(Effects, Index + 1, Action,
-                                               Api));
+      : (scheduleListenerEffect<State>(Listeners[Index], Action, Api),
+         scheduleListenerEffectsRecursive<State>(Listeners, Index + 1, Action,
+                                                 Api));
 }
 
 template <typename State>
 void runListenerEffects(
-    const TMap<FString, TArray<typename ListenerMiddleware<State>::EffectCallback>>
-        &Listeners,
+    const typename ListenerMiddleware<State>::ListenerMap &Listeners,
     const AnyAction &Action, const MiddlewareApi<State> &Api) {
-  const TArray<typename ListenerMiddleware<State>::EffectCallback>
-      *ActiveListeners = Listeners.Find(Action.Type);
-  ActiveListeners
-      ? invokeListenerEffectsRecursive<State>(*ActiveListeners, 0, Action, Api)
-      : void();
+  const TArray<typename ListenerMiddleware<State>::Entry> *ActiveListeners =
+      Listeners.Find(Action.Type);
+  ActiveListeners ? scheduleListenerEffectsRecursive<State>(*ActiveListeners,
+                                                            0, Action, Api)
+                  : void();
+}
+
+template <typename State>
+void cancelListenerEffectsRecursive(
+    const TArray<typename ListenerMiddleware<State>::Entry> &Listeners,
+    int32 Index) {
+  Index >= Listeners.Num()
+      ? void()
+      : (Listeners[Index].Control->Epoch.fetch_add(1),
+         cancelListenerEffectsRecursive<State>(Listeners, Index + 1));
 }
 } // namespace detail
 
@@ -1045,30 +2208,85 @@ ListenerMiddleware<State> createListenerMiddleware() {
   return ListenerMiddleware<State>();
 }
 
+/**
+ * Registers an effect for an action type with explicit execution options.
+ * The effect receives its run's handle.
+ * User Story: As listener authors, I need mode and policy chosen at
+ * registration so dispatch never waits on effects that do not need it to.
+ */
 template <typename State>
 ListenerMiddleware<State>
 addListener(ListenerMiddleware<State> MiddlewareValue,
             const FString &ActionType,
-            typename ListenerMiddleware<State>::EffectCallback Effect) {
-  MiddlewareValue.listeners.FindOrAdd(ActionType).Add(Effect);
+            typename ListenerMiddleware<State>::CancellableEffect Effect,
+            ListenerOptions Options) {
+  auto Next = std::make_shared<typename ListenerMiddleware<State>::ListenerMap>(
+      *MiddlewareValue.listeners);
+  Next->FindOrAdd(ActionType)
+      .Add(typename ListenerMiddleware<State>::Entry{
+          std::move(Effect), std::move(Options),
+          std::make_shared<ListenerControl>()});
+  MiddlewareValue.listeners = std::move(Next);
   return MiddlewareValue;
 }
 
+/**
+ * Registers a synchronous effect for an action type.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename State>
+ListenerMiddleware<State>
+addListener(ListenerMiddleware<State> MiddlewareValue,
+            const FString &ActionType,
+            typename ListenerMiddleware<State>::EffectCallback Effect) {
+  return addListener<State>(
+      std::move(MiddlewareValue), ActionType,
+      [Effect = std::move(Effect)](const AnyAction &action,
+                                   const MiddlewareApi<State> &api,
+                                   const EffectHandle &) {
+        Effect(action, api);
+      },
+      ListenerOptions());
+}
+
+/**
+ * Cancels every pending or running effect registered for an action type.
+ * Later triggers run normally.
+ * User Story: As teardown flows, I need queued and debounced listener work
+ * dropped so effects for a removed NPC or closed session never fire late.
+ */
+template <typename State>
+void cancelListenerEffects(const ListenerMiddleware<State> &MiddlewareValue,
+                           const FString &ActionType) {
+  const TArray<typename ListenerMiddleware<State>::Entry> *Entries =
+      MiddlewareValue.listeners->Find(ActionType);
+  Entries ? detail::cancelListenerEffectsRecursive<State>(*Entries, 0)
+          : void();
+}
+
+/**
+ * Builds a flat middleware that schedules listener effects after the
+ * reducers. It is filtered on the registered action types, so every other
+ * action skips it entirely. Deferred effects run as the outermost dispatch
+ * unwinds.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
 template <typename State>
 Middleware<State>
 buildListenerMiddleware(const ListenerMiddleware<State> &MiddlewareValue) {
-  const TMap<FString, TArray<typename ListenerMiddleware<State>::EffectCallback>>
-      ListenersCopy = MiddlewareValue.listeners;
-  return [ListenersCopy](const MiddlewareApi<State> &api)
-             -> std::function<Dispatcher(Dispatcher)> {
-    return [ListenersCopy, api](Dispatcher next) -> Dispatcher {
-      return [ListenersCopy, api, next](const AnyAction &action) -> AnyAction {
+  const std::shared_ptr<const typename ListenerMiddleware<State>::ListenerMap>
+      Listeners = MiddlewareValue.listeners;
+  TArray<FString> Types;
+  Listeners->GetKeys(Types);
+  return Middleware<State>::filtered(
+      Types,
+      [Listeners](const AnyAction &action, const MiddlewareApi<State> &api,
+                  const NextDispatch<State> &next) -> AnyAction {
+        const ScopedEffectBatch Batch;
         const AnyAction ResultAction = next(action);
-        detail::runListenerEffects<State>(ListenersCopy, action, api);
+        detail::runListenerEffects<State>(*Listeners, action, api);
         return ResultAction;
-      };
-    };
-  };
+      });
 }
 
 /**
@@ -1117,6 +2335,244 @@ std::function<Result(const State &)> createSelector(
       };
 }
 
+/**
+ * Creates a memoized selector that may be called from several threads at
+ * once, e.g. from thunks on worker threads reading a state snapshot. The
+ * combiner's last inputs and result are kept as one atomic snapshot.
+ * User Story: As selector authors, I need a thread-safe createSelector so
+ * derived state can be shared with worker threads without recomputing it.
+ */
+template <typename State, typename Result, typename... InSelectors>
+std::function<Result(const State &)> createSharedSelector(
+    const std::tuple<InSelectors...> &inputSelectors,
+    std::function<
+        Result(decltype(std::declval<InSelectors>()(
+            std::declval<const State &>()))...)>
+        combiner) {
+  const auto memoizedCombiner = func::memoizeLastShared(combiner);
+
+  return [inputSelectors, memoizedCombiner](const State &state) -> Result {
+    return detail::evaluateSelector<Result>(
+        state, memoizedCombiner, inputSelectors,
+        func::gen_seq<sizeof...(InSelectors)>());
+  };
+}
+
+/**
+ * Cache counters for keyed and identity selectors.
+ * User Story: As UI and tooling authors, I need hit, miss and eviction counts
+ * so a selector's cache capacity can be sized from what a frame really does.
+ */
+struct SelectorCacheStats {
+  uint64 Hits = 0;
+  uint64 Misses = 0;
+  uint64 Evictions = 0;
+  int32 Size = 0;
+  int32 Capacity = 0;
+};
+
+/** Entries a keyed selector keeps unless the caller asks for another bound. */
+inline constexpr int32 DefaultKeyedSelectorCapacity = 64;
+
+namespace detail {
+/**
+ * Bounded least-recently-used cache. Entries live in a flat slot array with a
+ * key -> slot map; a full cache overwrites the slot ranked lowest by Rank.
+ * Not synchronized, like createSelector's cache: call from one thread.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Key, typename Tag, typename Result> struct SelectorSlots {
+  struct Slot {
+    Key SlotKey;
+    Tag SlotTag;
+    Result Value;
+    uint64 LastUsed;
+  };
+
+  TArray<Slot> Slots;
+  TMap<Key, int32> SlotOf;
+  int32 Capacity;
+  uint64 Clock = 0;
+  SelectorCacheStats Stats;
+
+  explicit SelectorSlots(int32 InCapacity)
+      : Capacity(InCapacity > 0 ? InCapacity : 1) {
+    Stats.Capacity = Capacity;
+  }
+
+  Slot *find(const Key &SlotKey) {
+    const int32 *Index = SlotOf.Find(SlotKey);
+    return Index ? &Slots[*Index] : nullptr;
+  }
+
+  const Result &hit(Slot &Found) {
+    ++Stats.Hits;
+    Found.LastUsed = ++Clock;
+    return Found.Value;
+  }
+
+  /**
+   * Stores a freshly computed value. Reuses the key's slot, appends while
+   * below capacity, and otherwise overwrites the lowest-ranked slot.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  template <typename RankFn>
+  const Result &store(const Key &SlotKey, Tag SlotTag, Result Value,
+                      RankFn Rank) {
+    ++Stats.Misses;
+    const int32 *Existing = SlotOf.Find(SlotKey);
+    const int32 Index =
+        Existing ? *Existing
+        : Slots.Num() < Capacity
+            ? Slots.Add(Slot{SlotKey, SlotTag, Result(), 0})
+            : evict(Rank);
+    SlotOf.Add(SlotKey, Index);
+    Slots[Index] =
+        Slot{SlotKey, std::move(SlotTag), std::move(Value), ++Clock};
+    Stats.Size = Slots.Num();
+    return Slots[Index].Value;
+  }
+
+  void clear() {
+    Slots.Reset();
+    SlotOf.Reset();
+    Stats.Size = 0;
+  }
+
+private:
+  template <typename RankFn> int32 evict(RankFn Rank) {
+    const Slot *Victim =
+        std::min_element(Slots.GetData(), Slots.GetData() + Slots.Num(),
+                         [&Rank](const Slot &A, const Slot &B) {
+                           return Rank(A) < Rank(B);
+                         });
+    const int32 Index = static_cast<int32>(Victim - Slots.GetData());
+    SlotOf.Remove(Slots[Index].SlotKey);
+    ++Stats.Evictions;
+    return Index;
+  }
+};
+
+/**
+ * Value type a keyed input selector yields for (state, key).
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Selector, typename State, typename Key>
+using KeyedInputOf = std::decay_t<decltype(std::declval<Selector>()(
+    std::declval<const State &>(), std::declval<const Key &>()))>;
+
+template <typename State, typename Key, typename InputTuple,
+          typename Selectors, size_t... Is>
+InputTuple evaluateKeyedInputs(const State &state, const Key &key,
+                               const Selectors &inputs, func::seq<Is...>) {
+  return InputTuple(std::get<Is>(inputs)(state, key)...);
+}
+} // namespace detail
+
+/**
+ * Memoized selector taking an extra key argument (an NPC id, a memory id).
+ * Each key remembers its own last inputs and result, bounded to Capacity
+ * keys with least-recently-used eviction, so calling it for many keys in one
+ * frame hits the cache for each of them. Copies share one cache.
+ * User Story: As UI that lists many NPCs, I need select-by-id selectors that
+ * stay memoized when called with a different id each row, every frame.
+ */
+template <typename State, typename Key, typename Result,
+          typename... InSelectors>
+struct KeyedSelector {
+  using InputTuple =
+      std::tuple<detail::KeyedInputOf<InSelectors, State, Key>...>;
+  using CombinerFn = std::function<Result(
+      const detail::KeyedInputOf<InSelectors, State, Key> &...)>;
+  using Cache = detail::SelectorSlots<Key, InputTuple, Result>;
+
+  std::tuple<InSelectors...> Inputs;
+  CombinerFn Combiner;
+  std::shared_ptr<Cache> Slots;
+
+  Result operator()(const State &state, const Key &key) const {
+    InputTuple Current = detail::evaluateKeyedInputs<State, Key, InputTuple>(
+        state, key, Inputs, func::gen_seq<sizeof...(InSelectors)>());
+    typename Cache::Slot *Found = Slots->find(key);
+    return (Found && Found->SlotTag == Current)
+               ? Slots->hit(*Found)
+               : Slots->store(key, Current,
+                              func::apply(Combiner, Current),
+                              [](const typename Cache::Slot &S) {
+                                return S.LastUsed;
+                              });
+  }
+
+  SelectorCacheStats stats() const { return Slots->Stats; }
+
+  void clear() const { Slots->clear(); }
+};
+
+/**
+ * Creates a keyed selector. Input selectors are called with (state, key);
+ * the combiner receives their results and only runs when they differ from
+ * the ones last seen for that key.
+ * User Story: As selector authors, I need parameterized selectors built the
+ * same way as createSelector so per-key caching is a drop-in change.
+ */
+template <typename State, typename Key, typename Result,
+          typename... InSelectors>
+KeyedSelector<State, Key, Result, InSelectors...> createKeyedSelector(
+    const std::tuple<InSelectors...> &inputSelectors,
+    typename KeyedSelector<State, Key, Result, InSelectors...>::CombinerFn
+        combiner,
+    int32 capacity = DefaultKeyedSelectorCapacity) {
+  using Selector = KeyedSelector<State, Key, Result, InSelectors...>;
+  return Selector{inputSelectors, std::move(combiner),
+                  std::make_shared<typename Selector::Cache>(capacity)};
+}
+
+/**
+ * Memoized selector keyed by input identity, the WeakMap variant. Results are
+ * cached per shared input object and held only as long as that object lives:
+ * an entry whose input was released is the first to be reused.
+ * User Story: As selectors over shared, structurally shared collections, I
+ * need caching by object identity so an unchanged collection hits without a
+ * deep comparison and a released one does not keep stale results alive.
+ */
+template <typename Input, typename Result> struct IdentitySelector {
+  using Cache =
+      detail::SelectorSlots<const Input *, std::weak_ptr<const Input>, Result>;
+
+  std::function<Result(const Input &)> Compute;
+  std::shared_ptr<Cache> Slots;
+
+  Result operator()(const std::shared_ptr<const Input> &input) const {
+    typename Cache::Slot *Found = input ? Slots->find(input.get()) : nullptr;
+    return !input ? Result()
+           : (Found && !Found->SlotTag.expired())
+               ? Slots->hit(*Found)
+               : Slots->store(input.get(), std::weak_ptr<const Input>(input),
+                              Compute(*input),
+                              [](const typename Cache::Slot &S) {
+                                return S.SlotTag.expired() ? 0 : S.LastUsed;
+                              });
+  }
+
+  SelectorCacheStats stats() const { return Slots->Stats; }
+
+  void clear() const { Slots->clear(); }
+};
+
+/**
+ * Creates an identity-keyed selector over shared inputs.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename Input, typename Result>
+IdentitySelector<Input, Result>
+createIdentitySelector(std::function<Result(const Input &)> compute,
+                       int32 capacity = DefaultKeyedSelectorCapacity) {
+  return IdentitySelector<Input, Result>{
+      std::move(compute),
+      std::make_shared<typename IdentitySelector<Input, Result>::Cache>(
+          capacity)};
+}
+
 /**
  * Phase 7: RTK Query Equivalent (API Slice)
  * User Story: As a maintainer, I need this implementation note so I can understand which milestone behavior the surrounding code is preserving.
@@ -1138,6 +2594,16 @@ template <typename Arg, typename Result> struct ApiEndpoint {
    */
   std::function<func::AsyncResult<func::HttpResult<Result>>(const Arg &)>
       RequestBuilder;
+
+  /**
+   * Request builder that also receives the run's abort signal. Preferred
+   * over RequestBuilder when set.
+   * User Story: As endpoint authors, I need the signal handed to the request
+   * so aborted runs cancel their HTTP call.
+   */
+  std::function<func::AsyncResult<func::HttpResult<Result>>(
+      const Arg &, const func::AbortSignal &)>
+      AbortableRequestBuilder;
 };
 
 /**
@@ -1184,7 +2650,10 @@ injectEndpoint(const ApiSlice<State> &Slice,
       [EndpointDesc](const Arg &arg, const ThunkApi<State> &api)
           -> func::AsyncResult<Result> {
         return func::AsyncChain::then<func::HttpResult<Result>, Result>(
-            EndpointDesc.RequestBuilder(arg), unwrapEndpointResult<Result>);
+            EndpointDesc.AbortableRequestBuilder
+                ? EndpointDesc.AbortableRequestBuilder(arg, api.signal)
+                : EndpointDesc.RequestBuilder(arg),
+            unwrapEndpointResult<Result>);
       });
 }
 
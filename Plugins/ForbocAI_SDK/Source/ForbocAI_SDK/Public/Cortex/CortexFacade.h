@@ -39,8 +39,12 @@ struct FCortexOps {
   std::function<TArray<float>(Native::Llama::Context, const FString &)> Embed;
 
   FCortexOps()
-      : LoadModel(Native::Llama::LoadModel),
-        LoadEmbeddingModel(Native::Llama::LoadEmbeddingModel),
+      : LoadModel([](const FString &Path) {
+          return Native::Llama::LoadModel(Path);
+        }),
+        LoadEmbeddingModel([](const FString &Path) {
+          return Native::Llama::LoadEmbeddingModel(Path);
+        }),
         FreeModel(Native::Llama::FreeModel),
         Infer([](Native::Llama::Context Ctx, const FString &Prompt,
                  const FCortexConfig &Config) {
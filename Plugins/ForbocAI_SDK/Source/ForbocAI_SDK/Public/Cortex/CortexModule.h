@@ -72,7 +72,8 @@ Complete(const FCortex &Cortex, const FString &Prompt,
          const TMap<FString, FString> &Context = TMap<FString, FString>());
 
 /**
- * Per-token callback type for streaming inference.
+ * Streamed text callback type; receives the tokens generated since the last
+ * game-thread drain, concatenated into one chunk.
  * User Story: As an SDK integrator, I need this type or module note so I can understand the role of the surrounding API surface quickly.
  */
 using FOnCortexToken = std::function<void(const FString &Token)>;
@@ -83,7 +84,8 @@ using FOnCortexToken = std::function<void(const FString &Token)>;
  * gameplay systems can react while generation is in progress.
  * @param Cortex The Cortex instance to use.
  * @param Prompt The input prompt text.
- * @param OnToken Called for each generated token on the game thread.
+ * @param OnToken Called on the game thread with each coalesced chunk of new
+ * tokens, at most once per frame.
  * @param Context Optional context data.
  * @return Future resolving to the full accumulated response.
  */
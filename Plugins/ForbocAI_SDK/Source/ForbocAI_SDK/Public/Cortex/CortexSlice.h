@@ -33,11 +33,18 @@ struct FCortexSliceState {
    * User Story: As a maintainer, I need this implementation note so I can understand which milestone behavior the surrounding code is preserving.
    */
   bool bIsStreaming;
+  /**
+   * Filled only by CortexStreamToken producers; the node stream thunk hands
+   * tokens to TokenStream and reports StreamTokenCount instead.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
   FString StreamAccumulated;
+  int32 StreamTokenCount;
 
   FCortexSliceState()
       : Status(ECortexEngineStatus::Idle), bIsDownloading(false),
-        DownloadProgress(0.0f), bEmbedderReady(false), bIsStreaming(false) {}
+        DownloadProgress(0.0f), bEmbedderReady(false), bIsStreaming(false),
+        StreamTokenCount(0) {}
 };
 
 namespace Actions {
@@ -237,6 +244,17 @@ inline const ActionCreator<FString> &CortexStreamTokenActionCreator() {
   return ActionCreator;
 }
 
+/**
+ * Returns the memoized action creator for stream progress events.
+ * User Story: As cortex reducers and tests, I need stable action creators so
+ * periodic token counts reach the store without per-token dispatches.
+ */
+inline const ActionCreator<int32> &CortexStreamProgressActionCreator() {
+  static const ActionCreator<int32> ActionCreator =
+      createAction<int32>(TEXT("cortex/streamProgress"));
+  return ActionCreator;
+}
+
 /**
  * Returns the memoized action creator for stream-complete events.
  * User Story: As cortex reducers and tests, I need stable action creators so
@@ -266,6 +284,15 @@ inline AnyAction CortexStreamToken(const FString &Token) {
   return CortexStreamTokenActionCreator()(Token);
 }
 
+/**
+ * Builds the action that reports how many tokens have streamed so far.
+ * User Story: As streaming orchestration, I need a typed progress helper so
+ * UI bound to the store can show activity while tokens bypass it.
+ */
+inline AnyAction CortexStreamProgress(int32 TokenCount) {
+  return CortexStreamProgressActionCreator()(TokenCount);
+}
+
 /**
  * Builds the action that finalizes a streamed completion.
  * User Story: As streaming orchestration, I need typed action helpers so the
@@ -375,6 +402,7 @@ inline Slice<FCortexSliceState> CreateCortexSlice() {
             FCortexSliceState Next = State;
             Next.bIsStreaming = true;
             Next.StreamAccumulated.Empty();
+            Next.StreamTokenCount = 0;
             Next.LastPrompt = Action.PayloadValue;
             Next.Error.Empty();
             return Next;
@@ -387,6 +415,14 @@ inline Slice<FCortexSliceState> CreateCortexSlice() {
             Next.StreamAccumulated += Action.PayloadValue;
             return Next;
           })
+      | addExtraCase(
+          Actions::CortexStreamProgressActionCreator(),
+          [](const FCortexSliceState &State,
+             const Action<int32> &Action) -> FCortexSliceState {
+            FCortexSliceState Next = State;
+            Next.StreamTokenCount = Action.PayloadValue;
+            return Next;
+          })
       | addExtraCase(
           Actions::CortexStreamCompleteActionCreator(),
           [](const FCortexSliceState &State,
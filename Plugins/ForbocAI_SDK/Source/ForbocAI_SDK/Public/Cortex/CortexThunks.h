@@ -7,6 +7,8 @@
 #include "Core/ThunkDetail.h"
 #include "Core/functional_core.hpp"
 #include "Cortex/CortexSlice.h"
+#include "Cortex/ModelVariants.h"
+#include "Cortex/TokenStream.h"
 #include "Errors.h"
 #include "RuntimeConfig.h"
 
@@ -18,7 +20,8 @@ namespace rtk {
  */
 inline ThunkAction<FCortexResponse, FStoreState>
 completeNodeCortexThunk(const FString &Prompt,
-                        const FCortexConfig &Config = FCortexConfig());
+                        const FCortexConfig &Config = FCortexConfig(),
+                        const func::AbortSignal &Signal = func::AbortSignal());
 
 inline ThunkAction<FCortexResponse, FStoreState>
 completeRemoteThunk(const FString &CortexId, const FString &Prompt,
@@ -41,56 +44,67 @@ initNodeCortexThunk(const FString &ModelPath) {
                               std::function<void(std::string)> Reject) {
 #if WITH_FORBOC_NATIVE
           /**
-           * Map known model ids to Hugging Face GGUF URLs, mirroring TS SDK.
+           * Plan the GGUF variant for known model ids (download URL, and a
+           * local requantize step when the chosen quant is not published).
+           * Host probing only runs for the "auto" policy.
            * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
            */
           const FString DefaultModelId = TEXT("smollm2-135m");
-          const FString SmolUrl =
-              TEXT("https://huggingface.co/bartowski/SmolLM2-135M-Instruct-"
-                   "GGUF/resolve/main/SmolLM2-135M-Instruct-Q4_K_M.gguf");
-          const FString Llama3Url =
-              TEXT("https://huggingface.co/lmstudio-community/Meta-Llama-3-8B-"
-                   "Instruct-GGUF/resolve/main/Meta-Llama-3-8B-Instruct-"
-                   "Q4_K_M.gguf");
-
           FString EffectiveModel = ModelPath.IsEmpty() ? DefaultModelId : ModelPath;
-          const FString Url = func::or_else(
-              func::multi_match<FString, FString>(
-                  EffectiveModel,
-                  {func::when<FString, FString>(
-                       [](const FString &M) {
-                         return M.Equals(TEXT("smollm2-135m"),
-                                         ESearchCase::IgnoreCase);
-                       },
-                       [&SmolUrl](const FString &) { return SmolUrl; }),
-                   func::when<FString, FString>(
-                       [](const FString &M) {
-                         return M.Equals(TEXT("llama3-8b"),
-                                         ESearchCase::IgnoreCase);
-                       },
-                       [&Llama3Url](const FString &) {
-                         return Llama3Url;
-                       })}),
-              FString());
+          const FString QuantPolicy = SDKConfig::GetModelQuant();
+          const FCortexHostCapabilities Caps =
+              QuantPolicy.Equals(ModelVariants::AutoPolicy,
+                                 ESearchCase::IgnoreCase)
+                  ? Native::Llama::DetectHostCapabilities()
+                  : FCortexHostCapabilities();
+          const ModelVariants::FVariantPlan Plan = ModelVariants::PlanForModel(
+              EffectiveModel,
+              detail::GetLocalInfrastructureDir() + TEXT("models/"),
+              QuantPolicy, Caps,
+              ModelVariants::ResolveBudgetBytes(
+                  SDKConfig::GetModelMemoryBudgetMb(), Caps));
+          const FString Url = Plan.DownloadUrl;
+          const FString LocalPath = Plan.LocalPath;
 
-          const FString ModelsDir =
-              detail::GetLocalInfrastructureDir() + TEXT("models/");
-          const FString FileName =
-              Url.IsEmpty() ? EffectiveModel : FPaths::GetCleanFilename(Url);
-          const FString LocalPath =
-              FPaths::ConvertRelativePathToFull(ModelsDir / FileName);
+          /**
+           * Threading is keyed by model id first, then by GGUF file name;
+           * resolved here so the worker never touches config storage.
+           * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+           */
+          const FCortexThreadingConfig Threading =
+              SDKConfig::HasThreadingConfig(EffectiveModel)
+                  ? SDKConfig::GetThreadingConfig(EffectiveModel)
+                  : SDKConfig::GetThreadingConfig(
+                        FPaths::GetBaseFilename(LocalPath));
 
-          auto LoadOnWorker = [LocalPath, EffectiveModel, Dispatch, Resolve,
-                               Reject]() {
+          auto LoadOnWorker = [Plan, LocalPath, EffectiveModel, Threading,
+                               Dispatch, Resolve, Reject]() {
             Async(EAsyncExecution::Thread,
-                  [LocalPath, EffectiveModel, Dispatch, Resolve, Reject]() {
-                    Native::Llama::Context &Handle = detail::NodeCortexHandle();
-                    Handle
-                        ? (Native::Llama::FreeModel(Handle),
-                           (void)(Handle = nullptr))
-                        : (void)0;
+                  [Plan, LocalPath, EffectiveModel, Threading, Dispatch,
+                   Resolve, Reject]() {
+                    /**
+                     * Build the requantized variant once; later inits reuse it.
+                     * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+                     */
+                    const func::Either<FString, FString> Variant =
+                        Plan.bRequantize
+                            ? ModelVariants::EnsureVariant(
+                                  Plan.DownloadPath, LocalPath, Plan.Quant,
+                                  &Native::Llama::Quantize)
+                            : func::make_right<FString, FString>(LocalPath);
 
-                    Handle = Native::Llama::LoadModel(LocalPath);
+                    /**
+                     * Retire the old model first so new calls stop using it;
+                     * it is freed once in-flight inferences release it.
+                     * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+                     */
+                    NativeHandles::Retire(detail::NodeCortexSlot());
+                    const Native::Llama::Context Handle =
+                        Variant.isLeft ? nullptr
+                                       : Native::Llama::LoadModel(LocalPath,
+                                                                  Threading);
+                    NativeHandles::Install(detail::NodeCortexSlot(), Handle,
+                                           &detail::ReleaseLlamaContext);
 
                     FCortexStatus Status;
                     Status.Id = TEXT("local-llama");
@@ -98,9 +112,10 @@ initNodeCortexThunk(const FString &ModelPath) {
                     Status.bReady = (Handle != nullptr);
                     Status.Engine = ECortexEngine::NodeLlamaCpp;
                     Status.DownloadProgress = Status.bReady ? 1.0f : 0.0f;
-                    Status.Error = Status.bReady
-                                       ? TEXT("")
-                                       : TEXT("Failed to load model");
+                    Status.Error = Status.bReady     ? FString(TEXT(""))
+                                   : Variant.isLeft ? Variant.left
+                                                    : FString(TEXT(
+                                                          "Failed to load model"));
 
                     AsyncTask(ENamedThreads::GameThread,
                               [Dispatch, Resolve, Reject, Status]() {
@@ -122,7 +137,8 @@ initNodeCortexThunk(const FString &ModelPath) {
            * Download first when URL is known and file is missing.
            * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
            */
-          (!Url.IsEmpty() && !FPaths::FileExists(LocalPath))
+          (!Url.IsEmpty() && !FPaths::FileExists(LocalPath) &&
+           !FPaths::FileExists(Plan.DownloadPath))
               ? (
                     /**
                      * G2: Dispatch download start
@@ -130,7 +146,7 @@ initNodeCortexThunk(const FString &ModelPath) {
                      */
                     Dispatch(
                         CortexSlice::Actions::SetDownloadState(true, 0.0f)),
-                    Native::File::DownloadBinary(Url, LocalPath)
+                    Native::File::DownloadBinary(Url, Plan.DownloadPath)
                         .then([LoadOnWorker,
                                Dispatch](const FString &) mutable {
                           /**
@@ -181,44 +197,63 @@ initNodeCortexThunk(const FString &ModelPath) {
   };
 }
 
+/**
+ * Runs local completion on a worker. When Signal fires, generation stops at
+ * the next token and the thunk rejects with an abort message instead of
+ * fulfilling.
+ * User Story: As local inference callers, I need abandoned completions to free
+ * the model as soon as possible so the next NPC's turn is not queued behind it.
+ */
 inline ThunkAction<FCortexResponse, FStoreState>
-completeNodeCortexThunk(const FString &Prompt, const FCortexConfig &Config) {
-  return [Prompt, Config](std::function<AnyAction(const AnyAction &)> Dispatch,
-                          std::function<FStoreState()> GetState)
+completeNodeCortexThunk(const FString &Prompt, const FCortexConfig &Config,
+                        const func::AbortSignal &Signal) {
+  return [Prompt, Config,
+          Signal](std::function<AnyAction(const AnyAction &)> Dispatch,
+                  std::function<FStoreState()> GetState)
              -> func::AsyncResult<FCortexResponse> {
     Dispatch(CortexSlice::Actions::CortexCompletePending(Prompt));
 
     return func::AsyncResult<FCortexResponse>::create(
-        [Prompt, Config, Dispatch](std::function<void(FCortexResponse)> Resolve,
-                                   std::function<void(std::string)> Reject) {
-          Async(EAsyncExecution::Thread, [Prompt, Config, Dispatch, Resolve,
-                                          Reject]() {
-            Native::Llama::Context Handle = detail::NodeCortexHandle();
-            !Handle
-                ? [&]() {
-                    const FString Error =
-                        TEXT("Local cortex is not initialized");
-                    AsyncTask(ENamedThreads::GameThread,
-                              [Dispatch, Reject, Error]() {
-                                Dispatch(CortexSlice::Actions::
-                                             CortexCompleteRejected(Error));
-                                Reject(TCHAR_TO_UTF8(*Error));
-                              });
-                  }()
+        [Prompt, Config, Signal,
+         Dispatch](std::function<void(FCortexResponse)> Resolve,
+                   std::function<void(std::string)> Reject) {
+          Async(EAsyncExecution::Thread, [Prompt, Config, Signal, Dispatch,
+                                          Resolve, Reject]() {
+            const NativeHandles::FNativeLease Cortex(
+                NativeHandles::Current(detail::NodeCortexSlot()),
+                NativeHandles::ELeaseMode::Exclusive);
+            const auto RejectOnGameThread = [Dispatch,
+                                             Reject](const FString &Error) {
+              AsyncTask(ENamedThreads::GameThread, [Dispatch, Reject, Error]() {
+                Dispatch(CortexSlice::Actions::CortexCompleteRejected(Error));
+                Reject(TCHAR_TO_UTF8(*Error));
+              });
+            };
+            !Cortex ? RejectOnGameThread(TEXT("Local cortex is not initialized"))
+            : Signal.aborted()
+                ? RejectOnGameThread(UTF8_TO_TCHAR(
+                      func::abortMessage(Signal.reason()).c_str()))
                 : [&]() {
                     FCortexResponse Response;
                     Response.Id = FGuid::NewGuid().ToString();
-                    Response.Text =
-                        Native::Llama::Infer(Handle, Prompt, Config);
+                    {
+                      const detail::FNativeAbortScope AbortScope(Cortex.Get(),
+                                                                 Signal);
+                      Response.Text =
+                          Native::Llama::Infer(Cortex.Get(), Prompt, Config);
+                    }
                     Response.Stats = TEXT("local-node");
 
-                    AsyncTask(ENamedThreads::GameThread,
-                              [Dispatch, Resolve, Response]() {
-                                Dispatch(CortexSlice::Actions::
-                                             CortexCompleteFulfilled(
-                                                 Response));
-                                Resolve(Response);
-                              });
+                    Signal.aborted()
+                        ? RejectOnGameThread(UTF8_TO_TCHAR(
+                              func::abortMessage(Signal.reason()).c_str()))
+                        : AsyncTask(ENamedThreads::GameThread,
+                                    [Dispatch, Resolve, Response]() {
+                                      Dispatch(CortexSlice::Actions::
+                                                   CortexCompleteFulfilled(
+                                                       Response));
+                                      Resolve(Response);
+                                    });
                   }();
           });
         });
@@ -238,8 +273,7 @@ generateNodeEmbeddingThunk(const FString &Text) {
         [Text](std::function<void(TArray<float>)> Resolve,
                std::function<void(std::string)> Reject) {
           Async(EAsyncExecution::Thread, [Text, Resolve]() {
-            TArray<float> Embedding =
-                Native::Llama::Embed(detail::NodeEmbeddingHandle(), Text);
+            TArray<float> Embedding = detail::EmbedText(Text);
             AsyncTask(ENamedThreads::GameThread,
                       [Resolve, Embedding]() { Resolve(Embedding); });
           });
@@ -249,7 +283,11 @@ generateNodeEmbeddingThunk(const FString &Text) {
 
 /**
  * G7: Streaming node cortex thunk (mirrors TS stream.ts)
- * Token-by-token callback, dispatches StreamToken per token on game thread
+ * Tokens travel through a TokenStream channel drained on the game thread;
+ * OnToken receives coalesced chunks and the store only sees start, periodic
+ * progress and completion.
+ * When Signal fires, generation stops at the next token and the thunk
+ * rejects with an abort message instead of fulfilling.
  * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
  */
 
@@ -257,21 +295,25 @@ using FOnTokenCallback = std::function<void(const FString &Token)>;
 
 inline ThunkAction<FCortexResponse, FStoreState>
 streamNodeCortexThunk(const FString &Prompt, const FCortexConfig &Config,
-                      const FOnTokenCallback &OnToken) {
-  return [Prompt, Config, OnToken](
+                      const FOnTokenCallback &OnToken,
+                      const func::AbortSignal &Signal = func::AbortSignal()) {
+  return [Prompt, Config, OnToken, Signal](
              std::function<AnyAction(const AnyAction &)> Dispatch,
              std::function<FStoreState()> GetState)
              -> func::AsyncResult<FCortexResponse> {
     Dispatch(CortexSlice::Actions::CortexStreamStart(Prompt));
 
     return func::AsyncResult<FCortexResponse>::create(
-        [Prompt, Config, OnToken, Dispatch](
+        [Prompt, Config, OnToken, Signal, Dispatch](
             std::function<void(FCortexResponse)> Resolve,
             std::function<void(std::string)> Reject) {
           Async(EAsyncExecution::Thread,
-                [Prompt, Config, OnToken, Dispatch, Resolve, Reject]() {
-                  Native::Llama::Context Handle = detail::NodeCortexHandle();
-                  !Handle
+                [Prompt, Config, OnToken, Signal, Dispatch, Resolve,
+                 Reject]() {
+                  const NativeHandles::FNativeLease Cortex(
+                      NativeHandles::Current(detail::NodeCortexSlot()),
+                      NativeHandles::ELeaseMode::Exclusive);
+                  !Cortex
                       ? [&]() {
                           const FString Error =
                               TEXT("Local cortex is not initialized");
@@ -284,39 +326,53 @@ streamNodeCortexThunk(const FString &Prompt, const FCortexConfig &Config,
                                     });
                         }()
                       : [&]() {
-                          FString FullText = Native::Llama::InferStream(
-                              Handle, Prompt, Config,
-                              [&Dispatch, &OnToken](const FString &Token) {
-                                /**
-                                 * Forward each token to game thread
-                                 * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
-                                 */
-                                AsyncTask(
-                                    ENamedThreads::GameThread,
-                                    [Dispatch, OnToken, Token]() {
-                                      Dispatch(CortexSlice::Actions::
-                                                   CortexStreamToken(Token));
-                                      OnToken
-                                          ? (OnToken(Token), void())
-                                          : void();
-                                    });
-                              });
+                          const TokenStream::FChannelRef Channel =
+                              TokenStream::Open(
+                                  OnToken,
+                                  [Dispatch](int32 TokenCount) {
+                                    Dispatch(CortexSlice::Actions::
+                                                 CortexStreamProgress(
+                                                     TokenCount));
+                                  },
+                                  [Signal, Dispatch, Resolve,
+                                   Reject](const FString &Text) {
+                                    const FString Aborted =
+                                        Signal.aborted()
+                                            ? FString(UTF8_TO_TCHAR(
+                                                  func::abortMessage(
+                                                      Signal.reason())
+                                                      .c_str()))
+                                            : FString();
+                                    !Aborted.IsEmpty()
+                                        ? (Dispatch(CortexSlice::Actions::
+                                                        CortexCompleteRejected(
+                                                            Aborted)),
+                                           Reject(TCHAR_TO_UTF8(*Aborted)))
+                                        : [&]() {
+                                    FCortexResponse Response;
+                                    Response.Id = FGuid::NewGuid().ToString();
+                                    Response.Text = Text;
+                                    Response.Stats = TEXT("local-node-stream");
+                                    Dispatch(CortexSlice::Actions::
+                                                 CortexStreamComplete(
+                                                     Response.Text));
+                                    Dispatch(CortexSlice::Actions::
+                                                 CortexCompleteFulfilled(
+                                                     Response));
+                                    Resolve(Response);
+                                          }();
+                                  });
 
-                          FCortexResponse Response;
-                          Response.Id = FGuid::NewGuid().ToString();
-                          Response.Text = FullText;
-                          Response.Stats = TEXT("local-node-stream");
-
-                          AsyncTask(ENamedThreads::GameThread,
-                                    [Dispatch, Resolve, Response]() {
-                                      Dispatch(CortexSlice::Actions::
-                                                   CortexStreamComplete(
-                                                       Response.Text));
-                                      Dispatch(CortexSlice::Actions::
-                                                   CortexCompleteFulfilled(
-                                                       Response));
-                                      Resolve(Response);
-                                    });
+                          const FString FullText = [&]() {
+                            const detail::FNativeAbortScope AbortScope(
+                                Cortex.Get(), Signal);
+                            return Native::Llama::InferStream(
+                                Cortex.Get(), Prompt, Config,
+                                [&Channel](const FString &Token) {
+                                  TokenStream::Push(Channel, Token);
+                                });
+                          }();
+                          TokenStream::Close(Channel, FullText);
                         }();
                 });
         });
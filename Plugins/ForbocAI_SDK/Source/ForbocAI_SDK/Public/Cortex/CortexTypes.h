@@ -129,6 +129,142 @@ struct FCortexStatus {
       : bReady(false), Engine(ECortexEngine::Mock), DownloadProgress(0.0f) {}
 };
 
+/**
+ * NUMA placement strategy for native CPU inference (mirrors ggml_numa_strategy).
+ * User Story: As a server operator, I need NUMA placement selectable so
+ * inference memory stays local to the cores that run it on multi-socket hosts.
+ */
+UENUM(BlueprintType)
+enum class ECortexNumaStrategy : uint8 {
+  Disabled,
+  Distribute,
+  Isolate,
+  Numactl,
+  Mirror
+};
+
+/**
+ * Cortex Threading — CPU parallelism for native inference contexts.
+ * Zero thread counts resolve to physical cores minus one so the game thread
+ * keeps a core. Contexts with identical settings share one ggml threadpool.
+ * User Story: As a server operator, I need thread counts, core affinity, and
+ * NUMA placement configurable so inference does not oversubscribe the host.
+ */
+USTRUCT(BlueprintType)
+struct FCortexThreadingConfig {
+  GENERATED_BODY()
+
+  /**
+   * Threads used for single-token generation; 0 means auto.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadWrite, Category = "Cortex")
+  int32 Threads;
+
+  /**
+   * Threads used for prompt and batch processing; 0 means same as Threads.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadWrite, Category = "Cortex")
+  int32 BatchThreads;
+
+  /**
+   * Logical core ids the pool may run on; empty leaves placement to the OS.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadWrite, Category = "Cortex")
+  TArray<int32> AffinityCores;
+
+  /**
+   * Pin each worker to one core from AffinityCores instead of the whole set.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadWrite, Category = "Cortex")
+  bool bStrictAffinity;
+
+  /**
+   * Worker spin level between graph runs (0 sleeps, 100 busy-polls).
+   * Defaults to 0 so idle inference threads do not steal frame time.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadWrite, Category = "Cortex")
+  int32 PollLevel;
+
+  /**
+   * NUMA strategy; applied once per process on the first native load.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadWrite, Category = "Cortex")
+  ECortexNumaStrategy Numa;
+
+  /**
+   * Reuse one threadpool across contexts that resolve to identical settings.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadWrite, Category = "Cortex")
+  bool bSharedPool;
+
+  FCortexThreadingConfig()
+      : Threads(0), BatchThreads(0), bStrictAffinity(false), PollLevel(0),
+        Numa(ECortexNumaStrategy::Disabled), bSharedPool(true) {}
+};
+
+/**
+ * Host facts used to pick a model quantization variant.
+ * User Story: As local model bootstrap, I need memory, core and SIMD facts in
+ * one value so variant selection is deterministic and testable off-device.
+ */
+USTRUCT(BlueprintType)
+struct FCortexHostCapabilities {
+  GENERATED_BODY()
+
+  /**
+   * Physical memory currently available to the process, in bytes.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadOnly, Category = "Cortex")
+  int64 AvailableMemoryBytes;
+
+  /**
+   * Physical core count.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadOnly, Category = "Cortex")
+  int32 PhysicalCores;
+
+  /**
+   * AVX2 kernels available (x86 K-quant fast path).
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadOnly, Category = "Cortex")
+  bool bAvx2;
+
+  /**
+   * AVX-512 kernels available.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadOnly, Category = "Cortex")
+  bool bAvx512;
+
+  /**
+   * F16C conversions available (fast F16 weights on x86).
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadOnly, Category = "Cortex")
+  bool bF16C;
+
+  /**
+   * NEON kernels available (ARM fast path for K-quants and F16).
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadOnly, Category = "Cortex")
+  bool bNeon;
+
+  FCortexHostCapabilities()
+      : AvailableMemoryBytes(0), PhysicalCores(0), bAvx2(false),
+        bAvx512(false), bF16C(false), bNeon(false) {}
+};
+
 /**
  * Cortex Configuration — Immutable data.
  * User Story: As an SDK integrator, I need this type or module note so I can understand the role of the surrounding API surface quickly.
@@ -176,6 +312,14 @@ struct FCortexConfig {
   UPROPERTY(BlueprintReadOnly, Category = "Cortex")
   FString GbnfGrammar;
 
+  /**
+   * CPU threading for the local llama.cpp path. Non-zero Threads re-apply to
+   * the loaded context before inference; defaults keep the load-time setup.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintReadOnly, Category = "Cortex")
+  FCortexThreadingConfig Threading;
+
   FCortexConfig()
       : Model(TEXT("smollm2-135m")), UseGPU(false), MaxTokens(512),
         Temperature(0.7f), TopK(40), TopP(0.9f) {}
@@ -0,0 +1,371 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/functional_core.hpp"
+#include "Cortex/CortexTypes.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include <functional>
+
+/**
+ * Model Variants — quantization catalog, host-aware selection and cached
+ * GGUF requantization for local cortex models.
+ * User Story: As local model bootstrap, I need one place that maps a model id
+ * and host to a concrete GGUF variant so memory and speed match each SKU.
+ */
+namespace ModelVariants {
+
+/**
+ * Quant policy value that selects a variant from host capabilities.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline constexpr const TCHAR *AutoPolicy = TEXT("auto");
+
+/**
+ * Runtime overhead applied to raw weight size (KV cache, scratch buffers).
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline constexpr double RuntimeOverhead = 1.15;
+
+/**
+ * One llama.cpp quantization type.
+ * User Story: As variant selection, I need each quant's ftype and density so
+ * sizes can be estimated and requantization requested by name.
+ */
+struct FQuantSpec {
+  /** Canonical name, e.g. Q4_K_M. */
+  FString Name;
+  /** Tag used in published GGUF file names (bartowski uses lower-case f16). */
+  FString FileTag;
+  /** llama_ftype value passed to llama_model_quantize. */
+  int32 FType;
+  /** Average bits per weight including block scales. */
+  double BitsPerWeight;
+  /** K-quants are only fast with AVX2 or NEON kernels. */
+  bool bKQuant;
+};
+
+/**
+ * Quant catalog ordered from smallest to highest quality.
+ * User Story: As variant selection, I need a quality ordering so the best
+ * variant that fits the budget can be found by a single scan.
+ */
+inline const TArray<FQuantSpec> &QuantCatalog() {
+  static const TArray<FQuantSpec> Catalog = {
+      {TEXT("Q2_K"), TEXT("Q2_K"), 10, 2.96, true},
+      {TEXT("Q3_K_M"), TEXT("Q3_K_M"), 12, 3.91, true},
+      {TEXT("Q4_0"), TEXT("Q4_0"), 2, 4.55, false},
+      {TEXT("Q4_K_M"), TEXT("Q4_K_M"), 15, 4.89, true},
+      {TEXT("Q5_K_M"), TEXT("Q5_K_M"), 17, 5.70, true},
+      {TEXT("Q6_K"), TEXT("Q6_K"), 18, 6.56, true},
+      {TEXT("Q8_0"), TEXT("Q8_0"), 7, 8.50, false},
+      {TEXT("F16"), TEXT("f16"), 1, 16.0, false},
+  };
+  return Catalog;
+}
+
+/**
+ * A downloadable model family and the variants its publisher ships.
+ * User Story: As variant planning, I need to know which quants are published
+ * so only missing ones are built locally from the family source file.
+ */
+struct FModelFamily {
+  FString Id;
+  FString Repo;
+  FString FilePrefix;
+  int64 ParamCount;
+  FString DefaultQuant;
+  FString SourceQuant;
+  TArray<FString> PublishedQuants;
+};
+
+/**
+ * Known model families, mirroring the ids accepted by cortex init.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline const TArray<FModelFamily> &FamilyCatalog() {
+  static const TArray<FModelFamily> Catalog = {
+      {TEXT("smollm2-135m"), TEXT("bartowski/SmolLM2-135M-Instruct-GGUF"),
+       TEXT("SmolLM2-135M-Instruct"), 134515008LL, TEXT("Q4_K_M"),
+       TEXT("F16"),
+       {TEXT("Q4_0"), TEXT("Q4_K_M"), TEXT("Q5_K_M"), TEXT("Q6_K"),
+        TEXT("Q8_0"), TEXT("F16")}},
+      {TEXT("llama3-8b"),
+       TEXT("lmstudio-community/Meta-Llama-3-8B-Instruct-GGUF"),
+       TEXT("Meta-Llama-3-8B-Instruct"), 8030261248LL, TEXT("Q4_K_M"),
+       TEXT("Q8_0"),
+       {TEXT("Q4_K_M"), TEXT("Q5_K_M"), TEXT("Q6_K"), TEXT("Q8_0")}},
+  };
+  return Catalog;
+}
+
+/**
+ * Recursive helper: finds the first quant whose name matches.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline func::Maybe<FQuantSpec> FindQuantRecursive(const TArray<FQuantSpec> &Specs,
+                                                  const FString &Name,
+                                                  int32 Index) {
+  return Index >= Specs.Num() ? func::nothing<FQuantSpec>()
+         : Specs[Index].Name.Equals(Name, ESearchCase::IgnoreCase)
+             ? func::just(Specs[Index])
+             : FindQuantRecursive(Specs, Name, Index + 1);
+}
+
+/**
+ * Looks up a quant by name (case-insensitive).
+ * User Story: As config and CLI input handling, I need quant names resolved
+ * case-insensitively so q4_k_m and Q4_K_M mean the same variant.
+ */
+inline func::Maybe<FQuantSpec> FindQuant(const FString &Name) {
+  return FindQuantRecursive(QuantCatalog(), Name, 0);
+}
+
+/**
+ * Recursive helper: finds the family with the given id.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline func::Maybe<FModelFamily>
+FindFamilyRecursive(const TArray<FModelFamily> &Families, const FString &Id,
+                    int32 Index) {
+  return Index >= Families.Num() ? func::nothing<FModelFamily>()
+         : Families[Index].Id.Equals(Id, ESearchCase::IgnoreCase)
+             ? func::just(Families[Index])
+             : FindFamilyRecursive(Families, Id, Index + 1);
+}
+
+/**
+ * Looks up a model family by id (case-insensitive).
+ * User Story: As cortex init, I need known ids resolved to a family so
+ * download and requantize plans can be built.
+ */
+inline func::Maybe<FModelFamily> FindFamily(const FString &ModelId) {
+  return FindFamilyRecursive(FamilyCatalog(), ModelId, 0);
+}
+
+/**
+ * Estimated resident bytes for a family at a quant, including overhead.
+ * User Story: As variant selection, I need a size estimate so the chosen
+ * variant leaves room for the game within the memory budget.
+ */
+inline int64 EstimateBytes(const FModelFamily &Family, const FQuantSpec &Quant) {
+  return static_cast<int64>(static_cast<double>(Family.ParamCount) *
+                            Quant.BitsPerWeight / 8.0 * RuntimeOverhead);
+}
+
+/**
+ * Whether a quant has fast kernels on the host. K-quants want AVX2 or NEON;
+ * F16 wants F16C or NEON; Q4_0 and Q8_0 run everywhere.
+ * User Story: As variant selection, I need slow paths excluded so a smaller
+ * file does not end up decoding slower than a larger one.
+ */
+inline bool QuantSupported(const FQuantSpec &Quant,
+                           const FCortexHostCapabilities &Caps) {
+  return Quant.FType == 1 ? (Caps.bF16C || Caps.bNeon)
+         : Quant.bKQuant  ? (Caps.bAvx2 || Caps.bNeon)
+                          : true;
+}
+
+/**
+ * Memory budget in bytes: the configured MiB, else half of available memory.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline int64 ResolveBudgetBytes(int32 ConfiguredMb,
+                                const FCortexHostCapabilities &Caps) {
+  return ConfiguredMb > 0 ? static_cast<int64>(ConfiguredMb) * 1024 * 1024
+                          : Caps.AvailableMemoryBytes / 2;
+}
+
+/**
+ * Recursive helper: scans the catalog from highest quality down and returns
+ * the first supported quant that fits the budget.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline func::Maybe<FQuantSpec>
+BestFitRecursive(const TArray<FQuantSpec> &Specs, const FModelFamily &Family,
+                 const FCortexHostCapabilities &Caps, int64 BudgetBytes,
+                 int32 Index) {
+  return Index < 0 ? func::nothing<FQuantSpec>()
+         : (QuantSupported(Specs[Index], Caps) &&
+            EstimateBytes(Family, Specs[Index]) <= BudgetBytes)
+             ? func::just(Specs[Index])
+             : BestFitRecursive(Specs, Family, Caps, BudgetBytes, Index - 1);
+}
+
+/**
+ * Recursive helper: catalog index of the quant with the given name, or -1.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline int32 QuantRankRecursive(const TArray<FQuantSpec> &Specs,
+                                const FString &Name, int32 Index) {
+  return Index >= Specs.Num() ? -1
+         : Specs[Index].Name.Equals(Name, ESearchCase::IgnoreCase)
+             ? Index
+             : QuantRankRecursive(Specs, Name, Index + 1);
+}
+
+/**
+ * Highest catalog index selection may consider for a family: its source
+ * quant, since requantizing upward only inflates the file without adding
+ * quality. Unknown sources leave the whole catalog open.
+ * User Story: As auto variant selection, I need candidates capped at the
+ * source so a Q8_0-sourced family never plans a bloated F16 rebuild.
+ */
+inline int32 MaxQuantRank(const FModelFamily &Family) {
+  const int32 Rank = QuantRankRecursive(QuantCatalog(), Family.SourceQuant, 0);
+  return Rank >= 0 ? Rank : QuantCatalog().Num() - 1;
+}
+
+/**
+ * Picks the highest-quality quant the host supports within the budget, no
+ * better than the family source, falling back to the family default when
+ * nothing fits.
+ * User Story: As auto variant selection, I need a deterministic choice from
+ * host facts so identical hardware always loads the same variant.
+ */
+inline FString SelectQuant(const FModelFamily &Family,
+                           const FCortexHostCapabilities &Caps,
+                           int64 BudgetBytes) {
+  const func::Maybe<FQuantSpec> Best = BestFitRecursive(
+      QuantCatalog(), Family, Caps, BudgetBytes, MaxQuantRank(Family));
+  return Best.hasValue ? Best.value.Name : Family.DefaultQuant;
+}
+
+/**
+ * Resolves a quant policy: empty keeps the family default, "auto" selects
+ * from capabilities, and a known quant name pins that variant.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FString ResolveQuant(const FModelFamily &Family, const FString &Policy,
+                            const FCortexHostCapabilities &Caps,
+                            int64 BudgetBytes) {
+  return Policy.IsEmpty() ? Family.DefaultQuant
+         : Policy.Equals(AutoPolicy, ESearchCase::IgnoreCase)
+             ? SelectQuant(Family, Caps, BudgetBytes)
+             : [&Policy, &Family]() {
+                 const func::Maybe<FQuantSpec> Spec = FindQuant(Policy);
+                 return Spec.hasValue ? Spec.value.Name : Family.DefaultQuant;
+               }();
+}
+
+/**
+ * GGUF file name for a family variant, e.g. SmolLM2-135M-Instruct-Q8_0.gguf.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FString VariantFileName(const FModelFamily &Family,
+                               const FString &Quant) {
+  const func::Maybe<FQuantSpec> Spec = FindQuant(Quant);
+  return FString::Printf(TEXT("%s-%s.gguf"), *Family.FilePrefix,
+                         Spec.hasValue ? *Spec.value.FileTag : *Quant);
+}
+
+/**
+ * Hugging Face download URL for a published family variant.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FString VariantUrl(const FModelFamily &Family, const FString &Quant) {
+  return FString::Printf(TEXT("https://huggingface.co/%s/resolve/main/%s"),
+                         *Family.Repo, *VariantFileName(Family, Quant));
+}
+
+/**
+ * Download and build plan for one model on one host. When the chosen quant
+ * is not published, the family source is downloaded and requantized.
+ * User Story: As cortex init, I need the whole plan computed up front so the
+ * thunk only executes steps instead of re-deriving paths.
+ */
+struct FVariantPlan {
+  bool bKnown;
+  FString Quant;
+  FString DownloadUrl;
+  FString DownloadPath;
+  FString LocalPath;
+  bool bRequantize;
+
+  FVariantPlan() : bKnown(false), bRequantize(false) {}
+};
+
+/**
+ * Builds the variant plan for a model id. Unknown ids are treated as a file
+ * name under ModelsDir with nothing to download.
+ * User Story: As local model bootstrap, I need known ids planned against the
+ * quant policy so the right variant is downloaded or built once and reused.
+ */
+inline FVariantPlan PlanForModel(const FString &ModelId,
+                                 const FString &ModelsDir,
+                                 const FString &Policy,
+                                 const FCortexHostCapabilities &Caps,
+                                 int64 BudgetBytes) {
+  const func::Maybe<FModelFamily> Family = FindFamily(ModelId);
+  FVariantPlan Plan;
+  Plan.bKnown = Family.hasValue;
+  Plan.LocalPath = FPaths::ConvertRelativePathToFull(ModelsDir / ModelId);
+  return !Family.hasValue
+             ? Plan
+             : [&]() {
+                 const FModelFamily &F = Family.value;
+                 Plan.Quant = ResolveQuant(F, Policy, Caps, BudgetBytes);
+                 Plan.bRequantize = !F.PublishedQuants.ContainsByPredicate(
+                     [&Plan](const FString &Q) {
+                       return Q.Equals(Plan.Quant, ESearchCase::IgnoreCase);
+                     });
+                 const FString Fetch =
+                     Plan.bRequantize ? F.SourceQuant : Plan.Quant;
+                 Plan.DownloadUrl = VariantUrl(F, Fetch);
+                 Plan.DownloadPath = FPaths::ConvertRelativePathToFull(
+                     ModelsDir / VariantFileName(F, Fetch));
+                 Plan.LocalPath = FPaths::ConvertRelativePathToFull(
+                     ModelsDir / VariantFileName(F, Plan.Quant));
+                 return Plan;
+               }();
+}
+
+/**
+ * Quantizer signature: (source, output, llama_ftype, allow requantize).
+ * Injected so variant caching can be tested without native libraries.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+using QuantizeFn = std::function<bool(const FString &, const FString &, int32,
+                                      bool)>;
+
+/**
+ * Ensures OutPath holds SourcePath requantized to Quant. An output newer than
+ * its source is reused as-is; otherwise the quantizer writes a temp file
+ * that is moved into place, so a crash never leaves a truncated variant.
+ * User Story: As offline model preparation, I need requantized variants
+ * cached on disk so a build is paid once per source and quant.
+ */
+inline func::Either<FString, FString>
+EnsureVariant(const FString &SourcePath, const FString &OutPath,
+              const FString &Quant, const QuantizeFn &Quantize) {
+  IFileManager &FM = IFileManager::Get();
+  const func::Maybe<FQuantSpec> Spec = FindQuant(Quant);
+  return !FPaths::FileExists(SourcePath)
+             ? func::make_left<FString, FString>(
+                   FString::Printf(TEXT("Source model not found: %s"),
+                                   *SourcePath))
+         : !Spec.hasValue
+             ? func::make_left<FString, FString>(
+                   FString::Printf(TEXT("Unknown quant: %s"), *Quant))
+         : (FPaths::FileExists(OutPath) &&
+            FM.GetTimeStamp(*OutPath) >= FM.GetTimeStamp(*SourcePath))
+             ? func::make_right<FString, FString>(OutPath)
+             : [&]() -> func::Either<FString, FString> {
+                 const FString TempPath = OutPath + TEXT(".tmp");
+                 FM.MakeDirectory(*FPaths::GetPath(OutPath), true);
+                 FM.Delete(*TempPath, false, true, true);
+                 const bool bBuilt =
+                     Quantize(SourcePath, TempPath, Spec.value.FType, true) &&
+                     FPaths::FileExists(TempPath) &&
+                     FM.Move(*OutPath, *TempPath, true, true);
+                 return bBuilt
+                            ? func::make_right<FString, FString>(OutPath)
+                            : (FM.Delete(*TempPath, false, true, true),
+                               func::make_left<FString, FString>(
+                                   FString::Printf(
+                                       TEXT("Quantize to %s failed: %s"),
+                                       *Spec.value.Name, *SourcePath)));
+               }();
+}
+
+} // namespace ModelVariants
@@ -0,0 +1,207 @@
+#pragma once
+/**
+ * Token stream channel — per-request SPSC ring drained on the game thread
+ * User Story: As streaming inference, I need tokens delivered outside the
+ * store so long responses cost one coalesced callback per frame instead of
+ * one dispatch and one string copy per token.
+ */
+
+#include "Containers/Ticker.h"
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace TokenStream {
+
+constexpr uint32 DEFAULT_RING_CAPACITY = 256;
+constexpr double DEFAULT_PROGRESS_INTERVAL_SECONDS = 0.25;
+
+using FOnChunk = std::function<void(const FString &Chunk)>;
+using FOnProgress = std::function<void(int32 TokenCount)>;
+using FOnClosed = std::function<void(const FString &FullText)>;
+
+/**
+ * Lock-free single-producer/single-consumer ring of token pieces. Head is
+ * only written by the producer, Tail only by the consumer.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FTokenRing {
+  TArray<FString> Slots;
+  uint32 Mask;
+  std::atomic<uint32> Head;
+  std::atomic<uint32> Tail;
+
+  explicit FTokenRing(uint32 Capacity)
+      : Mask(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(Capacity, 2)) - 1),
+        Head(0), Tail(0) {
+    Slots.SetNum(static_cast<int32>(Mask + 1));
+  }
+};
+
+/**
+ * Stores a piece if the ring has room; leaves the piece untouched when full.
+ * User Story: As the inference worker, I need a non-blocking push so token
+ * generation never waits on a slow game thread.
+ */
+inline bool TryPush(FTokenRing &Ring, FString &Piece) {
+  const uint32 H = Ring.Head.load(std::memory_order_relaxed);
+  const uint32 T = Ring.Tail.load(std::memory_order_acquire);
+  return H - T > Ring.Mask
+             ? false
+             : (Ring.Slots[static_cast<int32>(H & Ring.Mask)] =
+                    MoveTemp(Piece),
+                Piece.Reset(),
+                Ring.Head.store(H + 1, std::memory_order_release), true);
+}
+
+/**
+ * Appends every published piece to Out and releases their slots.
+ * User Story: As the game-thread consumer, I need one drain call to collect
+ * all pending pieces so delivery is coalesced per frame.
+ */
+inline void DrainRing(FTokenRing &Ring, FString &Out) {
+  struct Drain {
+    static void apply(FTokenRing &R, FString &Acc, uint32 Index, uint32 End) {
+      Index != End
+          ? (Acc += R.Slots[static_cast<int32>(Index & R.Mask)],
+             R.Slots[static_cast<int32>(Index & R.Mask)].Reset(),
+             apply(R, Acc, Index + 1, End), void())
+          : void();
+    }
+  };
+  const uint32 T = Ring.Tail.load(std::memory_order_relaxed);
+  const uint32 H = Ring.Head.load(std::memory_order_acquire);
+  Drain::apply(Ring, Out, T, H);
+  Ring.Tail.store(H, std::memory_order_release);
+}
+
+/**
+ * One streaming request. Producer-only, shared and consumer-only fields are
+ * grouped in that order.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FTokenChannel {
+  FTokenRing Ring;
+  FString Pending;
+  FString Remainder;
+  FString FullText;
+
+  std::atomic<int32> TokenCount;
+  std::atomic<bool> bClosed;
+  std::atomic<bool> bDrainScheduled;
+
+  FOnChunk OnChunk;
+  FOnProgress OnProgress;
+  FOnClosed OnClosed;
+  double ProgressInterval;
+  double LastProgressTime;
+  int32 ReportedTokens;
+  bool bFinished;
+
+  explicit FTokenChannel(uint32 Capacity)
+      : Ring(Capacity), TokenCount(0), bClosed(false), bDrainScheduled(false),
+        ProgressInterval(DEFAULT_PROGRESS_INTERVAL_SECONDS),
+        LastProgressTime(0.0), ReportedTokens(0), bFinished(false) {}
+};
+
+using FChannelRef = std::shared_ptr<FTokenChannel>;
+
+/**
+ * Opens a channel whose callbacks all run on the game thread.
+ * User Story: As stream orchestration, I need chunk, progress and close
+ * callbacks so UI text, store progress and completion stay ordered.
+ */
+inline FChannelRef Open(FOnChunk OnChunk, FOnProgress OnProgress,
+                        FOnClosed OnClosed,
+                        uint32 Capacity = DEFAULT_RING_CAPACITY,
+                        double ProgressInterval =
+                            DEFAULT_PROGRESS_INTERVAL_SECONDS) {
+  FChannelRef Channel = std::make_shared<FTokenChannel>(Capacity);
+  Channel->OnChunk = MoveTemp(OnChunk);
+  Channel->OnProgress = MoveTemp(OnProgress);
+  Channel->OnClosed = MoveTemp(OnClosed);
+  Channel->ProgressInterval = ProgressInterval;
+  Channel->LastProgressTime = FPlatformTime::Seconds();
+  return Channel;
+}
+
+/**
+ * Delivers everything published so far. Runs on the game thread; returns
+ * true once the close callback has fired.
+ * User Story: As the game-thread consumer, I need a single drain step so
+ * chunks, progress and completion are emitted in producer order.
+ */
+inline bool Drain(FTokenChannel &Channel) {
+  Channel.bDrainScheduled.store(false, std::memory_order_release);
+  const bool bClosed = Channel.bClosed.load(std::memory_order_acquire);
+
+  FString Chunk;
+  DrainRing(Channel.Ring, Chunk);
+  bClosed ? (Chunk += Channel.Remainder, Channel.Remainder.Reset(), void())
+          : void();
+  (!Chunk.IsEmpty() && Channel.OnChunk) ? (Channel.OnChunk(Chunk), void())
+                                        : void();
+
+  const int32 Tokens = Channel.TokenCount.load(std::memory_order_relaxed);
+  const double Now = FPlatformTime::Seconds();
+  (Channel.OnProgress && Tokens > Channel.ReportedTokens &&
+   (bClosed || Now - Channel.LastProgressTime >= Channel.ProgressInterval))
+      ? (Channel.ReportedTokens = Tokens, Channel.LastProgressTime = Now,
+         Channel.OnProgress(Tokens), void())
+      : void();
+
+  (bClosed && !Channel.bFinished)
+      ? (Channel.bFinished = true,
+         Channel.OnClosed ? (Channel.OnClosed(Channel.FullText), void())
+                          : void(),
+         void())
+      : void();
+  return Channel.bFinished;
+}
+
+/**
+ * Queues one drain on the core ticker unless one is already queued. The
+ * ticker runs on the game thread once per frame and fires a ticker added
+ * mid-tick on the next frame, so a channel drains at most once per frame.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void ScheduleDrain(const FChannelRef &Channel) {
+  !Channel->bDrainScheduled.exchange(true, std::memory_order_acq_rel)
+      ? (FTSTicker::GetCoreTicker().AddTicker(
+             FTickerDelegate::CreateLambda([Channel](float) {
+               Drain(*Channel);
+               return false;
+             })),
+         void())
+      : void();
+}
+
+/**
+ * Publishes one token from the producer thread. When the ring is full the
+ * token is held and coalesced into the next piece that fits.
+ * User Story: As the inference worker, I need a cheap per-token call so the
+ * decode loop is not slowed by game-thread delivery.
+ */
+inline void Push(const FChannelRef &Channel, const FString &Token) {
+  Channel->Pending += Token;
+  Channel->TokenCount.fetch_add(1, std::memory_order_relaxed);
+  TryPush(Channel->Ring, Channel->Pending);
+  ScheduleDrain(Channel);
+}
+
+/**
+ * Marks the stream finished; the final drain flushes held text, reports the
+ * last progress and fires the close callback.
+ * User Story: As the inference worker, I need a close step so completion is
+ * delivered only after every token chunk.
+ */
+inline void Close(const FChannelRef &Channel, const FString &FullText) {
+  Channel->Remainder = MoveTemp(Channel->Pending);
+  Channel->FullText = FullText;
+  Channel->bClosed.store(true, std::memory_order_release);
+  ScheduleDrain(Channel);
+}
+
+} // namespace TokenStream
@@ -48,12 +48,25 @@ struct FDirectiveRunFailedPayload {
 inline FString DirectiveIdSelector(const FDirectiveRun &Run) { return Run.Id; }
 
 /**
- * Returns the entity adapter used to manage directive runs.
+ * Name of the directive index keyed by NpcId.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline const FString &DirectiveNpcIndex() {
+  static const FString Name = TEXT("npcId");
+  return Name;
+}
+
+/**
+ * Returns the entity adapter used to manage directive runs, indexed by NpcId.
  * User Story: As directive reducers and selectors, I need a shared adapter so
  * entity operations stay consistent across the slice.
  */
 inline EntityAdapterOps<FDirectiveRun> GetDirectiveAdapter() {
-  return createEntityAdapter<FDirectiveRun>(&DirectiveIdSelector);
+  static const EntityAdapterOps<FDirectiveRun> Adapter = withIndex(
+      createEntityAdapter<FDirectiveRun>(&DirectiveIdSelector),
+      DirectiveNpcIndex(),
+      [](const FDirectiveRun &Run) { return Run.NpcId; });
+  return Adapter;
 }
 
 struct FDirectiveSliceState {
@@ -317,24 +330,9 @@ inline Slice<FDirectiveSliceState> CreateDirectiveSlice() {
           [](const FDirectiveSliceState &State,
              const Action<FString> &Action) -> FDirectiveSliceState {
             FDirectiveSliceState Next = State;
-            const TArray<FDirectiveRun> Runs =
-                GetDirectiveAdapter().getSelectors().selectAll(Next.Entities);
-            struct CollectIds {
-              static void apply(
-                  const TArray<FDirectiveRun> &R,
-                  const FString &NpcId,
-                  TArray<FString> &Out,
-                  int32 Idx) {
-                Idx >= R.Num()
-                    ? void()
-                    : (R[Idx].NpcId == NpcId
-                           ? (Out.Add(R[Idx].Id), void())
-                           : void(),
-                       apply(R, NpcId, Out, Idx + 1), void());
-              }
-            };
-            TArray<FString> IdsToRemove;
-            CollectIds::apply(Runs, Action.PayloadValue, IdsToRemove, 0);
+            const TArray<FString> IdsToRemove =
+                GetDirectiveAdapter().getSelectors().selectIdsByIndex(
+                    Next.Entities, DirectiveNpcIndex(), Action.PayloadValue);
             Next.Entities =
                 GetDirectiveAdapter().removeMany(Next.Entities, IdsToRemove);
             IdsToRemove.Contains(Next.ActiveDirectiveId)
@@ -364,6 +362,17 @@ inline TArray<FDirectiveRun> SelectAllDirectives(
   return GetDirectiveAdapter().getSelectors().selectAll(State.Entities);
 }
 
+/**
+ * Returns the directive runs issued for one NPC, in creation order.
+ * User Story: As per-NPC directive views, I need an NPC's runs from the index
+ * so lookups do not scan every run in the world.
+ */
+inline TArray<FDirectiveRun> SelectDirectivesForNpc(
+    const FDirectiveSliceState &State, const FString &NpcId) {
+  return GetDirectiveAdapter().getSelectors().selectByIndex(
+      State.Entities, DirectiveNpcIndex(), NpcId);
+}
+
 /**
  * Returns the id of the currently active directive run.
  * User Story: As directive UI binding, I need the active run id so views can
@@ -13,16 +13,17 @@ namespace rtk {
  */
 
 inline ThunkAction<FGhostRunResponse, FStoreState>
-startGhostThunk(const FGhostConfig &Config) {
-  return [Config](std::function<AnyAction(const AnyAction &)> Dispatch,
-                  std::function<FStoreState()> GetState)
+startGhostThunk(const FGhostConfig &Config,
+                const func::AbortSignal &Signal = func::AbortSignal()) {
+  return [Config, Signal](std::function<AnyAction(const AnyAction &)> Dispatch,
+                          std::function<FStoreState()> GetState)
              -> func::AsyncResult<FGhostRunResponse> {
     const auto ApiKeyError = Errors::requireApiKeyGuidance(
         SDKConfig::GetApiUrl(), SDKConfig::GetApiKey());
     return ApiKeyError.hasValue
         ? detail::RejectAsync<FGhostRunResponse>(ApiKeyError.value)
         : func::AsyncChain::then<FGhostRunResponse, FGhostRunResponse>(
-        APISlice::Endpoints::postGhostRun(Config)(Dispatch, GetState),
+        APISlice::Endpoints::postGhostRun(Config, Signal)(Dispatch, GetState),
         [Dispatch](const FGhostRunResponse &Response) {
           Dispatch(GhostSlice::Actions::GhostSessionStarted(
               Response.SessionId, Response.RunStatus));
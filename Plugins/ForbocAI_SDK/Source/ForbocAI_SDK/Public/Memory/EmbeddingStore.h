@@ -0,0 +1,167 @@
+#pragma once
+/**
+ * Embedding side store — memory vectors keyed by memory id, outside state
+ * User Story: As memory slice state, I need records without their 384-float
+ * vectors so every reducer copy and selector pass moves text, not kilobytes.
+ */
+
+#include "Core/functional_core.hpp"
+#include "CoreMinimal.h"
+#include "Memory/MemoryTypes.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace EmbeddingStore {
+
+/**
+ * Most embeddings the store holds at once. Local memories can always be read
+ * back from the memory database, so the oldest entry is dropped past this.
+ * User Story: As long sessions, I need the side store capped so remote recalls
+ * and export reads cannot grow it for as long as the process runs.
+ */
+constexpr int32 MAX_HELD_EMBEDDINGS = 4096;
+
+/**
+ * One held vector and the ring slot that admitted it.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FHeldEmbedding {
+  TArray<float> Vector;
+  int32 Slot = INDEX_NONE;
+};
+
+/**
+ * Process-wide table of embeddings. Written from memory worker threads, read
+ * by export and serialization on any thread. Ring records admission order;
+ * a slot only evicts the id that still points back at it.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FEmbeddingTable {
+  FRWLock Lock;
+  TMap<FString, FHeldEmbedding> Vectors;
+  TArray<FString> Ring;
+  int32 Cursor = 0;
+
+  FEmbeddingTable() { Ring.SetNum(MAX_HELD_EMBEDDINGS); }
+};
+
+/**
+ * Returns the process-wide embedding table.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FEmbeddingTable &Table() {
+  static FEmbeddingTable Instance;
+  return Instance;
+}
+
+/**
+ * Adds a new id at the cursor, dropping the entry admitted there a full
+ * ring ago. Caller holds the write lock.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void AdmitLocked(FEmbeddingTable &Held, const FString &Id,
+                        TArray<float> &&Vector) {
+  const FString Oldest = Held.Ring[Held.Cursor];
+  const FHeldEmbedding *Victim = Held.Vectors.Find(Oldest);
+  (Victim && Victim->Slot == Held.Cursor) ? (void)Held.Vectors.Remove(Oldest)
+                                          : void();
+  Held.Vectors.Add(Id, FHeldEmbedding{MoveTemp(Vector), Held.Cursor});
+  Held.Ring[Held.Cursor] = Id;
+  Held.Cursor = (Held.Cursor + 1) % MAX_HELD_EMBEDDINGS;
+}
+
+/**
+ * Stores an embedding for a memory id. Empty ids and vectors are ignored; a
+ * held id is overwritten in place.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void Put(const FString &Id, TArray<float> &&Vector) {
+  (!Id.IsEmpty() && Vector.Num() > 0)
+      ? [&]() {
+          FWriteScopeLock Lock(Table().Lock);
+          FHeldEmbedding *Existing = Table().Vectors.Find(Id);
+          Existing ? (Existing->Vector = MoveTemp(Vector), void())
+                   : AdmitLocked(Table(), Id, MoveTemp(Vector));
+        }()
+      : void();
+}
+
+/**
+ * Looks up the embedding for a memory id.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline func::Maybe<TArray<float>> Find(const FString &Id) {
+  FReadScopeLock Lock(Table().Lock);
+  const FHeldEmbedding *Found = Table().Vectors.Find(Id);
+  return Found ? func::just(Found->Vector) : func::nothing<TArray<float>>();
+}
+
+/**
+ * Drops the embedding for a memory id.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void Remove(const FString &Id) {
+  FWriteScopeLock Lock(Table().Lock);
+  Table().Vectors.Remove(Id);
+}
+
+/**
+ * Drops every embedding.
+ * User Story: As memory clear flows, I need the side store emptied with the
+ * database so a cleared NPC cannot export stale vectors.
+ */
+inline void Reset() {
+  FWriteScopeLock Lock(Table().Lock);
+  Table().Vectors.Reset();
+}
+
+/**
+ * Returns how many embeddings are held.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline int32 Num() {
+  FReadScopeLock Lock(Table().Lock);
+  return Table().Vectors.Num();
+}
+
+/**
+ * Moves an item's embedding into the store and returns the lightweight
+ * record.
+ * User Story: As memory thunks, I need vectors split off before an item is
+ * dispatched so the slice only ever holds lightweight records.
+ */
+inline FMemoryItem Detach(FMemoryItem Item) {
+  Put(Item.Id, MoveTemp(Item.Embedding));
+  Item.Embedding.Empty();
+  return Item;
+}
+
+/**
+ * Empties an item's embedding without holding it and drops any copy held for
+ * its id, for records whose vector was just written to the memory database.
+ * User Story: As local memory writes, I need the database to stay the only
+ * copy of a stored vector so the side store never holds a stale one.
+ */
+inline FMemoryItem Strip(FMemoryItem Item) {
+  Remove(Item.Id);
+  Item.Embedding.Empty();
+  return Item;
+}
+
+/**
+ * Detach applied to every item of a result set.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline TArray<FMemoryItem> DetachAll(TArray<FMemoryItem> Items) {
+  struct Helper {
+    static void apply(TArray<FMemoryItem> &Items, int32 Index) {
+      Index < Items.Num()
+          ? (Items[Index] = Detach(MoveTemp(Items[Index])),
+             apply(Items, Index + 1), void())
+          : void();
+    }
+  };
+  Helper::apply(Items, 0);
+  return Items;
+}
+
+} // namespace EmbeddingStore
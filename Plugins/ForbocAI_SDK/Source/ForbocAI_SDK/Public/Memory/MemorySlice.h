@@ -56,16 +56,18 @@ inline void ResolveIdsRecursive(const TArray<FString> &Ids,
 inline FString MemoryItemIdSelector(const FMemoryItem &Item) { return Item.Id; }
 
 /**
- * Returns the entity adapter used to manage memory records by id.
+ * Returns the entity adapter used to manage memory records by id. Memories
+ * grow into the thousands per session, so they use the persistent backend:
+ * each stored memory copies a few trie nodes rather than the whole table.
  * User Story: As memory reducers and selectors, I need one shared adapter so
  * entity operations stay consistent across the slice.
  */
-inline EntityAdapterOps<FMemoryItem> GetMemoryAdapter() {
-  return createEntityAdapter<FMemoryItem>(&MemoryItemIdSelector);
+inline PersistentEntityAdapterOps<FMemoryItem> GetMemoryAdapter() {
+  return createPersistentEntityAdapter<FMemoryItem>(&MemoryItemIdSelector);
 }
 
 struct FMemorySliceState {
-  EntityState<FMemoryItem> Entities;
+  PersistentEntityState<FMemoryItem> Entities;
   FString StorageStatus;
   FString RecallStatus;
   FString Error;
@@ -3,6 +3,7 @@
 #include "Core/ThunkDetail.h"
 #include "Cortex/CortexSlice.h"
 #include "Memory/MemorySlice.h"
+#include "RuntimeConfig.h"
 
 namespace rtk {
 
@@ -11,10 +12,12 @@ namespace rtk {
  * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
  */
 inline ThunkAction<FMemoryItem, FStoreState>
-nodeMemoryStoreThunk(const FMemoryItem &Item);
+nodeMemoryStoreThunk(const FMemoryItem &Item,
+                     const func::AbortSignal &Signal = func::AbortSignal());
 
 inline ThunkAction<TArray<FMemoryItem>, FStoreState>
-nodeMemoryRecallThunk(const FMemoryRecallRequest &Request);
+nodeMemoryRecallThunk(const FMemoryRecallRequest &Request,
+                      const func::AbortSignal &Signal = func::AbortSignal());
 
 /**
  * User Story: As memory persistence setup, I need validated DB/table paths so
@@ -22,24 +25,47 @@ nodeMemoryRecallThunk(const FMemoryRecallRequest &Request);
  */
 
 inline ThunkAction<rtk::FEmptyPayload, FStoreState>
-initNodeMemoryThunk(const FString &DatabasePath = TEXT("")) {
-  return [DatabasePath](std::function<AnyAction(const AnyAction &)> Dispatch,
-                        std::function<FStoreState()> GetState)
+initNodeMemoryThunk(const FString &DatabasePath = TEXT(""),
+                    const FString &VectorStorage = TEXT("")) {
+  return [DatabasePath,
+          VectorStorage](std::function<AnyAction(const AnyAction &)> Dispatch,
+                         std::function<FStoreState()> GetState)
              -> func::AsyncResult<rtk::FEmptyPayload> {
+    /**
+     * Storage applies to new database files; empty uses the configured mode.
+     * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+     */
+    const Native::Sqlite::EVectorStorage Storage =
+        Native::Sqlite::StorageFromName(
+            VectorStorage.IsEmpty() ? SDKConfig::GetMemoryVectorStorage()
+                                    : VectorStorage);
     return func::AsyncResult<rtk::FEmptyPayload>::create(
-        [DatabasePath](std::function<void(rtk::FEmptyPayload)> Resolve,
-                       std::function<void(std::string)> Reject) {
-          Async(EAsyncExecution::Thread, [DatabasePath, Resolve, Reject]() {
-            Native::Sqlite::DB &Handle = detail::NodeMemoryHandle();
-            Handle
-                ? (Native::Sqlite::Close(Handle), (void)(Handle = nullptr))
-                : (void)0;
+        [DatabasePath, Storage](std::function<void(rtk::FEmptyPayload)> Resolve,
+                                std::function<void(std::string)> Reject) {
+          Async(EAsyncExecution::Thread, [DatabasePath, Storage, Resolve,
+                                          Reject]() {
+            NativeHandles::Drain(detail::NodeMemoryReaders());
+            NativeHandles::Shutdown(
+                NativeHandles::Retire(detail::NodeMemorySlot()));
+            EmbeddingStore::Reset();
 
             const FString Path = DatabasePath.IsEmpty()
                                      ? detail::DefaultNodeMemoryPath()
                                      : DatabasePath;
             detail::NodeMemoryPathStorage() = Path;
-            Handle = Native::Sqlite::Open(Path);
+            const Native::Sqlite::DB Handle =
+                Native::Sqlite::Open(Path, Storage);
+            NativeHandles::Install(detail::NodeMemorySlot(), Handle,
+                                   &detail::ReleaseSqliteDatabase);
+
+            /**
+             * Readers open after the writer has created the table and
+             * switched the file to WAL.
+             * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+             */
+            Handle ? (void)detail::OpenNodeMemoryReaders(
+                         Path, SDKConfig::GetMemoryReadConnections())
+                   : void();
 
             AsyncTask(ENamedThreads::GameThread, [Handle, Resolve, Reject]() {
               Handle
@@ -52,88 +78,111 @@ initNodeMemoryThunk(const FString &DatabasePath = TEXT("")) {
   };
 }
 
+/**
+ * Embeds and stores one memory on a worker. Signal is checked before and
+ * after embedding; once it fires the thunk rejects with an abort message and
+ * nothing is written.
+ * User Story: As protocol runs that get cancelled, I need pending memory
+ * writes dropped so an abandoned turn does not keep the embedder busy.
+ */
 inline ThunkAction<FMemoryItem, FStoreState>
-nodeMemoryStoreThunk(const FMemoryItem &Item) {
-  return [Item](std::function<AnyAction(const AnyAction &)> Dispatch,
-                std::function<FStoreState()> GetState)
+nodeMemoryStoreThunk(const FMemoryItem &Item,
+                     const func::AbortSignal &Signal) {
+  return [Item, Signal](std::function<AnyAction(const AnyAction &)> Dispatch,
+                        std::function<FStoreState()> GetState)
              -> func::AsyncResult<FMemoryItem> {
     Dispatch(MemorySlice::Actions::MemoryStoreStart());
 
     return func::AsyncResult<FMemoryItem>::create(
-        [Item, Dispatch](std::function<void(FMemoryItem)> Resolve,
-                         std::function<void(std::string)> Reject) {
-          Async(EAsyncExecution::Thread, [Item, Dispatch, Resolve, Reject]() {
-            Native::Sqlite::DB Db = detail::EnsureNodeMemoryDatabase();
-            !Db
-                ? [&]() {
-                    const FString Error =
-                        TEXT("Local memory is not initialized");
-                    AsyncTask(ENamedThreads::GameThread,
-                              [Dispatch, Reject, Error]() {
-                                Dispatch(MemorySlice::Actions::
-                                             MemoryStoreFailed(Error));
-                                Reject(TCHAR_TO_UTF8(*Error));
-                              });
-                  }()
+        [Item, Signal, Dispatch](std::function<void(FMemoryItem)> Resolve,
+                                 std::function<void(std::string)> Reject) {
+          Async(EAsyncExecution::Thread, [Item, Signal, Dispatch, Resolve,
+                                          Reject]() {
+            const auto RejectOnGameThread = [Dispatch,
+                                             Reject](const FString &Error) {
+              AsyncTask(ENamedThreads::GameThread, [Dispatch, Reject, Error]() {
+                Dispatch(MemorySlice::Actions::MemoryStoreFailed(Error));
+                Reject(TCHAR_TO_UTF8(*Error));
+              });
+            };
+            const auto AbortError = [&Signal]() {
+              return FString(
+                  UTF8_TO_TCHAR(func::abortMessage(Signal.reason()).c_str()));
+            };
+            FMemoryItem Stored = Item;
+            !NativeHandles::IsLoaded(detail::NodeMemorySlot())
+                ? RejectOnGameThread(TEXT("Local memory is not initialized"))
+            : Signal.aborted() ? RejectOnGameThread(AbortError())
+            : (Stored.Embedding = detail::EmbedText(Stored.Text),
+               Signal.aborted())
+                ? RejectOnGameThread(AbortError())
                 : [&]() {
-                    FMemoryItem Stored = Item;
-                    Stored.Embedding = Native::Llama::Embed(
-                        detail::NodeEmbeddingHandle(), Stored.Text);
+                    const NativeHandles::FNativeLease Db(
+                        NativeHandles::Current(detail::NodeMemorySlot()),
+                        NativeHandles::ELeaseMode::Exclusive);
                     const bool bStored =
-                        Native::Sqlite::Upsert(Db, Stored, Stored.Embedding);
-
-                    AsyncTask(
-                        ENamedThreads::GameThread,
-                        [Dispatch, Resolve, Reject, Stored, bStored]() {
-                          bStored
-                              ? (Dispatch(MemorySlice::Actions::
-                                              MemoryStoreSuccess(Stored)),
-                                 Resolve(Stored), void())
-                              : [&]() {
-                                  const FString Error =
-                                      TEXT("Failed to store local memory");
-                                  Dispatch(MemorySlice::Actions::
-                                               MemoryStoreFailed(Error));
-                                  Reject(TCHAR_TO_UTF8(*Error));
-                                }();
-                        });
+                        Db && Native::Sqlite::Upsert(Db.Get(), Stored,
+                                                     Stored.Embedding);
+                    const FMemoryItem Record = EmbeddingStore::Strip(Stored);
+
+                    bStored
+                        ? AsyncTask(ENamedThreads::GameThread,
+                                    [Dispatch, Resolve, Stored, Record]() {
+                                      Dispatch(MemorySlice::Actions::
+                                                   MemoryStoreSuccess(Record));
+                                      Resolve(Stored);
+                                    })
+                        : RejectOnGameThread(
+                              TEXT("Failed to store local memory"));
                   }();
           });
         });
   };
 }
 
+/**
+ * Embeds the query and searches node memory on a worker. Signal is checked
+ * before and after embedding; once it fires the thunk rejects with an abort
+ * message and no search runs.
+ * User Story: As protocol runs that get cancelled, I need pending recalls
+ * dropped so an abandoned turn does not hold a memory reader.
+ */
 inline ThunkAction<TArray<FMemoryItem>, FStoreState>
-nodeMemoryRecallThunk(const FMemoryRecallRequest &Request) {
-  return [Request](std::function<AnyAction(const AnyAction &)> Dispatch,
-                   std::function<FStoreState()> GetState)
+nodeMemoryRecallThunk(const FMemoryRecallRequest &Request,
+                      const func::AbortSignal &Signal) {
+  return [Request, Signal](std::function<AnyAction(const AnyAction &)> Dispatch,
+                           std::function<FStoreState()> GetState)
              -> func::AsyncResult<TArray<FMemoryItem>> {
     Dispatch(MemorySlice::Actions::MemoryRecallStart());
 
     return func::AsyncResult<TArray<FMemoryItem>>::create(
-        [Request, Dispatch](std::function<void(TArray<FMemoryItem>)> Resolve,
-                            std::function<void(std::string)> Reject) {
-          Async(EAsyncExecution::Thread, [Request, Dispatch, Resolve,
+        [Request, Signal,
+         Dispatch](std::function<void(TArray<FMemoryItem>)> Resolve,
+                   std::function<void(std::string)> Reject) {
+          Async(EAsyncExecution::Thread, [Request, Signal, Dispatch, Resolve,
                                           Reject]() {
-            Native::Sqlite::DB Db = detail::EnsureNodeMemoryDatabase();
-            !Db
-                ? [&]() {
-                    const FString Error =
-                        TEXT("Local memory is not initialized");
-                    AsyncTask(ENamedThreads::GameThread,
-                              [Dispatch, Reject, Error]() {
-                                Dispatch(MemorySlice::Actions::
-                                             MemoryRecallFailed(Error));
-                                Reject(TCHAR_TO_UTF8(*Error));
-                              });
-                  }()
+            const auto RejectOnGameThread = [Dispatch,
+                                             Reject](const FString &Error) {
+              AsyncTask(ENamedThreads::GameThread, [Dispatch, Reject, Error]() {
+                Dispatch(MemorySlice::Actions::MemoryRecallFailed(Error));
+                Reject(TCHAR_TO_UTF8(*Error));
+              });
+            };
+            const auto AbortError = [&Signal]() {
+              return FString(
+                  UTF8_TO_TCHAR(func::abortMessage(Signal.reason()).c_str()));
+            };
+            TArray<float> QueryEmbedding;
+            !NativeHandles::IsLoaded(detail::NodeMemorySlot())
+                ? RejectOnGameThread(TEXT("Local memory is not initialized"))
+            : Signal.aborted() ? RejectOnGameThread(AbortError())
+            : (QueryEmbedding = detail::EmbedText(Request.Query),
+               Signal.aborted())
+                ? RejectOnGameThread(AbortError())
                 : [&]() {
-                    const TArray<float> QueryEmbedding =
-                        Native::Llama::Embed(detail::NodeEmbeddingHandle(),
-                                             Request.Query);
-                    TArray<FMemoryItem> Results =
-                        Native::Sqlite::Search(Db, QueryEmbedding,
-                                               Request.Limit);
+                    TArray<FMemoryItem> Results = detail::SearchNodeMemory(
+                        QueryEmbedding, Request.Limit,
+                        detail::RecallScoringFor(Request.Scoring));
 
                     Request.Threshold > 0.0f
                         ? (void)Results.RemoveAll(
@@ -161,22 +210,24 @@ nodeMemoryRecallThunk(const FMemoryRecallRequest &Request) {
 inline ThunkAction<FMemoryItem, FStoreState>
 storeNodeMemoryThunk(const FString &Text,
                      const FString &Type = TEXT("observation"),
-                     float Importance = 0.5f) {
+                     float Importance = 0.5f,
+                     const func::AbortSignal &Signal = func::AbortSignal()) {
   FMemoryStoreInstruction Instruction;
   Instruction.Text = Text;
   Instruction.Type = Type;
   Instruction.Importance = Importance;
-  return nodeMemoryStoreThunk(detail::MakeMemoryItem(Instruction));
+  return nodeMemoryStoreThunk(detail::MakeMemoryItem(Instruction), Signal);
 }
 
 inline ThunkAction<TArray<FMemoryItem>, FStoreState>
 recallNodeMemoryThunk(const FString &Query, int32 Limit = 10,
-                      float Threshold = 0.7f) {
+                      float Threshold = 0.7f,
+                      const func::AbortSignal &Signal = func::AbortSignal()) {
   FMemoryRecallRequest Request;
   Request.Query = Query;
   Request.Limit = Limit;
   Request.Threshold = Threshold;
-  return nodeMemoryRecallThunk(Request);
+  return nodeMemoryRecallThunk(Request, Signal);
 }
 
 inline ThunkAction<rtk::FEmptyPayload, FStoreState> clearNodeMemoryThunk() {
@@ -187,16 +238,29 @@ inline ThunkAction<rtk::FEmptyPayload, FStoreState> clearNodeMemoryThunk() {
         [Dispatch](std::function<void(rtk::FEmptyPayload)> Resolve,
                    std::function<void(std::string)> Reject) {
           Async(EAsyncExecution::Thread, [Dispatch, Resolve]() {
-            Native::Sqlite::DB &Handle = detail::NodeMemoryHandle();
+            /**
+             * Close every reader, detach the writer, wait for in-flight
+             * writes, then clear and close it before the files are deleted.
+             * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+             */
+            NativeHandles::Drain(detail::NodeMemoryReaders());
+            const NativeHandles::FResourceRef Retired =
+                NativeHandles::Retire(detail::NodeMemorySlot());
             const FString Path = detail::NodeMemoryPathStorage();
-            Handle
-                ? (Native::Sqlite::Clear(Handle),
-                   Native::Sqlite::Close(Handle),
-                   (void)(Handle = nullptr))
+            Retired
+                ? NativeHandles::Shutdown(
+                      Retired, [](void *Handle) {
+                        Native::Sqlite::Clear(Handle);
+                      })
                 : (void)Native::Sqlite::ClearPath(Path);
 
             IFileManager::Get().Delete(*Path, false, true, true);
+            IFileManager::Get().Delete(*(Path + TEXT("-wal")), false, true,
+                                       true);
+            IFileManager::Get().Delete(*(Path + TEXT("-shm")), false, true,
+                                       true);
             detail::NodeMemoryPathStorage() = detail::DefaultNodeMemoryPath();
+            EmbeddingStore::Reset();
 
             AsyncTask(ENamedThreads::GameThread, [Dispatch, Resolve]() {
               Dispatch(MemorySlice::Actions::MemoryClear());
@@ -207,6 +271,53 @@ inline ThunkAction<rtk::FEmptyPayload, FStoreState> clearNodeMemoryThunk() {
   };
 }
 
+/**
+ * Converts the node-memory database to another vector storage mode. Open
+ * connections are closed for the rewrite and reopened afterwards.
+ * User Story: As operators moving a server to quantized storage, I need the
+ * existing database migrated in place so NPC memories survive the switch.
+ */
+inline ThunkAction<rtk::FEmptyPayload, FStoreState>
+migrateNodeMemoryStorageThunk(const FString &VectorStorage) {
+  return [VectorStorage](std::function<AnyAction(const AnyAction &)> Dispatch,
+                         std::function<FStoreState()> GetState)
+             -> func::AsyncResult<rtk::FEmptyPayload> {
+    return func::AsyncResult<rtk::FEmptyPayload>::create(
+        [VectorStorage](std::function<void(rtk::FEmptyPayload)> Resolve,
+                        std::function<void(std::string)> Reject) {
+          Async(EAsyncExecution::Thread, [VectorStorage, Resolve, Reject]() {
+            const Native::Sqlite::EVectorStorage Target =
+                Native::Sqlite::StorageFromName(VectorStorage);
+            const FString Path = detail::NodeMemoryPathStorage();
+            const bool bWasOpen =
+                NativeHandles::IsLoaded(detail::NodeMemorySlot());
+
+            NativeHandles::Drain(detail::NodeMemoryReaders());
+            NativeHandles::Shutdown(
+                NativeHandles::Retire(detail::NodeMemorySlot()));
+
+            const bool bMigrated = Native::Sqlite::MigrateStorage(Path, Target);
+
+            const Native::Sqlite::DB Handle =
+                bWasOpen ? Native::Sqlite::Open(Path, Target) : nullptr;
+            NativeHandles::Install(detail::NodeMemorySlot(), Handle,
+                                   &detail::ReleaseSqliteDatabase);
+            Handle ? (void)detail::OpenNodeMemoryReaders(
+                         Path, SDKConfig::GetMemoryReadConnections())
+                   : void();
+
+            AsyncTask(ENamedThreads::GameThread, [bMigrated, Resolve,
+                                                  Reject]() {
+              bMigrated
+                  ? (Resolve(rtk::FEmptyPayload{}), void())
+                  : (Reject("Failed to migrate node memory vector storage"),
+                     void());
+            });
+          });
+        });
+  };
+}
+
 inline ThunkAction<rtk::FEmptyPayload, FStoreState>
 initNodeVectorThunk(const FString &EmbeddingModelPath = TEXT("")) {
   return [EmbeddingModelPath](std::function<AnyAction(const AnyAction &)> Dispatch,
@@ -225,15 +336,17 @@ initNodeVectorThunk(const FString &EmbeddingModelPath = TEXT("")) {
                                    ? detail::DefaultEmbeddingModelPath()
                                    : EmbeddingModelPath;
 
-          auto LoadOnWorker = [Path, Dispatch, Resolve, Reject]() {
-            Async(EAsyncExecution::Thread, [Path, Dispatch, Resolve, Reject]() {
-              Native::Llama::Context &Handle = detail::NodeEmbeddingHandle();
-              Handle
-                  ? (Native::Llama::FreeModel(Handle),
-                     (void)(Handle = nullptr))
-                  : (void)0;
+          const FCortexThreadingConfig Threading =
+              SDKConfig::GetThreadingConfig(FPaths::GetBaseFilename(Path));
 
-              Handle = Native::Llama::LoadEmbeddingModel(Path);
+          auto LoadOnWorker = [Path, Threading, Dispatch, Resolve, Reject]() {
+            Async(EAsyncExecution::Thread, [Path, Threading, Dispatch, Resolve,
+                                            Reject]() {
+              NativeHandles::Retire(detail::NodeEmbeddingSlot());
+              const Native::Llama::Context Handle =
+                  Native::Llama::LoadEmbeddingModel(Path, Threading);
+              NativeHandles::Install(detail::NodeEmbeddingSlot(), Handle,
+                                     &detail::ReleaseLlamaContext);
 
               AsyncTask(ENamedThreads::GameThread,
                         [Handle, Dispatch, Resolve, Reject]() {
@@ -282,31 +395,35 @@ initNodeVectorThunk(const FString &EmbeddingModelPath = TEXT("")) {
 
 /**
  * Remote memory thunks (mirrors TS core thunks.ts)
+ * Signal aborts the underlying request.
  * User Story: As a maintainer, I need this section note so related declarations and logic stay easy to locate.
  */
 
 inline ThunkAction<rtk::FEmptyPayload, FStoreState>
 storeMemoryRemoteThunk(const FString &NpcId, const FString &Observation,
-                       float Importance = 0.8f) {
-  return [NpcId, Observation,
-          Importance](std::function<AnyAction(const AnyAction &)> Dispatch,
-                      std::function<FStoreState()> GetState)
+                       float Importance = 0.8f,
+                       const func::AbortSignal &Signal = func::AbortSignal()) {
+  return [NpcId, Observation, Importance,
+          Signal](std::function<AnyAction(const AnyAction &)> Dispatch,
+                  std::function<FStoreState()> GetState)
              -> func::AsyncResult<rtk::FEmptyPayload> {
     return APISlice::Endpoints::postMemoryStore(
-        NpcId, TypeFactory::RemoteMemoryStoreRequest(Observation, Importance))(
-        Dispatch, GetState);
+        NpcId, TypeFactory::RemoteMemoryStoreRequest(Observation, Importance),
+        Signal)(Dispatch, GetState);
   };
 }
 
 inline ThunkAction<TArray<FMemoryItem>, FStoreState>
-listMemoryRemoteThunk(const FString &NpcId) {
-  return [NpcId](std::function<AnyAction(const AnyAction &)> Dispatch,
-                 std::function<FStoreState()> GetState)
+listMemoryRemoteThunk(const FString &NpcId,
+                      const func::AbortSignal &Signal = func::AbortSignal()) {
+  return [NpcId, Signal](std::function<AnyAction(const AnyAction &)> Dispatch,
+                         std::function<FStoreState()> GetState)
              -> func::AsyncResult<TArray<FMemoryItem>> {
     return func::AsyncChain::then<TArray<FMemoryItem>, TArray<FMemoryItem>>(
-        APISlice::Endpoints::getMemoryList(NpcId)(Dispatch, GetState),
+        APISlice::Endpoints::getMemoryList(NpcId, Signal)(Dispatch, GetState),
         [Dispatch](const TArray<FMemoryItem> &Items) {
-          Dispatch(MemorySlice::Actions::MemoryRecallSuccess(Items));
+          Dispatch(MemorySlice::Actions::MemoryRecallSuccess(
+              EmbeddingStore::DetachAll(Items)));
           return detail::ResolveAsync(Items);
         });
   };
@@ -314,18 +431,21 @@ listMemoryRemoteThunk(const FString &NpcId) {
 
 inline ThunkAction<TArray<FMemoryItem>, FStoreState>
 recallMemoryRemoteThunk(const FString &NpcId, const FString &Query,
-                        float Similarity = 0.0f) {
-  return [NpcId, Query,
-          Similarity](std::function<AnyAction(const AnyAction &)> Dispatch,
-                      std::function<FStoreState()> GetState)
+                        float Similarity = 0.0f,
+                        const func::AbortSignal &Signal = func::AbortSignal()) {
+  return [NpcId, Query, Similarity,
+          Signal](std::function<AnyAction(const AnyAction &)> Dispatch,
+                  std::function<FStoreState()> GetState)
              -> func::AsyncResult<TArray<FMemoryItem>> {
     Dispatch(MemorySlice::Actions::MemoryRecallStart());
     return func::AsyncChain::then<TArray<FMemoryItem>, TArray<FMemoryItem>>(
                APISlice::Endpoints::postMemoryRecall(
-                   NpcId, TypeFactory::RemoteMemoryRecallRequest(
-                              Query, Similarity))(Dispatch, GetState),
+                   NpcId,
+                   TypeFactory::RemoteMemoryRecallRequest(Query, Similarity),
+                   Signal)(Dispatch, GetState),
                [Dispatch](const TArray<FMemoryItem> &Items) {
-                 Dispatch(MemorySlice::Actions::MemoryRecallSuccess(Items));
+                 Dispatch(MemorySlice::Actions::MemoryRecallSuccess(
+                     EmbeddingStore::DetachAll(Items)));
                  return detail::ResolveAsync(Items);
                })
         .catch_([Dispatch](std::string Error) {
@@ -336,13 +456,16 @@ recallMemoryRemoteThunk(const FString &NpcId, const FString &Query,
 }
 
 inline ThunkAction<rtk::FEmptyPayload, FStoreState>
-clearMemoryRemoteThunk(const FString &NpcId) {
-  return [NpcId](std::function<AnyAction(const AnyAction &)> Dispatch,
-                 std::function<FStoreState()> GetState)
+clearMemoryRemoteThunk(const FString &NpcId,
+                       const func::AbortSignal &Signal = func::AbortSignal()) {
+  return [NpcId, Signal](std::function<AnyAction(const AnyAction &)> Dispatch,
+                         std::function<FStoreState()> GetState)
              -> func::AsyncResult<rtk::FEmptyPayload> {
     return func::AsyncChain::then<rtk::FEmptyPayload, rtk::FEmptyPayload>(
-        APISlice::Endpoints::deleteMemoryClear(NpcId)(Dispatch, GetState),
+        APISlice::Endpoints::deleteMemoryClear(NpcId, Signal)(Dispatch,
+                                                              GetState),
         [Dispatch](const rtk::FEmptyPayload &Payload) {
+          EmbeddingStore::Reset();
           Dispatch(MemorySlice::Actions::MemoryClear());
           return detail::ResolveAsync(Payload);
         });
@@ -96,6 +96,10 @@ struct FMemoryRecallRequest {
   UPROPERTY(BlueprintReadOnly, Category = "Memory")
   float Threshold;
 
+  /** "similarity", "weighted" or "mmr"; empty uses memoryRecallScoring. */
+  UPROPERTY(BlueprintReadOnly, Category = "Memory")
+  FString Scoring;
+
   FMemoryRecallRequest() : Limit(10), Threshold(0.7f) {}
 };
 
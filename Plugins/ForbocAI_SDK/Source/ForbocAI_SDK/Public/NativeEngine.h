@@ -25,6 +25,14 @@ using Context = void *;
  */
 FORBOCAI_SDK_API Context LoadModel(const FString &Path);
 
+/**
+ * Loads a GGUF model for inference with explicit CPU threading.
+ * User Story: As local inference setup, I need per-load threading so a model
+ * can be pinned to specific cores and share a threadpool with its peers.
+ */
+FORBOCAI_SDK_API Context LoadModel(const FString &Path,
+                                   const FCortexThreadingConfig &Threading);
+
 /**
  * Loads a GGUF embedding model for memory operations.
  * User Story: As local memory setup, I need an embedding model loader so text
@@ -32,6 +40,53 @@ FORBOCAI_SDK_API Context LoadModel(const FString &Path);
  */
 FORBOCAI_SDK_API Context LoadEmbeddingModel(const FString &Path);
 
+/**
+ * Loads a GGUF embedding model with explicit CPU threading.
+ * User Story: As local memory setup, I need embedder threading configurable
+ * so embedding work can be kept off the cores used for generation.
+ */
+FORBOCAI_SDK_API Context
+LoadEmbeddingModel(const FString &Path, const FCortexThreadingConfig &Threading);
+
+/**
+ * Re-applies CPU threading to a loaded context; false when unavailable.
+ * User Story: As runtime tuning, I need threading changed on a live context so
+ * servers can rebalance cores without reloading models.
+ */
+FORBOCAI_SDK_API bool SetThreading(Context Ctx,
+                                   const FCortexThreadingConfig &Threading);
+
+/**
+ * Number of ggml threadpools created since startup; 0 without native code.
+ * User Story: As threading diagnostics, I need pool churn observable so
+ * repeated requests can be checked for reusing the attached pool.
+ */
+FORBOCAI_SDK_API int64 ThreadpoolCreations();
+
+/**
+ * Installs an abort flag that generation polls between tokens and inside
+ * decode; nullptr clears it. Set it only while holding an exclusive lease.
+ * User Story: As cancellable inference, I need generation stopped once the
+ * requesting NPC is gone so cores are not spent on text nobody reads.
+ */
+FORBOCAI_SDK_API void SetAbortFlag(Context Ctx, const std::atomic<bool> *Flag);
+
+/**
+ * Reports host memory, cores and the SIMD features of the active CPU backend.
+ * User Story: As model variant selection, I need host capabilities measured so
+ * auto quantization picks a variant this machine can hold and run fast.
+ */
+FORBOCAI_SDK_API FCortexHostCapabilities DetectHostCapabilities();
+
+/**
+ * Requantizes a GGUF model to a llama_ftype; blocking, so call off-thread.
+ * User Story: As offline model preparation, I need GGUF requantization so a
+ * single downloaded source can produce the variant each SKU needs.
+ */
+FORBOCAI_SDK_API bool Quantize(const FString &SourcePath,
+                               const FString &OutPath, int32 FType,
+                               bool bAllowRequantize);
+
 /**
  * Frees the model context.
  * User Story: As native resource cleanup, I need model contexts released so
@@ -97,6 +152,87 @@ namespace Sqlite {
 
 using DB = void *;
 
+/**
+ * How a database stores memory embeddings. Float keeps fp32 vectors in the
+ * search table. Int8 and Binary keep quantized vectors there (4x and 32x
+ * smaller) and the fp32 originals in a cold table used only to re-rank the
+ * top candidates.
+ * User Story: As memory-constrained servers, I need quantized vector storage
+ * so scans touch a fraction of the bytes without losing final ranking.
+ */
+enum class EVectorStorage : uint8 { Float, Int8, Binary };
+
+/**
+ * Returns the config name of a storage mode ("float", "int8", "binary").
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline const TCHAR *StorageName(EVectorStorage Storage) {
+  return Storage == EVectorStorage::Int8     ? TEXT("int8")
+         : Storage == EVectorStorage::Binary ? TEXT("binary")
+                                             : TEXT("float");
+}
+
+/**
+ * Parses a storage mode name; unknown names mean Float.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline EVectorStorage StorageFromName(const FString &Name) {
+  return Name.Equals(TEXT("int8"), ESearchCase::IgnoreCase)
+             ? EVectorStorage::Int8
+         : Name.Equals(TEXT("binary"), ESearchCase::IgnoreCase)
+             ? EVectorStorage::Binary
+             : EVectorStorage::Float;
+}
+
+/**
+ * How recall orders its results. Similarity ranks by vector distance alone.
+ * Weighted ranks by similarity x importance x exp(-age / tau). Mmr picks
+ * greedily by maximal marginal relevance over the weighted score, trading
+ * relevance against similarity to results already picked.
+ * User Story: As games with recency and importance rules, I need recall
+ * ranked in the engine so they stop over-fetching and re-ranking themselves.
+ */
+enum class ERecallScoring : uint8 { Similarity, Weighted, Mmr };
+
+/**
+ * Returns the config name of a scoring mode ("similarity", "weighted",
+ * "mmr").
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline const TCHAR *ScoringName(ERecallScoring Scoring) {
+  return Scoring == ERecallScoring::Weighted ? TEXT("weighted")
+         : Scoring == ERecallScoring::Mmr    ? TEXT("mmr")
+                                             : TEXT("similarity");
+}
+
+/**
+ * Parses a scoring mode name; unknown names mean Similarity.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline ERecallScoring ScoringFromName(const FString &Name) {
+  return Name.Equals(TEXT("weighted"), ESearchCase::IgnoreCase)
+             ? ERecallScoring::Weighted
+         : Name.Equals(TEXT("mmr"), ESearchCase::IgnoreCase)
+             ? ERecallScoring::Mmr
+             : ERecallScoring::Similarity;
+}
+
+/**
+ * Parameters for one scored recall. NowSeconds is the unix time ages are
+ * measured from; a non-positive tau disables recency decay.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FRecallScoring {
+  ERecallScoring Mode;
+  double RecencyTauSeconds;
+  float MmrLambda;
+  int64 NowSeconds;
+
+  FRecallScoring()
+      : Mode(ERecallScoring::Similarity), RecencyTauSeconds(0.0),
+        MmrLambda(0.7f), NowSeconds(0) {}
+};
+
 /**
  * Opens a vector-enabled sqlite database.
  * User Story: As local vector memory setup, I need database open support so
@@ -104,6 +240,40 @@ using DB = void *;
  */
 FORBOCAI_SDK_API DB Open(const FString &Path);
 
+/**
+ * Opens a vector-enabled sqlite database, creating it with the given storage
+ * mode when new. An existing database keeps the mode it was created with;
+ * MigrateStorage converts it.
+ * User Story: As per-store configuration, I need the storage mode chosen at
+ * open so each database can be sized for its host.
+ */
+FORBOCAI_SDK_API DB Open(const FString &Path, EVectorStorage Storage);
+
+/**
+ * Returns the storage mode of an open database.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+FORBOCAI_SDK_API EVectorStorage GetStorage(DB Database);
+
+/**
+ * Rewrites an existing database file into another storage mode in one
+ * transaction. The file must not be open elsewhere. Returns false and leaves
+ * the file unchanged on failure.
+ * User Story: As operators switching storage modes, I need existing memories
+ * converted in place so a quantization change does not wipe NPC history.
+ */
+FORBOCAI_SDK_API bool MigrateStorage(const FString &Path,
+                                     EVectorStorage Target);
+
+/**
+ * Opens a read-only connection to a database already created by Open.
+ * Returns null for in-memory databases, which cannot be shared between
+ * connections.
+ * User Story: As concurrent vector recall, I need extra read connections so
+ * searches run in parallel under WAL without blocking the writer.
+ */
+FORBOCAI_SDK_API DB OpenReader(const FString &Path);
+
 /**
  * Closes the database.
  * User Story: As local vector memory cleanup, I need database handles closed
@@ -148,6 +318,36 @@ FORBOCAI_SDK_API bool Upsert(DB Database, const FMemoryItem &Item);
 FORBOCAI_SDK_API TArray<FMemoryItem>
 Search(DB Database, const TArray<float> &Vector, int32 TopK = 5);
 
+/**
+ * Reads the full-precision embedding stored for a memory id; empty when the
+ * id is unknown. Quantized databases answer from their cold fp32 table.
+ * User Story: As soul export, I need a memory's vector fetched by id so
+ * embeddings can stay out of runtime state until something serializes them.
+ */
+FORBOCAI_SDK_API TArray<float> FetchEmbedding(DB Database, const FString &Id);
+
+/**
+ * Runs a scored recall: fetches an oversampled candidate set by vector
+ * distance, ranks it with the given scoring and returns the best TopK.
+ * Similarity mode is a plain Search. Returned items carry no embeddings.
+ * User Story: As local-memory recall, I need recency, importance and
+ * diversity applied where the candidates already are so each recall reads
+ * only the rows it needs.
+ */
+FORBOCAI_SDK_API TArray<FMemoryItem>
+SearchScored(DB Database, const TArray<float> &Vector, int32 TopK,
+             const FRecallScoring &Scoring);
+
+/**
+ * Orders candidates with a scoring mode and keeps the best TopK. Mmr reads
+ * candidate embeddings for its diversity term; candidates without one count
+ * as unlike everything.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+FORBOCAI_SDK_API TArray<FMemoryItem>
+RankRecall(const TArray<FMemoryItem> &Candidates, int32 TopK,
+           const FRecallScoring &Scoring);
+
 /**
  * Provides the compatibility upsert overload during migration.
  * User Story: As migration compatibility, I need the legacy upsert overload so
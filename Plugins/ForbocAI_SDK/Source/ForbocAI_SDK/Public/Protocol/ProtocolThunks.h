@@ -17,6 +17,13 @@ struct FProtocolRuntime {
   std::function<ThunkAction<FCortexResponse, FStoreState>(
       const FString &, const FCortexConfig &)>
       CompleteInference;
+  /**
+   * Cancellation signal for the run; checked before every protocol turn and
+   * forwarded to the process endpoint, local memory and local inference.
+   * User Story: As NPC cancellation flows, I need one signal per run so
+   * aborting it stops HTTP turns and native generation together.
+   */
+  func::AbortSignal Signal;
 
   /**
    * Returns whether local memory store and recall handlers are configured.
@@ -40,17 +47,19 @@ struct FProtocolRuntime {
  * User Story: As local protocol execution, I need a ready-made runtime so the
  * protocol loop can call local memory and inference services consistently.
  */
-inline FProtocolRuntime LocalProtocolRuntime() {
+inline FProtocolRuntime
+LocalProtocolRuntime(const func::AbortSignal &Signal = func::AbortSignal()) {
   FProtocolRuntime Runtime;
-  Runtime.StoreMemory = [](const FMemoryItem &Item) {
-    return nodeMemoryStoreThunk(Item);
+  Runtime.Signal = Signal;
+  Runtime.StoreMemory = [Signal](const FMemoryItem &Item) {
+    return nodeMemoryStoreThunk(Item, Signal);
   };
-  Runtime.RecallMemory = [](const FMemoryRecallRequest &Request) {
-    return nodeMemoryRecallThunk(Request);
+  Runtime.RecallMemory = [Signal](const FMemoryRecallRequest &Request) {
+    return nodeMemoryRecallThunk(Request, Signal);
   };
-  Runtime.CompleteInference = [](const FString &Prompt,
-                                 const FCortexConfig &Config) {
-    return completeNodeCortexThunk(Prompt, Config);
+  Runtime.CompleteInference = [Signal](const FString &Prompt,
+                                       const FCortexConfig &Config) {
+    return completeNodeCortexThunk(Prompt, Config, Signal);
   };
   return Runtime;
 }
@@ -87,9 +96,15 @@ PopulateRecalledMemoriesRecursive(const TArray<FMemoryItem> &Memories,
                                                   MoveTemp(Result)));
 }
 
+/**
+ * Upper bound on memory stores in flight for one finalize step.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline constexpr size_t MemoryPersistConcurrency = 4;
+
 inline func::AsyncResult<rtk::FEmptyPayload>
 PersistMemoryInstructions(const TArray<FMemoryStoreInstruction> &Instructions,
-                          int32 Index, const FProtocolRuntime &Runtime,
+                          const FProtocolRuntime &Runtime,
                           std::function<AnyAction(const AnyAction &)> Dispatch,
                           std::function<FStoreState()> GetState);
 
@@ -244,8 +259,8 @@ HandleFinalize(const FNPCInstruction &Instruction,
                                : Instruction.Dialogue)),
                 ResolveAsync(BuildAgentResponse(Instruction)))
              : func::AsyncChain::then<rtk::FEmptyPayload, FAgentResponse>(
-                   PersistMemoryInstructions(Instruction.MemoryStore, 0,
-                                             Runtime, Dispatch, GetState),
+                   PersistMemoryInstructions(Instruction.MemoryStore, Runtime,
+                                             Dispatch, GetState),
                    [NpcId, Input, Instruction, Dispatch,
                     GetState](const rtk::FEmptyPayload &) {
                      HasStatePayload(Instruction.StateTransform)
@@ -273,7 +288,13 @@ RunProtocolTurn(const FString &NpcId, const FString &Input,
                 int32 Turn, const FProtocolRuntime &Runtime,
                 std::function<AnyAction(const AnyAction &)> Dispatch,
                 std::function<FStoreState()> GetState) {
-  return Turn >= 12
+  const FString AbortError = FString(UTF8_TO_TCHAR(
+      func::abortMessage(Runtime.Signal.reason()).c_str()));
+  return Runtime.Signal.aborted()
+             ? (Dispatch(DirectiveSlice::Actions::DirectiveRunFailed(
+                    RunId, AbortError)),
+                RejectAsync<FAgentResponse>(AbortError))
+         : Turn >= 12
              ? (Dispatch(DirectiveSlice::Actions::DirectiveRunFailed(
                     RunId, TEXT("Max turns exceeded"))),
                 RejectAsync<FAgentResponse>(
@@ -285,7 +306,8 @@ RunProtocolTurn(const FString &NpcId, const FString &Input,
     Request.bHasLastResult = bHasLastResult;
 
     return func::AsyncChain::then<FNPCProcessResponse, FAgentResponse>(
-               APISlice::Endpoints::postNpcProcess(NpcId, Request)(Dispatch,
+               APISlice::Endpoints::postNpcProcess(NpcId, Request,
+                                                   Runtime.Signal)(Dispatch,
                                                                    GetState),
                [NpcId, Input, RunId, Tape, Turn, Runtime, Dispatch,
                 GetState](const FNPCProcessResponse &Response)
@@ -330,25 +352,42 @@ RunProtocolTurn(const FString &NpcId, const FString &Input,
   }();
 }
 
+/**
+ * Stores every memory instruction of a finalize step, up to
+ * MemoryPersistConcurrency at a time. Embedding dominates each store, so the
+ * items overlap on worker threads instead of running back to back.
+ * User Story: As protocol finalization, I need memory writes fanned out so a
+ * verdict with several memories does not add their latencies together.
+ */
 inline func::AsyncResult<rtk::FEmptyPayload>
 PersistMemoryInstructions(const TArray<FMemoryStoreInstruction> &Instructions,
-                          int32 Index, const FProtocolRuntime &Runtime,
+                          const FProtocolRuntime &Runtime,
                           std::function<AnyAction(const AnyAction &)> Dispatch,
                           std::function<FStoreState()> GetState) {
-  return Index >= Instructions.Num()
+  return Instructions.Num() == 0
              ? ResolveAsync(rtk::FEmptyPayload{})
          : !Runtime.StoreMemory
              ? RejectAsync<rtk::FEmptyPayload>(
                    TEXT("API returned memoryStore instructions, but no memory "
                         "engine is configured"))
-             : func::AsyncChain::then<FMemoryItem, rtk::FEmptyPayload>(
-                   Runtime.StoreMemory(MakeMemoryItem(Instructions[Index]))(
-                       Dispatch, GetState),
-                   [Instructions, Index, Runtime, Dispatch,
-                    GetState](const FMemoryItem &Stored) {
-                     return PersistMemoryInstructions(Instructions, Index + 1,
-                                                      Runtime, Dispatch,
-                                                      GetState);
+             : func::AsyncChain::then<std::vector<FMemoryItem>,
+                                      rtk::FEmptyPayload>(
+                   func::mapConcurrent(
+                       std::vector<FMemoryStoreInstruction>(
+                           Instructions.GetData(),
+                           Instructions.GetData() + Instructions.Num()),
+                       MemoryPersistConcurrency,
+                       [Runtime, Dispatch, GetState](
+                           const FMemoryStoreInstruction &Instruction,
+                           const func::AbortSignal &Signal) {
+                         return func::abortable(
+                             Runtime.StoreMemory(MakeMemoryItem(Instruction))(
+                                 Dispatch, GetState),
+                             Signal);
+                       },
+                       Runtime.Signal),
+                   [](const std::vector<FMemoryItem> &) {
+                     return ResolveAsync(rtk::FEmptyPayload{});
                    });
 }
 
@@ -0,0 +1,261 @@
+#pragma once
+
+#include "Bridge/BridgeTypes.h"
+#include "Core/functional_core.hpp"
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "RuntimeAsyncActions.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FForbocAIAsyncTextPin,
+                                             const FString &, Result,
+                                             const FString &, Error);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FForbocAIAsyncValidationPin,
+                                             const FValidationResult &, Result,
+                                             const FString &, Error);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FForbocAIAsyncCancelledPin);
+
+/**
+ * Base for latent ForbocAI Blueprint nodes.
+ * Each node dispatches its thunk on Activate and fires exactly one of its
+ * outcome pins on the game thread; the game thread never waits.
+ * User Story: As a Blueprint integrator, I need non-blocking SDK nodes so
+ * network and inference calls do not freeze gameplay.
+ */
+UCLASS(Abstract)
+class FORBOCAI_SDK_API UForbocAIAsyncAction : public UBlueprintAsyncActionBase {
+  GENERATED_BODY()
+
+public:
+  /**
+   * Fires when Cancel is called before the operation finished.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY(BlueprintAssignable)
+  FForbocAIAsyncCancelledPin OnCancelled;
+
+  /**
+   * Stops the node from delivering a result and aborts its signal, which
+   * stops the HTTP request or native generation it started where the call
+   * takes one. Any outcome that still arrives is discarded.
+   * User Story: As Blueprint gameplay flows, I need to cancel a pending node
+   * so abandoned conversations do not fire late callbacks.
+   */
+  UFUNCTION(BlueprintCallable, Category = "ForbocAI|Async")
+  void Cancel();
+
+  /**
+   * Reports whether the node is still waiting for its outcome.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UFUNCTION(BlueprintPure, Category = "ForbocAI|Async")
+  bool IsPending() const;
+
+  /**
+   * Claims the single outcome slot; false once finished or cancelled.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  bool TryFinish();
+
+  /**
+   * Signal Activate hands to the node's request; Cancel aborts it.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  const func::AbortSignal &GetAbortSignal() const { return Abort.signal; }
+
+protected:
+  bool bFinished = false;
+
+private:
+  func::AbortController Abort = func::createAbortController();
+};
+
+/**
+ * Base for latent nodes whose outcome is a single string.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+UCLASS(Abstract)
+class FORBOCAI_SDK_API UForbocAIAsyncTextAction : public UForbocAIAsyncAction {
+  GENERATED_BODY()
+
+public:
+  UPROPERTY(BlueprintAssignable)
+  FForbocAIAsyncTextPin OnSuccess;
+
+  UPROPERTY(BlueprintAssignable)
+  FForbocAIAsyncTextPin OnFailure;
+
+  void Succeed(const FString &Result);
+  void Fail(const FString &Error);
+
+protected:
+  /**
+   * Watches the stubbed result when one is set; false leaves Activate to
+   * dispatch its real request.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  bool WatchStubbedResult();
+
+private:
+  /**
+   * Node tests set ResultStub so the next Activate watches a canned result
+   * instead of dispatching its request. The stub receives the node's abort
+   * signal, as the real request would.
+   * User Story: As node tests, I need Activate driven by a canned result so
+   * pin delivery can be checked without a live API.
+   */
+  friend struct FForbocAIAsyncActionTestAccess;
+
+  TFunction<func::AsyncResult<FString>(const func::AbortSignal &)> ResultStub;
+};
+
+/**
+ * Latent ProcessNpc: runs a protocol turn and returns the dialogue.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+UCLASS()
+class FORBOCAI_SDK_API UForbocAIProcessNpcAsync
+    : public UForbocAIAsyncTextAction {
+  GENERATED_BODY()
+
+public:
+  UFUNCTION(BlueprintCallable, Category = "ForbocAI|NPC",
+            meta = (BlueprintInternalUseOnly = "true",
+                    WorldContext = "WorldContextObject",
+                    DisplayName = "Process NPC (Async)"))
+  static UForbocAIProcessNpcAsync *ProcessNpcAsync(UObject *WorldContextObject,
+                                                   const FString &NpcId,
+                                                   const FString &Text);
+
+  virtual void Activate() override;
+
+private:
+  FString NpcId;
+  FString Text;
+};
+
+/**
+ * Latent ChatNpc: sends a chat message and returns the dialogue.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+UCLASS()
+class FORBOCAI_SDK_API UForbocAIChatNpcAsync : public UForbocAIAsyncTextAction {
+  GENERATED_BODY()
+
+public:
+  UFUNCTION(BlueprintCallable, Category = "ForbocAI|NPC",
+            meta = (BlueprintInternalUseOnly = "true",
+                    WorldContext = "WorldContextObject",
+                    DisplayName = "Chat With NPC (Async)"))
+  static UForbocAIChatNpcAsync *ChatNpcAsync(UObject *WorldContextObject,
+                                             const FString &NpcId,
+                                             const FString &Message);
+
+  virtual void Activate() override;
+
+private:
+  FString NpcId;
+  FString Message;
+};
+
+/**
+ * Latent ExportSoul: exports an NPC soul and returns the transaction id.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+UCLASS()
+class FORBOCAI_SDK_API UForbocAIExportSoulAsync
+    : public UForbocAIAsyncTextAction {
+  GENERATED_BODY()
+
+public:
+  UFUNCTION(BlueprintCallable, Category = "ForbocAI|Soul",
+            meta = (BlueprintInternalUseOnly = "true",
+                    WorldContext = "WorldContextObject",
+                    DisplayName = "Export Soul (Async)"))
+  static UForbocAIExportSoulAsync *ExportSoulAsync(UObject *WorldContextObject,
+                                                   const FString &NpcId);
+
+  virtual void Activate() override;
+
+private:
+  FString NpcId;
+};
+
+/**
+ * Latent ImportSoul: imports a soul and returns the soul id.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+UCLASS()
+class FORBOCAI_SDK_API UForbocAIImportSoulAsync
+    : public UForbocAIAsyncTextAction {
+  GENERATED_BODY()
+
+public:
+  UFUNCTION(BlueprintCallable, Category = "ForbocAI|Soul",
+            meta = (BlueprintInternalUseOnly = "true",
+                    WorldContext = "WorldContextObject",
+                    DisplayName = "Import Soul (Async)"))
+  static UForbocAIImportSoulAsync *ImportSoulAsync(UObject *WorldContextObject,
+                                                   const FString &TxId);
+
+  virtual void Activate() override;
+
+private:
+  FString TxId;
+};
+
+/**
+ * Latent GhostRun: starts a ghost session and returns the session id.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+UCLASS()
+class FORBOCAI_SDK_API UForbocAIGhostRunAsync : public UForbocAIAsyncTextAction {
+  GENERATED_BODY()
+
+public:
+  UFUNCTION(BlueprintCallable, Category = "ForbocAI|Ghost",
+            meta = (BlueprintInternalUseOnly = "true",
+                    WorldContext = "WorldContextObject",
+                    DisplayName = "Ghost Run (Async)"))
+  static UForbocAIGhostRunAsync *GhostRunAsync(UObject *WorldContextObject,
+                                               const FString &TestSuite,
+                                               int32 Duration = 300);
+
+  virtual void Activate() override;
+
+private:
+  FString TestSuite;
+  int32 Duration = 300;
+};
+
+/**
+ * Latent ValidateBridgeAction: validates a raw JSON action.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+UCLASS()
+class FORBOCAI_SDK_API UForbocAIValidateBridgeActionAsync
+    : public UForbocAIAsyncAction {
+  GENERATED_BODY()
+
+public:
+  UPROPERTY(BlueprintAssignable)
+  FForbocAIAsyncValidationPin OnSuccess;
+
+  UPROPERTY(BlueprintAssignable)
+  FForbocAIAsyncValidationPin OnFailure;
+
+  UFUNCTION(BlueprintCallable, Category = "ForbocAI|Bridge",
+            meta = (BlueprintInternalUseOnly = "true",
+                    WorldContext = "WorldContextObject",
+                    DisplayName = "Validate Bridge Action (Async)"))
+  static UForbocAIValidateBridgeActionAsync *
+  ValidateBridgeActionAsync(UObject *WorldContextObject,
+                            const FString &ActionJson);
+
+  virtual void Activate() override;
+
+  void Succeed(const FValidationResult &Result);
+  void Fail(const FString &Error);
+
+private:
+  FString ActionJson;
+};
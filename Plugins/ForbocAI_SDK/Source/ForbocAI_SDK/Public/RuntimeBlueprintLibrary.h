@@ -7,7 +7,9 @@
 
 /**
  * Blueprint-callable wrappers around Ops.
- * Exposes the core ForbocAI operations to Blueprints.
+ * Exposes the core ForbocAI operations to Blueprints. Network and inference
+ * calls here block until they finish; gameplay graphs should use the latent
+ * nodes in RuntimeAsyncActions.h instead.
  * User Story: As a Blueprint integrator, I need this API note so I can call the SDK surface correctly from Unreal gameplay code.
  */
 UCLASS()
@@ -1,14 +1,20 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Core/functional_core.hpp"
+#include "Cortex/CortexTypes.h"
+#include "Cortex/ModelVariants.h"
 #include "Dom/JsonObject.h"
 #include "HAL/FileManager.h"
 #include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include <atomic>
+#include <mutex>
 
 #if PLATFORM_MAC || PLATFORM_UNIX
 #include <sys/stat.h>
@@ -17,6 +23,8 @@
 /**
  * SDK Configuration — env var > config file > defaults precedence.
  * Equivalent to TS nodeConfig.ts plus CLI config persistence in sdkOps.ts.
+ * Resolved config is published as an immutable snapshot: readers take one
+ * atomic load, and file/env access only happens when a snapshot is built.
  * User Story: As an SDK integrator, I need this type or module note so I can understand the role of the surrounding API surface quickly.
  */
 namespace SDKConfig {
@@ -29,99 +37,835 @@ inline constexpr TCHAR DEFAULT_API_URL[] = TEXT("http://localhost:8080");
 inline constexpr TCHAR PRODUCTION_API_URL[] = TEXT("https://api.forboc.ai");
 inline constexpr int32 DEFAULT_VECTOR_DIMENSION = 384;
 inline constexpr int32 DEFAULT_MAX_RECALL_RESULTS = 10;
+inline constexpr int32 MAX_VECTOR_DIMENSION = 4096;
+inline constexpr int32 MAX_RECALL_RESULTS_LIMIT = 1000;
+inline constexpr int32 DEFAULT_MEMORY_READ_CONNECTIONS = 4;
+inline constexpr int32 MAX_MEMORY_READ_CONNECTIONS = 32;
+inline constexpr TCHAR DEFAULT_THREADING_KEY[] = TEXT("default");
+inline constexpr float DEFAULT_WATCH_INTERVAL_SECONDS = 1.0f;
+inline constexpr double SNAPSHOT_RETIRE_GRACE_SECONDS = 30.0;
 
 /**
- * Returns the mutable storage backing the configured API URL.
- * User Story: As config loading and override helpers, I need shared URL
- * storage so disk, environment, and runtime writes update one source of truth.
+ * Facade store-sync modes: "direct" skips store updates, "batched" applies
+ * them once per frame, "store" dispatches them as each call runs.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+inline constexpr TCHAR FACADE_SYNC_DIRECT[] = TEXT("direct");
+inline constexpr TCHAR FACADE_SYNC_BATCHED[] = TEXT("batched");
+inline constexpr TCHAR FACADE_SYNC_STORE[] = TEXT("store");
+
+/**
+ * Memory vector storage modes: "float" keeps fp32 vectors, "int8" and
+ * "binary" store quantized vectors and re-rank from a cold fp32 table.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+inline constexpr TCHAR VECTOR_STORAGE_FLOAT[] = TEXT("float");
+inline constexpr TCHAR VECTOR_STORAGE_INT8[] = TEXT("int8");
+inline constexpr TCHAR VECTOR_STORAGE_BINARY[] = TEXT("binary");
+
+/**
+ * Memory recall scoring modes: "similarity" ranks by vector distance,
+ * "weighted" by similarity x importance x recency, "mmr" by maximal marginal
+ * relevance over the weighted score. Recency decays as exp(-age / tau).
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
+ */
+inline constexpr TCHAR RECALL_SCORING_SIMILARITY[] = TEXT("similarity");
+inline constexpr TCHAR RECALL_SCORING_WEIGHTED[] = TEXT("weighted");
+inline constexpr TCHAR RECALL_SCORING_MMR[] = TEXT("mmr");
+inline constexpr double DEFAULT_MEMORY_RECENCY_TAU_SECONDS = 604800.0;
+inline constexpr float DEFAULT_MEMORY_MMR_LAMBDA = 0.7f;
+
+/**
+ * Immutable, fully resolved and validated configuration.
+ * User Story: As hot-path config readers (HTTP requests, memory operations), I
+ * need one consistent value read without locks, file access or env lookups.
  */
-inline FString &ApiUrlStorage() {
-  static FString Value = DEFAULT_API_URL;
+struct FSDKConfigSnapshot {
+  FString ApiUrl;
+  FString ApiKey;
+  FString ModelPath;
+  FString DatabasePath;
+  int32 VectorDimension;
+  int32 MaxRecallResults;
+  FString ModelQuant;
+  int32 ModelMemoryBudgetMb;
+  int32 MemoryReadConnections;
+  FString MemoryVectorStorage;
+  FString MemoryRecallScoring;
+  double MemoryRecencyTauSeconds;
+  float MemoryMmrLambda;
+  FString FacadeStoreSync;
+  FString StoreSnapshotSlot;
+  TMap<FString, FCortexThreadingConfig> Threading;
+
+  /** Config file this snapshot was read from, and its stamp at read time. */
+  FString SourcePath;
+  FDateTime SourceTimestamp;
+  int64 SourceSize;
+
+  /** Increments on every publish; lets callers detect config changes. */
+  uint64 Generation;
+
+  /** Problems found while validating; offending fields fell back to defaults. */
+  TArray<FString> ValidationErrors;
+
+  /** The file and environment share of ValidationErrors; override publishes
+   * restart from it so re-validation never repeats an error. */
+  TArray<FString> SourceValidationErrors;
+
+  FSDKConfigSnapshot()
+      : ApiUrl(DEFAULT_API_URL), VectorDimension(DEFAULT_VECTOR_DIMENSION),
+        MaxRecallResults(DEFAULT_MAX_RECALL_RESULTS), ModelMemoryBudgetMb(0),
+        MemoryReadConnections(DEFAULT_MEMORY_READ_CONNECTIONS),
+        MemoryVectorStorage(VECTOR_STORAGE_FLOAT),
+        MemoryRecallScoring(RECALL_SCORING_SIMILARITY),
+        MemoryRecencyTauSeconds(DEFAULT_MEMORY_RECENCY_TAU_SECONDS),
+        MemoryMmrLambda(DEFAULT_MEMORY_MMR_LAMBDA),
+        FacadeStoreSync(FACADE_SYNC_DIRECT),
+        SourceTimestamp(FDateTime::MinValue()), SourceSize(-1),
+        Generation(0) {}
+};
+
+/**
+ * In-process overrides layered on top of file and environment values. They
+ * survive watcher reloads and are cleared by an explicit ReloadConfig.
+ * User Story: As runtime override flows, I need values set from code to stick
+ * when the config file changes underneath a running game.
+ */
+struct FSDKConfigOverrides {
+  func::Maybe<FString> ApiUrl;
+  func::Maybe<FString> ApiKey;
+  func::Maybe<FString> FacadeStoreSync;
+  TMap<FString, FCortexThreadingConfig> Threading;
+
+  FSDKConfigOverrides()
+      : ApiUrl(func::nothing<FString>()), ApiKey(func::nothing<FString>()),
+        FacadeStoreSync(func::nothing<FString>()) {}
+};
+
+/**
+ * Returns the optional config-path override used by tests and tooling.
+ * User Story: As tests and CLI tooling, I need an override slot so config I/O
+ * can target a temporary file instead of the user default path.
+ */
+inline FString &ConfigFilePathOverrideStorage() {
+  static FString Value;
   return Value;
 }
 
 /**
- * Returns the mutable storage backing the configured API key.
- * User Story: As config loading and override helpers, I need shared API key
- * storage so every config source reads and writes the same secret value.
+ * Overrides the config file path used for subsequent disk reads and writes.
+ * User Story: As tests and tooling, I need to redirect config I/O so I can
+ * isolate runs from the user's real config file.
  */
-inline FString &ApiKeyStorage() {
-  static FString Value = TEXT("");
-  return Value;
+inline void SetConfigFilePathOverride(const FString &ConfigFilePath) {
+  ConfigFilePathOverrideStorage() = ConfigFilePath;
 }
 
 /**
- * Returns the mutable storage backing the configured model path.
- * User Story: As local model configuration, I need shared path storage so
- * runtime code and tooling resolve the same model location.
+ * Resolves the home directory from environment variables with project fallback.
+ * User Story: As config path helpers, I need a home directory resolver so
+ * config file location can be determined across platforms.
  */
-inline FString &ModelPathStorage() {
-  static FString Value = TEXT("");
-  return Value;
+inline FString ResolveHomeDir() {
+  const FString Home = FPlatformMisc::GetEnvironmentVariable(TEXT("HOME"));
+  const FString Profile =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("USERPROFILE"));
+  return !Home.IsEmpty()
+      ? Home
+      : (!Profile.IsEmpty() ? Profile : FPaths::ProjectDir());
 }
 
 /**
- * Returns the mutable storage backing the configured database path.
- * User Story: As memory persistence configuration, I need shared database path
- * storage so local memory features point at the same file.
+ * Resolves the config file path, honoring any explicit override first.
+ * User Story: As config file helpers, I need the effective path so reads and
+ * writes target the correct config location.
  */
-inline FString &DatabasePathStorage() {
-  static FString Value = TEXT("");
-  return Value;
+inline FString GetConfigFilePath() {
+  return !ConfigFilePathOverrideStorage().IsEmpty()
+      ? ConfigFilePathOverrideStorage()
+      : FPaths::Combine(ResolveHomeDir(), TEXT(".forbocai.json"));
 }
 
 /**
- * Returns the mutable storage backing the configured embedding width.
- * User Story: As embedding configuration, I need shared vector dimension
- * storage so recall and indexing use the same width.
+ * Loads the raw config JSON object from disk, or an empty object when absent.
+ * User Story: As config parsing helpers, I need raw JSON config data so I can
+ * populate in-memory settings from persisted values.
  */
-inline int32 &VectorDimensionStorage() {
-  static int32 Value = DEFAULT_VECTOR_DIMENSION;
-  return Value;
+inline TSharedPtr<FJsonObject> LoadConfigJsonObject() {
+  const FString ConfigPath = GetConfigFilePath();
+  FString JsonString;
+  return !FFileHelper::LoadFileToString(JsonString, *ConfigPath)
+      ? MakeShared<FJsonObject>()
+      : [&JsonString]() {
+          TSharedPtr<FJsonObject> JsonObject;
+          const TSharedRef<TJsonReader<>> Reader =
+              TJsonReaderFactory<>::Create(JsonString);
+          return (FJsonSerializer::Deserialize(Reader, JsonObject) &&
+                  JsonObject.IsValid())
+              ? JsonObject
+              : MakeShared<FJsonObject>();
+        }();
 }
 
 /**
- * Returns the mutable storage backing the configured recall limit.
- * User Story: As recall configuration, I need shared limit storage so default
- * recall behavior stays consistent across runtime entry points.
+ * Persists a raw config JSON object to disk with restricted file permissions.
+ * User Story: As config persistence flows, I need a safe write helper so
+ * resolved settings can be saved with private file permissions when possible.
  */
-inline int32 &MaxRecallResultsStorage() {
-  static int32 Value = DEFAULT_MAX_RECALL_RESULTS;
-  return Value;
+inline bool WriteConfigJsonObject(const TSharedRef<FJsonObject> &JsonObject) {
+  const FString ConfigPath = GetConfigFilePath();
+  const FString Directory = FPaths::GetPath(ConfigPath);
+  !Directory.IsEmpty()
+      ? (IFileManager::Get().MakeDirectory(*Directory, true), void())
+      : void();
+
+  FString JsonString;
+  const TSharedRef<TJsonWriter<>> Writer =
+      TJsonWriterFactory<>::Create(&JsonString);
+  FJsonSerializer::Serialize(JsonObject, Writer);
+
+  const bool bSaved = FFileHelper::SaveStringToFile(JsonString, *ConfigPath);
+#if PLATFORM_MAC || PLATFORM_UNIX
+  bSaved ? (void)chmod(TCHAR_TO_UTF8(*ConfigPath), 0600) : (void)0;
+#endif
+  return bSaved;
 }
 
 /**
- * Returns the initialization flag used to guard lazy config loading.
- * User Story: As lazy config access, I need a shared initialized flag so
- * getters can avoid reloading config on every call.
+ * Parses a NUMA strategy name as used in config files and env vars.
+ * User Story: As config parsing, I need NUMA names mapped to the enum so file
+ * and environment values resolve to the same strategy.
  */
-inline bool &InitializedStorage() {
-  static bool bInitialized = false;
-  return bInitialized;
+inline ECortexNumaStrategy ParseNumaStrategy(const FString &Name) {
+  return Name.Equals(TEXT("distribute"), ESearchCase::IgnoreCase)
+             ? ECortexNumaStrategy::Distribute
+         : Name.Equals(TEXT("isolate"), ESearchCase::IgnoreCase)
+             ? ECortexNumaStrategy::Isolate
+         : Name.Equals(TEXT("numactl"), ESearchCase::IgnoreCase)
+             ? ECortexNumaStrategy::Numactl
+         : Name.Equals(TEXT("mirror"), ESearchCase::IgnoreCase)
+             ? ECortexNumaStrategy::Mirror
+             : ECortexNumaStrategy::Disabled;
 }
 
 /**
- * Returns the optional config-path override used by tests and tooling.
- * User Story: As tests and CLI tooling, I need an override slot so config I/O
- * can target a temporary file instead of the user default path.
+ * Returns the config-file name of a NUMA strategy.
+ * User Story: As config persistence, I need NUMA strategies written as names
+ * so saved files stay readable and round-trip through ParseNumaStrategy.
  */
-inline FString &ConfigFilePathOverrideStorage() {
-  static FString Value;
+inline FString NumaStrategyName(ECortexNumaStrategy Strategy) {
+  return Strategy == ECortexNumaStrategy::Distribute ? TEXT("distribute")
+         : Strategy == ECortexNumaStrategy::Isolate  ? TEXT("isolate")
+         : Strategy == ECortexNumaStrategy::Numactl  ? TEXT("numactl")
+         : Strategy == ECortexNumaStrategy::Mirror   ? TEXT("mirror")
+                                                     : TEXT("disabled");
+}
+
+/**
+ * Collects integer core ids from a JSON array.
+ * User Story: As config parsing, I need affinity arrays read without loops so
+ * threading entries follow the same recursive style as the rest of the SDK.
+ */
+inline TArray<int32>
+CoreIdsFromJsonRecursive(const TArray<TSharedPtr<FJsonValue>> &Values,
+                         int32 Index, TArray<int32> Acc) {
+  return Index >= Values.Num()
+             ? Acc
+             : CoreIdsFromJsonRecursive(
+                   Values, Index + 1,
+                   (Values[Index].IsValid()
+                        ? (void)Acc.Add(
+                              static_cast<int32>(Values[Index]->AsNumber()))
+                        : (void)0,
+                    Acc));
+}
+
+/**
+ * Reads one threading entry; missing fields keep the supplied base values.
+ * User Story: As config parsing, I need partial threading entries merged onto
+ * a base so files only list the knobs they change.
+ */
+inline FCortexThreadingConfig
+ThreadingFromJson(const TSharedPtr<FJsonObject> &J,
+                  FCortexThreadingConfig Base) {
+  int32 I = 0;
+  bool B = false;
+  FString S;
+  const TArray<TSharedPtr<FJsonValue>> *Cores = nullptr;
+  return !J.IsValid()
+             ? Base
+             : (J->TryGetNumberField(TEXT("threads"), I)
+                    ? (void)(Base.Threads = I) : (void)0,
+                J->TryGetNumberField(TEXT("batchThreads"), I)
+                    ? (void)(Base.BatchThreads = I) : (void)0,
+                J->TryGetNumberField(TEXT("poll"), I)
+                    ? (void)(Base.PollLevel = I) : (void)0,
+                J->TryGetBoolField(TEXT("strictAffinity"), B)
+                    ? (void)(Base.bStrictAffinity = B) : (void)0,
+                J->TryGetBoolField(TEXT("sharedPool"), B)
+                    ? (void)(Base.bSharedPool = B) : (void)0,
+                J->TryGetStringField(TEXT("numa"), S)
+                    ? (void)(Base.Numa = ParseNumaStrategy(S)) : (void)0,
+                J->TryGetArrayField(TEXT("affinity"), Cores)
+                    ? (void)(Base.AffinityCores = CoreIdsFromJsonRecursive(
+                                 *Cores, 0, TArray<int32>()))
+                    : (void)0,
+                Base);
+}
+
+/**
+ * Serializes one threading entry for the config file.
+ * User Story: As config persistence, I need threading entries written in the
+ * same shape they are read so SaveToConfigFile round-trips cleanly.
+ */
+inline TSharedRef<FJsonObject>
+ThreadingToJson(const FCortexThreadingConfig &Config) {
+  const TSharedRef<FJsonObject> J = MakeShared<FJsonObject>();
+  J->SetNumberField(TEXT("threads"), Config.Threads);
+  J->SetNumberField(TEXT("batchThreads"), Config.BatchThreads);
+  J->SetNumberField(TEXT("poll"), Config.PollLevel);
+  J->SetBoolField(TEXT("strictAffinity"), Config.bStrictAffinity);
+  J->SetBoolField(TEXT("sharedPool"), Config.bSharedPool);
+  J->SetStringField(TEXT("numa"), NumaStrategyName(Config.Numa));
+  struct CoresHelper {
+    static TArray<TSharedPtr<FJsonValue>>
+    apply(const TArray<int32> &Cores, int32 Index,
+          TArray<TSharedPtr<FJsonValue>> Acc) {
+      return Index >= Cores.Num()
+                 ? Acc
+                 : (Acc.Add(MakeShared<FJsonValueNumber>(Cores[Index])),
+                    apply(Cores, Index + 1, Acc));
+    }
+  };
+  J->SetArrayField(TEXT("affinity"),
+                   CoresHelper::apply(Config.AffinityCores, 0,
+                                      TArray<TSharedPtr<FJsonValue>>()));
+  return J;
+}
+
+/**
+ * Applies persisted JSON config values onto a snapshot under construction.
+ * User Story: As local config loading, I need persisted settings applied so
+ * runtime defaults can be overridden by the saved config file.
+ */
+inline void ApplyConfigFile(FSDKConfigSnapshot &Out,
+                            const TSharedPtr<FJsonObject> &J) {
+  !J.IsValid()
+      ? void()
+      : [&Out, &J]() {
+          FString S;
+          (J->TryGetStringField(TEXT("apiUrl"), S) && !S.IsEmpty())
+              ? (void)(Out.ApiUrl = S) : (void)0;
+          (J->TryGetStringField(TEXT("apiKey"), S) && !S.IsEmpty())
+              ? (void)(Out.ApiKey = S) : (void)0;
+          (J->TryGetStringField(TEXT("modelPath"), S) && !S.IsEmpty())
+              ? (void)(Out.ModelPath = S) : (void)0;
+          (J->TryGetStringField(TEXT("databasePath"), S) && !S.IsEmpty())
+              ? (void)(Out.DatabasePath = S) : (void)0;
+          int32 I = 0;
+          J->TryGetNumberField(TEXT("vectorDimension"), I)
+              ? (void)(Out.VectorDimension = I) : (void)0;
+          J->TryGetNumberField(TEXT("maxRecallResults"), I)
+              ? (void)(Out.MaxRecallResults = I) : (void)0;
+          (J->TryGetStringField(TEXT("modelQuant"), S) && !S.IsEmpty())
+              ? (void)(Out.ModelQuant = S) : (void)0;
+          J->TryGetNumberField(TEXT("modelMemoryBudgetMb"), I)
+              ? (void)(Out.ModelMemoryBudgetMb = I) : (void)0;
+          J->TryGetNumberField(TEXT("memoryReadConnections"), I)
+              ? (void)(Out.MemoryReadConnections = I) : (void)0;
+          (J->TryGetStringField(TEXT("memoryVectorStorage"), S) &&
+           !S.IsEmpty())
+              ? (void)(Out.MemoryVectorStorage = S) : (void)0;
+          (J->TryGetStringField(TEXT("memoryRecallScoring"), S) &&
+           !S.IsEmpty())
+              ? (void)(Out.MemoryRecallScoring = S) : (void)0;
+          double D = 0.0;
+          J->TryGetNumberField(TEXT("memoryRecencyTauSeconds"), D)
+              ? (void)(Out.MemoryRecencyTauSeconds = D) : (void)0;
+          J->TryGetNumberField(TEXT("memoryMmrLambda"), D)
+              ? (void)(Out.MemoryMmrLambda = static_cast<float>(D)) : (void)0;
+          (J->TryGetStringField(TEXT("facadeStoreSync"), S) && !S.IsEmpty())
+              ? (void)(Out.FacadeStoreSync = S) : (void)0;
+          J->TryGetStringField(TEXT("storeSnapshotSlot"), S)
+              ? (void)(Out.StoreSnapshotSlot = S) : (void)0;
+
+          /**
+           * "threading": { "default": {...}, "<model>": {...} }. Model
+           * entries inherit unspecified fields from the default entry.
+           * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+           */
+          const TSharedPtr<FJsonObject> *Threading = nullptr;
+          J->TryGetObjectField(TEXT("threading"), Threading) && Threading &&
+                  Threading->IsValid()
+              ? [&Out, &Threading]() {
+                  const TSharedPtr<FJsonObject> *DefaultJson = nullptr;
+                  const FCortexThreadingConfig Default =
+                      (*Threading)->TryGetObjectField(DEFAULT_THREADING_KEY,
+                                                      DefaultJson)
+                          ? ThreadingFromJson(*DefaultJson,
+                                              FCortexThreadingConfig())
+                          : FCortexThreadingConfig();
+                  TArray<FString> Keys;
+                  (*Threading)->Values.GetKeys(Keys);
+                  struct EntriesHelper {
+                    static void apply(TMap<FString, FCortexThreadingConfig> &Table,
+                                      const TSharedPtr<FJsonObject> &Json,
+                                      const TArray<FString> &Keys,
+                                      int32 Index,
+                                      const FCortexThreadingConfig &Base) {
+                      Index >= Keys.Num()
+                          ? void()
+                          : [&]() {
+                              const TSharedPtr<FJsonObject> *Entry = nullptr;
+                              Json->TryGetObjectField(Keys[Index], Entry)
+                                  ? (void)Table.Add(
+                                        Keys[Index],
+                                        Keys[Index] == DEFAULT_THREADING_KEY
+                                            ? Base
+                                            : ThreadingFromJson(*Entry, Base))
+                                  : (void)0;
+                              apply(Table, Json, Keys, Index + 1, Base);
+                            }();
+                    }
+                  };
+                  EntriesHelper::apply(Out.Threading, *Threading, Keys, 0,
+                                       Default);
+                }()
+              : void();
+        }();
+}
+
+/**
+ * Applies supported FORBOCAI_* environment variables onto a snapshot.
+ * User Story: As deployment configuration, I need environment overrides to win
+ * so runtime settings can be injected without editing files.
+ */
+inline void ApplyEnvironment(FSDKConfigSnapshot &Out) {
+  const FString U =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_API_URL"));
+  const FString K =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_API_KEY"));
+  const FString M =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_MODEL_PATH"));
+  const FString D =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_DATABASE_PATH"));
+  const FString V =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_VECTOR_DIMENSION"));
+  const FString R =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_MAX_RECALL"));
+  !U.IsEmpty() ? (void)(Out.ApiUrl = U) : (void)0;
+  !K.IsEmpty() ? (void)(Out.ApiKey = K) : (void)0;
+  !M.IsEmpty() ? (void)(Out.ModelPath = M) : (void)0;
+  !D.IsEmpty() ? (void)(Out.DatabasePath = D) : (void)0;
+  !V.IsEmpty() ? (void)(Out.VectorDimension = FCString::Atoi(*V)) : (void)0;
+  !R.IsEmpty() ? (void)(Out.MaxRecallResults = FCString::Atoi(*R)) : (void)0;
+
+  const FString Q =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_MODEL_QUANT"));
+  const FString MB = FPlatformMisc::GetEnvironmentVariable(
+      TEXT("FORBOCAI_MODEL_MEMORY_BUDGET_MB"));
+  !Q.IsEmpty() ? (void)(Out.ModelQuant = Q) : (void)0;
+  !MB.IsEmpty() ? (void)(Out.ModelMemoryBudgetMb = FCString::Atoi(*MB))
+                : (void)0;
+
+  const FString RC = FPlatformMisc::GetEnvironmentVariable(
+      TEXT("FORBOCAI_MEMORY_READ_CONNECTIONS"));
+  !RC.IsEmpty() ? (void)(Out.MemoryReadConnections = FCString::Atoi(*RC))
+                : (void)0;
+  const FString VS = FPlatformMisc::GetEnvironmentVariable(
+      TEXT("FORBOCAI_MEMORY_VECTOR_STORAGE"));
+  !VS.IsEmpty() ? (void)(Out.MemoryVectorStorage = VS) : (void)0;
+  const FString RS = FPlatformMisc::GetEnvironmentVariable(
+      TEXT("FORBOCAI_MEMORY_RECALL_SCORING"));
+  !RS.IsEmpty() ? (void)(Out.MemoryRecallScoring = RS) : (void)0;
+  const FString RT = FPlatformMisc::GetEnvironmentVariable(
+      TEXT("FORBOCAI_MEMORY_RECENCY_TAU_SECONDS"));
+  !RT.IsEmpty() ? (void)(Out.MemoryRecencyTauSeconds = FCString::Atod(*RT))
+                : (void)0;
+  const FString ML = FPlatformMisc::GetEnvironmentVariable(
+      TEXT("FORBOCAI_MEMORY_MMR_LAMBDA"));
+  !ML.IsEmpty() ? (void)(Out.MemoryMmrLambda = FCString::Atof(*ML))
+                : (void)0;
+
+  const FString FS = FPlatformMisc::GetEnvironmentVariable(
+      TEXT("FORBOCAI_FACADE_STORE_SYNC"));
+  !FS.IsEmpty() ? (void)(Out.FacadeStoreSync = FS) : (void)0;
+  const FString SS = FPlatformMisc::GetEnvironmentVariable(
+      TEXT("FORBOCAI_STORE_SNAPSHOT_SLOT"));
+  !SS.IsEmpty() ? (void)(Out.StoreSnapshotSlot = SS) : (void)0;
+
+  const FString T =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_THREADS"));
+  const FString BT =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_BATCH_THREADS"));
+  const FString N =
+      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_NUMA"));
+  (!T.IsEmpty() || !BT.IsEmpty() || !N.IsEmpty())
+      ? [&]() {
+          FCortexThreadingConfig &Default =
+              Out.Threading.FindOrAdd(DEFAULT_THREADING_KEY);
+          !T.IsEmpty() ? (void)(Default.Threads = FCString::Atoi(*T))
+                       : (void)0;
+          !BT.IsEmpty() ? (void)(Default.BatchThreads = FCString::Atoi(*BT))
+                        : (void)0;
+          !N.IsEmpty() ? (void)(Default.Numa = ParseNumaStrategy(N))
+                       : (void)0;
+        }()
+      : void();
+}
+
+/**
+ * Applies in-process overrides onto a snapshot.
+ * User Story: As runtime override flows, I need code-set values to win over
+ * disk and environment so SetApiConfig behaves the same after a file reload.
+ */
+inline void ApplyOverrides(FSDKConfigSnapshot &Out,
+                           const FSDKConfigOverrides &Overrides) {
+  Overrides.ApiUrl.hasValue ? (void)(Out.ApiUrl = Overrides.ApiUrl.value)
+                            : (void)0;
+  Overrides.ApiKey.hasValue ? (void)(Out.ApiKey = Overrides.ApiKey.value)
+                            : (void)0;
+  Overrides.FacadeStoreSync.hasValue
+      ? (void)(Out.FacadeStoreSync = Overrides.FacadeStoreSync.value)
+      : (void)0;
+  Out.Threading.Append(Overrides.Threading);
+}
+
+/**
+ * Validates one threading entry, clamping invalid fields and recording why.
+ * User Story: As config validation, I need bad thread settings caught at load
+ * so native loads never see negative counts or out-of-range poll levels.
+ */
+inline FCortexThreadingConfig
+ValidateThreading(const FString &Key, FCortexThreadingConfig Config,
+                  TArray<FString> &Errors) {
+  const int32 InvalidCores = Config.AffinityCores.RemoveAll(
+      [](int32 Core) { return Core < 0; });
+  return (Config.Threads < 0
+              ? (Errors.Add(FString::Printf(
+                     TEXT("threading.%s.threads must be >= 0 (got %d)"),
+                     *Key, Config.Threads)),
+                 (void)(Config.Threads = 0))
+              : (void)0,
+          Config.BatchThreads < 0
+              ? (Errors.Add(FString::Printf(
+                     TEXT("threading.%s.batchThreads must be >= 0 (got %d)"),
+                     *Key, Config.BatchThreads)),
+                 (void)(Config.BatchThreads = 0))
+              : (void)0,
+          (Config.PollLevel < 0 || Config.PollLevel > 100)
+              ? (Errors.Add(FString::Printf(
+                     TEXT("threading.%s.poll must be 0-100 (got %d)"), *Key,
+                     Config.PollLevel)),
+                 (void)(Config.PollLevel =
+                            FMath::Clamp(Config.PollLevel, 0, 100)))
+              : (void)0,
+          InvalidCores > 0
+              ? (void)Errors.Add(FString::Printf(
+                    TEXT("threading.%s.affinity dropped %d negative core id(s)"),
+                    *Key, InvalidCores))
+              : (void)0,
+          Config);
+}
+
+/**
+ * Validates a snapshot up front. Invalid fields fall back to their defaults
+ * and each problem is recorded in ValidationErrors.
+ * User Story: As runtime consumers, I need config validated once at publish so
+ * hot paths can trust values without re-checking them on every read.
+ */
+inline void ValidateSnapshot(FSDKConfigSnapshot &Out) {
+  TArray<FString> &Errors = Out.ValidationErrors;
+  !(Out.ApiUrl.StartsWith(TEXT("http://")) ||
+    Out.ApiUrl.StartsWith(TEXT("https://")))
+      ? (Errors.Add(FString::Printf(
+             TEXT("apiUrl must start with http:// or https:// (got '%s')"),
+             *Out.ApiUrl)),
+         (void)(Out.ApiUrl = DEFAULT_API_URL))
+      : (void)0;
+  (Out.VectorDimension < 1 || Out.VectorDimension > MAX_VECTOR_DIMENSION)
+      ? (Errors.Add(FString::Printf(
+             TEXT("vectorDimension must be 1-%d (got %d)"),
+             MAX_VECTOR_DIMENSION, Out.VectorDimension)),
+         (void)(Out.VectorDimension = DEFAULT_VECTOR_DIMENSION))
+      : (void)0;
+  (Out.MaxRecallResults < 1 || Out.MaxRecallResults > MAX_RECALL_RESULTS_LIMIT)
+      ? (Errors.Add(FString::Printf(
+             TEXT("maxRecallResults must be 1-%d (got %d)"),
+             MAX_RECALL_RESULTS_LIMIT, Out.MaxRecallResults)),
+         (void)(Out.MaxRecallResults = DEFAULT_MAX_RECALL_RESULTS))
+      : (void)0;
+  Out.ModelMemoryBudgetMb < 0
+      ? (Errors.Add(FString::Printf(
+             TEXT("modelMemoryBudgetMb must be >= 0 (got %d)"),
+             Out.ModelMemoryBudgetMb)),
+         (void)(Out.ModelMemoryBudgetMb = 0))
+      : (void)0;
+  (Out.MemoryReadConnections < 0 ||
+   Out.MemoryReadConnections > MAX_MEMORY_READ_CONNECTIONS)
+      ? (Errors.Add(FString::Printf(
+             TEXT("memoryReadConnections must be 0-%d (got %d)"),
+             MAX_MEMORY_READ_CONNECTIONS, Out.MemoryReadConnections)),
+         (void)(Out.MemoryReadConnections = DEFAULT_MEMORY_READ_CONNECTIONS))
+      : (void)0;
+  !(Out.MemoryVectorStorage.Equals(VECTOR_STORAGE_FLOAT,
+                                   ESearchCase::IgnoreCase) ||
+    Out.MemoryVectorStorage.Equals(VECTOR_STORAGE_INT8,
+                                   ESearchCase::IgnoreCase) ||
+    Out.MemoryVectorStorage.Equals(VECTOR_STORAGE_BINARY,
+                                   ESearchCase::IgnoreCase))
+      ? (Errors.Add(FString::Printf(
+             TEXT("memoryVectorStorage must be 'float', 'int8' or 'binary' "
+                  "(got '%s')"),
+             *Out.MemoryVectorStorage)),
+         (void)(Out.MemoryVectorStorage = VECTOR_STORAGE_FLOAT))
+      : (void)(Out.MemoryVectorStorage = Out.MemoryVectorStorage.ToLower());
+  !(Out.MemoryRecallScoring.Equals(RECALL_SCORING_SIMILARITY,
+                                   ESearchCase::IgnoreCase) ||
+    Out.MemoryRecallScoring.Equals(RECALL_SCORING_WEIGHTED,
+                                   ESearchCase::IgnoreCase) ||
+    Out.MemoryRecallScoring.Equals(RECALL_SCORING_MMR,
+                                   ESearchCase::IgnoreCase))
+      ? (Errors.Add(FString::Printf(
+             TEXT("memoryRecallScoring must be 'similarity', 'weighted' or "
+                  "'mmr' (got '%s')"),
+             *Out.MemoryRecallScoring)),
+         (void)(Out.MemoryRecallScoring = RECALL_SCORING_SIMILARITY))
+      : (void)(Out.MemoryRecallScoring = Out.MemoryRecallScoring.ToLower());
+  Out.MemoryRecencyTauSeconds < 0.0
+      ? (Errors.Add(FString::Printf(
+             TEXT("memoryRecencyTauSeconds must be >= 0 (got %f)"),
+             Out.MemoryRecencyTauSeconds)),
+         (void)(Out.MemoryRecencyTauSeconds =
+                    DEFAULT_MEMORY_RECENCY_TAU_SECONDS))
+      : (void)0;
+  (Out.MemoryMmrLambda < 0.0f || Out.MemoryMmrLambda > 1.0f)
+      ? (Errors.Add(FString::Printf(
+             TEXT("memoryMmrLambda must be 0-1 (got %f)"),
+             Out.MemoryMmrLambda)),
+         (void)(Out.MemoryMmrLambda = DEFAULT_MEMORY_MMR_LAMBDA))
+      : (void)0;
+  !(Out.ModelQuant.IsEmpty() ||
+    Out.ModelQuant.Equals(ModelVariants::AutoPolicy,
+                          ESearchCase::IgnoreCase) ||
+    ModelVariants::FindQuant(Out.ModelQuant).hasValue)
+      ? (Errors.Add(FString::Printf(
+             TEXT("modelQuant must be empty, 'auto' or a known quant "
+                  "(got '%s')"),
+             *Out.ModelQuant)),
+         (void)(Out.ModelQuant = TEXT("")))
+      : (void)0;
+  !(Out.FacadeStoreSync.Equals(FACADE_SYNC_DIRECT, ESearchCase::IgnoreCase) ||
+    Out.FacadeStoreSync.Equals(FACADE_SYNC_BATCHED, ESearchCase::IgnoreCase) ||
+    Out.FacadeStoreSync.Equals(FACADE_SYNC_STORE, ESearchCase::IgnoreCase))
+      ? (Errors.Add(FString::Printf(
+             TEXT("facadeStoreSync must be 'direct', 'batched' or 'store' "
+                  "(got '%s')"),
+             *Out.FacadeStoreSync)),
+         (void)(Out.FacadeStoreSync = FACADE_SYNC_DIRECT))
+      : (void)(Out.FacadeStoreSync = Out.FacadeStoreSync.ToLower());
+
+  struct ThreadingHelper {
+    static void apply(TMap<FString, FCortexThreadingConfig> &Table,
+                      const TArray<FString> &Keys, int32 Index,
+                      TArray<FString> &Errors) {
+      Index >= Keys.Num()
+          ? void()
+          : (Table[Keys[Index]] =
+                 ValidateThreading(Keys[Index], Table[Keys[Index]], Errors),
+             apply(Table, Keys, Index + 1, Errors));
+    }
+  };
+  TArray<FString> Keys;
+  Out.Threading.GetKeys(Keys);
+  ThreadingHelper::apply(Out.Threading, Keys, 0, Errors);
+}
+
+/**
+ * Builds a validated snapshot from defaults, disk, environment and overrides.
+ * The file is stamped before it is read, so a write racing the read is seen
+ * as a change on the next watch check. Sources are validated before overrides
+ * so their errors can be kept apart from override errors.
+ * User Story: As config publication, I need every source resolved in one pass
+ * so a snapshot is internally consistent.
+ */
+inline FSDKConfigSnapshot BuildSnapshot(const FSDKConfigOverrides &Overrides) {
+  FSDKConfigSnapshot Out;
+  Out.SourcePath = GetConfigFilePath();
+  Out.SourceTimestamp = IFileManager::Get().GetTimeStamp(*Out.SourcePath);
+  Out.SourceSize = IFileManager::Get().FileSize(*Out.SourcePath);
+  ApplyConfigFile(Out, LoadConfigJsonObject());
+  ApplyEnvironment(Out);
+  ValidateSnapshot(Out);
+  Out.SourceValidationErrors = Out.ValidationErrors;
+  ApplyOverrides(Out, Overrides);
+  ValidateSnapshot(Out);
+  return Out;
+}
+
+/**
+ * Returns the slot holding the currently published snapshot.
+ * User Story: As hot-path config readers, I need the current snapshot behind a
+ * single atomic pointer so reads never take a lock.
+ */
+inline std::atomic<const FSDKConfigSnapshot *> &SnapshotSlot() {
+  static std::atomic<const FSDKConfigSnapshot *> Slot(nullptr);
+  return Slot;
+}
+
+/**
+ * Returns the mutex serializing snapshot builds and publishes.
+ * User Story: As config writers, I need publishes serialized so concurrent
+ * overrides and reloads cannot lose each other's changes.
+ */
+inline std::mutex &WriterMutex() {
+  static std::mutex Mutex;
+  return Mutex;
+}
+
+/**
+ * A replaced snapshot and when it stopped being current.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FRetiredSnapshot {
+  TUniquePtr<const FSDKConfigSnapshot> Snapshot;
+  double RetiredAt;
+};
+
+/**
+ * Owns the currently published snapshot. Guarded by WriterMutex.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline TUniquePtr<const FSDKConfigSnapshot> &CurrentSnapshotOwner() {
+  static TUniquePtr<const FSDKConfigSnapshot> Owner;
+  return Owner;
+}
+
+/**
+ * Owns replaced snapshots until SNAPSHOT_RETIRE_GRACE_SECONDS have passed, so
+ * a reader still holding one from before a publish is not left dangling.
+ * Guarded by WriterMutex.
+ * User Story: As lock-free config readers, I need a returned snapshot to stay
+ * valid while I use it, without every reload leaking a full copy.
+ */
+inline TArray<FRetiredSnapshot> &RetiredSnapshots() {
+  static TArray<FRetiredSnapshot> Retired;
+  return Retired;
+}
+
+/**
+ * Returns the in-process override layer. Guarded by WriterMutex.
+ * User Story: As runtime override flows, I need overrides kept apart from
+ * disk values so a watcher reload can reapply them.
+ */
+inline FSDKConfigOverrides &OverridesStorage() {
+  static FSDKConfigOverrides Value;
   return Value;
 }
 
 /**
- * Resets all in-memory config values back to their built-in defaults.
- * User Story: As config reload flows, I need a default reset step so stale
- * values do not survive before disk and environment overrides are reapplied.
+ * Whether two optional override values are both unset or hold equal strings.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline bool SameOverrideValue(const func::Maybe<FString> &A,
+                              const func::Maybe<FString> &B) {
+  return A.hasValue == B.hasValue && (!A.hasValue || A.value.Equals(B.value));
+}
+
+/**
+ * Field-wise equality for threading entries.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline bool SameThreading(const FCortexThreadingConfig &A,
+                          const FCortexThreadingConfig &B) {
+  return A.Threads == B.Threads && A.BatchThreads == B.BatchThreads &&
+         A.AffinityCores == B.AffinityCores &&
+         A.bStrictAffinity == B.bStrictAffinity &&
+         A.PollLevel == B.PollLevel && A.Numa == B.Numa &&
+         A.bSharedPool == B.bSharedPool;
+}
+
+/**
+ * Recursive helper: whether every key in Keys maps to equal entries in A and B.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline bool SameThreadingEntries(
+    const TArray<FString> &Keys,
+    const TMap<FString, FCortexThreadingConfig> &A,
+    const TMap<FString, FCortexThreadingConfig> &B, int32 Index) {
+  const FCortexThreadingConfig *Other =
+      Index < Keys.Num() ? B.Find(Keys[Index]) : nullptr;
+  return Index >= Keys.Num() ||
+         (Other && SameThreading(A.FindChecked(Keys[Index]), *Other) &&
+          SameThreadingEntries(Keys, A, B, Index + 1));
+}
+
+/**
+ * Whether two override layers would produce the same snapshot.
+ * User Story: As override publication, I need no-op overrides detected so
+ * callers that re-set the same values on every request publish nothing.
+ */
+inline bool SameOverrides(const FSDKConfigOverrides &A,
+                          const FSDKConfigOverrides &B) {
+  TArray<FString> Keys;
+  A.Threading.GetKeys(Keys);
+  return SameOverrideValue(A.ApiUrl, B.ApiUrl) &&
+         SameOverrideValue(A.ApiKey, B.ApiKey) &&
+         SameOverrideValue(A.FacadeStoreSync, B.FacadeStoreSync) &&
+         A.Threading.Num() == B.Threading.Num() &&
+         SameThreadingEntries(Keys, A.Threading, B.Threading, 0);
+}
+
+/**
+ * Publishes a snapshot and retires the previous one; caller must hold
+ * WriterMutex. Retired snapshots past their grace period are freed here.
+ * User Story: As config publication, I need new snapshots swapped in with one
+ * release store so readers see either the old or the new config, never a mix.
  */
-inline void ResetToDefaults() {
-  ApiUrlStorage() = DEFAULT_API_URL;
-  ApiKeyStorage() = TEXT("");
-  ModelPathStorage() = TEXT("");
-  DatabasePathStorage() = TEXT("");
-  VectorDimensionStorage() = DEFAULT_VECTOR_DIMENSION;
-  MaxRecallResultsStorage() = DEFAULT_MAX_RECALL_RESULTS;
+inline const FSDKConfigSnapshot &PublishLocked(FSDKConfigSnapshot Next) {
+  const FSDKConfigSnapshot *Previous =
+      SnapshotSlot().load(std::memory_order_acquire);
+  Next.Generation = Previous ? Previous->Generation + 1 : 1;
+  const bool bNewErrors =
+      Next.ValidationErrors.Num() > 0 &&
+      (!Previous || Previous->ValidationErrors != Next.ValidationErrors);
+  const double Now = FPlatformTime::Seconds();
+  RetiredSnapshots().RemoveAll([Now](const FRetiredSnapshot &Retired) {
+    return Now - Retired.RetiredAt >= SNAPSHOT_RETIRE_GRACE_SECONDS;
+  });
+  CurrentSnapshotOwner().IsValid()
+      ? (void)RetiredSnapshots().Add(
+            FRetiredSnapshot{MoveTemp(CurrentSnapshotOwner()), Now})
+      : (void)0;
+  CurrentSnapshotOwner() = MakeUnique<FSDKConfigSnapshot>(MoveTemp(Next));
+  const FSDKConfigSnapshot *Published = CurrentSnapshotOwner().Get();
+  SnapshotSlot().store(Published, std::memory_order_release);
+  bNewErrors ? [Published]() {
+    UE_LOG(LogTemp, Warning, TEXT("ForbocAI: invalid config in %s: %s"),
+           *Published->SourcePath,
+           *FString::Join(Published->ValidationErrors, TEXT("; ")));
+  }()
+             : void();
+  return *Published;
+}
+
+/**
+ * Returns the current snapshot, building the first one on demand. The
+ * reference stays valid for at least SNAPSHOT_RETIRE_GRACE_SECONDS after a
+ * newer publish; copy out what must live longer.
+ * User Story: As config consumers, I need reads to self-initialize so access
+ * works even if startup code did not initialize config explicitly.
+ */
+inline const FSDKConfigSnapshot &Snapshot() {
+  const FSDKConfigSnapshot *Current =
+      SnapshotSlot().load(std::memory_order_acquire);
+  return Current ? *Current : [&]() -> const FSDKConfigSnapshot & {
+    std::lock_guard<std::mutex> Lock(WriterMutex());
+    const FSDKConfigSnapshot *Raced =
+        SnapshotSlot().load(std::memory_order_acquire);
+    return Raced ? *Raced : PublishLocked(BuildSnapshot(OverridesStorage()));
+  }();
 }
 
 /**
@@ -129,25 +873,86 @@ inline void ResetToDefaults() {
  * User Story: As runtime startup, I need one initialization entry point so all
  * getters observe the same resolved configuration values.
  */
-inline void InitializeConfig();
+inline void InitializeConfig() { (void)Snapshot(); }
 
 /**
  * Ensures config has been loaded before a getter reads from storage.
  * User Story: As config consumers, I need getters to self-initialize so reads
  * work even if startup code did not initialize config explicitly.
  */
-inline void EnsureInitialized() {
-  !InitializedStorage() ? (InitializeConfig(), void()) : void();
-}
+inline void EnsureInitialized() { (void)Snapshot(); }
 
 /**
- * Forces config to reload from disk and environment.
+ * Forces config to reload from disk and environment, dropping in-process
+ * overrides.
  * User Story: As config mutation flows, I need a reload helper so persisted or
  * environment changes can be reflected without restarting the runtime.
  */
 inline void ReloadConfig() {
-  InitializedStorage() = false;
-  InitializeConfig();
+  std::lock_guard<std::mutex> Lock(WriterMutex());
+  OverridesStorage() = FSDKConfigOverrides();
+  PublishLocked(BuildSnapshot(OverridesStorage()));
+}
+
+/**
+ * Rebuilds and publishes a snapshot when the config file changed (path,
+ * timestamp or size) since the current one was read. Overrides are kept.
+ * Returns true when a new snapshot was published.
+ * User Story: As live config editing, I need file edits picked up without a
+ * restart so operators can repoint or re-key a running server.
+ */
+inline bool CheckForChanges() {
+  const FSDKConfigSnapshot &Current = Snapshot();
+  const FString Path = GetConfigFilePath();
+  IFileManager &FM = IFileManager::Get();
+  const bool bChanged = Path != Current.SourcePath ||
+                        FM.FileSize(*Path) != Current.SourceSize ||
+                        FM.GetTimeStamp(*Path) != Current.SourceTimestamp;
+  return bChanged ? [&]() {
+    std::lock_guard<std::mutex> Lock(WriterMutex());
+    PublishLocked(BuildSnapshot(OverridesStorage()));
+    return true;
+  }()
+                  : false;
+}
+
+/**
+ * Returns the ticker handle of the active config file watcher.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FTSTicker::FDelegateHandle &WatchHandleStorage() {
+  static FTSTicker::FDelegateHandle Handle;
+  return Handle;
+}
+
+/**
+ * Starts polling the config file on the core ticker. The stat runs once per
+ * interval on the ticking thread, never on config reads.
+ * User Story: As long-running servers, I need config edits published
+ * automatically so changes apply without a restart or an explicit reload.
+ */
+inline void StartWatching(
+    float IntervalSeconds = DEFAULT_WATCH_INTERVAL_SECONDS) {
+  !WatchHandleStorage().IsValid()
+      ? (void)(WatchHandleStorage() = FTSTicker::GetCoreTicker().AddTicker(
+                   FTickerDelegate::CreateLambda([](float) {
+                     CheckForChanges();
+                     return true;
+                   }),
+                   IntervalSeconds))
+      : (void)0;
+}
+
+/**
+ * Stops the config file watcher if running.
+ * User Story: As runtime shutdown, I need the watcher removed so no ticker
+ * outlives the subsystem that started it.
+ */
+inline void StopWatching() {
+  WatchHandleStorage().IsValid()
+      ? (FTSTicker::GetCoreTicker().RemoveTicker(WatchHandleStorage()),
+         WatchHandleStorage().Reset(), void())
+      : void();
 }
 
 /**
@@ -155,232 +960,294 @@ inline void ReloadConfig() {
  * User Story: As networked SDK features, I need the resolved API URL so all
  * requests target the current environment.
  */
-inline FString GetApiUrl() {
-  EnsureInitialized();
-  return ApiUrlStorage();
-}
+inline const FString &GetApiUrl() { return Snapshot().ApiUrl; }
 
 /**
  * Returns the active API key.
  * User Story: As authenticated SDK requests, I need the resolved API key so
  * outbound calls can include the current credential.
  */
-inline FString GetApiKey() {
-  EnsureInitialized();
-  return ApiKeyStorage();
-}
+inline const FString &GetApiKey() { return Snapshot().ApiKey; }
 
 /**
  * Returns the configured local model path.
  * User Story: As local inference setup, I need the resolved model path so the
  * runtime can load the configured on-device model.
  */
-inline FString GetModelPath() {
-  EnsureInitialized();
-  return ModelPathStorage();
-}
+inline const FString &GetModelPath() { return Snapshot().ModelPath; }
 
 /**
  * Returns the configured local database path.
  * User Story: As local memory storage, I need the resolved database path so
  * persistence code opens the intended datastore.
  */
-inline FString GetDatabasePath() {
-  EnsureInitialized();
-  return DatabasePathStorage();
-}
+inline const FString &GetDatabasePath() { return Snapshot().DatabasePath; }
 
 /**
  * Returns the configured vector dimension for local memory embeddings.
  * User Story: As embedding-backed recall flows, I need the resolved dimension
  * so vector operations use the correct width.
  */
-inline int32 GetVectorDimension() {
-  EnsureInitialized();
-  return VectorDimensionStorage();
-}
+inline int32 GetVectorDimension() { return Snapshot().VectorDimension; }
 
 /**
  * Returns the configured default recall limit.
  * User Story: As memory recall flows, I need the resolved default limit so
  * callers can cap results consistently when no explicit limit is provided.
  */
-inline int32 GetMaxRecallResults() {
-  EnsureInitialized();
-  return MaxRecallResultsStorage();
-}
+inline int32 GetMaxRecallResults() { return Snapshot().MaxRecallResults; }
 
 /**
- * Returns the SDK version string baked into the plugin build.
- * User Story: As diagnostics and tooling, I need the runtime SDK version so I
- * can report which plugin build is running.
+ * Returns the configured model quantization policy: empty keeps each model's
+ * default variant, "auto" selects by host capabilities, and a quant name
+ * (Q4_K_M, Q8_0, ...) pins that variant.
+ * User Story: As local model bootstrap, I need the resolved quant policy so
+ * the variant manager downloads or builds the intended GGUF.
  */
-inline FString GetSdkVersion() { return TEXT("0.6.3"); }
+inline const FString &GetModelQuant() { return Snapshot().ModelQuant; }
 
 /**
- * Updates the in-memory API URL and API key overrides.
- * User Story: As runtime override flows, I need to swap API connection values
- * in memory so subsequent requests use the new endpoint and credential.
+ * Returns the configured model memory budget in MiB; zero means half of the
+ * host's available physical memory.
+ * User Story: As auto variant selection, I need the resolved memory budget so
+ * quant choice respects the host's configured headroom.
  */
-inline void SetApiConfig(const FString &ApiUrl, const FString &ApiKey) {
-  EnsureInitialized();
-  !ApiUrl.IsEmpty() ? (void)(ApiUrlStorage() = ApiUrl) : (void)0;
-  ApiKeyStorage() = ApiKey;
+inline int32 GetModelMemoryBudgetMb() { return Snapshot().ModelMemoryBudgetMb; }
+
+/**
+ * Returns how many read-only connections the local memory database opens
+ * alongside its writer; zero routes recalls through the writer connection.
+ * User Story: As concurrent NPC recall, I need the reader pool size tunable
+ * so hosts can trade file handles for parallel searches.
+ */
+inline int32 GetMemoryReadConnections() {
+  return Snapshot().MemoryReadConnections;
 }
 
 /**
- * Overrides the config file path used for subsequent disk reads and writes.
- * User Story: As tests and tooling, I need to redirect config I/O so I can
- * isolate runs from the user's real config file.
+ * Returns the vector storage mode new memory databases are created with.
+ * Existing databases keep their mode until migrated with vector_migrate.
+ * User Story: As memory-constrained servers, I need quantized storage
+ * selectable from config so vector memory shrinks without code changes.
  */
-inline void SetConfigFilePathOverride(const FString &ConfigFilePath) {
-  ConfigFilePathOverrideStorage() = ConfigFilePath;
+inline const FString &GetMemoryVectorStorage() {
+  return Snapshot().MemoryVectorStorage;
 }
 
 /**
- * Resolves the home directory from environment variables with project fallback.
- * User Story: As config path helpers, I need a home directory resolver so
- * config file location can be determined across platforms.
+ * Returns the default recall scoring mode: "similarity", "weighted" or
+ * "mmr". A recall request may name its own.
+ * User Story: As games weighting recency and importance, I need the ranking
+ * rule set once in config so every recall applies it without custom code.
  */
-inline FString ResolveHomeDir() {
-  const FString Home = FPlatformMisc::GetEnvironmentVariable(TEXT("HOME"));
-  const FString Profile =
-      FPlatformMisc::GetEnvironmentVariable(TEXT("USERPROFILE"));
-  return !Home.IsEmpty()
-      ? Home
-      : (!Profile.IsEmpty() ? Profile : FPaths::ProjectDir());
+inline const FString &GetMemoryRecallScoring() {
+  return Snapshot().MemoryRecallScoring;
 }
 
 /**
- * Resolves the config file path, honoring any explicit override first.
- * User Story: As config file helpers, I need the effective path so reads and
- * writes target the correct config location.
+ * Returns tau, in seconds, for the exp(-age / tau) recency decay used by
+ * weighted and mmr recall; zero disables decay.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
  */
-inline FString GetConfigFilePath() {
-  return !ConfigFilePathOverrideStorage().IsEmpty()
-      ? ConfigFilePathOverrideStorage()
-      : FPaths::Combine(ResolveHomeDir(), TEXT(".forbocai.json"));
+inline double GetMemoryRecencyTauSeconds() {
+  return Snapshot().MemoryRecencyTauSeconds;
 }
 
 /**
- * Loads the raw config JSON object from disk, or an empty object when absent.
- * User Story: As config parsing helpers, I need raw JSON config data so I can
- * populate in-memory settings from persisted values.
+ * Returns the mmr relevance/diversity balance: 1 is pure relevance, 0 pure
+ * diversity.
+ * User Story: As a maintainer, I need this note so the surrounding API intent stays clear during maintenance and integration.
  */
-inline TSharedPtr<FJsonObject> LoadConfigJsonObject() {
-  const FString ConfigPath = GetConfigFilePath();
-  FString JsonString;
-  return !FFileHelper::LoadFileToString(JsonString, *ConfigPath)
-      ? MakeShared<FJsonObject>()
-      : [&JsonString]() {
-          TSharedPtr<FJsonObject> JsonObject;
-          const TSharedRef<TJsonReader<>> Reader =
-              TJsonReaderFactory<>::Create(JsonString);
-          return (FJsonSerializer::Deserialize(Reader, JsonObject) &&
-                  JsonObject.IsValid())
-              ? JsonObject
-              : MakeShared<FJsonObject>();
-        }();
+inline float GetMemoryMmrLambda() { return Snapshot().MemoryMmrLambda; }
+
+/**
+ * Returns how module facades sync their results into the runtime store:
+ * "direct" (default) skips the store, "batched" applies lifecycle actions
+ * once per frame, "store" dispatches every action as it happens.
+ * User Story: As gameplay code calling module facades, I need store updates
+ * opt-in so a facade call only pays for the work it asked for.
+ */
+inline const FString &GetFacadeStoreSync() { return Snapshot().FacadeStoreSync; }
+
+/**
+ * Returns the save-game slot the subsystem restores the store from at startup
+ * and saves it to at shutdown; empty (default) disables store snapshots.
+ * User Story: As games with large NPC and memory state, I need warm starts
+ * from a snapshot instead of re-running every hydration thunk.
+ */
+inline const FString &GetStoreSnapshotSlot() { return Snapshot().StoreSnapshotSlot; }
+
+/**
+ * Returns the validation problems found in the current snapshot.
+ * User Story: As diagnostics, I need config errors reported so a typo in the
+ * config file is visible instead of silently falling back to defaults.
+ */
+inline const TArray<FString> &GetValidationErrors() {
+  return Snapshot().ValidationErrors;
 }
 
 /**
- * Persists a raw config JSON object to disk with restricted file permissions.
- * User Story: As config persistence flows, I need a safe write helper so
- * resolved settings can be saved with private file permissions when possible.
+ * Returns whether a threading entry exists for exactly this key.
+ * User Story: As model loaders, I need to know if a model id has its own entry
+ * so lookups can fall back to the GGUF file name before the default.
  */
-inline bool WriteConfigJsonObject(const TSharedRef<FJsonObject> &JsonObject) {
-  const FString ConfigPath = GetConfigFilePath();
-  const FString Directory = FPaths::GetPath(ConfigPath);
-  !Directory.IsEmpty()
-      ? (IFileManager::Get().MakeDirectory(*Directory, true), void())
-      : void();
+inline bool HasThreadingConfig(const FString &ModelKey) {
+  return Snapshot().Threading.Contains(ModelKey);
+}
 
-  FString JsonString;
-  const TSharedRef<TJsonWriter<>> Writer =
-      TJsonWriterFactory<>::Create(&JsonString);
-  FJsonSerializer::Serialize(JsonObject, Writer);
+/**
+ * Returns threading for a model, falling back to the default entry.
+ * User Story: As native model loading, I need one lookup for thread settings
+ * so model-specific overrides win over the shared default.
+ */
+inline FCortexThreadingConfig GetThreadingConfig(const FString &ModelKey) {
+  const FSDKConfigSnapshot &Current = Snapshot();
+  const FCortexThreadingConfig *Specific =
+      ModelKey.IsEmpty() ? nullptr : Current.Threading.Find(ModelKey);
+  const FCortexThreadingConfig *Default =
+      Current.Threading.Find(DEFAULT_THREADING_KEY);
+  return Specific ? *Specific
+                  : (Default ? *Default : FCortexThreadingConfig());
+}
 
-  const bool bSaved = FFileHelper::SaveStringToFile(JsonString, *ConfigPath);
-#if PLATFORM_MAC || PLATFORM_UNIX
-  bSaved ? (void)chmod(TCHAR_TO_UTF8(*ConfigPath), 0600) : (void)0;
-#endif
-  return bSaved;
+/**
+ * Records an override and publishes the current snapshot with it applied.
+ * Overrides that leave the layer unchanged publish nothing, so callers that
+ * re-set the same values do not churn snapshots. Validation restarts from the
+ * source errors so repeated overrides do not accumulate duplicates.
+ * User Story: As runtime override flows, I need overrides published like any
+ * other change so readers pick them up with the same atomic load.
+ */
+template <typename Fn> inline void PublishOverride(Fn Mutate) {
+  (void)Snapshot();
+  std::lock_guard<std::mutex> Lock(WriterMutex());
+  const FSDKConfigOverrides Before = OverridesStorage();
+  Mutate(OverridesStorage());
+  SameOverrides(Before, OverridesStorage()) ? void() : [&]() {
+    FSDKConfigSnapshot Next = *SnapshotSlot().load(std::memory_order_acquire);
+    Next.ValidationErrors = Next.SourceValidationErrors;
+    ApplyOverrides(Next, OverridesStorage());
+    ValidateSnapshot(Next);
+    PublishLocked(MoveTemp(Next));
+  }();
 }
 
 /**
- * Applies supported FORBOCAI_* environment variables to in-memory config.
- * User Story: As deployment configuration, I need environment overrides to win
- * so runtime settings can be injected without editing files.
+ * Overrides threading for a model (or the default entry) in memory.
+ * User Story: As runtime tuning flows, I need thread settings changed without
+ * editing files so operators can rebalance a live server.
  */
-inline void LoadFromEnvironment() {
-  const FString U =
-      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_API_URL"));
-  const FString K =
-      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_API_KEY"));
-  const FString M =
-      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_MODEL_PATH"));
-  const FString D =
-      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_DATABASE_PATH"));
-  const FString V =
-      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_VECTOR_DIMENSION"));
-  const FString R =
-      FPlatformMisc::GetEnvironmentVariable(TEXT("FORBOCAI_MAX_RECALL"));
-  !U.IsEmpty() ? (void)(ApiUrlStorage() = U) : (void)0;
-  !K.IsEmpty() ? (void)(ApiKeyStorage() = K) : (void)0;
-  !M.IsEmpty() ? (void)(ModelPathStorage() = M) : (void)0;
-  !D.IsEmpty() ? (void)(DatabasePathStorage() = D) : (void)0;
-  !V.IsEmpty() ? (void)(VectorDimensionStorage() = FCString::Atoi(*V))
-               : (void)0;
-  !R.IsEmpty() ? (void)(MaxRecallResultsStorage() = FCString::Atoi(*R))
-               : (void)0;
+inline void SetThreadingConfig(const FString &ModelKey,
+                               const FCortexThreadingConfig &Config) {
+  PublishOverride([&ModelKey, &Config](FSDKConfigOverrides &Overrides) {
+    Overrides.Threading.Add(ModelKey.IsEmpty() ? FString(DEFAULT_THREADING_KEY)
+                                               : ModelKey,
+                            Config);
+  });
 }
 
 /**
- * Applies persisted JSON config values to in-memory config storage.
- * User Story: As local config loading, I need persisted settings applied so
- * runtime defaults can be overridden by the saved config file.
+ * Returns the SDK version string baked into the plugin build.
+ * User Story: As diagnostics and tooling, I need the runtime SDK version so I
+ * can report which plugin build is running.
  */
-inline void LoadFromConfigFile() {
-  const TSharedPtr<FJsonObject> J = LoadConfigJsonObject();
-  !J.IsValid()
-      ? void()
-      : [&J]() {
-          FString S;
-          (J->TryGetStringField(TEXT("apiUrl"), S) && !S.IsEmpty())
-              ? (void)(ApiUrlStorage() = S) : (void)0;
-          (J->TryGetStringField(TEXT("apiKey"), S) && !S.IsEmpty())
-              ? (void)(ApiKeyStorage() = S) : (void)0;
-          (J->TryGetStringField(TEXT("modelPath"), S) && !S.IsEmpty())
-              ? (void)(ModelPathStorage() = S) : (void)0;
-          (J->TryGetStringField(TEXT("databasePath"), S) && !S.IsEmpty())
-              ? (void)(DatabasePathStorage() = S) : (void)0;
-          int32 I = 0;
-          J->TryGetNumberField(TEXT("vectorDimension"), I)
-              ? (void)(VectorDimensionStorage() = I) : (void)0;
-          J->TryGetNumberField(TEXT("maxRecallResults"), I)
-              ? (void)(MaxRecallResultsStorage() = I) : (void)0;
-        }();
+inline FString GetSdkVersion() { return TEXT("0.6.3"); }
+
+/**
+ * Updates the in-memory API URL and API key overrides.
+ * User Story: As runtime override flows, I need to swap API connection values
+ * in memory so subsequent requests use the new endpoint and credential.
+ */
+inline void SetApiConfig(const FString &ApiUrl, const FString &ApiKey) {
+  PublishOverride([&ApiUrl, &ApiKey](FSDKConfigOverrides &Overrides) {
+    !ApiUrl.IsEmpty() ? (void)(Overrides.ApiUrl = func::just(ApiUrl))
+                      : (void)0;
+    Overrides.ApiKey = func::just(ApiKey);
+  });
+}
+
+/**
+ * Overrides the facade store-sync mode in memory.
+ * User Story: As tools and tests that read facade results from the store, I
+ * need to opt back into store updates without editing the config file.
+ */
+inline void SetFacadeStoreSync(const FString &Mode) {
+  PublishOverride([&Mode](FSDKConfigOverrides &Overrides) {
+    Overrides.FacadeStoreSync = func::just(Mode);
+  });
 }
 
 /**
- * Saves the current in-memory configuration values back to disk.
+ * Saves the current configuration snapshot back to disk.
  * User Story: As config editing flows, I need current settings persisted so
  * future runs start with the same resolved configuration.
  */
 inline bool SaveToConfigFile() {
-  EnsureInitialized();
+  const FSDKConfigSnapshot &Current = Snapshot();
 
   const TSharedRef<FJsonObject> J = MakeShared<FJsonObject>();
-  J->SetStringField(TEXT("apiUrl"), ApiUrlStorage());
-  !ApiKeyStorage().IsEmpty()
-      ? J->SetStringField(TEXT("apiKey"), ApiKeyStorage()) : (void)0;
-  !ModelPathStorage().IsEmpty()
-      ? J->SetStringField(TEXT("modelPath"), ModelPathStorage()) : (void)0;
-  !DatabasePathStorage().IsEmpty()
-      ? J->SetStringField(TEXT("databasePath"), DatabasePathStorage())
+  J->SetStringField(TEXT("apiUrl"), Current.ApiUrl);
+  !Current.ApiKey.IsEmpty()
+      ? J->SetStringField(TEXT("apiKey"), Current.ApiKey) : (void)0;
+  !Current.ModelPath.IsEmpty()
+      ? J->SetStringField(TEXT("modelPath"), Current.ModelPath) : (void)0;
+  !Current.DatabasePath.IsEmpty()
+      ? J->SetStringField(TEXT("databasePath"), Current.DatabasePath)
+      : (void)0;
+  J->SetNumberField(TEXT("vectorDimension"), Current.VectorDimension);
+  J->SetNumberField(TEXT("maxRecallResults"), Current.MaxRecallResults);
+  !Current.ModelQuant.IsEmpty()
+      ? J->SetStringField(TEXT("modelQuant"), Current.ModelQuant) : (void)0;
+  Current.ModelMemoryBudgetMb > 0
+      ? J->SetNumberField(TEXT("modelMemoryBudgetMb"),
+                          Current.ModelMemoryBudgetMb)
+      : (void)0;
+  Current.MemoryReadConnections != DEFAULT_MEMORY_READ_CONNECTIONS
+      ? J->SetNumberField(TEXT("memoryReadConnections"),
+                          Current.MemoryReadConnections)
+      : (void)0;
+  Current.MemoryVectorStorage != VECTOR_STORAGE_FLOAT
+      ? J->SetStringField(TEXT("memoryVectorStorage"),
+                          Current.MemoryVectorStorage)
+      : (void)0;
+  Current.MemoryRecallScoring != RECALL_SCORING_SIMILARITY
+      ? J->SetStringField(TEXT("memoryRecallScoring"),
+                          Current.MemoryRecallScoring)
+      : (void)0;
+  Current.MemoryRecencyTauSeconds != DEFAULT_MEMORY_RECENCY_TAU_SECONDS
+      ? J->SetNumberField(TEXT("memoryRecencyTauSeconds"),
+                          Current.MemoryRecencyTauSeconds)
       : (void)0;
-  J->SetNumberField(TEXT("vectorDimension"), VectorDimensionStorage());
-  J->SetNumberField(TEXT("maxRecallResults"), MaxRecallResultsStorage());
+  Current.MemoryMmrLambda != DEFAULT_MEMORY_MMR_LAMBDA
+      ? J->SetNumberField(TEXT("memoryMmrLambda"), Current.MemoryMmrLambda)
+      : (void)0;
+  Current.FacadeStoreSync != FACADE_SYNC_DIRECT
+      ? J->SetStringField(TEXT("facadeStoreSync"), Current.FacadeStoreSync)
+      : (void)0;
+  !Current.StoreSnapshotSlot.IsEmpty()
+      ? J->SetStringField(TEXT("storeSnapshotSlot"), Current.StoreSnapshotSlot)
+      : (void)0;
+
+  struct ThreadingHelper {
+    static void apply(const TSharedRef<FJsonObject> &Table,
+                      const TMap<FString, FCortexThreadingConfig> &Entries,
+                      const TArray<FString> &Keys, int32 Index) {
+      Index >= Keys.Num()
+          ? void()
+          : (Table->SetObjectField(Keys[Index],
+                                   ThreadingToJson(Entries[Keys[Index]])),
+             apply(Table, Entries, Keys, Index + 1));
+    }
+  };
+  Current.Threading.Num() > 0
+      ? [&J, &Current]() {
+          TArray<FString> Keys;
+          Current.Threading.GetKeys(Keys);
+          const TSharedRef<FJsonObject> Table = MakeShared<FJsonObject>();
+          ThreadingHelper::apply(Table, Current.Threading, Keys, 0);
+          J->SetObjectField(TEXT("threading"), Table);
+        }()
+      : void();
 
   return WriteConfigJsonObject(J);
 }
@@ -434,6 +1301,64 @@ inline void SetConfigValue(const FString &Key, const FString &Value) {
                                            FCString::Atoi(*Value));
                 return true;
               }),
+          func::when<FString, bool>(
+              func::equals<FString>(FString(TEXT("modelQuant"))),
+              [&](const FString &) {
+                JsonObject->SetStringField(TEXT("modelQuant"), Value);
+                return true;
+              }),
+          func::when<FString, bool>(
+              func::equals<FString>(FString(TEXT("modelMemoryBudgetMb"))),
+              [&](const FString &) {
+                JsonObject->SetNumberField(TEXT("modelMemoryBudgetMb"),
+                                           FCString::Atoi(*Value));
+                return true;
+              }),
+          func::when<FString, bool>(
+              func::equals<FString>(FString(TEXT("memoryReadConnections"))),
+              [&](const FString &) {
+                JsonObject->SetNumberField(TEXT("memoryReadConnections"),
+                                           FCString::Atoi(*Value));
+                return true;
+              }),
+          func::when<FString, bool>(
+              func::equals<FString>(FString(TEXT("memoryVectorStorage"))),
+              [&](const FString &) {
+                JsonObject->SetStringField(TEXT("memoryVectorStorage"), Value);
+                return true;
+              }),
+          func::when<FString, bool>(
+              func::equals<FString>(FString(TEXT("memoryRecallScoring"))),
+              [&](const FString &) {
+                JsonObject->SetStringField(TEXT("memoryRecallScoring"), Value);
+                return true;
+              }),
+          func::when<FString, bool>(
+              func::equals<FString>(FString(TEXT("memoryRecencyTauSeconds"))),
+              [&](const FString &) {
+                JsonObject->SetNumberField(TEXT("memoryRecencyTauSeconds"),
+                                           FCString::Atod(*Value));
+                return true;
+              }),
+          func::when<FString, bool>(
+              func::equals<FString>(FString(TEXT("memoryMmrLambda"))),
+              [&](const FString &) {
+                JsonObject->SetNumberField(TEXT("memoryMmrLambda"),
+                                           FCString::Atod(*Value));
+                return true;
+              }),
+          func::when<FString, bool>(
+              func::equals<FString>(FString(TEXT("storeSnapshotSlot"))),
+              [&](const FString &) {
+                JsonObject->SetStringField(TEXT("storeSnapshotSlot"), Value);
+                return true;
+              }),
+          func::when<FString, bool>(
+              func::equals<FString>(FString(TEXT("facadeStoreSync"))),
+              [&](const FString &) {
+                JsonObject->SetStringField(TEXT("facadeStoreSync"), Value);
+                return true;
+              }),
       }),
       false);
 
@@ -505,21 +1430,90 @@ inline FString GetConfigValue(const FString &Key) {
                                          TEXT("maxRecallResults"), V)
                                   ? FString::FromInt(V) : FString(TEXT(""));
                             }),
+                        func::when<FString, FString>(
+                            func::equals<FString>(FString(TEXT("modelQuant"))),
+                            [&J](const FString &) {
+                              FString V;
+                              return J->TryGetStringField(TEXT("modelQuant"), V)
+                                  ? V : FString(TEXT(""));
+                            }),
+                        func::when<FString, FString>(
+                            func::equals<FString>(
+                                FString(TEXT("modelMemoryBudgetMb"))),
+                            [&J](const FString &) {
+                              int32 V = 0;
+                              return J->TryGetNumberField(
+                                         TEXT("modelMemoryBudgetMb"), V)
+                                  ? FString::FromInt(V) : FString(TEXT(""));
+                            }),
+                        func::when<FString, FString>(
+                            func::equals<FString>(
+                                FString(TEXT("memoryReadConnections"))),
+                            [&J](const FString &) {
+                              int32 V = 0;
+                              return J->TryGetNumberField(
+                                         TEXT("memoryReadConnections"), V)
+                                  ? FString::FromInt(V) : FString(TEXT(""));
+                            }),
+                        func::when<FString, FString>(
+                            func::equals<FString>(
+                                FString(TEXT("memoryVectorStorage"))),
+                            [&J](const FString &) {
+                              FString V;
+                              return J->TryGetStringField(
+                                         TEXT("memoryVectorStorage"), V)
+                                  ? V : FString(TEXT(""));
+                            }),
+                        func::when<FString, FString>(
+                            func::equals<FString>(
+                                FString(TEXT("memoryRecallScoring"))),
+                            [&J](const FString &) {
+                              FString V;
+                              return J->TryGetStringField(
+                                         TEXT("memoryRecallScoring"), V)
+                                  ? V : FString(TEXT(""));
+                            }),
+                        func::when<FString, FString>(
+                            func::equals<FString>(
+                                FString(TEXT("memoryRecencyTauSeconds"))),
+                            [&J](const FString &) {
+                              double V = 0.0;
+                              return J->TryGetNumberField(
+                                         TEXT("memoryRecencyTauSeconds"), V)
+                                  ? FString::SanitizeFloat(V)
+                                  : FString(TEXT(""));
+                            }),
+                        func::when<FString, FString>(
+                            func::equals<FString>(
+                                FString(TEXT("memoryMmrLambda"))),
+                            [&J](const FString &) {
+                              double V = 0.0;
+                              return J->TryGetNumberField(
+                                         TEXT("memoryMmrLambda"), V)
+                                  ? FString::SanitizeFloat(V)
+                                  : FString(TEXT(""));
+                            }),
+                        func::when<FString, FString>(
+                            func::equals<FString>(
+                                FString(TEXT("storeSnapshotSlot"))),
+                            [&J](const FString &) {
+                              FString V;
+                              return J->TryGetStringField(
+                                         TEXT("storeSnapshotSlot"), V)
+                                  ? V : FString(TEXT(""));
+                            }),
+                        func::when<FString, FString>(
+                            func::equals<FString>(
+                                FString(TEXT("facadeStoreSync"))),
+                            [&J](const FString &) {
+                              FString V;
+                              return J->TryGetStringField(
+                                         TEXT("facadeStoreSync"), V)
+                                  ? V : FString(TEXT(""));
+                            }),
                     }),
                     FString(TEXT("")));
         }();
 }
 
-/**
- * Initializes config once using defaults, persisted JSON, then env overrides.
- * User Story: As runtime startup, I need deterministic config precedence so
- * defaults, file values, and environment overrides resolve predictably.
- */
-inline void InitializeConfig() {
-  InitializedStorage()
-      ? void()
-      : (ResetToDefaults(), LoadFromConfigFile(), LoadFromEnvironment(),
-         (void)(InitializedStorage() = true));
-}
-
 } // namespace SDKConfig
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "Async/Async.h"
+#include "Core/functional_core.hpp"
+#include "CoreMinimal.h"
+#include "RuntimeConfig.h"
+#include "RuntimeStore.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+/**
+ * Facade Dispatch — direct execution for module facades.
+ * CortexOps, MemoryOps, BridgeOps, SoulOps and GhostOps run the same thunks
+ * the store runs, but hand them a facade dispatcher instead of the store's.
+ * The native work is identical; whether the lifecycle actions reach the
+ * store is decided by SDKConfig::GetFacadeStoreSync().
+ * User Story: As gameplay code calling module facades, I need calls to pay
+ * only for their native work so a completion or recall does not also run a
+ * pending/fulfilled cycle through every slice.
+ */
+namespace FacadeDispatch {
+
+/**
+ * How facade calls sync their lifecycle actions into the runtime store.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+enum class EFacadeStoreSync : uint8 { Direct, Batched, Store };
+
+/**
+ * Resolves the configured store-sync mode.
+ * User Story: As facade calls, I need the mode read from the config snapshot
+ * so operators can switch it without rebuilding.
+ */
+inline EFacadeStoreSync CurrentMode() {
+  const FString Mode = SDKConfig::GetFacadeStoreSync();
+  return Mode == SDKConfig::FACADE_SYNC_STORE
+             ? EFacadeStoreSync::Store
+             : (Mode == SDKConfig::FACADE_SYNC_BATCHED
+                    ? EFacadeStoreSync::Batched
+                    : EFacadeStoreSync::Direct);
+}
+
+/**
+ * Actions queued by batched facade calls, applied together on the game
+ * thread.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FActionBatch {
+  std::mutex Mutex;
+  TArray<rtk::AnyAction> Queue;
+  std::atomic<bool> bFlushScheduled;
+
+  FActionBatch() : bFlushScheduled(false) {}
+};
+
+/**
+ * Returns the process-wide action batch.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FActionBatch &PendingBatch() {
+  static FActionBatch Batch;
+  return Batch;
+}
+
+/**
+ * Dispatches every queued action into the runtime store in queue order and
+ * returns how many were applied. Runs on the game thread. Deferred listener
+ * effects run once, after the whole batch.
+ * User Story: As batched facade mode, I need one flush per frame so store
+ * listeners see a facade call's actions together instead of interleaved with
+ * gameplay.
+ */
+inline int32 Flush() {
+  FActionBatch &Batch = PendingBatch();
+  Batch.bFlushScheduled.store(false, std::memory_order_release);
+  TArray<rtk::AnyAction> Drained;
+  {
+    std::lock_guard<std::mutex> Lock(Batch.Mutex);
+    Drained = MoveTemp(Batch.Queue);
+    Batch.Queue.Reset();
+  }
+  struct Apply {
+    static void apply(const rtk::EnhancedStore<FStoreState> &Store,
+                      const TArray<rtk::AnyAction> &Actions, int32 Index) {
+      Index < Actions.Num()
+          ? (Store.dispatch(Actions[Index]), apply(Store, Actions, Index + 1),
+             void())
+          : void();
+    }
+  };
+  const rtk::ScopedEffectBatch EffectBatch;
+  Drained.Num() > 0 ? (Apply::apply(ConfigureStore(), Drained, 0), void())
+                    : void();
+  return Drained.Num();
+}
+
+/**
+ * Queues an action and posts one flush unless one is already pending.
+ * User Story: As batched facade mode, I need enqueueing to be cheap and safe
+ * from worker threads so facade callbacks never block on the store.
+ */
+inline void Enqueue(const rtk::AnyAction &Action) {
+  FActionBatch &Batch = PendingBatch();
+  {
+    std::lock_guard<std::mutex> Lock(Batch.Mutex);
+    Batch.Queue.Add(Action);
+  }
+  !Batch.bFlushScheduled.exchange(true, std::memory_order_acq_rel)
+      ? (AsyncTask(ENamedThreads::GameThread, []() { Flush(); }), void())
+      : void();
+}
+
+/**
+ * Returns the dispatcher facade thunks run with for the given mode.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline std::function<rtk::AnyAction(const rtk::AnyAction &)>
+MakeDispatch(EFacadeStoreSync Mode) {
+  return Mode == EFacadeStoreSync::Store
+             ? std::function<rtk::AnyAction(const rtk::AnyAction &)>(
+                   [](const rtk::AnyAction &Action) {
+                     return ConfigureStore().dispatch(Action);
+                   })
+             : (Mode == EFacadeStoreSync::Batched
+                    ? std::function<rtk::AnyAction(const rtk::AnyAction &)>(
+                          [](const rtk::AnyAction &Action) {
+                            Enqueue(Action);
+                            return Action;
+                          })
+                    : std::function<rtk::AnyAction(const rtk::AnyAction &)>(
+                          [](const rtk::AnyAction &Action) {
+                            return Action;
+                          }));
+}
+
+/**
+ * Dispatches one action the way the current mode syncs facade results.
+ * User Story: As facades that emit their own actions (ghost session results),
+ * I need them to follow the same opt-in rule as thunk lifecycle actions.
+ */
+inline rtk::AnyAction Dispatch(const rtk::AnyAction &Action) {
+  return MakeDispatch(CurrentMode())(Action);
+}
+
+/**
+ * Runs a thunk directly with the facade dispatcher. State reads still see the
+ * runtime store, so thunks that consult configuration or cached entities
+ * behave the same in every mode.
+ * User Story: As module facades, I need one entry point that executes a thunk
+ * without the store so direct mode skips the slice reducers entirely.
+ */
+template <typename T>
+func::AsyncResult<T> Run(const rtk::ThunkAction<T, FStoreState> &Thunk) {
+  return Thunk(MakeDispatch(CurrentMode()),
+               []() { return ConfigureStore().getState(); });
+}
+
+/**
+ * Executes a facade result and settles it into a future of Either.
+ * User Story: As facade APIs that return futures, I need one adapter so
+ * every module reports errors as a Left the same way.
+ */
+template <typename T>
+TFuture<func::Either<FString, T>> ToFuture(func::AsyncResult<T> Result) {
+  auto PromisePtr = std::make_shared<TPromise<func::Either<FString, T>>>();
+  TFuture<func::Either<FString, T>> Future = PromisePtr->GetFuture();
+  Result
+      .then([PromisePtr](T Value) {
+        PromisePtr->SetValue(func::make_right(FString(), Value));
+      })
+      .catch_([PromisePtr](std::string Error) {
+        PromisePtr->SetValue(
+            func::make_left(FString(UTF8_TO_TCHAR(Error.c_str())), T{}));
+      });
+  Result.execute();
+  return Future;
+}
+
+} // namespace FacadeDispatch
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "API/APISlice.h"
+#include "Async/Async.h"
 #include "Bridge/BridgeSlice.h"
+#include "Containers/Ticker.h"
 #include "Core/rtk.hpp"
 #include "CoreMinimal.h"
 #include "Core/functional_core.hpp"
@@ -11,6 +13,9 @@
 #include "Memory/MemorySlice.h"
 #include "NPC/NPCSlice.h"
 #include "Soul/SoulSlice.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 struct FStoreState {
   NPCSlice::FNPCSliceState NPCs;
@@ -123,6 +128,34 @@ inline const rtk::Slice<APISlice::FAPIState> &GetAPISlice() {
   return Slice;
 }
 
+/**
+ * Points rtk's worker-mode listener effects at the engine thread pool, their
+ * dispatches back at the game thread (the store's thread), and its debounce
+ * timer at the core ticker. Runs once per process.
+ * User Story: As store assembly, I need listener effects scheduled on engine
+ * threads so offloaded and debounced effects work without per-listener setup.
+ */
+inline void InstallEffectRuntime() {
+  static const bool bInstalled = []() {
+    rtk::setEffectExecutor([](rtk::EffectTask Task) {
+      Async(EAsyncExecution::ThreadPool, MoveTemp(Task));
+    });
+    rtk::setEffectDispatchExecutor([](rtk::EffectTask Task) {
+      AsyncTask(ENamedThreads::GameThread, MoveTemp(Task));
+    });
+    rtk::setEffectDelay([](double Seconds, rtk::EffectTask Task) {
+      FTSTicker::GetCoreTicker().AddTicker(
+          FTickerDelegate::CreateLambda([Task = MoveTemp(Task)](float) {
+            Task();
+            return false;
+          }),
+          static_cast<float>(Seconds));
+    });
+    return true;
+  }();
+  (void)bInstalled;
+}
+
 } // namespace StoreInternal
 
 /**
@@ -151,22 +184,246 @@ inline std::vector<ExtraReducerFn> &ExtraReducers() {
 } // namespace StoreInternal (extension)
 
 /**
- * Runs the SDK reducers, then applies any registered extra reducers.
+ * A slice mounted on one member of the root state.
+ * User Story: As root store routing, I need each mounted slice to carry its
+ * handled action types so dispatch only runs the slices an action targets.
+ */
+struct FSliceMount {
+  FString Name;
+  TArray<FString> ActionTypes;
+  std::function<void(FStoreState &, const rtk::AnyAction &)> Reduce;
+};
+
+/**
+ * Routing table built from the mounted slices.
+ * User Story: As root store routing, I need action types mapped to mount
+ * indices so one lookup replaces running every slice reducer.
+ */
+struct FSliceRoutes {
+  std::vector<FSliceMount> Mounts;
+  TMap<FString, TArray<int32>> ByType;
+};
+
+using SliceMountFactory = std::function<FSliceMount()>;
+
+namespace StoreInternal {
+
+/**
+ * Wraps a slice getter as a deferred mount on one FStoreState member.
+ * User Story: As store assembly, I need mounts created lazily so a slice is
+ * only built when the routing table is first needed.
+ */
+template <typename SliceState>
+SliceMountFactory MakeSliceMount(SliceState FStoreState::*Member,
+                                 const rtk::Slice<SliceState> &(*GetSlice)()) {
+  return [Member, GetSlice]() -> FSliceMount {
+    const rtk::Slice<SliceState> &Slice = GetSlice();
+    FSliceMount Mount;
+    Mount.Name = Slice.Name;
+    Mount.ActionTypes = Slice.ActionTypes;
+    const rtk::CaseReducer<SliceState> Reducer = Slice.Reducer;
+    Mount.Reduce = [Member, Reducer](FStoreState &Next,
+                                     const rtk::AnyAction &Action) {
+      Next.*Member = Reducer(Next.*Member, Action);
+    };
+    return Mount;
+  };
+}
+
+/**
+ * Returns the registered slice mounts, seeded with the SDK slices.
+ * User Story: As store extensibility, I need one mount registry so features
+ * can inject slices without editing the root reducer.
+ */
+inline std::vector<SliceMountFactory> &SliceMounts() {
+  static std::vector<SliceMountFactory> Mounts = {
+      MakeSliceMount(&FStoreState::NPCs, &GetNPCSlice),
+      MakeSliceMount(&FStoreState::Memory, &GetMemorySlice),
+      MakeSliceMount(&FStoreState::Directives, &GetDirectiveSlice),
+      MakeSliceMount(&FStoreState::Bridge, &GetBridgeSlice),
+      MakeSliceMount(&FStoreState::Cortex, &GetCortexSlice),
+      MakeSliceMount(&FStoreState::Soul, &GetSoulSlice),
+      MakeSliceMount(&FStoreState::Ghost, &GetGhostSlice),
+      MakeSliceMount(&FStoreState::API, &GetAPISlice)};
+  return Mounts;
+}
+
+/**
+ * Guards the mount registry and the published routing table.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline std::mutex &SliceRoutesMutex() {
+  static std::mutex Mutex;
+  return Mutex;
+}
+
+/**
+ * Holds the current routing table; empty until the first dispatch and after
+ * every new mount.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline std::shared_ptr<const FSliceRoutes> &SliceRoutesSlot() {
+  static std::shared_ptr<const FSliceRoutes> Slot;
+  return Slot;
+}
+
+/**
+ * Counts published routing tables; bumped under the mutex on every mount so
+ * dispatching threads can tell their cached table is stale.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline std::atomic<uint64> &SliceRoutesEpoch() {
+  static std::atomic<uint64> Epoch(1);
+  return Epoch;
+}
+
+/**
+ * Builds slices from the registered mounts and indexes their action types.
+ * User Story: As root store routing, I need the table derived from the
+ * slices' own case maps so routing never drifts from reducer behavior.
+ */
+inline std::shared_ptr<const FSliceRoutes>
+BuildSliceRoutes(const std::vector<SliceMountFactory> &Factories) {
+  struct Build {
+    static void types(TMap<FString, TArray<int32>> &ByType,
+                      const TArray<FString> &Types, int32 MountIndex,
+                      int32 Index) {
+      Index < Types.Num()
+          ? (ByType.FindOrAdd(Types[Index]).AddUnique(MountIndex),
+             types(ByType, Types, MountIndex, Index + 1), void())
+          : void();
+    }
+    static void mounts(FSliceRoutes &Out,
+                       const std::vector<SliceMountFactory> &Factories,
+                       size_t Index) {
+      Index < Factories.size()
+          ? (Out.Mounts.push_back(Factories[Index]()),
+             types(Out.ByType, Out.Mounts.back().ActionTypes,
+                   static_cast<int32>(Index), 0),
+             mounts(Out, Factories, Index + 1), void())
+          : void();
+    }
+  };
+  std::shared_ptr<FSliceRoutes> Routes = std::make_shared<FSliceRoutes>();
+  Build::mounts(*Routes, Factories, 0);
+  return Routes;
+}
+
+/**
+ * Returns the routing table, building it on first use. Each thread keeps the
+ * table it last saw and only takes the mutex when the epoch moved, so steady
+ * dispatch is one atomic load with no lock and no refcount traffic. The
+ * reference stays valid until this thread next sees a new epoch; reducers do
+ * not mount slices, so that never happens mid-reduction.
+ * User Story: As root store reduction, I need a cached table so routing costs
+ * one map lookup per dispatch after the first.
+ */
+inline const FSliceRoutes &ActiveSliceRoutes() {
+  struct FCache {
+    uint64 Epoch = 0;
+    std::shared_ptr<const FSliceRoutes> Routes;
+  };
+  thread_local FCache Cache;
+  return Cache.Epoch == SliceRoutesEpoch().load(std::memory_order_acquire)
+             ? *Cache.Routes
+             : [&]() -> const FSliceRoutes & {
+                 std::lock_guard<std::mutex> Lock(SliceRoutesMutex());
+                 std::shared_ptr<const FSliceRoutes> &Slot = SliceRoutesSlot();
+                 !Slot && (Slot = BuildSliceRoutes(SliceMounts()), true);
+                 Cache.Routes = Slot;
+                 Cache.Epoch =
+                     SliceRoutesEpoch().load(std::memory_order_relaxed);
+                 return *Cache.Routes;
+               }();
+}
+
+} // namespace StoreInternal (routing)
+
+/**
+ * Mounts a slice on a root state member; the routing table is rebuilt on the
+ * next dispatch.
+ * User Story: As feature integration, I need to inject slices after startup
+ * so optional features register their reducers only when they are used.
+ */
+template <typename SliceState>
+void mountSlice(SliceState FStoreState::*Member,
+                const rtk::Slice<SliceState> &(*GetSlice)()) {
+  std::lock_guard<std::mutex> Lock(StoreInternal::SliceRoutesMutex());
+  StoreInternal::SliceMounts().push_back(
+      StoreInternal::MakeSliceMount(Member, GetSlice));
+  StoreInternal::SliceRoutesSlot().reset();
+  StoreInternal::SliceRoutesEpoch().fetch_add(1, std::memory_order_release);
+}
+
+/**
+ * Returns the names of the slices an action type is routed to.
+ * User Story: As store diagnostics, I need routed slice names so tests and
+ * tooling can confirm which reducers an action reaches.
+ */
+inline TArray<FString> routedSliceNames(const FString &ActionType) {
+  const FSliceRoutes &Routes = StoreInternal::ActiveSliceRoutes();
+  const TArray<int32> *Indices = Routes.ByType.Find(ActionType);
+  struct Collect {
+    static TArray<FString> apply(TArray<FString> Acc,
+                                 const FSliceRoutes &R,
+                                 const TArray<int32> &Idx, int32 I) {
+      return I >= Idx.Num()
+                 ? Acc
+                 : (Acc.Add(R.Mounts[Idx[I]].Name),
+                    apply(MoveTemp(Acc), R, Idx, I + 1));
+    }
+  };
+  return Indices ? Collect::apply(TArray<FString>(), Routes, *Indices, 0)
+                 : TArray<FString>();
+}
+
+namespace StoreActions {
+
+/**
+ * Returns the memoized action creator that replaces the whole root state.
+ * User Story: As snapshot restore, I need hydration to go through dispatch so
+ * middleware and subscribers see the restored state like any other update.
+ */
+inline const rtk::ActionCreator<FStoreState> &HydrateStoreActionCreator() {
+  static const rtk::ActionCreator<FStoreState> ActionCreator =
+      rtk::createAction<FStoreState>(TEXT("store/hydrate"));
+  return ActionCreator;
+}
+
+/**
+ * Builds the action that replaces the root state with State.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline rtk::AnyAction HydrateStore(const FStoreState &State) {
+  return HydrateStoreActionCreator()(State);
+}
+
+} // namespace StoreActions
+
+/**
+ * Runs the slices routed for the action type, then applies any registered
+ * extra reducers. Slices without a case for the type are skipped entirely.
  * User Story: As root store reduction, I need SDK and game reducers composed
  * together so one dispatch updates all registered state.
  */
-inline FStoreState StoreReducer(const FStoreState &State,
-                                const rtk::AnyAction &Action) {
+inline FStoreState ReduceMountedSlices(const FStoreState &State,
+                                       const rtk::AnyAction &Action) {
+  const FSliceRoutes &Routes = StoreInternal::ActiveSliceRoutes();
+  const TArray<int32> *Routed = Routes.ByType.Find(Action.Type);
+
+  struct ApplyMounts {
+    static void apply(FStoreState &S, const rtk::AnyAction &A,
+                      const FSliceRoutes &R, const TArray<int32> &Idx,
+                      int32 Index) {
+      Index < Idx.Num()
+          ? (R.Mounts[Idx[Index]].Reduce(S, A),
+             apply(S, A, R, Idx, Index + 1), void())
+          : void();
+    }
+  };
   FStoreState Next = State;
-  Next.NPCs = StoreInternal::GetNPCSlice().Reducer(State.NPCs, Action);
-  Next.Memory = StoreInternal::GetMemorySlice().Reducer(State.Memory, Action);
-  Next.Directives =
-      StoreInternal::GetDirectiveSlice().Reducer(State.Directives, Action);
-  Next.Bridge = StoreInternal::GetBridgeSlice().Reducer(State.Bridge, Action);
-  Next.Cortex = StoreInternal::GetCortexSlice().Reducer(State.Cortex, Action);
-  Next.Soul = StoreInternal::GetSoulSlice().Reducer(State.Soul, Action);
-  Next.Ghost = StoreInternal::GetGhostSlice().Reducer(State.Ghost, Action);
-  Next.API = StoreInternal::GetAPISlice().Reducer(State.API, Action);
+  Routed ? (ApplyMounts::apply(Next, Action, Routes, *Routed, 0), void())
+         : void();
 
   /**
    * G8: Run extra reducers (game slices) — recursive application.
@@ -186,48 +443,55 @@ inline FStoreState StoreReducer(const FStoreState &State,
   }();
 }
 
+/**
+ * Root reducer: a hydrate action replaces the state outright, every other
+ * action goes through the mounted slices.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FStoreState StoreReducer(const FStoreState &State,
+                                const rtk::AnyAction &Action) {
+  const FStoreState *Hydrated =
+      StoreActions::HydrateStoreActionCreator().match(Action)
+          ? Action.peekPayload<FStoreState>()
+          : nullptr;
+  return Hydrated ? *Hydrated : ReduceMountedSlices(State, Action);
+}
+
 /**
  * Builds middleware that clears dependent state when an NPC is removed.
+ * Filtered on the remove action, so every other dispatch skips it without
+ * reading state. The clearing dispatches run as soon as the remove has been
+ * reduced, inside the remove's own dispatch, so an effect batch around several
+ * actions (a facade flush) cannot move them past a later re-add of the NPC.
  * User Story: As NPC teardown, I need dependent slices cleaned up
  * automatically so removed NPCs do not leave stale state behind.
  */
 inline rtk::Middleware<FStoreState> createNpcRemovalListener() {
-  return [](const rtk::MiddlewareApi<FStoreState> &Api)
-             -> std::function<rtk::Dispatcher(rtk::Dispatcher)> {
-    return [Api](rtk::Dispatcher Next) -> rtk::Dispatcher {
-      return [Api, Next](const rtk::AnyAction &Action) -> rtk::AnyAction {
+  return rtk::Middleware<FStoreState>::filtered(
+      {NPCSlice::Actions::RemoveNPCActionCreator().Type},
+      [](const rtk::AnyAction &Action,
+         const rtk::MiddlewareApi<FStoreState> &Api,
+         const rtk::NextDispatch<FStoreState> &Next) -> rtk::AnyAction {
         const FString ActiveNpcIdBefore = Api.getState().NPCs.ActiveNpcId;
         const rtk::AnyAction Result = Next(Action);
 
-        NPCSlice::Actions::RemoveNPCActionCreator().match(Action)
-            ? [&]() {
-                const auto RemovedNpcId =
-                    NPCSlice::Actions::RemoveNPCActionCreator().extract(Action);
-                RemovedNpcId.hasValue
-                    ? (Api.dispatch(
-                           DirectiveSlice::Actions::ClearDirectivesForNpc(
-                               RemovedNpcId.value)),
-                       Api.dispatch(
-                           BridgeSlice::Actions::ClearBridgeValidation()),
-                       Api.dispatch(
-                           GhostSlice::Actions::ClearGhostSession()),
-                       Api.dispatch(SoulSlice::Actions::ClearSoulState()),
-                       Api.dispatch(
-                           NPCSlice::Actions::ClearBlock(RemovedNpcId.value)),
-                       RemovedNpcId.value == ActiveNpcIdBefore
-                           ? (Api.dispatch(
-                                  MemorySlice::Actions::MemoryClear()),
-                              void())
-                           : void(),
-                       void())
-                    : void();
-              }()
+        const auto RemovedNpcId =
+            NPCSlice::Actions::RemoveNPCActionCreator().extract(Action);
+        RemovedNpcId.hasValue
+            ? (Api.dispatch(DirectiveSlice::Actions::ClearDirectivesForNpc(
+                   RemovedNpcId.value)),
+               Api.dispatch(BridgeSlice::Actions::ClearBridgeValidation()),
+               Api.dispatch(GhostSlice::Actions::ClearGhostSession()),
+               Api.dispatch(SoulSlice::Actions::ClearSoulState()),
+               Api.dispatch(NPCSlice::Actions::ClearBlock(RemovedNpcId.value)),
+               RemovedNpcId.value == ActiveNpcIdBefore
+                   ? (Api.dispatch(MemorySlice::Actions::MemoryClear()), void())
+                   : void(),
+               void())
             : void();
 
         return Result;
-      };
-    };
-  };
+      });
 }
 
 /**
@@ -258,6 +522,7 @@ inline rtk::EnhancedStore<FStoreState>
 createStore(func::Maybe<FStoreState> PreloadedState =
                 func::nothing<FStoreState>(),
             std::vector<rtk::Middleware<FStoreState>> ExtraMiddlewares = {}) {
+  StoreInternal::InstallEffectRuntime();
   std::vector<rtk::Middleware<FStoreState>> Middlewares;
   Middlewares.push_back(createNpcRemovalListener());
 
@@ -60,6 +60,15 @@ public:
   UFUNCTION(BlueprintCallable, Category = "Forboc AI|NPC")
   void ProcessNPC(FString NpcId, FString Input = TEXT(""));
 
+  /**
+   * Cancels the in-flight protocol run for an NPC, stopping its HTTP turns and
+   * local generation. The run fails with an "Aborted" reason.
+   * User Story: As gameplay interaction flows, I need to drop a conversation
+   * when the player walks away so no work or tokens are spent on it.
+   */
+  UFUNCTION(BlueprintCallable, Category = "Forboc AI|NPC")
+  void CancelNPC(FString NpcId);
+
   /**
    * Exports an NPC's Soul to Arweave.
    * User Story: As Blueprint soul export flows, I need a callable export entry
@@ -117,6 +126,23 @@ public:
   UFUNCTION(BlueprintPure, Category = "Forboc AI|Soul")
   bool GetLastImportedSoul(FSoul &OutSoul) const;
 
+  /**
+   * Saves the store to a save-game slot as a binary snapshot.
+   * User Story: As Blueprint save flows, I need SDK state written to a slot so
+   * the next session can warm start instead of re-fetching.
+   */
+  UFUNCTION(BlueprintCallable, Category = "Forboc AI|Snapshot")
+  bool SaveStoreSnapshot(FString SlotName, int32 UserIndex = 0);
+
+  /**
+   * Restores the store from a save-game slot written by SaveStoreSnapshot.
+   * Returns false when the slot is missing or the snapshot is rejected.
+   * User Story: As Blueprint load flows, I need SDK state restored from a slot
+   * so NPCs resume where the last session left them.
+   */
+  UFUNCTION(BlueprintCallable, Category = "Forboc AI|Snapshot")
+  bool LoadStoreSnapshot(FString SlotName, int32 UserIndex = 0);
+
   /**
    * Delegate triggered when a new action is received from the NPC.
    * User Story: As a runtime subscriber, I need this event contract so gameplay and UI systems know when to react to SDK state changes.
@@ -166,6 +192,13 @@ private:
    */
   TSharedPtr<rtk::EnhancedStore<FStoreState>> Store;
 
+  /**
+   * Abort controllers for in-flight protocol runs, keyed by NPC id.
+   * User Story: As NPC cancellation flows, I need the live run per NPC so a
+   * new turn, removal or shutdown can abort the one before it.
+   */
+  TMap<FString, func::AbortController> ActiveRuns;
+
   /**
    * Handles store actions emitted through listener middleware.
    * User Story: As subsystem event bridging, I need action callbacks so the
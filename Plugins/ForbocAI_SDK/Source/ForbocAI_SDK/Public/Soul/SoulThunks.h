@@ -204,7 +204,8 @@ localExportSoulThunk(const FString &NpcId = TEXT("")) {
         : detail::ResolveAsync(TypeFactory::Soul(
               TargetNpcId, TEXT("1.0.0"), TEXT("NPC"), Npc.value.Persona,
               Npc.value.State,
-              MemorySlice::SelectAllMemories(GetState().Memory)));
+              detail::HydrateEmbeddings(
+                  MemorySlice::SelectAllMemories(GetState().Memory))));
   };
 }
 
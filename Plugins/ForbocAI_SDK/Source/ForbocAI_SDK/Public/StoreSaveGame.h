@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SaveGame.h"
+#include "StoreSaveGame.generated.h"
+
+/**
+ * Save-game object carrying a binary store snapshot.
+ * Games that already have their own USaveGame can store the bytes from
+ * StoreSnapshot::SaveStore in a property of their own instead.
+ * User Story: As game save flows, I need SDK state stored through the regular
+ * save-game slots so it follows the platform's save handling.
+ */
+UCLASS()
+class FORBOCAI_SDK_API UForbocAIStoreSaveGame : public USaveGame {
+  GENERATED_BODY()
+
+public:
+  /**
+   * Snapshot bytes produced by StoreSnapshot::SaveState.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
+  UPROPERTY()
+  TArray<uint8> Snapshot;
+};
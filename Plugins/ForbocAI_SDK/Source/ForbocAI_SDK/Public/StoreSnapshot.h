@@ -0,0 +1,739 @@
+#pragma once
+
+#include "Core/functional_core.hpp"
+#include "CoreMinimal.h"
+#include "Memory/MemoryView.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "RuntimeStore.h"
+#include "Serialization/ArchiveProxy.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/ObjectVersion.h"
+#include "UObject/UnrealNames.h"
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * Store Snapshots — versioned binary save and restore of the root state.
+ * A snapshot is a small header (magic, container version, engine and custom
+ * versions, compression) followed by one section per persisted slice. Each
+ * section carries its own version and length, so a reader skips sections it
+ * does not know and restores the rest. USTRUCT records are written with
+ * tagged properties and every FName goes through one shared name table.
+ * User Story: As level loads and server restarts, I need NPC, memory and
+ * directive state restored from one read so warm starts skip re-fetching.
+ */
+namespace StoreSnapshot {
+
+/**
+ * Leading bytes of every snapshot ("FBSS").
+ * User Story: As snapshot restore, I need a magic number so arbitrary files
+ * are rejected before any payload is parsed.
+ */
+inline constexpr uint32 SnapshotMagic = 0x53534246u;
+
+/**
+ * Container layout version. Section contents are versioned separately.
+ * User Story: As snapshot restore, I need the container version so a build
+ * refuses layouts written by a newer SDK instead of misreading them.
+ */
+inline constexpr uint32 SnapshotFormatVersion = 1;
+
+/**
+ * Payload compression codec.
+ * User Story: As snapshot writers, I need the codec recorded per snapshot so
+ * readers decompress with the format that was actually used.
+ */
+enum class ECompression : uint8 { None = 0, Zlib = 1, Oodle = 2 };
+
+/**
+ * Options for writing a snapshot.
+ * User Story: As snapshot writers, I need the codec selectable so shipping
+ * builds can trade CPU for size.
+ */
+struct FSaveOptions {
+  ECompression Compression;
+
+  FSaveOptions() : Compression(ECompression::Zlib) {}
+};
+
+/**
+ * What a restore read and which sections it applied.
+ * User Story: As restore diagnostics, I need skipped sections reported so
+ * partial restores after a schema change are visible in logs and tests.
+ */
+struct FRestoreReport {
+  uint32 FormatVersion;
+  ECompression Compression;
+  int32 PayloadBytes;
+  TArray<FString> RestoredSections;
+  TArray<FString> SkippedSections;
+
+  FRestoreReport()
+      : FormatVersion(0), Compression(ECompression::None), PayloadBytes(0) {}
+};
+
+/**
+ * Restored root state together with its report.
+ * User Story: As snapshot restore, I need state and report returned together
+ * so callers can hydrate and log from one result.
+ */
+struct FRestoredState {
+  FStoreState State;
+  FRestoreReport Report;
+};
+
+/**
+ * One persisted part of the root state.
+ * Load receives the version the section was saved with, never newer than
+ * Version, and must leave State untouched when the archive reports an error.
+ * User Story: As game modules with their own slices, I need to register
+ * sections so game state rides along in the same snapshot.
+ */
+struct FSnapshotSection {
+  FString Name;
+  uint32 Version;
+  std::function<void(FArchive &, const FStoreState &)> Save;
+  std::function<void(FArchive &, FStoreState &, uint32)> Load;
+};
+
+namespace detail {
+
+/**
+ * Maps a codec to the engine compression format name.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FName CompressionFormat(ECompression Compression) {
+  return Compression == ECompression::Oodle ? NAME_Oodle : NAME_Zlib;
+}
+
+/**
+ * Writes each FName as an index into a table shared by the whole snapshot.
+ * User Story: As snapshot writers, I need property and type names stored once
+ * so tagged records stay compact.
+ */
+class FNameTableWriter : public FArchiveProxy {
+public:
+  FNameTableWriter(FArchive &Inner, TArray<FString> &InNames,
+                   TMap<FName, int32> &InIndices)
+      : FArchiveProxy(Inner), Names(InNames), Indices(InIndices) {}
+
+  virtual FArchive &operator<<(FName &Value) override {
+    const int32 *Found = Indices.Find(Value);
+    int32 Index = Found ? *Found
+                        : (Indices.Add(Value, Names.Num()),
+                           Names.Add(Value.ToString()));
+    InnerArchive << Index;
+    return *this;
+  }
+
+  virtual FString GetArchiveName() const override {
+    return TEXT("StoreSnapshot.NameTableWriter");
+  }
+
+private:
+  TArray<FString> &Names;
+  TMap<FName, int32> &Indices;
+};
+
+/**
+ * Resolves FName indices against the snapshot name table.
+ * Errors from the wrapped reader are mirrored onto the proxy so section
+ * loaders only have to check the archive they were given.
+ * User Story: As snapshot restore, I need out-of-range name indices and
+ * truncated bytes surfaced as archive errors instead of crashes.
+ */
+class FNameTableReader : public FArchiveProxy {
+public:
+  FNameTableReader(FArchive &Inner, const TArray<FName> &InNames)
+      : FArchiveProxy(Inner), Names(InNames) {}
+
+  virtual FArchive &operator<<(FName &Value) override {
+    int32 Index = INDEX_NONE;
+    InnerArchive << Index;
+    const bool bValid = !InnerArchive.IsError() && Names.IsValidIndex(Index);
+    Value = bValid ? Names[Index] : FName(NAME_None);
+    bValid ? void() : SetError();
+    return *this;
+  }
+
+  virtual void Serialize(void *Data, int64 Length) override {
+    InnerArchive.Serialize(Data, Length);
+    InnerArchive.IsError() ? SetError() : void();
+  }
+
+  virtual FString GetArchiveName() const override {
+    return TEXT("StoreSnapshot.NameTableReader");
+  }
+
+private:
+  const TArray<FName> &Names;
+};
+
+/**
+ * Bytes left to read, used to reject counts a valid snapshot cannot hold.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline int64 Remaining(FArchive &Ar) { return Ar.TotalSize() - Ar.Tell(); }
+
+/**
+ * Serializes records in place, in order; saving and loading share it.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+template <typename T>
+void SerializeRecordsRecursive(FArchive &Ar, T *Records, int32 Count,
+                               int32 Index) {
+  Index < Count
+      ? (T::StaticStruct()->SerializeItem(Ar, &Records[Index], nullptr),
+         SerializeRecordsRecursive(Ar, Records, Count, Index + 1))
+      : void();
+}
+
+/**
+ * Writes a record array with tagged property serialization.
+ * User Story: As snapshot sections, I need records written by property name so
+ * fields added or removed later still load.
+ */
+template <typename T>
+void SaveRecords(FArchive &Ar, const TArray<T> &Records) {
+  int32 Count = Records.Num();
+  Ar << Count;
+  SerializeRecordsRecursive(Ar, const_cast<T *>(Records.GetData()), Count, 0);
+}
+
+/**
+ * Reads a record array written by SaveRecords.
+ * User Story: As snapshot restore, I need corrupt counts rejected before
+ * allocation so a damaged file cannot exhaust memory.
+ */
+template <typename T> TArray<T> LoadRecords(FArchive &Ar) {
+  int32 Count = 0;
+  Ar << Count;
+  TArray<T> Records;
+  !Ar.IsError() && Count >= 0 && Count <= Remaining(Ar)
+      ? (Records.SetNum(Count),
+         SerializeRecordsRecursive(Ar, Records.GetData(), Count, 0))
+      : Ar.SetError();
+  return Records;
+}
+
+/**
+ * Snapshot section for NPC records and the active NPC.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FSnapshotSection NpcSection() {
+  return FSnapshotSection{
+      TEXT("npc"), 1,
+      [](FArchive &Ar, const FStoreState &State) {
+        SaveRecords(Ar, NPCSlice::SelectAllNPCs(State.NPCs));
+        FString Active = State.NPCs.ActiveNpcId;
+        Ar << Active;
+      },
+      [](FArchive &Ar, FStoreState &State, uint32) {
+        const TArray<FNPCInternalState> Npcs =
+            LoadRecords<FNPCInternalState>(Ar);
+        FString Active;
+        Ar << Active;
+        !Ar.IsError()
+            ? (State.NPCs.Entities = NPCSlice::GetNPCAdapter().setAll(
+                   NPCSlice::GetNPCAdapter().getInitialState(), Npcs),
+               State.NPCs.ActiveNpcId = Active, void())
+            : void();
+      }};
+}
+
+/**
+ * Snapshot section for stored memories.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FSnapshotSection MemorySection() {
+  return FSnapshotSection{
+      TEXT("memory"), 1,
+      [](FArchive &Ar, const FStoreState &State) {
+        SaveRecords(Ar, MemorySlice::SelectAllMemories(State.Memory));
+      },
+      [](FArchive &Ar, FStoreState &State, uint32) {
+        const TArray<FMemoryItem> Items = LoadRecords<FMemoryItem>(Ar);
+        !Ar.IsError()
+            ? (State.Memory.Entities = MemorySlice::GetMemoryAdapter().setAll(
+                   MemorySlice::GetMemoryAdapter().getInitialState(), Items),
+               void())
+            : void();
+      }};
+}
+
+/**
+ * Snapshot section for directive runs and the active run.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FSnapshotSection DirectiveSection() {
+  return FSnapshotSection{
+      TEXT("directives"), 1,
+      [](FArchive &Ar, const FStoreState &State) {
+        SaveRecords(Ar, DirectiveSlice::GetDirectiveAdapter()
+                            .getSelectors()
+                            .selectAll(State.Directives.Entities));
+        FString Active = State.Directives.ActiveDirectiveId;
+        Ar << Active;
+      },
+      [](FArchive &Ar, FStoreState &State, uint32) {
+        const TArray<FDirectiveRun> Runs = LoadRecords<FDirectiveRun>(Ar);
+        FString Active;
+        Ar << Active;
+        !Ar.IsError()
+            ? (State.Directives.Entities =
+                   DirectiveSlice::GetDirectiveAdapter().setAll(
+                       DirectiveSlice::GetDirectiveAdapter().getInitialState(),
+                       Runs),
+               State.Directives.ActiveDirectiveId = Active, void())
+            : void();
+      }};
+}
+
+/**
+ * Snapshot section for loaded rulesets and preset ids.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FSnapshotSection BridgeSection() {
+  return FSnapshotSection{
+      TEXT("bridge"), 1,
+      [](FArchive &Ar, const FStoreState &State) {
+        SaveRecords(Ar, State.Bridge.ActivePresets);
+        SaveRecords(Ar, State.Bridge.AvailableRulesets);
+        TArray<FString> PresetIds = State.Bridge.AvailablePresetIds;
+        Ar << PresetIds;
+      },
+      [](FArchive &Ar, FStoreState &State, uint32) {
+        const TArray<FDirectiveRuleSet> Active =
+            LoadRecords<FDirectiveRuleSet>(Ar);
+        const TArray<FDirectiveRuleSet> Available =
+            LoadRecords<FDirectiveRuleSet>(Ar);
+        TArray<FString> PresetIds;
+        Ar << PresetIds;
+        !Ar.IsError() ? (State.Bridge.ActivePresets = Active,
+                         State.Bridge.AvailableRulesets = Available,
+                         State.Bridge.AvailablePresetIds = PresetIds, void())
+                      : void();
+      }};
+}
+
+/**
+ * Snapshot section for the string extension map.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline FSnapshotSection ExtraSection() {
+  return FSnapshotSection{
+      TEXT("extra"), 1,
+      [](FArchive &Ar, const FStoreState &State) {
+        TMap<FString, FString> Extra = State.Extra;
+        Ar << Extra;
+      },
+      [](FArchive &Ar, FStoreState &State, uint32) {
+        TMap<FString, FString> Extra;
+        Ar << Extra;
+        !Ar.IsError() ? (State.Extra = MoveTemp(Extra), void()) : void();
+      }};
+}
+
+/**
+ * Registered sections, SDK sections first.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline std::vector<FSnapshotSection> &Sections() {
+  static std::vector<FSnapshotSection> Registered = {
+      NpcSection(), MemorySection(), DirectiveSection(), BridgeSection(),
+      ExtraSection()};
+  return Registered;
+}
+
+/**
+ * Guards section registration against concurrent saves and restores.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline std::mutex &SectionsMutex() {
+  static std::mutex Mutex;
+  return Mutex;
+}
+
+/**
+ * Copies the registry so save and restore run without holding the lock.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline std::vector<FSnapshotSection> RegisteredSections() {
+  std::lock_guard<std::mutex> Lock(SectionsMutex());
+  return Sections();
+}
+
+/**
+ * Fixed-layout fields that precede the payload.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+struct FSnapshotHeader {
+  uint32 Magic = 0;
+  uint32 FormatVersion = 0;
+  int32 FileVersionUE4 = 0;
+  int32 FileVersionUE5 = 0;
+  int32 LicenseeVersion = 0;
+  FCustomVersionContainer CustomVersions;
+  uint8 Compression = 0;
+  int32 PayloadBytes = 0;
+  int32 StoredBytes = 0;
+};
+
+/**
+ * Stamps the versions a snapshot was written with onto a reading archive.
+ * User Story: As snapshot restore, I need engine and custom versions applied
+ * so tagged structs run their upgrade paths for older data.
+ */
+inline void ApplyVersions(FArchive &Ar, const FSnapshotHeader &Header) {
+  Ar.SetUEVer(FPackageFileVersion(
+      Header.FileVersionUE4,
+      static_cast<EUnrealEngineObjectUE5Version>(Header.FileVersionUE5)));
+  Ar.SetLicenseeUEVer(Header.LicenseeVersion);
+  Ar.SetCustomVersions(Header.CustomVersions);
+}
+
+/**
+ * Serializes the header. Reading stops after the magic and format version
+ * when they do not match, so foreign files are not parsed further.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline void SerializeHeader(FArchive &Ar, FSnapshotHeader &Header) {
+  Ar << Header.Magic << Header.FormatVersion;
+  Header.Magic == SnapshotMagic && Header.FormatVersion <= SnapshotFormatVersion
+      ? (Ar << Header.FileVersionUE4 << Header.FileVersionUE5
+            << Header.LicenseeVersion,
+         Header.CustomVersions.Serialize(Ar),
+         Ar << Header.Compression << Header.PayloadBytes
+            << Header.StoredBytes,
+         void())
+      : void();
+}
+
+/**
+ * Describes why a header cannot be restored, or returns an empty string.
+ * User Story: As snapshot restore, I need a precise rejection reason so save
+ * corruption and version skew are distinguishable in logs.
+ */
+inline FString ValidateHeader(FArchive &Ar, const FSnapshotHeader &Header) {
+  return Header.Magic != SnapshotMagic
+             ? FString(TEXT("Not a store snapshot"))
+         : Header.FormatVersion > SnapshotFormatVersion
+             ? FString::Printf(
+                   TEXT("Snapshot format v%u is newer than supported v%u"),
+                   Header.FormatVersion, SnapshotFormatVersion)
+         : Ar.IsError() ? FString(TEXT("Snapshot header is truncated"))
+         : Header.FileVersionUE5 > GPackageFileUEVersion.FileVersionUE5 ||
+                 Header.FileVersionUE4 > GPackageFileUEVersion.FileVersionUE4
+             ? FString(TEXT("Snapshot was written by a newer engine"))
+         : Header.Compression > static_cast<uint8>(ECompression::Oodle)
+             ? FString::Printf(TEXT("Unknown snapshot compression %u"),
+                               Header.Compression)
+         : Header.PayloadBytes < 0 || Header.StoredBytes < 0 ||
+                 Header.StoredBytes > Remaining(Ar)
+             ? FString(TEXT("Snapshot payload is truncated"))
+             : FString();
+}
+
+/**
+ * Compresses Payload, returning false when the codec is unavailable.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline bool CompressPayload(ECompression Compression,
+                            const TArray<uint8> &Payload,
+                            TArray<uint8> &OutStored) {
+  const FName Format = CompressionFormat(Compression);
+  int32 Size = FCompression::CompressMemoryBound(Format, Payload.Num());
+  OutStored.SetNumUninitialized(Size);
+  const bool bCompressed = FCompression::CompressMemory(
+      Format, OutStored.GetData(), Size, Payload.GetData(), Payload.Num());
+  OutStored.SetNum(bCompressed ? Size : 0);
+  return bCompressed;
+}
+
+/**
+ * Writes every registered section and the name table they referenced.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline TArray<uint8> WritePayload(const FStoreState &State) {
+  const std::vector<FSnapshotSection> Registered = RegisteredSections();
+  TArray<FString> Names;
+  TMap<FName, int32> Indices;
+  TArray<uint8> SectionBytes;
+  FMemoryWriter SectionWriter(SectionBytes, true);
+  int32 SectionCount = static_cast<int32>(Registered.size());
+  SectionWriter << SectionCount;
+  struct WriteSections {
+    static void apply(FArchive &Out, const FStoreState &S,
+                      const std::vector<FSnapshotSection> &Sections,
+                      TArray<FString> &Names, TMap<FName, int32> &Indices,
+                      size_t Index) {
+      Index < Sections.size()
+          ? [&]() {
+              TArray<uint8> Body;
+              FMemoryWriter BodyWriter(Body, true);
+              FNameTableWriter Named(BodyWriter, Names, Indices);
+              Sections[Index].Save(Named, S);
+              FString Name = Sections[Index].Name;
+              uint32 Version = Sections[Index].Version;
+              int32 Bytes = Body.Num();
+              Out << Name << Version << Bytes;
+              Out.Serialize(Body.GetData(), Bytes);
+              apply(Out, S, Sections, Names, Indices, Index + 1);
+            }()
+          : void();
+    }
+  };
+  WriteSections::apply(SectionWriter, State, Registered, Names, Indices, 0);
+
+  TArray<uint8> Payload;
+  FMemoryWriter PayloadWriter(Payload, true);
+  PayloadWriter << Names;
+  PayloadWriter.Serialize(SectionBytes.GetData(), SectionBytes.Num());
+  return Payload;
+}
+
+/**
+ * Reads the sections of a decompressed payload over Base.
+ * Unknown sections, sections newer than the registered reader, and sections
+ * that fail to parse are skipped and reported; the rest are applied.
+ * User Story: As snapshot restore, I need partial restores after schema
+ * changes so one stale slice does not discard the whole save.
+ */
+inline func::Either<FString, FRestoredState>
+ReadPayload(const TArray<uint8> &Payload, const FSnapshotHeader &Header,
+            const FStoreState &Base) {
+  FMemoryReader Ar(Payload, true);
+  ApplyVersions(Ar, Header);
+  TArray<FString> NameStrings;
+  Ar << NameStrings;
+  TArray<FName> Names;
+  Names.Reserve(NameStrings.Num());
+  struct ToNames {
+    static void apply(const TArray<FString> &From, TArray<FName> &Out,
+                      int32 Index) {
+      Index < From.Num()
+          ? (Out.Add(FName(*From[Index])), apply(From, Out, Index + 1))
+          : void();
+    }
+  };
+  ToNames::apply(NameStrings, Names, 0);
+  int32 SectionCount = 0;
+  Ar << SectionCount;
+
+  const std::vector<FSnapshotSection> Registered = RegisteredSections();
+  FRestoredState Result{Base, FRestoreReport()};
+
+  struct ReadSections {
+    static void apply(FMemoryReader &Ar, const TArray<uint8> &Payload,
+                      const FSnapshotHeader &H, const TArray<FName> &Names,
+                      const std::vector<FSnapshotSection> &Registered,
+                      FRestoredState &Out, int32 Left) {
+      FString Name;
+      uint32 Version = 0;
+      int32 Bytes = 0;
+      Left > 0 ? (Ar << Name << Version << Bytes, void()) : void();
+      const bool bFramed = Left > 0 && !Ar.IsError() && Bytes >= 0 &&
+                           Bytes <= Remaining(Ar);
+      const auto Found = std::find_if(
+          Registered.begin(), Registered.end(),
+          [&Name](const FSnapshotSection &S) { return S.Name == Name; });
+      const bool bReadable = bFramed && Found != Registered.end() &&
+                             Version <= Found->Version;
+      bReadable ? [&]() {
+        const int64 Start = Ar.Tell();
+        FMemoryReaderView BodyReader(
+            FMemoryView(Payload.GetData() + Start, Bytes), true);
+        ApplyVersions(BodyReader, H);
+        FNameTableReader Named(BodyReader, Names);
+        ApplyVersions(Named, H);
+        Found->Load(Named, Out.State, Version);
+        Named.IsError() ? (Out.Report.SkippedSections.Add(Name), void())
+                        : (Out.Report.RestoredSections.Add(Name), void());
+      }()
+                : bFramed ? (Out.Report.SkippedSections.Add(Name), void())
+                          : void();
+      bFramed ? (Ar.Seek(Ar.Tell() + Bytes),
+                 apply(Ar, Payload, H, Names, Registered, Out, Left - 1),
+                 void())
+      : Left > 0 ? Ar.SetError()
+                 : void();
+    }
+  };
+  ReadSections::apply(Ar, Payload, Header, Names, Registered, Result,
+                      SectionCount);
+
+  return Ar.IsError()
+             ? func::make_left<FString, FRestoredState>(
+                   TEXT("Snapshot sections are corrupt"))
+             : func::make_right<FString, FRestoredState>(Result);
+}
+
+} // namespace detail
+
+/**
+ * Registers or replaces a snapshot section by name.
+ * User Story: As game modules with mounted slices, I need their state saved
+ * next to the SDK slices so one snapshot restores the whole runtime.
+ */
+inline void registerSnapshotSection(const FSnapshotSection &Section) {
+  std::lock_guard<std::mutex> Lock(detail::SectionsMutex());
+  std::vector<FSnapshotSection> &Registered = detail::Sections();
+  const auto Existing = std::find_if(
+      Registered.begin(), Registered.end(),
+      [&Section](const FSnapshotSection &S) { return S.Name == Section.Name; });
+  Existing != Registered.end() ? (*Existing = Section, void())
+                               : Registered.push_back(Section);
+}
+
+/**
+ * Removes a registered section; snapshots that contain it skip it on load.
+ * User Story: As game modules that unmount slices, I need their section
+ * dropped so later snapshots stop carrying it.
+ */
+inline void unregisterSnapshotSection(const FString &Name) {
+  std::lock_guard<std::mutex> Lock(detail::SectionsMutex());
+  std::vector<FSnapshotSection> &Registered = detail::Sections();
+  Registered.erase(
+      std::remove_if(Registered.begin(), Registered.end(),
+                     [&Name](const FSnapshotSection &S) { return S.Name == Name; }),
+      Registered.end());
+}
+
+/**
+ * Serializes State into a snapshot.
+ * Falls back to an uncompressed payload when the codec is unavailable.
+ * User Story: As save flows, I need the root state as bytes so they can be
+ * stored in a file, a save-game slot, or sent to a server.
+ */
+inline TArray<uint8> SaveState(const FStoreState &State,
+                               const FSaveOptions &Options = FSaveOptions()) {
+  const TArray<uint8> Payload = detail::WritePayload(State);
+  TArray<uint8> Compressed;
+  const bool bCompressed =
+      Options.Compression != ECompression::None &&
+      detail::CompressPayload(Options.Compression, Payload, Compressed);
+
+  detail::FSnapshotHeader Header;
+  Header.Magic = SnapshotMagic;
+  Header.FormatVersion = SnapshotFormatVersion;
+  Header.FileVersionUE4 = GPackageFileUEVersion.FileVersionUE4;
+  Header.FileVersionUE5 = GPackageFileUEVersion.FileVersionUE5;
+  Header.LicenseeVersion = GPackageFileLicenseeUEVersion;
+  Header.CustomVersions = FCurrentCustomVersions::GetAll();
+  Header.Compression = static_cast<uint8>(
+      bCompressed ? Options.Compression : ECompression::None);
+  Header.PayloadBytes = Payload.Num();
+  const TArray<uint8> &Stored = bCompressed ? Compressed : Payload;
+  Header.StoredBytes = Stored.Num();
+
+  TArray<uint8> Snapshot;
+  FMemoryWriter Ar(Snapshot, true);
+  detail::SerializeHeader(Ar, Header);
+  Ar.Serialize(const_cast<uint8 *>(Stored.GetData()), Stored.Num());
+  return Snapshot;
+}
+
+/**
+ * Restores a snapshot over Base. Sections missing from the snapshot keep
+ * Base's values.
+ * User Story: As load flows, I need a rejected snapshot reported as an error
+ * rather than half-applied so callers can fall back to a cold start.
+ */
+inline func::Either<FString, FRestoredState>
+LoadState(const TArray<uint8> &Snapshot, const FStoreState &Base) {
+  FMemoryReader Ar(Snapshot, true);
+  detail::FSnapshotHeader Header;
+  detail::SerializeHeader(Ar, Header);
+  const FString HeaderError = detail::ValidateHeader(Ar, Header);
+
+  return !HeaderError.IsEmpty()
+             ? func::make_left<FString, FRestoredState>(HeaderError)
+             : [&]() -> func::Either<FString, FRestoredState> {
+    const ECompression Compression =
+        static_cast<ECompression>(Header.Compression);
+    const uint8 *Stored = Snapshot.GetData() + Ar.Tell();
+    TArray<uint8> Payload;
+    const bool bDecoded =
+        Compression == ECompression::None
+            ? (Payload.Append(Stored, Header.StoredBytes),
+               Header.StoredBytes == Header.PayloadBytes)
+            : (Payload.SetNumUninitialized(Header.PayloadBytes),
+               FCompression::UncompressMemory(
+                   detail::CompressionFormat(Compression), Payload.GetData(),
+                   Header.PayloadBytes, Stored, Header.StoredBytes));
+    return !bDecoded
+               ? func::make_left<FString, FRestoredState>(
+                     TEXT("Snapshot payload failed to decompress"))
+               : func::fmap(detail::ReadPayload(Payload, Header, Base),
+                            [&Header](FRestoredState Restored) {
+                              Restored.Report.FormatVersion =
+                                  Header.FormatVersion;
+                              Restored.Report.Compression =
+                                  static_cast<ECompression>(
+                                      Header.Compression);
+                              Restored.Report.PayloadBytes =
+                                  Header.PayloadBytes;
+                              return Restored;
+                            });
+  }();
+}
+
+/**
+ * Snapshots the current state of a running store.
+ * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+ */
+inline TArray<uint8>
+SaveStore(const rtk::EnhancedStore<FStoreState> &Store,
+          const FSaveOptions &Options = FSaveOptions()) {
+  return SaveState(Store.getState(), Options);
+}
+
+/**
+ * Restores a snapshot into a running store through one hydrate dispatch.
+ * User Story: As warm-start flows, I need restored state to reach listeners
+ * and middleware like any other update, in a single notification.
+ */
+inline func::Either<FString, FRestoreReport>
+RestoreStore(rtk::EnhancedStore<FStoreState> &Store,
+             const TArray<uint8> &Snapshot) {
+  const func::Either<FString, FRestoredState> Loaded =
+      LoadState(Snapshot, Store.getState());
+  return Loaded.isLeft
+             ? func::make_left<FString, FRestoreReport>(Loaded.left)
+             : (Store.dispatch(StoreActions::HydrateStore(Loaded.right.State)),
+                func::make_right<FString, FRestoreReport>(
+                    Loaded.right.Report));
+}
+
+/**
+ * Writes a store snapshot to disk.
+ * User Story: As dedicated server restarts, I need the snapshot on disk so the
+ * next process can warm start from it.
+ */
+inline bool SaveStoreToFile(const rtk::EnhancedStore<FStoreState> &Store,
+                            const FString &Path,
+                            const FSaveOptions &Options = FSaveOptions()) {
+  return FFileHelper::SaveArrayToFile(SaveStore(Store, Options), *Path);
+}
+
+/**
+ * Restores a store from a snapshot file written by SaveStoreToFile.
+ * User Story: As dedicated server restarts, I need one call that reads and
+ * hydrates so startup code stays small.
+ */
+inline func::Either<FString, FRestoreReport>
+RestoreStoreFromFile(rtk::EnhancedStore<FStoreState> &Store,
+                     const FString &Path) {
+  TArray<uint8> Snapshot;
+  return FFileHelper::LoadFileToArray(Snapshot, *Path)
+             ? RestoreStore(Store, Snapshot)
+             : func::make_left<FString, FRestoreReport>(
+                   FString::Printf(TEXT("Could not read snapshot %s"), *Path));
+}
+
+} // namespace StoreSnapshot
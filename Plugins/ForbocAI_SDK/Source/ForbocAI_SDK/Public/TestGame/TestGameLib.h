@@ -7,6 +7,7 @@
 
 #include "CLI/CliOperations.h"
 #include "Core/AsyncHttp.h"
+#include "Core/TimerWheel.h"
 #include "CoreMinimal.h"
 #include "RuntimeStore.h"
 #include "Serialization/JsonReader.h"
@@ -195,23 +196,24 @@ inline FCommandResult RunExternalCommand(const FString &CommandLine) {
       *Executable, *Args, false, true, true, nullptr, 0, nullptr, WritePipe,
       ReadPipe);
 
-  struct ProcPoller {
-    static void Poll(FProcHandle &Proc, void *ReadPipe, FString &StdOut,
-                     double StartTime) {
-      return !FPlatformProcess::IsProcRunning(Proc)
-                 ? (void)0
-                 : (FPlatformTime::Seconds() - StartTime > 10.0)
-                       ? (FPlatformProcess::TerminateProc(Proc, true), void())
-                       : (StdOut += FPlatformProcess::ReadPipe(ReadPipe),
-                          FPlatformProcess::Sleep(0.01f),
-                          Poll(Proc, ReadPipe, StdOut, StartTime));
-    }
-  };
-
+  /**
+   * Drains the pipe every 10 ms on the timer wheel until the process exits,
+   * terminating it after 10 s; this thread waits without sleep-polling.
+   * User Story: As a maintainer, I need this note so the surrounding code intent stays clear during maintenance and debugging.
+   */
   Proc.IsValid()
       ? [&]() {
           const double StartTime = FPlatformTime::Seconds();
-          ProcPoller::Poll(Proc, ReadPipe, StdOut, StartTime);
+          Timers::awaitResult(Timers::interval(
+              10, [&Proc, ReadPipe, &StdOut, StartTime](int64) {
+                return !FPlatformProcess::IsProcRunning(Proc)
+                           ? false
+                       : (FPlatformTime::Seconds() - StartTime > 10.0)
+                           ? (FPlatformProcess::TerminateProc(Proc, true),
+                              false)
+                           : (StdOut += FPlatformProcess::ReadPipe(ReadPipe),
+                              true);
+              }));
           StdOut += FPlatformProcess::ReadPipe(ReadPipe);
           FPlatformProcess::GetProcReturnCode(Proc, &ReturnCode);
           FPlatformProcess::CloseProc(Proc);
@@ -15,12 +15,14 @@ namespace TestGame {
 /**
  * Creates listener middleware that logs NPC movement to the UI message box.
  * Mirrors TS: npcsActions.moveNPC → uiActions.addMessage
+ * Only MoveNPC and ApplyNpcVerdict reach it; other actions skip the stage.
  * User Story: As test-game reactive UI, I need listener middleware so NPC
  * movement and verdict application emit readable terminal messages.
  */
 inline rtk::Middleware<FTestGameState> createGameListenerMiddleware() {
-  return [](const rtk::MiddlewareApi<FTestGameState> &Api)
-             -> std::function<rtk::Dispatcher(rtk::Dispatcher)> {
+  const rtk::Middleware<FTestGameState> Listener =
+      [](const rtk::MiddlewareApi<FTestGameState> &Api)
+      -> std::function<rtk::Dispatcher(rtk::Dispatcher)> {
     return [Api](rtk::Dispatcher Next) -> rtk::Dispatcher {
       return [Api, Next](const rtk::AnyAction &Action) -> rtk::AnyAction {
         /**
@@ -90,6 +92,8 @@ inline rtk::Middleware<FTestGameState> createGameListenerMiddleware() {
       };
     };
   };
+  return Listener.onlyFor({NPCsActions::MoveNPCActionCreator().Type,
+                           NPCsActions::ApplyNpcVerdictActionCreator().Type});
 }
 
 /**
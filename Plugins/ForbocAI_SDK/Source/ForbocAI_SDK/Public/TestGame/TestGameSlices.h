@@ -605,9 +605,10 @@ inline rtk::Slice<FBridgeRulesState> CreateGameBridgeSlice() {
  * memory records use a consistent normalized state structure.
  */
 inline rtk::EntityAdapterOps<FMemoryRecord> &GetGameMemoryAdapter() {
-  static rtk::EntityAdapterOps<FMemoryRecord> Adapter =
+  static rtk::EntityAdapterOps<FMemoryRecord> Adapter = rtk::withIndex(
       rtk::createEntityAdapter<FMemoryRecord>(
-          [](const FMemoryRecord &R) { return R.Id; });
+          [](const FMemoryRecord &R) { return R.Id; }),
+      TEXT("npcId"), [](const FMemoryRecord &R) { return R.NpcId; });
   return Adapter;
 }
 
@@ -686,23 +687,9 @@ inline rtk::Slice<FGameMemorySliceState> CreateGameMemorySlice() {
           [](const FGameMemorySliceState &S,
              const rtk::Action<FString> &A) -> FGameMemorySliceState {
             FGameMemorySliceState Next = S;
-            struct CollectIds {
-              static void apply(
-                  const rtk::EntityState<FMemoryRecord> &E,
-                  const FString &NpcId,
-                  TArray<FString> &Out,
-                  int32 Idx) {
-                Idx >= E.ids.Num()
-                    ? void()
-                    : ((E.entities.Find(E.ids[Idx]) != nullptr &&
-                        E.entities.Find(E.ids[Idx])->NpcId == NpcId)
-                           ? (Out.Add(E.ids[Idx]), void())
-                           : void(),
-                       apply(E, NpcId, Out, Idx + 1), void());
-              }
-            };
-            TArray<FString> ToRemove;
-            CollectIds::apply(Next.Entities, A.PayloadValue, ToRemove, 0);
+            const TArray<FString> ToRemove =
+                GetGameMemoryAdapter().getSelectors().selectIdsByIndex(
+                    Next.Entities, TEXT("npcId"), A.PayloadValue);
             Next.Entities =
                 GetGameMemoryAdapter().removeMany(Next.Entities, ToRemove);
             return Next;